@@ -0,0 +1,364 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ateccbench.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atca_grisp.h>
+
+#include "bench.h"
+
+#define ATECCBENCH_DEFAULT_MIN_MS 2000
+
+/* The mflops column shows operations per second */
+#define ATECCBENCH_OPS_PER_CALL 1e6
+
+struct ateccbench_state {
+	uint16_t key_id;
+	uint8_t message[32];
+	uint8_t public_key[64];
+	uint8_t signature[64];
+	/* Input of the SHA-256 */
+	uint8_t *data;
+	uint32_t size;
+	/* Result of the last call and of the first variant */
+	uint8_t output[64];
+	uint8_t reference[64];
+	bool has_reference;
+	bool verified;
+};
+
+struct ateccbench_variant {
+	const char *name;
+	bool polling;
+	bool burst;
+	/* Through the atcab_*() functions of cryptoauthlib */
+	bool atcab;
+};
+
+/*
+ * maxdelay waits the maximum execution times like the stock HAL. All but the
+ * bursts wake the device and send it to idle for every operation.
+ */
+static const struct ateccbench_variant ateccbench_variants[] = {
+	{ "maxdelay", false, false, false },
+	{ "poll", true, false, false },
+	{ "burst", true, true, false },
+	{ "atcab", true, true, true },
+};
+
+struct ateccbench_op {
+	const char *name;
+	bool sized;
+	ATCA_STATUS (*run)(struct ateccbench_state *s, bool atcab);
+	bool (*check)(struct ateccbench_state *s);
+};
+
+static ATCA_STATUS
+ateccbench_run_sign(struct ateccbench_state *s, bool atcab)
+{
+	if (atcab) {
+		return atcab_sign(s->key_id, s->message, s->output);
+	}
+
+	return atca_grisp_sign(s->key_id, s->message, s->output);
+}
+
+static ATCA_STATUS
+ateccbench_run_verify(struct ateccbench_state *s, bool atcab)
+{
+	if (atcab) {
+		return atcab_verify_extern(s->message, s->signature,
+		    s->public_key, &s->verified);
+	}
+
+	return atca_grisp_verify_extern(s->message, s->signature,
+	    s->public_key, &s->verified);
+}
+
+static ATCA_STATUS
+ateccbench_run_ecdh(struct ateccbench_state *s, bool atcab)
+{
+	if (atcab) {
+		return atcab_ecdh(s->key_id, s->public_key, s->output);
+	}
+
+	return atca_grisp_ecdh(s->key_id, s->public_key, s->output);
+}
+
+static ATCA_STATUS
+ateccbench_run_sha(struct ateccbench_state *s, bool atcab)
+{
+	if (atcab) {
+		return atcab_sha((uint16_t)s->size, s->data, s->output);
+	}
+
+	return atca_grisp_sha256(s->data, s->size, s->output);
+}
+
+/* The signatures differ every time, so let the device check them */
+static bool
+ateccbench_check_sign(struct ateccbench_state *s)
+{
+	bool verified;
+
+	return atca_grisp_verify_extern(s->message, s->output, s->public_key,
+	    &verified) == ATCA_SUCCESS && verified;
+}
+
+static bool
+ateccbench_check_verify(struct ateccbench_state *s)
+{
+	return s->verified;
+}
+
+/* The first variant gives the reference for the others */
+static bool
+ateccbench_check_same(struct ateccbench_state *s)
+{
+	if (!s->has_reference) {
+		memcpy(s->reference, s->output, 32);
+		s->has_reference = true;
+	}
+
+	return memcmp(s->reference, s->output, 32) == 0;
+}
+
+static const struct ateccbench_op ateccbench_ops[] = {
+	{ "sign", false, ateccbench_run_sign, ateccbench_check_sign },
+	{ "verify", false, ateccbench_run_verify, ateccbench_check_verify },
+	{ "ecdh", false, ateccbench_run_ecdh, ateccbench_check_same },
+	{ "sha", true, ateccbench_run_sha, ateccbench_check_same },
+};
+
+static const uint32_t ateccbench_sha_sizes[] = { 64, 1024 };
+
+static void
+ateccbench_measure(const struct ateccbench_op *op,
+    const struct ateccbench_variant *variant, struct ateccbench_state *s,
+    uint32_t min_ms)
+{
+	struct bench_timer timer = { 0 };
+	uint32_t size = op->sized ? s->size : 1;
+	ATCA_STATUS status;
+
+	atca_grisp_set_polling(variant->polling);
+	if (variant->burst) {
+		atca_grisp_burst_begin();
+	}
+
+	/* The first call measures the execution times for the polling */
+	status = (*op->run)(s, variant->atcab);
+	while (status == ATCA_SUCCESS && bench_timer_more(&timer, min_ms)) {
+		bench_timer_start(&timer);
+		status = (*op->run)(s, variant->atcab);
+		bench_timer_stop(&timer);
+	}
+
+	if (variant->burst) {
+		(void)atca_grisp_burst_end();
+	}
+	atca_grisp_set_polling(true);
+
+	if (status != ATCA_SUCCESS) {
+		printf("# %s %s %" PRIu32 ": failed with 0x%02x\n", op->name,
+		    variant->name, size, status);
+		return;
+	}
+
+	bench_result_print(bench_result_add(op->name, variant->name, size,
+	    ATECCBENCH_OPS_PER_CALL, 0, &timer));
+	printf("# %s %s %" PRIu32 ": %.1f ms per operation, result %s\n",
+	    op->name, variant->name, size,
+	    (double)timer.ns / 1e6 / timer.calls,
+	    (*op->check)(s) ? "ok" : "WRONG");
+}
+
+static void
+ateccbench_run(const struct ateccbench_op *op, struct ateccbench_state *s,
+    const uint32_t *sizes, int size_count, uint32_t min_ms, bool atcab)
+{
+	int i;
+
+	if (!op->sized) {
+		sizes = NULL;
+		size_count = 1;
+	} else if (size_count == 0) {
+		sizes = ateccbench_sha_sizes;
+		size_count = (int)RTEMS_ARRAY_SIZE(ateccbench_sha_sizes);
+	}
+
+	for (i = 0; i < size_count; ++i) {
+		size_t v;
+
+		s->size = sizes != NULL ? sizes[i] : 1;
+		s->has_reference = false;
+
+		for (v = 0; v < RTEMS_ARRAY_SIZE(ateccbench_variants); ++v) {
+			const struct ateccbench_variant *variant =
+			    &ateccbench_variants[v];
+
+			if (!variant->atcab || atcab) {
+				ateccbench_measure(op, variant, s, min_ms);
+			}
+		}
+	}
+}
+
+static bool
+ateccbench_known(const char *name)
+{
+	size_t i;
+
+	for (i = 0; i < RTEMS_ARRAY_SIZE(ateccbench_ops); ++i) {
+		if (strcmp(ateccbench_ops[i].name, name) == 0) {
+			return true;
+		}
+	}
+
+	return strcmp(name, "all") == 0;
+}
+
+static int
+command_atecc(int argc, char *argv[])
+{
+	static struct ateccbench_state s;
+	static uint8_t data[4096];
+	uint32_t sizes[BENCH_MAX_SIZES];
+	int size_count = 0;
+	uint32_t min_ms = ATECCBENCH_DEFAULT_MIN_MS;
+	int first_op = 0;
+	ATCA_STATUS status;
+	bool atcab;
+	int i;
+
+	memset(&s, 0, sizeof(s));
+	for (i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+			++i;
+			size_count = bench_parse_sizes(argv[i], sizes,
+			    BENCH_MAX_SIZES);
+			if (size_count < 0) {
+				break;
+			}
+		} else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+			++i;
+			min_ms = (uint32_t)strtoul(argv[i], NULL, 0);
+		} else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) {
+			++i;
+			s.key_id = (uint16_t)strtoul(argv[i], NULL, 0);
+		} else if (argv[i][0] != '-') {
+			first_op = i;
+			break;
+		} else {
+			break;
+		}
+	}
+
+	if (first_op == 0) {
+		puts(shell_ATECC_Command.usage);
+		return -1;
+	}
+	for (i = first_op; i < argc; ++i) {
+		if (!ateccbench_known(argv[i])) {
+			printf("Unknown operation: %s\n", argv[i]);
+			return -1;
+		}
+	}
+
+	for (i = 0; i < (int)sizeof(data); ++i) {
+		data[i] = (uint8_t)i;
+	}
+	for (i = 0; i < (int)sizeof(s.message); ++i) {
+		s.message[i] = (uint8_t)(i * 7);
+	}
+	s.data = data;
+
+	/* Verify and ECDH use the key of the slot */
+	status = atca_grisp_get_pubkey(s.key_id, s.public_key);
+	if (status == ATCA_SUCCESS) {
+		status = atca_grisp_sign(s.key_id, s.message, s.signature);
+	}
+	if (status != ATCA_SUCCESS) {
+		printf("No signature with the key in slot %u: 0x%02x\n",
+		    (unsigned)s.key_id, status);
+		return -1;
+	}
+
+	status = atcab_init(&cfg_atecc608_grisp);
+	atcab = status == ATCA_SUCCESS;
+	if (!atcab) {
+		printf("# atcab_init() failed with 0x%02x, no atcab variant\n",
+		    status);
+	}
+
+	bench_result_print_header();
+	for (i = first_op; i < argc; ++i) {
+		bool all = strcmp(argv[i], "all") == 0;
+		size_t k;
+
+		for (k = 0; k < RTEMS_ARRAY_SIZE(ateccbench_ops); ++k) {
+			const struct ateccbench_op *op = &ateccbench_ops[k];
+
+			if (all || strcmp(op->name, argv[i]) == 0) {
+				ateccbench_run(op, &s, sizes, size_count,
+				    min_ms, atcab);
+			}
+		}
+	}
+
+	if (atcab) {
+		(void)atcab_release();
+	}
+
+	return 0;
+}
+
+rtems_shell_cmd_t shell_ATECC_Command = {
+	.name = "atecc",
+	.usage = "Use with: atecc [-k slot] [-n sizes] [-t ms] operation...\n"
+	    "Benchmark sign, verify, ecdh and sha (or all) on the ATECC608\n"
+	    "with the key in -k slot (default: 0). The variants wait the\n"
+	    "maximum execution time (maxdelay), poll for the response (poll),\n"
+	    "keep the device awake between the operations (burst) and use\n"
+	    "cryptoauthlib in a burst (atcab). sha hashes -n bytes (default:\n"
+	    "64,1024). Each variant runs for at least -t milliseconds\n"
+	    "(default: 2000). The mflops column shows operations per second.\n"
+	    "Signatures are checked by the device, the other results against\n"
+	    "the first variant.\n",
+	.topic = "bench",
+	.command = command_atecc,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
@@ -0,0 +1,330 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "bench.h"
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static struct {
+	struct bench_result results[BENCH_MAX_RESULTS];
+	size_t count;
+	bool has_cycle_counter;
+	uint32_t cycles_per_us;
+} bench;
+
+void
+bench_init(void)
+{
+#if defined(__arm__) && defined(__ARM_ARCH_7A__)
+	/* PMCR: enable, reset the cycle counter, no divider */
+	__asm__ volatile ("mcr p15, 0, %0, c9, c12, 0" : : "r" (0x5));
+	/* PMCNTENSET: enable the cycle counter */
+	__asm__ volatile ("mcr p15, 0, %0, c9, c12, 1" : : "r" (1U << 31));
+#endif
+	{
+		uint64_t start_ns;
+		uint32_t start;
+		uint32_t cycles;
+		uint64_t ns;
+
+		/* Align to a tick, then measure for a few of them */
+		(void)rtems_task_wake_after(1);
+		start_ns = rtems_clock_get_uptime_nanoseconds();
+		start = bench_cycles();
+		(void)rtems_task_wake_after(5);
+		cycles = bench_cycles() - start;
+		ns = rtems_clock_get_uptime_nanoseconds() - start_ns;
+
+		bench.has_cycle_counter = cycles != 0;
+		bench.cycles_per_us = (uint32_t)(cycles * 1000ULL / ns);
+	}
+
+	if (bench.has_cycle_counter) {
+		printf("Cycle counter: %" PRIu32 " MHz\n", bench.cycles_per_us);
+	} else {
+		printf("No cycle counter, cycles are not reported\n");
+	}
+}
+
+const struct bench_result *
+bench_result_add(const char *name, const char *variant, uint32_t size,
+    double flops, double elements, const struct bench_timer *timer)
+{
+	struct bench_result *result;
+	double calls = timer->calls;
+
+	if (bench.count == BENCH_MAX_RESULTS) {
+		/* Keep the latest ones */
+		memmove(&bench.results[0], &bench.results[1],
+		    sizeof(bench.results) - sizeof(bench.results[0]));
+		--bench.count;
+	}
+	result = &bench.results[bench.count];
+	++bench.count;
+
+	strlcpy(result->name, name, sizeof(result->name));
+	strlcpy(result->variant, variant, sizeof(result->variant));
+	result->size = size;
+	result->mflops = timer->ns > 0 ?
+	    flops * calls * 1000.0 / (double)timer->ns : 0.0;
+	result->cycles_per_element = bench.has_cycle_counter && elements > 0 ?
+	    (double)timer->cycles / (calls * elements) : 0.0;
+
+	return result;
+}
+
+void
+bench_results_clear(void)
+{
+	bench.count = 0;
+}
+
+void
+bench_result_print_header(void)
+{
+	printf("# %-8s %-9s %6s %10s %10s\n", "name", "variant", "size",
+	    "mflops", "cyc/elem");
+}
+
+void
+bench_result_print(const struct bench_result *result)
+{
+	printf("%-10s %-9s %6" PRIu32 " %10.1f %10.2f\n", result->name,
+	    result->variant, result->size, result->mflops,
+	    result->cycles_per_element);
+}
+
+int
+bench_parse_sizes(const char *arg, uint32_t *sizes, int max)
+{
+	int count = 0;
+
+	while (*arg != '\0') {
+		char *end;
+		unsigned long value;
+
+		errno = 0;
+		value = strtoul(arg, &end, 10);
+		if (end == arg || errno != 0 || value == 0 ||
+		    value > 4096 || count == max ||
+		    (*end != ',' && *end != '\0')) {
+			return -1;
+		}
+		sizes[count] = (uint32_t)value;
+		++count;
+		arg = *end == ',' ? end + 1 : end;
+	}
+
+	return count > 0 ? count : -1;
+}
+
+static uint32_t
+bench_random(uint32_t *state)
+{
+	/* xorshift32, the same values on every run and target */
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return *state;
+}
+
+void
+bench_fill_float(float *x, size_t n, uint32_t seed)
+{
+	uint32_t state = seed != 0 ? seed : 1;
+	size_t i;
+
+	for (i = 0; i < n; ++i) {
+		x[i] = (float)(bench_random(&state) >> 8) / 16777216.0f - 0.5f;
+	}
+}
+
+void
+bench_fill_double(double *x, size_t n, uint32_t seed)
+{
+	uint32_t state = seed != 0 ? seed : 1;
+	size_t i;
+
+	for (i = 0; i < n; ++i) {
+		uint32_t value = bench_random(&state);
+
+		x[i] = (double)value / 4294967296.0 - 0.5;
+	}
+}
+
+int
+bench_baseline_save(const char *path)
+{
+	FILE *file;
+	size_t i;
+
+	file = fopen(path, "w");
+	if (file == NULL) {
+		return -1;
+	}
+
+	fprintf(file, "# name variant size mflops cycles/element\n");
+	for (i = 0; i < bench.count; ++i) {
+		const struct bench_result *r = &bench.results[i];
+
+		fprintf(file, "%s %s %" PRIu32 " %.1f %.2f\n", r->name,
+		    r->variant, r->size, r->mflops, r->cycles_per_element);
+	}
+
+	return fclose(file) == 0 ? 0 : -1;
+}
+
+static const struct bench_result *
+bench_find(const char *name, const char *variant, uint32_t size)
+{
+	size_t i;
+
+	/* The latest one wins if something was measured twice */
+	for (i = bench.count; i > 0; --i) {
+		const struct bench_result *r = &bench.results[i - 1];
+
+		if (r->size == size && strcmp(r->name, name) == 0 &&
+		    strcmp(r->variant, variant) == 0) {
+			return r;
+		}
+	}
+
+	return NULL;
+}
+
+int
+bench_baseline_compare(const char *path, double threshold_percent)
+{
+	FILE *file;
+	char line[128];
+	unsigned compared = 0;
+	unsigned slower = 0;
+
+	file = fopen(path, "r");
+	if (file == NULL) {
+		return -1;
+	}
+
+	printf("# %-8s %-9s %6s %10s %10s %8s\n", "name", "variant", "size",
+	    "baseline", "mflops", "change");
+	while (fgets(line, sizeof(line), file) != NULL) {
+		struct bench_result base;
+		const struct bench_result *now;
+		double change;
+
+		if (line[0] == '#' || sscanf(line, "%15s %11s %" SCNu32 " %lf",
+		    base.name, base.variant, &base.size, &base.mflops) != 4) {
+			continue;
+		}
+		now = bench_find(base.name, base.variant, base.size);
+		if (now == NULL || base.mflops <= 0.0) {
+			continue;
+		}
+
+		change = (now->mflops - base.mflops) * 100.0 / base.mflops;
+		printf("%-10s %-9s %6" PRIu32 " %10.1f %10.1f %+7.1f%%%s\n",
+		    base.name, base.variant, base.size, base.mflops,
+		    now->mflops, change,
+		    change < -threshold_percent ? "  SLOWER" : "");
+		++compared;
+		if (change < -threshold_percent) {
+			++slower;
+		}
+	}
+	fclose(file);
+
+	printf("%u results compared, %u slower by more than %.1f%%\n",
+	    compared, slower, threshold_percent);
+
+	return slower == 0 ? 0 : 1;
+}
+
+static int
+command_baseline(int argc, char *argv[])
+{
+	const char *path = BENCH_DEFAULT_BASELINE;
+	double threshold = 5.0;
+	int i;
+	int rv;
+
+	if (argc < 2) {
+		puts(shell_BASELINE_Command.usage);
+		return -1;
+	}
+
+	for (i = 2; i < argc; ++i) {
+		if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+			++i;
+			threshold = strtod(argv[i], NULL);
+		} else if (argv[i][0] != '-') {
+			path = argv[i];
+		} else {
+			puts(shell_BASELINE_Command.usage);
+			return -1;
+		}
+	}
+
+	if (strcmp(argv[1], "save") == 0) {
+		rv = bench_baseline_save(path);
+		if (rv == 0) {
+			printf("Saved %zu results to %s\n", bench.count, path);
+		}
+	} else if (strcmp(argv[1], "compare") == 0) {
+		rv = bench_baseline_compare(path, threshold);
+	} else if (strcmp(argv[1], "clear") == 0) {
+		bench_results_clear();
+		return 0;
+	} else {
+		puts(shell_BASELINE_Command.usage);
+		return -1;
+	}
+
+	if (rv < 0) {
+		printf("Couldn't access %s\n", path);
+	}
+	return rv;
+}
+
+rtems_shell_cmd_t shell_BASELINE_Command = {
+	.name = "baseline",
+	.usage = "Use with: baseline save|compare|clear [file] [-t percent]\n"
+	    "Save the results of the benchmarks since the last clear or\n"
+	    "compare them against a saved file. compare reports results that\n"
+	    "are slower by more than -t percent (default: 5) and fails if\n"
+	    "there are any (default file: " BENCH_DEFAULT_BASELINE ").\n",
+	.topic = "bench",
+	.command = command_baseline,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
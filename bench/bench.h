@@ -0,0 +1,154 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BENCH_BENCH_H
+#define BENCH_BENCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <rtems.h>
+#include <rtems/shell.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define BENCH_DEFAULT_BASELINE "/media/mmcsd-0-0/baseline.txt"
+#define BENCH_MAX_RESULTS 256
+#define BENCH_MAX_SIZES 16
+
+/*
+ * One measurement. The name is the kernel ("gemm", "potrf", ...) and the
+ * variant things like the precision. Sizes are the dimension of the square
+ * problem. Cycles per element refer to the elements of the result, so they
+ * can be compared between sizes of the same kernel.
+ */
+struct bench_result {
+	char name[16];
+	char variant[12];
+	uint32_t size;
+	double mflops;
+	double cycles_per_element;
+};
+
+/* Time and cycles spent in the measured calls */
+struct bench_timer {
+	uint64_t ns;
+	uint64_t cycles;
+	uint32_t calls;
+	uint64_t start_ns;
+	uint32_t start_cycles;
+};
+
+/*
+ * Enable the cycle counter of the Cortex-A7 performance monitor and measure
+ * its frequency against the clock tick. Without a cycle counter
+ * bench_cycles() returns 0 and no cycles are reported.
+ */
+void bench_init(void);
+
+static inline uint32_t
+bench_cycles(void)
+{
+#if defined(__arm__) && defined(__ARM_ARCH_7A__)
+	uint32_t value;
+
+	__asm__ volatile ("mrc p15, 0, %0, c9, c13, 0" : "=r" (value));
+	return value;
+#else
+	return 0;
+#endif
+}
+
+static inline void
+bench_timer_start(struct bench_timer *timer)
+{
+	timer->start_ns = rtems_clock_get_uptime_nanoseconds();
+	timer->start_cycles = bench_cycles();
+}
+
+/* Each call is short enough that the 32-bit cycle counter doesn't wrap twice */
+static inline void
+bench_timer_stop(struct bench_timer *timer)
+{
+	uint32_t cycles = bench_cycles();
+
+	timer->ns += rtems_clock_get_uptime_nanoseconds() - timer->start_ns;
+	timer->cycles += (uint32_t)(cycles - timer->start_cycles);
+	++timer->calls;
+}
+
+/* Returns true until at least one call and min_ms were measured */
+static inline bool
+bench_timer_more(const struct bench_timer *timer, uint32_t min_ms)
+{
+	return timer->calls == 0 || timer->ns < (uint64_t)min_ms * 1000000;
+}
+
+/*
+ * Record a result from the timer. The flops and elements are per call.
+ * Returns the result, which is also kept for bench_baseline_save() and
+ * bench_baseline_compare() until the next bench_results_clear().
+ */
+const struct bench_result *bench_result_add(const char *name,
+    const char *variant, uint32_t size, double flops, double elements,
+    const struct bench_timer *timer);
+
+void bench_results_clear(void);
+
+/* One line per result in the format of the baseline file */
+void bench_result_print_header(void);
+void bench_result_print(const struct bench_result *result);
+
+/* Parse a comma separated list like "16,32,64". Returns the count or -1. */
+int bench_parse_sizes(const char *arg, uint32_t *sizes, int max);
+
+/* Fill with reproducible values in [-0.5, 0.5) */
+void bench_fill_float(float *x, size_t n, uint32_t seed);
+void bench_fill_double(double *x, size_t n, uint32_t seed);
+
+/*
+ * The baseline file has the format of the printed results:
+ *
+ *   # name variant size mflops cycles/element
+ *   gemm s 64 402.1 1.27
+ *
+ * Lines starting with # are comments, so the output of a run on the console
+ * can be used as baseline, too.
+ */
+int bench_baseline_save(const char *path);
+int bench_baseline_compare(const char *path, double threshold_percent);
+
+extern rtems_shell_cmd_t shell_BASELINE_Command;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BENCH_BENCH_H */
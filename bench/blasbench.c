@@ -0,0 +1,823 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "blasbench.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cblas.h>
+#include <lapacke.h>
+
+#include "bench.h"
+
+#define BLASBENCH_DEFAULT_MIN_MS 200
+
+/* Small matrices per call of the batch benchmark */
+#define BLASBENCH_BATCH 256
+
+/*
+ * The results are checked against the sum of the absolute values of the
+ * terms: an error of up to this factor times (length + 2) eps of it is
+ * accepted. That covers any order of the additions and the blocked LAPACK
+ * algorithms.
+ */
+#define BLASBENCH_CHECK_FACTOR 8
+
+struct blasbench_buffers {
+	bool dbl;
+	int n;
+	/* Either float or double */
+	void *a;
+	void *b;
+	void *c;
+	/* To restore the input of the routines that overwrite it */
+	void *saved;
+	lapack_int *ipiv;
+};
+
+struct blasbench_kernel {
+	const char *name;
+	uint32_t default_sizes[BENCH_MAX_SIZES];
+	/* Number of matrices of size n x n per buffer */
+	int batch;
+	void (*prepare)(struct blasbench_buffers *buf);
+	/* Called with the timer stopped, returns the flops of one call */
+	double (*run)(struct blasbench_buffers *buf, struct bench_timer *timer);
+	/* Check the result of a call of run against a plain C reference */
+	bool (*check)(const struct blasbench_buffers *buf);
+	/* Elements of the result of one call */
+	double (*elements)(int n);
+};
+
+static size_t
+blasbench_count(const struct blasbench_buffers *buf)
+{
+	return (size_t)buf->n * (size_t)buf->n;
+}
+
+static void
+blasbench_fill(const struct blasbench_buffers *buf, void *x, size_t count,
+    uint32_t seed)
+{
+	if (buf->dbl) {
+		bench_fill_double(x, count, seed);
+	} else {
+		bench_fill_float(x, count, seed);
+	}
+}
+
+/* Add n to the diagonal, so the matrix is well conditioned */
+static void
+blasbench_dominant(const struct blasbench_buffers *buf, void *x)
+{
+	int i;
+
+	for (i = 0; i < buf->n; ++i) {
+		size_t d = (size_t)i * (size_t)buf->n + (size_t)i;
+
+		if (buf->dbl) {
+			((double *)x)[d] += buf->n;
+		} else {
+			((float *)x)[d] += (float)buf->n;
+		}
+	}
+}
+
+static void
+blasbench_restore(const struct blasbench_buffers *buf, void *x, size_t count)
+{
+	memcpy(x, buf->saved, count * (buf->dbl ? sizeof(double) :
+	    sizeof(float)));
+}
+
+static double
+blasbench_get(const struct blasbench_buffers *buf, const void *x, size_t i)
+{
+	return buf->dbl ? ((const double *)x)[i] : ((const float *)x)[i];
+}
+
+static void
+blasbench_set(const struct blasbench_buffers *buf, void *x, size_t i,
+    double value)
+{
+	if (buf->dbl) {
+		((double *)x)[i] = value;
+	} else {
+		((float *)x)[i] = (float)value;
+	}
+}
+
+/* Element (i, j) of a column major n x n matrix */
+static size_t
+blasbench_at(const struct blasbench_buffers *buf, int i, int j)
+{
+	return (size_t)i + (size_t)j * (size_t)buf->n;
+}
+
+/* Fails for NaN */
+static bool
+blasbench_close(const struct blasbench_buffers *buf, double value,
+    double ref, double abs_sum, int len)
+{
+	double eps = buf->dbl ? DBL_EPSILON : FLT_EPSILON;
+
+	return fabs(value - ref) <= BLASBENCH_CHECK_FACTOR * (len + 2) * eps *
+	    abs_sum;
+}
+
+static void
+blasbench_prepare_random(struct blasbench_buffers *buf)
+{
+	size_t count = blasbench_count(buf);
+
+	blasbench_fill(buf, buf->a, count, 1);
+	blasbench_fill(buf, buf->b, count, 2);
+	blasbench_fill(buf, buf->c, count, 3);
+}
+
+static double
+blasbench_gemm(struct blasbench_buffers *buf, struct bench_timer *timer)
+{
+	int n = buf->n;
+
+	bench_timer_start(timer);
+	if (buf->dbl) {
+		cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, n, n, n,
+		    1.0, buf->a, n, buf->b, n, 0.0, buf->c, n);
+	} else {
+		cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, n, n, n,
+		    1.0f, buf->a, n, buf->b, n, 0.0f, buf->c, n);
+	}
+	bench_timer_stop(timer);
+
+	return 2.0 * n * n * n;
+}
+
+/* C = A B for the matrices at the offset */
+static bool
+blasbench_check_product(const struct blasbench_buffers *buf, size_t offset)
+{
+	int n = buf->n;
+	int i;
+	int j;
+	int l;
+
+	for (j = 0; j < n; ++j) {
+		for (i = 0; i < n; ++i) {
+			double ref = 0.0;
+			double abs_sum = 0.0;
+
+			for (l = 0; l < n; ++l) {
+				double t = blasbench_get(buf, buf->a, offset +
+				    blasbench_at(buf, i, l)) *
+				    blasbench_get(buf, buf->b, offset +
+				    blasbench_at(buf, l, j));
+
+				ref += t;
+				abs_sum += fabs(t);
+			}
+			if (!blasbench_close(buf, blasbench_get(buf, buf->c,
+			    offset + blasbench_at(buf, i, j)), ref, abs_sum,
+			    n)) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+static bool
+blasbench_check_gemm(const struct blasbench_buffers *buf)
+{
+	return blasbench_check_product(buf, 0);
+}
+
+static double
+blasbench_gemv_trans(struct blasbench_buffers *buf, struct bench_timer *timer,
+    enum CBLAS_TRANSPOSE trans)
+{
+	int n = buf->n;
+
+	bench_timer_start(timer);
+	if (buf->dbl) {
+		cblas_dgemv(CblasColMajor, trans, n, n, 1.0, buf->a, n, buf->b,
+		    1, 0.0, buf->c, 1);
+	} else {
+		cblas_sgemv(CblasColMajor, trans, n, n, 1.0f, buf->a, n, buf->b,
+		    1, 0.0f, buf->c, 1);
+	}
+	bench_timer_stop(timer);
+
+	return 2.0 * n * n;
+}
+
+/* c = op(A) b */
+static bool
+blasbench_check_gemv_trans(const struct blasbench_buffers *buf, bool trans)
+{
+	int n = buf->n;
+	int i;
+	int l;
+
+	for (i = 0; i < n; ++i) {
+		double ref = 0.0;
+		double abs_sum = 0.0;
+
+		for (l = 0; l < n; ++l) {
+			double t = blasbench_get(buf, buf->a, trans ?
+			    blasbench_at(buf, l, i) : blasbench_at(buf, i, l)) *
+			    blasbench_get(buf, buf->b, (size_t)l);
+
+			ref += t;
+			abs_sum += fabs(t);
+		}
+		if (!blasbench_close(buf, blasbench_get(buf, buf->c,
+		    (size_t)i), ref, abs_sum, n)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool
+blasbench_check_gemv(const struct blasbench_buffers *buf)
+{
+	return blasbench_check_gemv_trans(buf, false);
+}
+
+static bool
+blasbench_check_gemvt(const struct blasbench_buffers *buf)
+{
+	return blasbench_check_gemv_trans(buf, true);
+}
+
+static double
+blasbench_gemv(struct blasbench_buffers *buf, struct bench_timer *timer)
+{
+	return blasbench_gemv_trans(buf, timer, CblasNoTrans);
+}
+
+static double
+blasbench_gemvt(struct blasbench_buffers *buf, struct bench_timer *timer)
+{
+	return blasbench_gemv_trans(buf, timer, CblasTrans);
+}
+
+static void
+blasbench_prepare_trsv(struct blasbench_buffers *buf)
+{
+	blasbench_prepare_random(buf);
+	blasbench_dominant(buf, buf->a);
+	memcpy(buf->saved, buf->b, (size_t)buf->n * (buf->dbl ?
+	    sizeof(double) : sizeof(float)));
+}
+
+static double
+blasbench_trsv(struct blasbench_buffers *buf, struct bench_timer *timer)
+{
+	int n = buf->n;
+
+	/* Solving again with the solution would end up in denormals */
+	blasbench_restore(buf, buf->b, (size_t)n);
+
+	bench_timer_start(timer);
+	if (buf->dbl) {
+		cblas_dtrsv(CblasColMajor, CblasLower, CblasNoTrans,
+		    CblasNonUnit, n, buf->a, n, buf->b, 1);
+	} else {
+		cblas_strsv(CblasColMajor, CblasLower, CblasNoTrans,
+		    CblasNonUnit, n, buf->a, n, buf->b, 1);
+	}
+	bench_timer_stop(timer);
+
+	return (double)n * n;
+}
+
+/* L x = b with the solution x in b and the right hand side in saved */
+static bool
+blasbench_check_trsv(const struct blasbench_buffers *buf)
+{
+	int n = buf->n;
+	int i;
+	int j;
+
+	for (i = 0; i < n; ++i) {
+		double value = 0.0;
+		double abs_sum = 0.0;
+
+		for (j = 0; j <= i; ++j) {
+			double t = blasbench_get(buf, buf->a,
+			    blasbench_at(buf, i, j)) *
+			    blasbench_get(buf, buf->b, (size_t)j);
+
+			value += t;
+			abs_sum += fabs(t);
+		}
+		if (!blasbench_close(buf, value, blasbench_get(buf,
+		    buf->saved, (size_t)i), abs_sum, n)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void
+blasbench_prepare_potrf(struct blasbench_buffers *buf)
+{
+	int n = buf->n;
+	int i;
+	int j;
+
+	/* Symmetric and diagonally dominant, so positive definite */
+	blasbench_prepare_random(buf);
+	for (j = 0; j < n; ++j) {
+		for (i = j + 1; i < n; ++i) {
+			size_t lower = (size_t)j * (size_t)n + (size_t)i;
+			size_t upper = (size_t)i * (size_t)n + (size_t)j;
+
+			if (buf->dbl) {
+				((double *)buf->a)[upper] =
+				    ((double *)buf->a)[lower];
+			} else {
+				((float *)buf->a)[upper] =
+				    ((float *)buf->a)[lower];
+			}
+		}
+	}
+	blasbench_dominant(buf, buf->a);
+	memcpy(buf->saved, buf->a, blasbench_count(buf) * (buf->dbl ?
+	    sizeof(double) : sizeof(float)));
+}
+
+static double
+blasbench_potrf(struct blasbench_buffers *buf, struct bench_timer *timer)
+{
+	int n = buf->n;
+	lapack_int info;
+
+	blasbench_restore(buf, buf->a, blasbench_count(buf));
+
+	bench_timer_start(timer);
+	if (buf->dbl) {
+		info = LAPACKE_dpotrf_work(LAPACK_COL_MAJOR, 'L', n, buf->a, n);
+	} else {
+		info = LAPACKE_spotrf_work(LAPACK_COL_MAJOR, 'L', n, buf->a, n);
+	}
+	bench_timer_stop(timer);
+
+	if (info != 0) {
+		printf("potrf failed: %d\n", (int)info);
+	}
+
+	return (double)n * n * n / 3.0;
+}
+
+/* L L^T = A with L in the lower triangle of a and A in saved */
+static bool
+blasbench_check_potrf(const struct blasbench_buffers *buf)
+{
+	int n = buf->n;
+	int i;
+	int j;
+	int l;
+
+	for (j = 0; j < n; ++j) {
+		for (i = j; i < n; ++i) {
+			double value = 0.0;
+			double abs_sum = 0.0;
+
+			for (l = 0; l <= j; ++l) {
+				double t = blasbench_get(buf, buf->a,
+				    blasbench_at(buf, i, l)) *
+				    blasbench_get(buf, buf->a,
+				    blasbench_at(buf, j, l));
+
+				value += t;
+				abs_sum += fabs(t);
+			}
+			if (!blasbench_close(buf, value, blasbench_get(buf,
+			    buf->saved, blasbench_at(buf, i, j)), abs_sum,
+			    n)) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+static void
+blasbench_prepare_getrf(struct blasbench_buffers *buf)
+{
+	blasbench_prepare_random(buf);
+	memcpy(buf->saved, buf->a, blasbench_count(buf) * (buf->dbl ?
+	    sizeof(double) : sizeof(float)));
+}
+
+static double
+blasbench_getrf(struct blasbench_buffers *buf, struct bench_timer *timer)
+{
+	int n = buf->n;
+	lapack_int info;
+
+	blasbench_restore(buf, buf->a, blasbench_count(buf));
+
+	bench_timer_start(timer);
+	if (buf->dbl) {
+		info = LAPACKE_dgetrf_work(LAPACK_COL_MAJOR, n, n, buf->a, n,
+		    buf->ipiv);
+	} else {
+		info = LAPACKE_sgetrf_work(LAPACK_COL_MAJOR, n, n, buf->a, n,
+		    buf->ipiv);
+	}
+	bench_timer_stop(timer);
+
+	if (info < 0) {
+		printf("getrf failed: %d\n", (int)info);
+	}
+
+	return 2.0 * n * n * n / 3.0;
+}
+
+/*
+ * L U = P A with the unit lower L and U in a and A in saved. P A is built in
+ * c, which getrf doesn't use.
+ */
+static bool
+blasbench_check_getrf(const struct blasbench_buffers *buf)
+{
+	int n = buf->n;
+	int i;
+	int j;
+	int l;
+
+	memcpy(buf->c, buf->saved, blasbench_count(buf) * (buf->dbl ?
+	    sizeof(double) : sizeof(float)));
+	for (i = 0; i < n; ++i) {
+		int p = (int)buf->ipiv[i] - 1;
+
+		for (j = 0; j < n && p != i; ++j) {
+			double t = blasbench_get(buf, buf->c,
+			    blasbench_at(buf, i, j));
+
+			blasbench_set(buf, buf->c, blasbench_at(buf, i, j),
+			    blasbench_get(buf, buf->c, blasbench_at(buf, p, j)));
+			blasbench_set(buf, buf->c, blasbench_at(buf, p, j), t);
+		}
+	}
+
+	for (j = 0; j < n; ++j) {
+		for (i = 0; i < n; ++i) {
+			double value = 0.0;
+			double abs_sum = 0.0;
+
+			for (l = 0; l <= i && l <= j; ++l) {
+				double lil = l == i ? 1.0 : blasbench_get(buf,
+				    buf->a, blasbench_at(buf, i, l));
+				double t = lil * blasbench_get(buf, buf->a,
+				    blasbench_at(buf, l, j));
+
+				value += t;
+				abs_sum += fabs(t);
+			}
+			if (!blasbench_close(buf, value, blasbench_get(buf,
+			    buf->c, blasbench_at(buf, i, j)), abs_sum, n)) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+static void
+blasbench_prepare_batch(struct blasbench_buffers *buf)
+{
+	size_t count = blasbench_count(buf) * BLASBENCH_BATCH;
+
+	blasbench_fill(buf, buf->a, count, 1);
+	blasbench_fill(buf, buf->b, count, 2);
+	blasbench_fill(buf, buf->c, count, 3);
+}
+
+/* Many small products like in filters and kinematics, call overhead counts */
+static double
+blasbench_batch(struct blasbench_buffers *buf, struct bench_timer *timer)
+{
+	int n = buf->n;
+	size_t stride = blasbench_count(buf);
+	int i;
+
+	bench_timer_start(timer);
+	if (buf->dbl) {
+		const double *a = buf->a;
+		const double *b = buf->b;
+		double *c = buf->c;
+
+		for (i = 0; i < BLASBENCH_BATCH; ++i) {
+			cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+			    n, n, n, 1.0, a, n, b, n, 0.0, c, n);
+			a += stride;
+			b += stride;
+			c += stride;
+		}
+	} else {
+		const float *a = buf->a;
+		const float *b = buf->b;
+		float *c = buf->c;
+
+		for (i = 0; i < BLASBENCH_BATCH; ++i) {
+			cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+			    n, n, n, 1.0f, a, n, b, n, 0.0f, c, n);
+			a += stride;
+			b += stride;
+			c += stride;
+		}
+	}
+	bench_timer_stop(timer);
+
+	return 2.0 * n * n * n * BLASBENCH_BATCH;
+}
+
+static bool
+blasbench_check_batch(const struct blasbench_buffers *buf)
+{
+	int i;
+
+	for (i = 0; i < BLASBENCH_BATCH; ++i) {
+		if (!blasbench_check_product(buf,
+		    (size_t)i * blasbench_count(buf))) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static double
+blasbench_elements_vector(int n)
+{
+	return n;
+}
+
+static double
+blasbench_elements_matrix(int n)
+{
+	return (double)n * n;
+}
+
+static double
+blasbench_elements_batch(int n)
+{
+	return (double)n * n * BLASBENCH_BATCH;
+}
+
+static const struct blasbench_kernel blasbench_kernels[] = {
+	{ "gemm", { 16, 32, 64, 128, 256 }, 1, blasbench_prepare_random,
+	    blasbench_gemm, blasbench_check_gemm, blasbench_elements_matrix },
+	{ "gemv", { 64, 128, 256, 512, 1024 }, 1, blasbench_prepare_random,
+	    blasbench_gemv, blasbench_check_gemv, blasbench_elements_vector },
+	{ "gemv_t", { 64, 128, 256, 512, 1024 }, 1, blasbench_prepare_random,
+	    blasbench_gemvt, blasbench_check_gemvt,
+	    blasbench_elements_vector },
+	{ "trsv", { 64, 128, 256, 512, 1024 }, 1, blasbench_prepare_trsv,
+	    blasbench_trsv, blasbench_check_trsv, blasbench_elements_vector },
+	{ "potrf", { 16, 32, 64, 128, 256 }, 1, blasbench_prepare_potrf,
+	    blasbench_potrf, blasbench_check_potrf,
+	    blasbench_elements_matrix },
+	{ "getrf", { 16, 32, 64, 128, 256 }, 1, blasbench_prepare_getrf,
+	    blasbench_getrf, blasbench_check_getrf,
+	    blasbench_elements_matrix },
+	{ "batch", { 2, 3, 4, 6, 8, 12, 16 }, BLASBENCH_BATCH,
+	    blasbench_prepare_batch, blasbench_batch, blasbench_check_batch,
+	    blasbench_elements_batch },
+};
+
+static void
+blasbench_free(struct blasbench_buffers *buf)
+{
+	free(buf->a);
+	free(buf->b);
+	free(buf->c);
+	free(buf->saved);
+	free(buf->ipiv);
+}
+
+static bool
+blasbench_alloc(struct blasbench_buffers *buf, bool dbl, int n, int batch)
+{
+	size_t size = (size_t)n * (size_t)n * (size_t)batch *
+	    (dbl ? sizeof(double) : sizeof(float));
+
+	memset(buf, 0, sizeof(*buf));
+	buf->dbl = dbl;
+	buf->n = n;
+	buf->a = malloc(size);
+	buf->b = malloc(size);
+	buf->c = malloc(size);
+	buf->saved = malloc(size);
+	buf->ipiv = malloc((size_t)n * sizeof(buf->ipiv[0]));
+	if (buf->a == NULL || buf->b == NULL || buf->c == NULL ||
+	    buf->saved == NULL || buf->ipiv == NULL) {
+		blasbench_free(buf);
+		return false;
+	}
+
+	return true;
+}
+
+static int
+blasbench_run(const struct blasbench_kernel *kernel, const char *precisions,
+    const uint32_t *sizes, int size_count, uint32_t min_ms)
+{
+	const char *p;
+	int i;
+
+	if (size_count == 0) {
+		sizes = kernel->default_sizes;
+		while (size_count < BENCH_MAX_SIZES &&
+		    kernel->default_sizes[size_count] != 0) {
+			++size_count;
+		}
+	}
+
+	for (p = precisions; *p != '\0'; ++p) {
+		char variant[2] = { *p, '\0' };
+
+		for (i = 0; i < size_count; ++i) {
+			struct blasbench_buffers buf;
+			struct bench_timer timer = { 0 };
+			int n = (int)sizes[i];
+			double flops = 0.0;
+
+			if (!blasbench_alloc(&buf, *p == 'd', n,
+			    kernel->batch)) {
+				printf("%s %s %d: Not enough memory\n",
+				    kernel->name, variant, n);
+				return -1;
+			}
+
+			(*kernel->prepare)(&buf);
+			/* Warm up the caches and the lazy initialization */
+			(void)(*kernel->run)(&buf, &timer);
+			memset(&timer, 0, sizeof(timer));
+
+			/* A fast but wrong kernel has no MFLOPS */
+			if (!(*kernel->check)(&buf)) {
+				printf("%s %s %d: Wrong result\n",
+				    kernel->name, variant, n);
+				blasbench_free(&buf);
+				return -1;
+			}
+
+			while (bench_timer_more(&timer, min_ms)) {
+				flops = (*kernel->run)(&buf, &timer);
+			}
+			bench_result_print(bench_result_add(kernel->name,
+			    variant, sizes[i], flops,
+			    (*kernel->elements)(n), &timer));
+
+			blasbench_free(&buf);
+		}
+	}
+
+	return 0;
+}
+
+static const struct blasbench_kernel *
+blasbench_find(const char *name)
+{
+	size_t i;
+
+	for (i = 0; i < RTEMS_ARRAY_SIZE(blasbench_kernels); ++i) {
+		if (strcmp(blasbench_kernels[i].name, name) == 0) {
+			return &blasbench_kernels[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int
+command_blas(int argc, char *argv[])
+{
+	const char *precisions = "sd";
+	uint32_t sizes[BENCH_MAX_SIZES];
+	int size_count = 0;
+	uint32_t min_ms = BLASBENCH_DEFAULT_MIN_MS;
+	int first_kernel = 0;
+	int i;
+
+	for (i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+			++i;
+			if (strcmp(argv[i], "s") != 0 &&
+			    strcmp(argv[i], "d") != 0 &&
+			    strcmp(argv[i], "sd") != 0) {
+				break;
+			}
+			precisions = argv[i];
+		} else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+			++i;
+			size_count = bench_parse_sizes(argv[i], sizes,
+			    BENCH_MAX_SIZES);
+			if (size_count < 0) {
+				break;
+			}
+		} else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+			++i;
+			min_ms = (uint32_t)strtoul(argv[i], NULL, 0);
+		} else if (argv[i][0] != '-') {
+			first_kernel = i;
+			break;
+		} else {
+			break;
+		}
+	}
+
+	if (first_kernel == 0) {
+		puts(shell_BLAS_Command.usage);
+		return -1;
+	}
+	for (i = first_kernel; i < argc; ++i) {
+		if (strcmp(argv[i], "all") != 0 && blasbench_find(argv[i]) ==
+		    NULL) {
+			printf("Unknown kernel: %s\n", argv[i]);
+			return -1;
+		}
+	}
+
+	bench_result_print_header();
+	for (i = first_kernel; i < argc; ++i) {
+		const struct blasbench_kernel *kernel = blasbench_find(argv[i]);
+
+		if (kernel != NULL) {
+			if (blasbench_run(kernel, precisions, sizes,
+			    size_count, min_ms) != 0) {
+				return -1;
+			}
+		} else {
+			size_t k;
+
+			for (k = 0; k < RTEMS_ARRAY_SIZE(blasbench_kernels);
+			    ++k) {
+				if (blasbench_run(&blasbench_kernels[k],
+				    precisions, sizes, size_count,
+				    min_ms) != 0) {
+					return -1;
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
+rtems_shell_cmd_t shell_BLAS_Command = {
+	.name = "blas",
+	.usage = "Use with: blas [-p s|d|sd] [-n sizes] [-t ms] kernel...\n"
+	    "Benchmark the kernels (gemm, gemv, gemv_t, trsv, potrf, getrf,\n"
+	    "batch or all) for a sweep of sizes (-n 16,32,64 instead of the\n"
+	    "defaults). Each size runs for at least -t milliseconds (default:\n"
+	    "200). Sizes of batch are the ones of 256 small products. Checks\n"
+	    "the result of each size against a plain C reference first, then\n"
+	    "prints MFLOPS and cycles per element of the result.\n",
+	.topic = "bench",
+	.command = command_blas,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
@@ -0,0 +1,388 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cryptobench.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atcac_neon.h>
+#include <crypto/atca_crypto_sw_sha2.h>
+
+#include "bench.h"
+
+#define CRYPTOBENCH_DEFAULT_MIN_MS 500
+
+/* The mflops column shows operations per second for verify */
+#define CRYPTOBENCH_OPS_PER_CALL 1e6
+
+/* Size of the application image, the size column shows KiB */
+#define CRYPTOBENCH_IMAGE_SIZE (4 * 1024 * 1024)
+
+struct cryptobench_state {
+	uint8_t *data;
+	uint8_t *out;
+	uint32_t size;
+	struct atcac_neon_aes aes;
+	uint8_t digest[ATCAC_NEON_SHA256_DIGEST_SIZE];
+	uint8_t tag[ATCAC_NEON_GCM_TAG_SIZE];
+	bool verified;
+};
+
+struct cryptobench_kernel {
+	const char *name;
+	const char *variant;
+	bool sized;
+	void (*run)(struct cryptobench_state *s);
+	bool (*check)(struct cryptobench_state *s);
+};
+
+static const uint8_t cryptobench_key[16] = {
+	0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+	0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c,
+};
+
+static const uint8_t cryptobench_iv[12] = {
+	0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad,
+	0xde, 0xca, 0xf8, 0x88,
+};
+
+/*
+ * RFC 6979 A.2.5, the signature of SHA-256("sample"). There is no private key
+ * to sign the image with, so the image variant verifies this one. The time
+ * doesn't depend on the digest.
+ */
+static const uint8_t cryptobench_public_key[64] = {
+	0x60, 0xfe, 0xd4, 0xba, 0x25, 0x5a, 0x9d, 0x31,
+	0xc9, 0x61, 0xeb, 0x74, 0xc6, 0x35, 0x6d, 0x68,
+	0xc0, 0x49, 0xb8, 0x92, 0x3b, 0x61, 0xfa, 0x6c,
+	0xe6, 0x69, 0x62, 0x2e, 0x60, 0xf2, 0x9f, 0xb6,
+	0x79, 0x03, 0xfe, 0x10, 0x08, 0xb8, 0xbc, 0x99,
+	0xa4, 0x1a, 0xe9, 0xe9, 0x56, 0x28, 0xbc, 0x64,
+	0xf2, 0xf1, 0xb2, 0x0c, 0x2d, 0x7e, 0x9f, 0x51,
+	0x77, 0xa3, 0xc2, 0x94, 0xd4, 0x46, 0x22, 0x99,
+};
+
+static const uint8_t cryptobench_signature[64] = {
+	0xef, 0xd4, 0x8b, 0x2a, 0xac, 0xb6, 0xa8, 0xfd,
+	0x11, 0x40, 0xdd, 0x9c, 0xd4, 0x5e, 0x81, 0xd6,
+	0x9d, 0x2c, 0x87, 0x7b, 0x56, 0xaa, 0xf9, 0x91,
+	0xc3, 0x4d, 0x0e, 0xa8, 0x4e, 0xaf, 0x37, 0x16,
+	0xf7, 0xcb, 0x1c, 0x94, 0x2d, 0x65, 0x7c, 0x41,
+	0xd4, 0x36, 0xc7, 0xa1, 0xb6, 0xe2, 0x9f, 0x65,
+	0xf3, 0xe9, 0x00, 0xdb, 0xb9, 0xaf, 0xf4, 0x06,
+	0x4d, 0xc4, 0xab, 0x2f, 0x84, 0x3a, 0xcd, 0xa8,
+};
+
+static void
+cryptobench_run_sha(struct cryptobench_state *s)
+{
+	atcac_neon_sha256(s->data, s->size, s->digest);
+}
+
+static void
+cryptobench_run_sha_atcac(struct cryptobench_state *s)
+{
+	(void)atcac_sw_sha2_256(s->data, s->size, s->digest);
+}
+
+static void
+cryptobench_run_ctr(struct cryptobench_state *s)
+{
+	uint8_t counter[ATCAC_NEON_AES_BLOCK_SIZE] = { 0 };
+
+	atcac_neon_aes_ctr(&s->aes, counter, s->data, s->out, s->size);
+}
+
+static void
+cryptobench_run_gcm(struct cryptobench_state *s)
+{
+	struct atcac_neon_gcm gcm;
+
+	(void)atcac_neon_gcm_init(&gcm, cryptobench_key,
+	    sizeof(cryptobench_key), cryptobench_iv, sizeof(cryptobench_iv));
+	atcac_neon_gcm_encrypt(&gcm, s->data, s->out, s->size);
+	atcac_neon_gcm_tag(&gcm, s->tag);
+}
+
+static void
+cryptobench_run_verify(struct cryptobench_state *s)
+{
+	atcac_neon_sha256("sample", 6, s->digest);
+	s->verified = atcac_neon_p256_verify(cryptobench_public_key,
+	    s->digest, cryptobench_signature);
+}
+
+static void
+cryptobench_run_image(struct cryptobench_state *s)
+{
+	uint8_t digest[ATCAC_NEON_SHA256_DIGEST_SIZE];
+
+	atcac_neon_sha256(s->data, s->size, s->digest);
+	atcac_neon_sha256("sample", 6, digest);
+	s->verified = atcac_neon_p256_verify(cryptobench_public_key, digest,
+	    cryptobench_signature);
+}
+
+/* Against the other implementation */
+static bool
+cryptobench_check_sha(struct cryptobench_state *s)
+{
+	uint8_t neon[ATCAC_NEON_SHA256_DIGEST_SIZE];
+	uint8_t atcac[ATCAC_NEON_SHA256_DIGEST_SIZE];
+
+	atcac_neon_sha256(s->data, s->size, neon);
+	return atcac_sw_sha2_256(s->data, s->size, atcac) == 0 &&
+	    memcmp(neon, s->digest, sizeof(neon)) == 0 &&
+	    memcmp(atcac, s->digest, sizeof(atcac)) == 0;
+}
+
+static bool
+cryptobench_check_ctr(struct cryptobench_state *s)
+{
+	uint8_t counter[ATCAC_NEON_AES_BLOCK_SIZE] = { 0 };
+
+	atcac_neon_aes_ctr(&s->aes, counter, s->out, s->out, s->size);
+	return memcmp(s->data, s->out, s->size) == 0;
+}
+
+static bool
+cryptobench_check_gcm(struct cryptobench_state *s)
+{
+	struct atcac_neon_gcm gcm;
+
+	(void)atcac_neon_gcm_init(&gcm, cryptobench_key,
+	    sizeof(cryptobench_key), cryptobench_iv, sizeof(cryptobench_iv));
+	atcac_neon_gcm_decrypt(&gcm, s->out, s->out, s->size);
+	return atcac_neon_gcm_check_tag(&gcm, s->tag, sizeof(s->tag)) == 0 &&
+	    memcmp(s->data, s->out, s->size) == 0;
+}
+
+static bool
+cryptobench_check_verify(struct cryptobench_state *s)
+{
+	return s->verified;
+}
+
+static bool
+cryptobench_check_image(struct cryptobench_state *s)
+{
+	uint8_t atcac[ATCAC_NEON_SHA256_DIGEST_SIZE];
+
+	return s->verified && atcac_sw_sha2_256(s->data, s->size, atcac) == 0 &&
+	    memcmp(atcac, s->digest, sizeof(atcac)) == 0;
+}
+
+static const struct cryptobench_kernel cryptobench_kernels[] = {
+	{ "sha", "neon", true, cryptobench_run_sha, cryptobench_check_sha },
+	{ "sha", "atcac", true, cryptobench_run_sha_atcac,
+	    cryptobench_check_sha },
+	{ "ctr", "neon", true, cryptobench_run_ctr, cryptobench_check_ctr },
+	{ "gcm", "neon", true, cryptobench_run_gcm, cryptobench_check_gcm },
+	{ "verify", "neon", false, cryptobench_run_verify,
+	    cryptobench_check_verify },
+	{ "image", "neon", false, cryptobench_run_image,
+	    cryptobench_check_image },
+};
+
+static const uint32_t cryptobench_sizes[] = { 64, 1024, 4096 };
+
+static void
+cryptobench_measure(const struct cryptobench_kernel *kernel,
+    struct cryptobench_state *s, uint32_t size, uint32_t min_ms)
+{
+	struct bench_timer timer = { 0 };
+	double flops = s->size > 0 ? (double)s->size : CRYPTOBENCH_OPS_PER_CALL;
+
+	while (bench_timer_more(&timer, min_ms)) {
+		bench_timer_start(&timer);
+		(*kernel->run)(s);
+		bench_timer_stop(&timer);
+	}
+
+	bench_result_print(bench_result_add(kernel->name, kernel->variant, size,
+	    flops, (double)s->size, &timer));
+	printf("# %s %s %" PRIu32 ": %.3f ms per call, result %s\n",
+	    kernel->name, kernel->variant, size,
+	    (double)timer.ns / 1e6 / timer.calls,
+	    (*kernel->check)(s) ? "ok" : "WRONG");
+}
+
+static int
+cryptobench_run(const struct cryptobench_kernel *kernel,
+    struct cryptobench_state *s, const uint32_t *sizes, int size_count,
+    uint32_t min_ms)
+{
+	int i;
+
+	if (kernel->run == cryptobench_run_image) {
+		uint8_t *image = malloc(CRYPTOBENCH_IMAGE_SIZE);
+		uint8_t *data = s->data;
+
+		if (image == NULL) {
+			puts("# image: not enough memory");
+			return -1;
+		}
+		memset(image, 0x5a, CRYPTOBENCH_IMAGE_SIZE);
+		s->data = image;
+		s->size = CRYPTOBENCH_IMAGE_SIZE;
+		cryptobench_measure(kernel, s, CRYPTOBENCH_IMAGE_SIZE / 1024,
+		    min_ms);
+		s->data = data;
+		free(image);
+		return 0;
+	}
+
+	if (!kernel->sized) {
+		s->size = 0;
+		cryptobench_measure(kernel, s, 1, min_ms);
+		return 0;
+	}
+	if (size_count == 0) {
+		sizes = cryptobench_sizes;
+		size_count = (int)RTEMS_ARRAY_SIZE(cryptobench_sizes);
+	}
+	for (i = 0; i < size_count; ++i) {
+		s->size = sizes[i];
+		cryptobench_measure(kernel, s, sizes[i], min_ms);
+	}
+
+	return 0;
+}
+
+static bool
+cryptobench_known(const char *name)
+{
+	size_t i;
+
+	for (i = 0; i < RTEMS_ARRAY_SIZE(cryptobench_kernels); ++i) {
+		if (strcmp(cryptobench_kernels[i].name, name) == 0) {
+			return true;
+		}
+	}
+
+	return strcmp(name, "all") == 0;
+}
+
+static int
+command_crypto(int argc, char *argv[])
+{
+	static struct cryptobench_state s;
+	static uint8_t data[4096];
+	static uint8_t out[4096];
+	uint32_t sizes[BENCH_MAX_SIZES];
+	int size_count = 0;
+	uint32_t min_ms = CRYPTOBENCH_DEFAULT_MIN_MS;
+	int first_kernel = 0;
+	const char *failed;
+	int i;
+
+	for (i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+			++i;
+			size_count = bench_parse_sizes(argv[i], sizes,
+			    BENCH_MAX_SIZES);
+			if (size_count < 0) {
+				break;
+			}
+		} else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+			++i;
+			min_ms = (uint32_t)strtoul(argv[i], NULL, 0);
+		} else if (argv[i][0] != '-') {
+			first_kernel = i;
+			break;
+		} else {
+			break;
+		}
+	}
+
+	if (first_kernel == 0) {
+		puts(shell_CRYPTO_Command.usage);
+		return -1;
+	}
+	for (i = first_kernel; i < argc; ++i) {
+		if (!cryptobench_known(argv[i])) {
+			printf("Unknown kernel: %s\n", argv[i]);
+			return -1;
+		}
+	}
+
+	if (atcac_neon_selftest(&failed) != 0) {
+		printf("Self test failed: %s\n", failed);
+		return -1;
+	}
+	puts("# self test ok");
+
+	for (i = 0; i < (int)sizeof(data); ++i) {
+		data[i] = (uint8_t)(i * 13);
+	}
+	memset(&s, 0, sizeof(s));
+	s.data = data;
+	s.out = out;
+	(void)atcac_neon_aes_init(&s.aes, cryptobench_key,
+	    sizeof(cryptobench_key));
+
+	bench_result_print_header();
+	for (i = first_kernel; i < argc; ++i) {
+		bool all = strcmp(argv[i], "all") == 0;
+		size_t k;
+
+		for (k = 0; k < RTEMS_ARRAY_SIZE(cryptobench_kernels); ++k) {
+			const struct cryptobench_kernel *kernel =
+			    &cryptobench_kernels[k];
+
+			if ((all || strcmp(kernel->name, argv[i]) == 0) &&
+			    cryptobench_run(kernel, &s, sizes, size_count,
+			    min_ms) != 0) {
+				return -1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+rtems_shell_cmd_t shell_CRYPTO_Command = {
+	.name = "crypto",
+	.usage = "Use with: crypto [-n sizes] [-t ms] kernel...\n"
+	    "Benchmark the software crypto of libcryptoauth-neon after its\n"
+	    "self test: sha (SHA-256, also with cryptoauthlib as atcac), ctr\n"
+	    "(AES-128-CTR), gcm (AES-128-GCM with the tag), verify (P-256\n"
+	    "ECDSA) and image (SHA-256 of 4096 KiB and a verify), or all.\n"
+	    "Sized kernels process -n bytes (default: 64,1024,4096). Each runs\n"
+	    "for at least -t milliseconds (default: 500). The mflops column\n"
+	    "shows MB/s, for verify operations per second.\n",
+	.topic = "bench",
+	.command = command_crypto,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
@@ -0,0 +1,1097 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dspbench.h"
+
+#include <float.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <dsp/dsp.h>
+
+#include "bench.h"
+
+#define DSPBENCH_DEFAULT_MIN_MS 200
+
+#define DSPBENCH_TAPS 64
+#define DSPBENCH_FACTOR 4
+#define DSPBENCH_SECTIONS 4
+#define DSPBENCH_CUTOFF 0.1
+
+/* The reference DFT is O(n^2), check only some bins of longer transforms */
+#define DSPBENCH_DFT_BINS 256
+
+enum dspbench_format {
+	DSPBENCH_F32,
+	DSPBENCH_Q15,
+	DSPBENCH_Q31,
+};
+
+enum dspbench_error {
+	/* Absolute, full scale is 1 */
+	DSPBENCH_ERROR_ABS,
+	/* Relative to the largest value of the reference */
+	DSPBENCH_ERROR_REL,
+	/* Units in the last place of the float result */
+	DSPBENCH_ERROR_ULP,
+};
+
+struct dspbench_coeffs {
+	float fir_f32[DSPBENCH_TAPS];
+	dsp_q15 fir_q15[DSPBENCH_TAPS];
+	dsp_q31 fir_q31[DSPBENCH_TAPS];
+	/* The fixed point ones are scaled by 2^-1 for a post shift of 1 */
+	float biquad_f32[5 * DSPBENCH_SECTIONS];
+	dsp_q15 biquad_q15[5 * DSPBENCH_SECTIONS];
+	dsp_q31 biquad_q31[5 * DSPBENCH_SECTIONS];
+};
+
+struct dspbench_buffers {
+	uint32_t n;
+	enum dspbench_format format;
+	float *in_f32;
+	float *out_f32;
+	float *state_f32;
+	dsp_q15 *in_q15;
+	dsp_q15 *out_q15;
+	dsp_q15 *state_q15;
+	dsp_q31 *in_q31;
+	dsp_q31 *out_q31;
+	dsp_q31 *state_q31;
+	/* Input and output of the reference */
+	double *ref_in;
+	double *ref_out;
+	union {
+		struct dsp_fir_f32 fir_f32;
+		struct dsp_fir_q15 fir_q15;
+		struct dsp_fir_q31 fir_q31;
+		struct dsp_decimate_f32 decimate_f32;
+		struct dsp_decimate_q15 decimate_q15;
+		struct dsp_biquad_f32 biquad_f32;
+		struct dsp_biquad_q15 biquad_q15;
+		struct dsp_biquad_q31 biquad_q31;
+		struct dsp_rfft_f32 rfft;
+	} u;
+};
+
+struct dspbench_kernel {
+	const char *name;
+	const char *variant;
+	enum dspbench_format format;
+	uint32_t default_sizes[BENCH_MAX_SIZES];
+	/* Interleaved channels of the input */
+	uint32_t channels;
+	enum dspbench_error error;
+	/* Set up the filter with a cleared state, returns false on errors */
+	bool (*init)(struct dspbench_buffers *buf);
+	void (*run)(struct dspbench_buffers *buf);
+	/* Compute the reference output, returns the count of output values */
+	uint32_t (*reference)(struct dspbench_buffers *buf);
+	/* Operations per input sample (per frame for several channels) */
+	double (*flops)(uint32_t n);
+};
+
+static struct dspbench_coeffs dspbench_coeffs;
+
+/* Hamming windowed sinc low-pass */
+static void
+dspbench_design_fir(void)
+{
+	struct dspbench_coeffs *c = &dspbench_coeffs;
+	double h[DSPBENCH_TAPS];
+	float w[DSPBENCH_TAPS];
+	double sum = 0.0;
+	int k;
+
+	dsp_window_f32(DSP_WINDOW_HAMMING, w, DSPBENCH_TAPS);
+	for (k = 0; k < DSPBENCH_TAPS; ++k) {
+		double t = k - (DSPBENCH_TAPS - 1) / 2.0;
+		double x = 2.0 * M_PI * DSPBENCH_CUTOFF * t;
+
+		h[k] = 2.0 * DSPBENCH_CUTOFF * sin(x) / x * w[k];
+		sum += h[k];
+	}
+	for (k = 0; k < DSPBENCH_TAPS; ++k) {
+		c->fir_f32[k] = (float)(h[k] / sum);
+	}
+	dsp_f32_to_q15(c->fir_f32, c->fir_q15, DSPBENCH_TAPS);
+	dsp_f32_to_q31(c->fir_f32, c->fir_q31, DSPBENCH_TAPS);
+}
+
+/* Butterworth low-pass as cascade with increasing Q */
+static void
+dspbench_design_biquad(void)
+{
+	struct dspbench_coeffs *c = &dspbench_coeffs;
+	float half[5 * DSPBENCH_SECTIONS];
+	double w0 = 2.0 * M_PI * DSPBENCH_CUTOFF;
+	int s;
+	int k;
+
+	for (s = 0; s < DSPBENCH_SECTIONS; ++s) {
+		double theta = M_PI * (2 * s + 1) / (4.0 * DSPBENCH_SECTIONS);
+		double q = 1.0 / (2.0 * cos(theta));
+		double alpha = sin(w0) / (2.0 * q);
+		double a0 = 1.0 + alpha;
+		float *b = &c->biquad_f32[5 * s];
+
+		b[0] = (float)((1.0 - cos(w0)) / 2.0 / a0);
+		b[1] = (float)((1.0 - cos(w0)) / a0);
+		b[2] = b[0];
+		b[3] = (float)(-2.0 * cos(w0) / a0);
+		b[4] = (float)((1.0 - alpha) / a0);
+	}
+	for (k = 0; k < 5 * DSPBENCH_SECTIONS; ++k) {
+		half[k] = c->biquad_f32[k] / 2.0f;
+	}
+	dsp_f32_to_q15(half, c->biquad_q15, 5 * DSPBENCH_SECTIONS);
+	dsp_f32_to_q31(half, c->biquad_q31, 5 * DSPBENCH_SECTIONS);
+}
+
+static double
+dspbench_to_double(const struct dspbench_buffers *buf, bool output,
+    uint32_t i)
+{
+	switch (buf->format) {
+	case DSPBENCH_Q15:
+		return (output ? buf->out_q15 : buf->in_q15)[i] / 32768.0;
+	case DSPBENCH_Q31:
+		return (output ? buf->out_q31 : buf->in_q31)[i] / 2147483648.0;
+	default:
+		return (output ? buf->out_f32 : buf->in_f32)[i];
+	}
+}
+
+static void
+dspbench_fir_coeffs(enum dspbench_format format, double *c)
+{
+	int k;
+
+	for (k = 0; k < DSPBENCH_TAPS; ++k) {
+		switch (format) {
+		case DSPBENCH_Q15:
+			c[k] = dspbench_coeffs.fir_q15[k] / 32768.0;
+			break;
+		case DSPBENCH_Q31:
+			c[k] = dspbench_coeffs.fir_q31[k] / 2147483648.0;
+			break;
+		default:
+			c[k] = dspbench_coeffs.fir_f32[k];
+			break;
+		}
+	}
+}
+
+static void
+dspbench_reference_fir(const struct dspbench_buffers *buf, double *y)
+{
+	double c[DSPBENCH_TAPS];
+	uint32_t i;
+
+	dspbench_fir_coeffs(buf->format, c);
+	for (i = 0; i < buf->n; ++i) {
+		double acc = 0.0;
+		uint32_t k;
+
+		for (k = 0; k < DSPBENCH_TAPS && k <= i; ++k) {
+			acc += c[k] * buf->ref_in[i - k];
+		}
+		y[i] = acc;
+	}
+}
+
+static bool
+dspbench_init_fir_f32(struct dspbench_buffers *buf)
+{
+	dsp_fir_f32_init(&buf->u.fir_f32, dspbench_coeffs.fir_f32,
+	    DSPBENCH_TAPS, buf->state_f32, buf->n);
+	return true;
+}
+
+static void
+dspbench_run_fir_f32(struct dspbench_buffers *buf)
+{
+	dsp_fir_f32(&buf->u.fir_f32, buf->in_f32, buf->out_f32, buf->n);
+}
+
+static bool
+dspbench_init_fir_q15(struct dspbench_buffers *buf)
+{
+	dsp_fir_q15_init(&buf->u.fir_q15, dspbench_coeffs.fir_q15,
+	    DSPBENCH_TAPS, buf->state_q15, buf->n);
+	return true;
+}
+
+static void
+dspbench_run_fir_q15(struct dspbench_buffers *buf)
+{
+	dsp_fir_q15(&buf->u.fir_q15, buf->in_q15, buf->out_q15, buf->n);
+}
+
+static bool
+dspbench_init_fir_q31(struct dspbench_buffers *buf)
+{
+	dsp_fir_q31_init(&buf->u.fir_q31, dspbench_coeffs.fir_q31,
+	    DSPBENCH_TAPS, buf->state_q31, buf->n);
+	return true;
+}
+
+static void
+dspbench_run_fir_q31(struct dspbench_buffers *buf)
+{
+	dsp_fir_q31(&buf->u.fir_q31, buf->in_q31, buf->out_q31, buf->n);
+}
+
+static uint32_t
+dspbench_reference_fir_all(struct dspbench_buffers *buf)
+{
+	dspbench_reference_fir(buf, buf->ref_out);
+	return buf->n;
+}
+
+static double
+dspbench_flops_fir(uint32_t n)
+{
+	(void)n;
+	return 2.0 * DSPBENCH_TAPS;
+}
+
+static bool
+dspbench_init_decimate_f32(struct dspbench_buffers *buf)
+{
+	dsp_decimate_f32_init(&buf->u.decimate_f32, DSPBENCH_FACTOR,
+	    dspbench_coeffs.fir_f32, DSPBENCH_TAPS, buf->state_f32, buf->n);
+	return true;
+}
+
+static void
+dspbench_run_decimate_f32(struct dspbench_buffers *buf)
+{
+	dsp_decimate_f32(&buf->u.decimate_f32, buf->in_f32, buf->out_f32,
+	    buf->n);
+}
+
+static bool
+dspbench_init_decimate_q15(struct dspbench_buffers *buf)
+{
+	dsp_decimate_q15_init(&buf->u.decimate_q15, DSPBENCH_FACTOR,
+	    dspbench_coeffs.fir_q15, DSPBENCH_TAPS, buf->state_q15, buf->n);
+	return true;
+}
+
+static void
+dspbench_run_decimate_q15(struct dspbench_buffers *buf)
+{
+	dsp_decimate_q15(&buf->u.decimate_q15, buf->in_q15, buf->out_q15,
+	    buf->n);
+}
+
+/* The decimator keeps the outputs 0, factor, 2 factor, ... of the filter */
+static uint32_t
+dspbench_reference_decimate(struct dspbench_buffers *buf)
+{
+	uint32_t count = buf->n / DSPBENCH_FACTOR;
+	uint32_t i;
+
+	dspbench_reference_fir(buf, buf->ref_out);
+	for (i = 0; i < count; ++i) {
+		buf->ref_out[i] = buf->ref_out[i * DSPBENCH_FACTOR];
+	}
+
+	return count;
+}
+
+static double
+dspbench_flops_decimate(uint32_t n)
+{
+	(void)n;
+	return 2.0 * DSPBENCH_TAPS / DSPBENCH_FACTOR;
+}
+
+static bool
+dspbench_init_biquad_f32(struct dspbench_buffers *buf)
+{
+	dsp_biquad_f32_init(&buf->u.biquad_f32, dspbench_coeffs.biquad_f32,
+	    DSPBENCH_SECTIONS, buf->state_f32);
+	return true;
+}
+
+static void
+dspbench_run_biquad_f32(struct dspbench_buffers *buf)
+{
+	dsp_biquad_f32(&buf->u.biquad_f32, buf->in_f32, buf->out_f32, buf->n);
+}
+
+static bool
+dspbench_init_biquad_f32x4(struct dspbench_buffers *buf)
+{
+	dsp_biquad_f32x4_init(&buf->u.biquad_f32, dspbench_coeffs.biquad_f32,
+	    DSPBENCH_SECTIONS, buf->state_f32);
+	return true;
+}
+
+static void
+dspbench_run_biquad_f32x4(struct dspbench_buffers *buf)
+{
+	dsp_biquad_f32x4(&buf->u.biquad_f32, buf->in_f32, buf->out_f32,
+	    buf->n);
+}
+
+static bool
+dspbench_init_biquad_q15(struct dspbench_buffers *buf)
+{
+	dsp_biquad_q15_init(&buf->u.biquad_q15, dspbench_coeffs.biquad_q15,
+	    DSPBENCH_SECTIONS, 1, buf->state_q15);
+	return true;
+}
+
+static void
+dspbench_run_biquad_q15(struct dspbench_buffers *buf)
+{
+	dsp_biquad_q15(&buf->u.biquad_q15, buf->in_q15, buf->out_q15, buf->n);
+}
+
+static bool
+dspbench_init_biquad_q31(struct dspbench_buffers *buf)
+{
+	dsp_biquad_q31_init(&buf->u.biquad_q31, dspbench_coeffs.biquad_q31,
+	    DSPBENCH_SECTIONS, 1, buf->state_q31);
+	return true;
+}
+
+static void
+dspbench_run_biquad_q31(struct dspbench_buffers *buf)
+{
+	dsp_biquad_q31(&buf->u.biquad_q31, buf->in_q31, buf->out_q31, buf->n);
+}
+
+/* Direct form I in double for every channel of the input */
+static void
+dspbench_reference_biquad_channels(struct dspbench_buffers *buf,
+    uint32_t channels)
+{
+	double c[5 * DSPBENCH_SECTIONS];
+	uint32_t ch;
+	int k;
+
+	for (k = 0; k < 5 * DSPBENCH_SECTIONS; ++k) {
+		switch (buf->format) {
+		case DSPBENCH_Q15:
+			c[k] = dspbench_coeffs.biquad_q15[k] / 16384.0;
+			break;
+		case DSPBENCH_Q31:
+			c[k] = dspbench_coeffs.biquad_q31[k] / 1073741824.0;
+			break;
+		default:
+			c[k] = dspbench_coeffs.biquad_f32[k];
+			break;
+		}
+	}
+
+	for (ch = 0; ch < channels; ++ch) {
+		double state[DSPBENCH_SECTIONS][4];
+		uint32_t i;
+
+		memset(state, 0, sizeof(state));
+		for (i = 0; i < buf->n; ++i) {
+			double x = buf->ref_in[i * channels + ch];
+			int s;
+
+			for (s = 0; s < DSPBENCH_SECTIONS; ++s) {
+				const double *b = &c[5 * s];
+				double *z = state[s];
+				double y = b[0] * x + b[1] * z[0] + b[2] * z[1] -
+				    b[3] * z[2] - b[4] * z[3];
+
+				z[1] = z[0];
+				z[0] = x;
+				z[3] = z[2];
+				z[2] = y;
+				x = y;
+			}
+			buf->ref_out[i * channels + ch] = x;
+		}
+	}
+}
+
+static uint32_t
+dspbench_reference_biquad(struct dspbench_buffers *buf)
+{
+	dspbench_reference_biquad_channels(buf, 1);
+	return buf->n;
+}
+
+static uint32_t
+dspbench_reference_biquad_x4(struct dspbench_buffers *buf)
+{
+	dspbench_reference_biquad_channels(buf, 4);
+	return 4 * buf->n;
+}
+
+static double
+dspbench_flops_biquad(uint32_t n)
+{
+	(void)n;
+	return 9.0 * DSPBENCH_SECTIONS;
+}
+
+static double
+dspbench_flops_biquad_x4(uint32_t n)
+{
+	return 4.0 * dspbench_flops_biquad(n);
+}
+
+static bool
+dspbench_init_rfft(struct dspbench_buffers *buf)
+{
+	return dsp_rfft_f32_init(&buf->u.rfft, buf->n) == 0;
+}
+
+static void
+dspbench_run_rfft(struct dspbench_buffers *buf)
+{
+	dsp_rfft_f32(&buf->u.rfft, buf->in_f32, buf->out_f32);
+}
+
+/*
+ * DFT of some bins in the packed format of dsp_rfft_f32(). Bins that are not
+ * checked are copied from the output, so they have no error.
+ */
+static uint32_t
+dspbench_reference_rfft(struct dspbench_buffers *buf)
+{
+	uint32_t n = buf->n;
+	uint32_t step = n / 2 > DSPBENCH_DFT_BINS ? n / 2 / DSPBENCH_DFT_BINS :
+	    1;
+	uint32_t k;
+
+	for (k = 0; k < n; ++k) {
+		buf->ref_out[k] = buf->out_f32[k];
+	}
+
+	for (k = 0; k <= n / 2; k += step) {
+		double re = 0.0;
+		double im = 0.0;
+		uint32_t j;
+
+		for (j = 0; j < n; ++j) {
+			double a = -2.0 * M_PI *
+			    (double)(((uint64_t)j * k) % n) / n;
+
+			re += buf->ref_in[j] * cos(a);
+			im += buf->ref_in[j] * sin(a);
+		}
+		if (k == 0) {
+			buf->ref_out[0] = re;
+		} else if (k == n / 2) {
+			buf->ref_out[1] = re;
+		} else {
+			buf->ref_out[2 * k] = re;
+			buf->ref_out[2 * k + 1] = im;
+		}
+	}
+
+	return n;
+}
+
+static double
+dspbench_flops_rfft(uint32_t n)
+{
+	/* The usual 2.5 n log2(n) of a real FFT, per sample */
+	return 2.5 * log2((double)n);
+}
+
+/*
+ * The math functions get inputs of a typical range. The init functions set
+ * them up from the random values every time, so they can be called again.
+ */
+static void
+dspbench_math_input(struct dspbench_buffers *buf, uint32_t count,
+    double (*map)(double x))
+{
+	uint32_t i;
+
+	bench_fill_float(buf->in_f32, count, 1);
+	for (i = 0; i < count; ++i) {
+		buf->in_f32[i] = (float)(*map)(buf->in_f32[i]);
+		buf->ref_in[i] = buf->in_f32[i];
+	}
+}
+
+static double
+dspbench_map_exp(double x)
+{
+	return 170.0 * x;
+}
+
+static double
+dspbench_map_log(double x)
+{
+	return exp2(60.0 * x);
+}
+
+static double
+dspbench_map_sin(double x)
+{
+	return 200.0 * x;
+}
+
+static double
+dspbench_map_atan2(double x)
+{
+	return 8.0 * x;
+}
+
+static bool
+dspbench_init_exp(struct dspbench_buffers *buf)
+{
+	dspbench_math_input(buf, buf->n, dspbench_map_exp);
+	return true;
+}
+
+static bool
+dspbench_init_log(struct dspbench_buffers *buf)
+{
+	dspbench_math_input(buf, buf->n, dspbench_map_log);
+	return true;
+}
+
+static bool
+dspbench_init_sin(struct dspbench_buffers *buf)
+{
+	dspbench_math_input(buf, buf->n, dspbench_map_sin);
+	return true;
+}
+
+/* y in the first half of the input, x in the second */
+static bool
+dspbench_init_atan2(struct dspbench_buffers *buf)
+{
+	dspbench_math_input(buf, 2 * buf->n, dspbench_map_atan2);
+	return true;
+}
+
+static void
+dspbench_run_exp(struct dspbench_buffers *buf)
+{
+	dsp_exp_f32(buf->in_f32, buf->out_f32, buf->n);
+}
+
+static void
+dspbench_run_exp_libm(struct dspbench_buffers *buf)
+{
+	uint32_t i;
+
+	for (i = 0; i < buf->n; ++i) {
+		buf->out_f32[i] = expf(buf->in_f32[i]);
+	}
+}
+
+static void
+dspbench_run_log(struct dspbench_buffers *buf)
+{
+	dsp_log_f32(buf->in_f32, buf->out_f32, buf->n);
+}
+
+static void
+dspbench_run_log_libm(struct dspbench_buffers *buf)
+{
+	uint32_t i;
+
+	for (i = 0; i < buf->n; ++i) {
+		buf->out_f32[i] = logf(buf->in_f32[i]);
+	}
+}
+
+static void
+dspbench_run_sin(struct dspbench_buffers *buf)
+{
+	dsp_sin_f32(buf->in_f32, buf->out_f32, buf->n);
+}
+
+static void
+dspbench_run_sin_libm(struct dspbench_buffers *buf)
+{
+	uint32_t i;
+
+	for (i = 0; i < buf->n; ++i) {
+		buf->out_f32[i] = sinf(buf->in_f32[i]);
+	}
+}
+
+static void
+dspbench_run_cos(struct dspbench_buffers *buf)
+{
+	dsp_cos_f32(buf->in_f32, buf->out_f32, buf->n);
+}
+
+static void
+dspbench_run_cos_libm(struct dspbench_buffers *buf)
+{
+	uint32_t i;
+
+	for (i = 0; i < buf->n; ++i) {
+		buf->out_f32[i] = cosf(buf->in_f32[i]);
+	}
+}
+
+static void
+dspbench_run_atan2(struct dspbench_buffers *buf)
+{
+	dsp_atan2_f32(buf->in_f32, buf->in_f32 + buf->n, buf->out_f32,
+	    buf->n);
+}
+
+static void
+dspbench_run_atan2_libm(struct dspbench_buffers *buf)
+{
+	const float *y = buf->in_f32;
+	const float *x = buf->in_f32 + buf->n;
+	uint32_t i;
+
+	for (i = 0; i < buf->n; ++i) {
+		buf->out_f32[i] = atan2f(y[i], x[i]);
+	}
+}
+
+static uint32_t
+dspbench_reference_math(struct dspbench_buffers *buf, double (*fn)(double x))
+{
+	uint32_t i;
+
+	for (i = 0; i < buf->n; ++i) {
+		buf->ref_out[i] = (*fn)(buf->ref_in[i]);
+	}
+
+	return buf->n;
+}
+
+static uint32_t
+dspbench_reference_exp(struct dspbench_buffers *buf)
+{
+	return dspbench_reference_math(buf, exp);
+}
+
+static uint32_t
+dspbench_reference_log(struct dspbench_buffers *buf)
+{
+	return dspbench_reference_math(buf, log);
+}
+
+static uint32_t
+dspbench_reference_sin(struct dspbench_buffers *buf)
+{
+	return dspbench_reference_math(buf, sin);
+}
+
+static uint32_t
+dspbench_reference_cos(struct dspbench_buffers *buf)
+{
+	return dspbench_reference_math(buf, cos);
+}
+
+static uint32_t
+dspbench_reference_atan2(struct dspbench_buffers *buf)
+{
+	uint32_t i;
+
+	for (i = 0; i < buf->n; ++i) {
+		buf->ref_out[i] = atan2(buf->ref_in[i], buf->ref_in[buf->n + i]);
+	}
+
+	return buf->n;
+}
+
+/* Values per call, the MFLOPS are millions of values per second */
+static double
+dspbench_flops_math(uint32_t n)
+{
+	(void)n;
+	return 1.0;
+}
+
+static const struct dspbench_kernel dspbench_kernels[] = {
+	{ "fir", "f32", DSPBENCH_F32, { 64, 256, 1024 },
+	    1, DSPBENCH_ERROR_ABS,
+	    dspbench_init_fir_f32, dspbench_run_fir_f32,
+	    dspbench_reference_fir_all, dspbench_flops_fir },
+	{ "fir", "q15", DSPBENCH_Q15, { 64, 256, 1024 },
+	    1, DSPBENCH_ERROR_ABS,
+	    dspbench_init_fir_q15, dspbench_run_fir_q15,
+	    dspbench_reference_fir_all, dspbench_flops_fir },
+	{ "fir", "q31", DSPBENCH_Q31, { 64, 256, 1024 },
+	    1, DSPBENCH_ERROR_ABS,
+	    dspbench_init_fir_q31, dspbench_run_fir_q31,
+	    dspbench_reference_fir_all, dspbench_flops_fir },
+	{ "decimate", "f32", DSPBENCH_F32, { 64, 256, 1024 },
+	    1, DSPBENCH_ERROR_ABS,
+	    dspbench_init_decimate_f32, dspbench_run_decimate_f32,
+	    dspbench_reference_decimate, dspbench_flops_decimate },
+	{ "decimate", "q15", DSPBENCH_Q15, { 64, 256, 1024 },
+	    1, DSPBENCH_ERROR_ABS,
+	    dspbench_init_decimate_q15, dspbench_run_decimate_q15,
+	    dspbench_reference_decimate, dspbench_flops_decimate },
+	{ "biquad", "f32", DSPBENCH_F32, { 64, 256, 1024 },
+	    1, DSPBENCH_ERROR_ABS,
+	    dspbench_init_biquad_f32, dspbench_run_biquad_f32,
+	    dspbench_reference_biquad, dspbench_flops_biquad },
+	{ "biquad", "f32x4", DSPBENCH_F32, { 64, 256, 1024 },
+	    4, DSPBENCH_ERROR_ABS,
+	    dspbench_init_biquad_f32x4, dspbench_run_biquad_f32x4,
+	    dspbench_reference_biquad_x4, dspbench_flops_biquad_x4 },
+	{ "biquad", "q15", DSPBENCH_Q15, { 64, 256, 1024 },
+	    1, DSPBENCH_ERROR_ABS,
+	    dspbench_init_biquad_q15, dspbench_run_biquad_q15,
+	    dspbench_reference_biquad, dspbench_flops_biquad },
+	{ "biquad", "q31", DSPBENCH_Q31, { 64, 256, 1024 },
+	    1, DSPBENCH_ERROR_ABS,
+	    dspbench_init_biquad_q31, dspbench_run_biquad_q31,
+	    dspbench_reference_biquad, dspbench_flops_biquad },
+	{ "rfft", "f32", DSPBENCH_F32, { 64, 256, 1024, 4096 },
+	    1, DSPBENCH_ERROR_REL,
+	    dspbench_init_rfft, dspbench_run_rfft,
+	    dspbench_reference_rfft, dspbench_flops_rfft },
+	{ "exp", "f32", DSPBENCH_F32, { 256, 1024, 4096 },
+	    1, DSPBENCH_ERROR_ULP,
+	    dspbench_init_exp, dspbench_run_exp,
+	    dspbench_reference_exp, dspbench_flops_math },
+	{ "exp", "libm", DSPBENCH_F32, { 256, 1024, 4096 },
+	    1, DSPBENCH_ERROR_ULP,
+	    dspbench_init_exp, dspbench_run_exp_libm,
+	    dspbench_reference_exp, dspbench_flops_math },
+	{ "log", "f32", DSPBENCH_F32, { 256, 1024, 4096 },
+	    1, DSPBENCH_ERROR_ULP,
+	    dspbench_init_log, dspbench_run_log,
+	    dspbench_reference_log, dspbench_flops_math },
+	{ "log", "libm", DSPBENCH_F32, { 256, 1024, 4096 },
+	    1, DSPBENCH_ERROR_ULP,
+	    dspbench_init_log, dspbench_run_log_libm,
+	    dspbench_reference_log, dspbench_flops_math },
+	{ "sin", "f32", DSPBENCH_F32, { 256, 1024, 4096 },
+	    1, DSPBENCH_ERROR_ULP,
+	    dspbench_init_sin, dspbench_run_sin,
+	    dspbench_reference_sin, dspbench_flops_math },
+	{ "sin", "libm", DSPBENCH_F32, { 256, 1024, 4096 },
+	    1, DSPBENCH_ERROR_ULP,
+	    dspbench_init_sin, dspbench_run_sin_libm,
+	    dspbench_reference_sin, dspbench_flops_math },
+	{ "cos", "f32", DSPBENCH_F32, { 256, 1024, 4096 },
+	    1, DSPBENCH_ERROR_ULP,
+	    dspbench_init_sin, dspbench_run_cos,
+	    dspbench_reference_cos, dspbench_flops_math },
+	{ "cos", "libm", DSPBENCH_F32, { 256, 1024, 4096 },
+	    1, DSPBENCH_ERROR_ULP,
+	    dspbench_init_sin, dspbench_run_cos_libm,
+	    dspbench_reference_cos, dspbench_flops_math },
+	{ "atan2", "f32", DSPBENCH_F32, { 256, 1024, 4096 },
+	    2, DSPBENCH_ERROR_ULP,
+	    dspbench_init_atan2, dspbench_run_atan2,
+	    dspbench_reference_atan2, dspbench_flops_math },
+	{ "atan2", "libm", DSPBENCH_F32, { 256, 1024, 4096 },
+	    2, DSPBENCH_ERROR_ULP,
+	    dspbench_init_atan2, dspbench_run_atan2_libm,
+	    dspbench_reference_atan2, dspbench_flops_math },
+};
+
+static void
+dspbench_free(struct dspbench_buffers *buf)
+{
+	free(buf->in_f32);
+	free(buf->out_f32);
+	free(buf->state_f32);
+	free(buf->in_q15);
+	free(buf->out_q15);
+	free(buf->state_q15);
+	free(buf->in_q31);
+	free(buf->out_q31);
+	free(buf->state_q31);
+	free(buf->ref_in);
+	free(buf->ref_out);
+}
+
+static bool
+dspbench_alloc(struct dspbench_buffers *buf,
+    const struct dspbench_kernel *kernel, uint32_t n)
+{
+	size_t count = (size_t)n * kernel->channels;
+	/* Enough for the FIR and the biquad cascades */
+	size_t state = DSP_FIR_STATE_SIZE(DSPBENCH_TAPS, n) +
+	    8 * DSPBENCH_SECTIONS;
+	uint32_t i;
+
+	memset(buf, 0, sizeof(*buf));
+	buf->n = n;
+	buf->format = kernel->format;
+	buf->in_f32 = malloc(count * sizeof(float));
+	buf->out_f32 = malloc(count * sizeof(float));
+	buf->state_f32 = malloc(state * sizeof(float));
+	buf->in_q15 = malloc(count * sizeof(dsp_q15));
+	buf->out_q15 = malloc(count * sizeof(dsp_q15));
+	buf->state_q15 = malloc(state * sizeof(dsp_q15));
+	buf->in_q31 = malloc(count * sizeof(dsp_q31));
+	buf->out_q31 = malloc(count * sizeof(dsp_q31));
+	buf->state_q31 = malloc(state * sizeof(dsp_q31));
+	buf->ref_in = malloc(count * sizeof(double));
+	buf->ref_out = malloc(count * sizeof(double));
+	if (buf->in_f32 == NULL || buf->out_f32 == NULL ||
+	    buf->state_f32 == NULL || buf->in_q15 == NULL ||
+	    buf->out_q15 == NULL || buf->state_q15 == NULL ||
+	    buf->in_q31 == NULL || buf->out_q31 == NULL ||
+	    buf->state_q31 == NULL || buf->ref_in == NULL ||
+	    buf->ref_out == NULL) {
+		dspbench_free(buf);
+		return false;
+	}
+
+	bench_fill_float(buf->in_f32, count, 1);
+	dsp_f32_to_q15(buf->in_f32, buf->in_q15, (uint32_t)count);
+	dsp_f32_to_q31(buf->in_f32, buf->in_q31, (uint32_t)count);
+	for (i = 0; i < count; ++i) {
+		buf->ref_in[i] = dspbench_to_double(buf, false, i);
+	}
+
+	return true;
+}
+
+/* Results below FLT_MIN are flushed to zero and count as exact */
+static double
+dspbench_ulp_error(double value, double reference)
+{
+	int exponent;
+
+	if (fabs(reference) < FLT_MIN) {
+		return fabs(value) < FLT_MIN ? 0.0 :
+		    fabs(value - reference) / ldexp(1.0, -149);
+	}
+	(void)frexp(reference, &exponent);
+
+	return fabs(value - reference) / ldexp(1.0, exponent - 24);
+}
+
+/* Maximum error of one block from a cleared state, relative for the FFT */
+static double
+dspbench_error(const struct dspbench_kernel *kernel,
+    struct dspbench_buffers *buf)
+{
+	uint32_t count;
+	double max_error = 0.0;
+	double max_value = 0.0;
+	uint32_t i;
+
+	(*kernel->run)(buf);
+	count = (*kernel->reference)(buf);
+	for (i = 0; i < count; ++i) {
+		double value = dspbench_to_double(buf, true, i);
+		double error = kernel->error == DSPBENCH_ERROR_ULP ?
+		    dspbench_ulp_error(value, buf->ref_out[i]) :
+		    fabs(value - buf->ref_out[i]);
+
+		if (error > max_error) {
+			max_error = error;
+		}
+		if (fabs(buf->ref_out[i]) > max_value) {
+			max_value = fabs(buf->ref_out[i]);
+		}
+	}
+
+	if (kernel->error == DSPBENCH_ERROR_REL && max_value > 0.0) {
+		max_error /= max_value;
+	}
+
+	return max_error;
+}
+
+static int
+dspbench_run(const struct dspbench_kernel *kernel, const uint32_t *sizes,
+    int size_count, uint32_t min_ms)
+{
+	int i;
+
+	if (size_count == 0) {
+		sizes = kernel->default_sizes;
+		while (size_count < BENCH_MAX_SIZES &&
+		    kernel->default_sizes[size_count] != 0) {
+			++size_count;
+		}
+	}
+
+	for (i = 0; i < size_count; ++i) {
+		struct dspbench_buffers buf;
+		struct bench_timer timer = { 0 };
+		uint32_t n = sizes[i];
+		double error;
+
+		if (kernel->run == dspbench_run_rfft &&
+		    (n < 16 || n > 65536 || (n & (n - 1)) != 0)) {
+			printf("# %s %s %" PRIu32 ": Size must be a power of "
+			    "two from 16 to 65536\n", kernel->name,
+			    kernel->variant, n);
+			continue;
+		}
+		if (n % DSPBENCH_FACTOR != 0 &&
+		    kernel->reference == dspbench_reference_decimate) {
+			printf("# %s %s %" PRIu32 ": Size must be a multiple "
+			    "of %d\n", kernel->name, kernel->variant, n,
+			    DSPBENCH_FACTOR);
+			continue;
+		}
+
+		if (!dspbench_alloc(&buf, kernel, n) ||
+		    !(*kernel->init)(&buf)) {
+			printf("%s %s %" PRIu32 ": Not enough memory\n",
+			    kernel->name, kernel->variant, n);
+			return -1;
+		}
+
+		/* Warm up the caches */
+		(*kernel->run)(&buf);
+
+		while (bench_timer_more(&timer, min_ms)) {
+			bench_timer_start(&timer);
+			(*kernel->run)(&buf);
+			bench_timer_stop(&timer);
+		}
+		bench_result_print(bench_result_add(kernel->name,
+		    kernel->variant, n, (*kernel->flops)(n) * n, n, &timer));
+
+		/* The FFT has no state, everything else starts again */
+		if (kernel->run == dspbench_run_rfft ||
+		    (*kernel->init)(&buf)) {
+			error = dspbench_error(kernel, &buf);
+			printf("# %s %s %" PRIu32 ": max error %.3g\n",
+			    kernel->name, kernel->variant, n, error);
+		}
+
+		if (kernel->run == dspbench_run_rfft) {
+			dsp_rfft_f32_destroy(&buf.u.rfft);
+		}
+		dspbench_free(&buf);
+	}
+
+	return 0;
+}
+
+static bool
+dspbench_known(const char *name)
+{
+	size_t i;
+
+	for (i = 0; i < RTEMS_ARRAY_SIZE(dspbench_kernels); ++i) {
+		if (strcmp(dspbench_kernels[i].name, name) == 0) {
+			return true;
+		}
+	}
+
+	return strcmp(name, "all") == 0;
+}
+
+static int
+command_dsp(int argc, char *argv[])
+{
+	uint32_t sizes[BENCH_MAX_SIZES];
+	int size_count = 0;
+	uint32_t min_ms = DSPBENCH_DEFAULT_MIN_MS;
+	int first_kernel = 0;
+	int i;
+
+	for (i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+			++i;
+			size_count = bench_parse_sizes(argv[i], sizes,
+			    BENCH_MAX_SIZES);
+			if (size_count < 0) {
+				break;
+			}
+		} else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+			++i;
+			min_ms = (uint32_t)strtoul(argv[i], NULL, 0);
+		} else if (argv[i][0] != '-') {
+			first_kernel = i;
+			break;
+		} else {
+			break;
+		}
+	}
+
+	if (first_kernel == 0) {
+		puts(shell_DSP_Command.usage);
+		return -1;
+	}
+	for (i = first_kernel; i < argc; ++i) {
+		if (!dspbench_known(argv[i])) {
+			printf("Unknown kernel: %s\n", argv[i]);
+			return -1;
+		}
+	}
+
+	dspbench_design_fir();
+	dspbench_design_biquad();
+
+	bench_result_print_header();
+	for (i = first_kernel; i < argc; ++i) {
+		bool all = strcmp(argv[i], "all") == 0;
+		size_t k;
+
+		for (k = 0; k < RTEMS_ARRAY_SIZE(dspbench_kernels); ++k) {
+			const struct dspbench_kernel *kernel =
+			    &dspbench_kernels[k];
+
+			if ((all || strcmp(kernel->name, argv[i]) == 0) &&
+			    dspbench_run(kernel, sizes, size_count,
+			    min_ms) != 0) {
+				return -1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+rtems_shell_cmd_t shell_DSP_Command = {
+	.name = "dsp",
+	.usage = "Use with: dsp [-n sizes] [-t ms] kernel...\n"
+	    "Benchmark libdsp (fir, decimate, biquad, rfft, exp, log, sin,\n"
+	    "cos, atan2 or all) in all formats for a sweep of block sizes\n"
+	    "(-n 64,256 instead of the defaults). The FIR has 64 taps, the\n"
+	    "decimator a factor of 4 and the biquad cascade 4 sections. The\n"
+	    "math functions run against the scalar ones of libm. Each size\n"
+	    "runs for at least -t milliseconds (default: 200). Prints MFLOPS\n"
+	    "(operations for fixed point, values for the math functions) and\n"
+	    "cycles per input sample, followed by the maximum error of one\n"
+	    "block against a double precision reference (in ulp for the math\n"
+	    "functions).\n",
+	.topic = "bench",
+	.command = command_dsp,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
@@ -0,0 +1,427 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "smallmatbench.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <cblas.h>
+#include <lapacke.h>
+#include <smallmat.hpp>
+
+#include "bench.h"
+
+namespace {
+
+/* Matrices per measured call, the calls of a few are too short to time */
+constexpr int batch = 16;
+
+constexpr uint32_t default_min_ms = 200;
+
+enum op {
+	OP_MUL,
+	OP_CHOL,
+	OP_SOLVE,
+	OP_INV,
+	OP_COUNT
+};
+
+const char *const op_names[OP_COUNT] = { "mul", "chol", "solve", "inv" };
+
+double
+op_flops(int o, int n)
+{
+	double n3 = (double)n * n * n;
+
+	switch (o) {
+	case OP_MUL:
+		return 2.0 * n3;
+	case OP_CHOL:
+		return n3 / 3.0;
+	case OP_SOLVE:
+		return 2.0 * n3 / 3.0 + 2.0 * n * n;
+	default:
+		return 2.0 * n3;
+	}
+}
+
+/* Keeps the compiler from dropping the results of the measured calls */
+inline void
+barrier(const void *p)
+{
+	__asm__ volatile ("" : : "r" (p) : "memory");
+}
+
+void
+fill(float *x, size_t n, uint32_t seed)
+{
+	bench_fill_float(x, n, seed);
+}
+
+void
+fill(double *x, size_t n, uint32_t seed)
+{
+	bench_fill_double(x, n, seed);
+}
+
+/* The LAPACKE path like an application would use it */
+void
+gemm(int n, const float *a, const float *b, float *c)
+{
+	cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, n, n, n, 1.0f,
+	    a, n, b, n, 0.0f, c, n);
+}
+
+void
+gemm(int n, const double *a, const double *b, double *c)
+{
+	cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, n, n, n, 1.0,
+	    a, n, b, n, 0.0, c, n);
+}
+
+void
+potrf(int n, float *a)
+{
+	(void)LAPACKE_spotrf_work(LAPACK_COL_MAJOR, 'L', n, a, n);
+}
+
+void
+potrf(int n, double *a)
+{
+	(void)LAPACKE_dpotrf_work(LAPACK_COL_MAJOR, 'L', n, a, n);
+}
+
+void
+gesv(int n, float *a, lapack_int *ipiv, float *b)
+{
+	(void)LAPACKE_sgesv_work(LAPACK_COL_MAJOR, n, 1, a, n, ipiv, b, n);
+}
+
+void
+gesv(int n, double *a, lapack_int *ipiv, double *b)
+{
+	(void)LAPACKE_dgesv_work(LAPACK_COL_MAJOR, n, 1, a, n, ipiv, b, n);
+}
+
+void
+getri(int n, float *a, lapack_int *ipiv, float *work)
+{
+	(void)LAPACKE_sgetrf_work(LAPACK_COL_MAJOR, n, n, a, n, ipiv);
+	(void)LAPACKE_sgetri_work(LAPACK_COL_MAJOR, n, a, n, ipiv, work,
+	    n * n);
+}
+
+void
+getri(int n, double *a, lapack_int *ipiv, double *work)
+{
+	(void)LAPACKE_dgetrf_work(LAPACK_COL_MAJOR, n, n, a, n, ipiv);
+	(void)LAPACKE_dgetri_work(LAPACK_COL_MAJOR, n, a, n, ipiv, work,
+	    n * n);
+}
+
+template <typename T, int N>
+struct workload {
+	using mat = smallmat::matrix<T, N, N>;
+	using vec = smallmat::vector<T, N>;
+
+	/* Inputs and outputs of smallmat */
+	mat a[batch];
+	mat spd[batch];
+	vec b[batch];
+	mat out[batch];
+	vec x[batch];
+
+	/* The same inputs as plain arrays with a leading dimension of N */
+	T la[batch][N * N];
+	T lspd[batch][N * N];
+	T lb[batch][N];
+	T lout[batch][N * N];
+	T lx[batch][N];
+	T work[N * N];
+	lapack_int ipiv[N];
+
+	void
+	prepare()
+	{
+		for (int k = 0; k < batch; ++k) {
+			T values[N * N];
+
+			fill(values, N * N, (uint32_t)k + 1);
+			for (int j = 0; j < N; ++j) {
+				for (int i = 0; i < N; ++i) {
+					a[k](i, j) = values[i + j * N];
+				}
+			}
+
+			/* Symmetric positive definite */
+			spd[k] = a[k] * smallmat::transpose(a[k]);
+			for (int i = 0; i < N; ++i) {
+				spd[k](i, i) += T(N);
+			}
+
+			fill(values, N, (uint32_t)k + 1000);
+			for (int i = 0; i < N; ++i) {
+				b[k](i, 0) = values[i];
+				lb[k][i] = values[i];
+			}
+
+			for (int j = 0; j < N; ++j) {
+				for (int i = 0; i < N; ++i) {
+					la[k][i + j * N] = a[k](i, j);
+					lspd[k][i + j * N] = spd[k](i, j);
+				}
+			}
+		}
+	}
+
+	void
+	run_fixed(int o, struct bench_timer *timer)
+	{
+		bench_timer_start(timer);
+		for (int k = 0; k < batch; ++k) {
+			switch (o) {
+			case OP_MUL:
+				smallmat::multiply(out[k], a[k], spd[k]);
+				break;
+			case OP_CHOL:
+				(void)smallmat::cholesky(out[k], spd[k]);
+				break;
+			case OP_SOLVE:
+				(void)smallmat::solve(x[k], a[k], b[k]);
+				break;
+			default:
+				(void)smallmat::inverse(out[k], a[k]);
+				break;
+			}
+		}
+		barrier(out);
+		barrier(x);
+		bench_timer_stop(timer);
+	}
+
+	/* Includes the copies of the inputs that LAPACK overwrites */
+	void
+	run_lapack(int o, struct bench_timer *timer)
+	{
+		bench_timer_start(timer);
+		for (int k = 0; k < batch; ++k) {
+			switch (o) {
+			case OP_MUL:
+				gemm(N, la[k], lspd[k], lout[k]);
+				break;
+			case OP_CHOL:
+				memcpy(lout[k], lspd[k], sizeof(lout[k]));
+				potrf(N, lout[k]);
+				break;
+			case OP_SOLVE:
+				memcpy(lout[k], la[k], sizeof(lout[k]));
+				memcpy(lx[k], lb[k], sizeof(lx[k]));
+				gesv(N, lout[k], ipiv, lx[k]);
+				break;
+			default:
+				memcpy(lout[k], la[k], sizeof(lout[k]));
+				getri(N, lout[k], ipiv, work);
+				break;
+			}
+		}
+		barrier(lout);
+		barrier(lx);
+		bench_timer_stop(timer);
+	}
+};
+
+template <typename T, int N>
+void
+run(char precision, const bool *ops, uint32_t min_ms)
+{
+	/* Static, so the alignment of the matrices is guaranteed */
+	static workload<T, N> w;
+
+	w.prepare();
+	for (int o = 0; o < OP_COUNT; ++o) {
+		double elements = (double)N * (o == OP_SOLVE ? 1 : N) * batch;
+		double flops = op_flops(o, N) * batch;
+
+		if (!ops[o]) {
+			continue;
+		}
+
+		for (int lapack = 0; lapack <= 1; ++lapack) {
+			struct bench_timer timer;
+			char variant[12];
+
+			snprintf(variant, sizeof(variant), "%c/%s", precision,
+			    lapack ? "lapack" : "fixed");
+
+			/* The first round warms up the caches */
+			for (int round = 0; round < 2; ++round) {
+				memset(&timer, 0, sizeof(timer));
+				while (bench_timer_more(&timer,
+				    round == 0 ? 0 : min_ms)) {
+					if (lapack) {
+						w.run_lapack(o, &timer);
+					} else {
+						w.run_fixed(o, &timer);
+					}
+				}
+			}
+
+			bench_result_print(bench_result_add(op_names[o],
+			    variant, N, flops, elements, &timer));
+		}
+	}
+}
+
+struct size_entry {
+	uint32_t n;
+	void (*run_float)(char, const bool *, uint32_t);
+	void (*run_double)(char, const bool *, uint32_t);
+};
+
+/* The sizes have to be known at compile time */
+const size_entry sizes[] = {
+	{ 3, run<float, 3>, run<double, 3> },
+	{ 4, run<float, 4>, run<double, 4> },
+	{ 6, run<float, 6>, run<double, 6> },
+	{ 8, run<float, 8>, run<double, 8> },
+	{ 9, run<float, 9>, run<double, 9> },
+	{ 12, run<float, 12>, run<double, 12> },
+};
+
+int
+command_smallmat(int argc, char *argv[])
+{
+	const char *precisions = "sd";
+	uint32_t selected[BENCH_MAX_SIZES];
+	int selected_count = 0;
+	uint32_t min_ms = default_min_ms;
+	bool ops[OP_COUNT] = { false };
+	bool any_op = false;
+	int i;
+
+	for (i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+			++i;
+			if (strcmp(argv[i], "s") != 0 &&
+			    strcmp(argv[i], "d") != 0 &&
+			    strcmp(argv[i], "sd") != 0) {
+				break;
+			}
+			precisions = argv[i];
+		} else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+			++i;
+			selected_count = bench_parse_sizes(argv[i], selected,
+			    BENCH_MAX_SIZES);
+			if (selected_count < 0) {
+				break;
+			}
+		} else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+			++i;
+			min_ms = (uint32_t)strtoul(argv[i], NULL, 0);
+		} else if (strcmp(argv[i], "all") == 0) {
+			for (int o = 0; o < OP_COUNT; ++o) {
+				ops[o] = true;
+			}
+			any_op = true;
+		} else {
+			int o;
+
+			for (o = 0; o < OP_COUNT; ++o) {
+				if (strcmp(argv[i], op_names[o]) == 0) {
+					break;
+				}
+			}
+			if (o == OP_COUNT) {
+				break;
+			}
+			ops[o] = true;
+			any_op = true;
+		}
+	}
+
+	if (i < argc || !any_op) {
+		puts(shell_SMALLMAT_Command.usage);
+		return -1;
+	}
+	for (i = 0; i < selected_count; ++i) {
+		size_t s;
+
+		for (s = 0; s < RTEMS_ARRAY_SIZE(sizes); ++s) {
+			if (sizes[s].n == selected[i]) {
+				break;
+			}
+		}
+		if (s == RTEMS_ARRAY_SIZE(sizes)) {
+			printf("Size %" PRIu32 " is not compiled in\n",
+			    selected[i]);
+			return -1;
+		}
+	}
+
+	bench_result_print_header();
+	for (const char *p = precisions; *p != '\0'; ++p) {
+		for (const size_entry &s : sizes) {
+			bool run_it = selected_count == 0;
+
+			for (i = 0; i < selected_count; ++i) {
+				run_it = run_it || selected[i] == s.n;
+			}
+			if (!run_it) {
+				continue;
+			}
+			if (*p == 's') {
+				(*s.run_float)(*p, ops, min_ms);
+			} else {
+				(*s.run_double)(*p, ops, min_ms);
+			}
+		}
+	}
+
+	return 0;
+}
+
+} /* namespace */
+
+rtems_shell_cmd_t shell_SMALLMAT_Command = {
+	.name = "smallmat",
+	.usage = "Use with: smallmat [-p s|d|sd] [-n sizes] [-t ms] op...\n"
+	    "Compare the fixed size matrices of smallmat.hpp with CBLAS and\n"
+	    "LAPACKE for the operations mul, chol, solve, inv or all. The\n"
+	    "sizes 3, 4, 6, 8, 9 and 12 are compiled in. Each measurement\n"
+	    "covers 16 matrices and runs for at least -t milliseconds\n"
+	    "(default: 200).\n",
+	.topic = "bench",
+	.command = command_smallmat,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
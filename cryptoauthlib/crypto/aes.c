@@ -0,0 +1,468 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "atcac-neon-internal.h"
+
+#include <string.h>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+/*
+ * SubBytes without a 256 byte table. The byte is mapped linearly to
+ * h * Y + l in GF(2^4)^2 with Y^2 + Y + 8 = 0 (GF(2^4) modulo z^4 + z + 1).
+ * There the inverse is
+ *
+ *   (h * Y + l)^-1 = (h * d^-1) * Y + (h + l) * d^-1,
+ *   d = 8 * h^2 + h * l + l^2,
+ *
+ * and products are sums of logarithms. The log of zero is 32, all sums with it
+ * are at least 32 and the exp table returns zero for them (vtbl returns zero
+ * for indices past the table). The map back includes the affine transform.
+ * Each table has 16 entries (32 for exp), so NEON holds them in registers and
+ * looks up 16 bytes with one vtbl per half.
+ */
+static const struct {
+	uint8_t to_tower_lo[16];
+	uint8_t to_tower_hi[16];
+	uint8_t log[16];
+	uint8_t sq_nu[16];
+	uint8_t sq[16];
+	uint8_t log_inv[16];
+	uint8_t from_tower_lo[16];
+	uint8_t from_tower_hi[16];
+	uint8_t exp[32];
+	uint8_t shift_rows[16];
+} aes_tables = {
+	.to_tower_lo = {
+		0x00, 0x01, 0x20, 0x21, 0x46, 0x47, 0x66, 0x67,
+		0x4c, 0x4d, 0x6c, 0x6d, 0x0a, 0x0b, 0x2a, 0x2b,
+	},
+	.to_tower_hi = {
+		0x00, 0x3c, 0xd5, 0xe9, 0x34, 0x08, 0xe1, 0xdd,
+		0xe5, 0xd9, 0x30, 0x0c, 0xd1, 0xed, 0x04, 0x38,
+	},
+	.log = {
+		0x20, 0x00, 0x01, 0x04, 0x02, 0x08, 0x05, 0x0a,
+		0x03, 0x0e, 0x09, 0x07, 0x06, 0x0d, 0x0b, 0x0c,
+	},
+	.sq_nu = {
+		0x00, 0x08, 0x06, 0x0e, 0x0b, 0x03, 0x0d, 0x05,
+		0x0a, 0x02, 0x0c, 0x04, 0x01, 0x09, 0x07, 0x0f,
+	},
+	.sq = {
+		0x00, 0x01, 0x04, 0x05, 0x03, 0x02, 0x07, 0x06,
+		0x0c, 0x0d, 0x08, 0x09, 0x0f, 0x0e, 0x0b, 0x0a,
+	},
+	.log_inv = {
+		0x20, 0x00, 0x0e, 0x0b, 0x0d, 0x07, 0x0a, 0x05,
+		0x0c, 0x01, 0x06, 0x08, 0x09, 0x02, 0x04, 0x03,
+	},
+	.from_tower_lo = {
+		0x63, 0x7c, 0xd1, 0xce, 0xc8, 0xd7, 0x7a, 0x65,
+		0x55, 0x4a, 0xe7, 0xf8, 0xfe, 0xe1, 0x4c, 0x53,
+	},
+	.from_tower_hi = {
+		0x00, 0x52, 0x3e, 0x6c, 0x65, 0x37, 0x5b, 0x09,
+		0x60, 0x32, 0x5e, 0x0c, 0x05, 0x57, 0x3b, 0x69,
+	},
+	.exp = {
+		0x01, 0x02, 0x04, 0x08, 0x03, 0x06, 0x0c, 0x0b,
+		0x05, 0x0a, 0x07, 0x0e, 0x0f, 0x0d, 0x09, 0x01,
+		0x02, 0x04, 0x08, 0x03, 0x06, 0x0c, 0x0b, 0x05,
+		0x0a, 0x07, 0x0e, 0x0f, 0x0d, 0x09, 0x01, 0x02,
+	},
+	/* Source of each byte of the column major state */
+	.shift_rows = {
+		0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11,
+	},
+};
+
+/* Blocks of key stream per step of CTR */
+#define AES_CTR_BLOCKS 8
+
+static uint8_t
+aes_exp(unsigned i)
+{
+	/* Zero for 32 and above without a branch */
+	return (uint8_t)(aes_tables.exp[i & 31] & (((i >> 5) & 1) - 1));
+}
+
+static uint8_t
+aes_sub_byte(uint8_t x)
+{
+	uint8_t t = aes_tables.to_tower_lo[x & 15] ^ aes_tables.to_tower_hi[x >> 4];
+	uint8_t h = t >> 4;
+	uint8_t l = t & 15;
+	unsigned log_h = aes_tables.log[h];
+	unsigned log_d;
+	uint8_t d;
+
+	d = aes_tables.sq_nu[h] ^ aes_tables.sq[l] ^
+	    aes_exp(log_h + aes_tables.log[l]);
+	log_d = aes_tables.log_inv[d];
+
+	return aes_tables.from_tower_lo[aes_exp(aes_tables.log[h ^ l] + log_d)] ^
+	    aes_tables.from_tower_hi[aes_exp(log_h + log_d)];
+}
+
+static uint8_t
+aes_xtime(uint8_t x)
+{
+	return (uint8_t)((x << 1) ^ (0x1b & (0 - (x >> 7))));
+}
+
+#ifdef __ARM_NEON
+struct aes_neon_tables {
+	uint8x8x2_t to_tower_lo;
+	uint8x8x2_t to_tower_hi;
+	uint8x8x2_t log;
+	uint8x8x2_t sq_nu;
+	uint8x8x2_t sq;
+	uint8x8x2_t log_inv;
+	uint8x8x2_t from_tower_lo;
+	uint8x8x2_t from_tower_hi;
+	uint8x8x4_t exp;
+	uint8x8_t shift_rows_lo;
+	uint8x8_t shift_rows_hi;
+};
+
+static inline uint8x8x2_t
+aes_neon_table(const uint8_t table[16])
+{
+	uint8x8x2_t t;
+
+	t.val[0] = vld1_u8(table);
+	t.val[1] = vld1_u8(table + 8);
+	return t;
+}
+
+static inline void
+aes_neon_load(struct aes_neon_tables *t)
+{
+	t->to_tower_lo = aes_neon_table(aes_tables.to_tower_lo);
+	t->to_tower_hi = aes_neon_table(aes_tables.to_tower_hi);
+	t->log = aes_neon_table(aes_tables.log);
+	t->sq_nu = aes_neon_table(aes_tables.sq_nu);
+	t->sq = aes_neon_table(aes_tables.sq);
+	t->log_inv = aes_neon_table(aes_tables.log_inv);
+	t->from_tower_lo = aes_neon_table(aes_tables.from_tower_lo);
+	t->from_tower_hi = aes_neon_table(aes_tables.from_tower_hi);
+	t->exp.val[0] = vld1_u8(aes_tables.exp);
+	t->exp.val[1] = vld1_u8(aes_tables.exp + 8);
+	t->exp.val[2] = vld1_u8(aes_tables.exp + 16);
+	t->exp.val[3] = vld1_u8(aes_tables.exp + 24);
+	t->shift_rows_lo = vld1_u8(aes_tables.shift_rows);
+	t->shift_rows_hi = vld1_u8(aes_tables.shift_rows + 8);
+}
+
+static inline uint8x16_t
+aes_lookup(uint8x8x2_t table, uint8x16_t index)
+{
+	return vcombine_u8(vtbl2_u8(table, vget_low_u8(index)),
+	    vtbl2_u8(table, vget_high_u8(index)));
+}
+
+static inline uint8x16_t
+aes_lookup_exp(uint8x8x4_t table, uint8x16_t index)
+{
+	return vcombine_u8(vtbl4_u8(table, vget_low_u8(index)),
+	    vtbl4_u8(table, vget_high_u8(index)));
+}
+
+/* ShiftRows and SubBytes, see aes_sub_byte() */
+static inline uint8x16_t
+aes_neon_sub_shift(const struct aes_neon_tables *t, uint8x16_t s)
+{
+	const uint8x16_t low_nibble = vdupq_n_u8(15);
+	uint8x8x2_t state = { { vget_low_u8(s), vget_high_u8(s) } };
+	uint8x16_t h;
+	uint8x16_t l;
+	uint8x16_t log_h;
+	uint8x16_t log_hl;
+	uint8x16_t log_d;
+	uint8x16_t d;
+
+	s = vcombine_u8(vtbl2_u8(state, t->shift_rows_lo),
+	    vtbl2_u8(state, t->shift_rows_hi));
+
+	s = veorq_u8(aes_lookup(t->to_tower_lo, vandq_u8(s, low_nibble)),
+	    aes_lookup(t->to_tower_hi, vshrq_n_u8(s, 4)));
+	h = vshrq_n_u8(s, 4);
+	l = vandq_u8(s, low_nibble);
+
+	log_h = aes_lookup(t->log, h);
+	log_hl = aes_lookup(t->log, veorq_u8(h, l));
+	d = veorq_u8(aes_lookup(t->sq_nu, h), aes_lookup(t->sq, l));
+	d = veorq_u8(d, aes_lookup_exp(t->exp,
+	    vaddq_u8(log_h, aes_lookup(t->log, l))));
+	log_d = aes_lookup(t->log_inv, d);
+
+	h = aes_lookup_exp(t->exp, vaddq_u8(log_h, log_d));
+	l = aes_lookup_exp(t->exp, vaddq_u8(log_hl, log_d));
+
+	return veorq_u8(aes_lookup(t->from_tower_lo, l),
+	    aes_lookup(t->from_tower_hi, h));
+}
+
+static inline uint8x16_t
+aes_neon_mix_columns(uint8x16_t s)
+{
+	uint32x4_t w = vreinterpretq_u32_u8(s);
+	/* The other bytes of each column: a1 a2 a3 a0, a2 a3 a0 a1, a3 a0 a1 a2 */
+	uint8x16_t r1 = vreinterpretq_u8_u32(vsriq_n_u32(vshlq_n_u32(w, 24), w, 8));
+	uint8x16_t r2 = vreinterpretq_u8_u16(vrev32q_u16(vreinterpretq_u16_u8(s)));
+	uint8x16_t r3 = vreinterpretq_u8_u32(vsriq_n_u32(vshlq_n_u32(w, 8), w, 24));
+	uint8x16_t x = veorq_u8(s, r1);
+	uint8x16_t carry;
+
+	/* 2 * a0 + 3 * a1 + a2 + a3 = 2 * (a0 + a1) + a1 + a2 + a3 */
+	carry = vreinterpretq_u8_s8(vshrq_n_s8(vreinterpretq_s8_u8(x), 7));
+	x = veorq_u8(vshlq_n_u8(x, 1), vandq_u8(carry, vdupq_n_u8(0x1b)));
+
+	return veorq_u8(veorq_u8(x, r1), veorq_u8(r2, r3));
+}
+
+static void
+aes_encrypt_blocks(const struct atcac_neon_aes *aes, const uint8_t *in,
+    uint8_t *out, size_t blocks)
+{
+	struct aes_neon_tables t;
+	unsigned rounds = aes->rounds;
+	unsigned r;
+
+	aes_neon_load(&t);
+
+	/* Two blocks at a time to hide the latency of the lookups */
+	while (blocks >= 2) {
+		uint8x16_t k = vld1q_u8(aes->round_keys[0]);
+		uint8x16_t a = veorq_u8(vld1q_u8(in), k);
+		uint8x16_t b = veorq_u8(vld1q_u8(in + 16), k);
+
+		for (r = 1; r < rounds; ++r) {
+			k = vld1q_u8(aes->round_keys[r]);
+			a = aes_neon_sub_shift(&t, a);
+			b = aes_neon_sub_shift(&t, b);
+			a = veorq_u8(aes_neon_mix_columns(a), k);
+			b = veorq_u8(aes_neon_mix_columns(b), k);
+		}
+		k = vld1q_u8(aes->round_keys[rounds]);
+		a = veorq_u8(aes_neon_sub_shift(&t, a), k);
+		b = veorq_u8(aes_neon_sub_shift(&t, b), k);
+
+		vst1q_u8(out, a);
+		vst1q_u8(out + 16, b);
+		in += 32;
+		out += 32;
+		blocks -= 2;
+	}
+
+	if (blocks > 0) {
+		uint8x16_t a = veorq_u8(vld1q_u8(in),
+		    vld1q_u8(aes->round_keys[0]));
+
+		for (r = 1; r < rounds; ++r) {
+			a = aes_neon_mix_columns(aes_neon_sub_shift(&t, a));
+			a = veorq_u8(a, vld1q_u8(aes->round_keys[r]));
+		}
+		a = aes_neon_sub_shift(&t, a);
+		vst1q_u8(out, veorq_u8(a, vld1q_u8(aes->round_keys[rounds])));
+	}
+}
+
+static void
+aes_xor(uint8_t *out, const uint8_t *in, const uint8_t *keystream, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i + 16 <= len; i += 16) {
+		vst1q_u8(out + i,
+		    veorq_u8(vld1q_u8(in + i), vld1q_u8(keystream + i)));
+	}
+	for (; i < len; ++i) {
+		out[i] = in[i] ^ keystream[i];
+	}
+}
+#else
+static void
+aes_encrypt_blocks(const struct atcac_neon_aes *aes, const uint8_t *in,
+    uint8_t *out, size_t blocks)
+{
+	while (blocks > 0) {
+		uint8_t s[16];
+		uint8_t u[16];
+		unsigned r;
+		int i;
+
+		for (i = 0; i < 16; ++i) {
+			s[i] = in[i] ^ aes->round_keys[0][i];
+		}
+
+		for (r = 1; r <= aes->rounds; ++r) {
+			for (i = 0; i < 16; ++i) {
+				u[i] = aes_sub_byte(s[aes_tables.shift_rows[i]]);
+			}
+			if (r < aes->rounds) {
+				for (i = 0; i < 16; i += 4) {
+					uint8_t a0 = u[i];
+					uint8_t a1 = u[i + 1];
+					uint8_t a2 = u[i + 2];
+					uint8_t a3 = u[i + 3];
+
+					u[i] = aes_xtime(a0 ^ a1) ^ a1 ^ a2 ^ a3;
+					u[i + 1] = aes_xtime(a1 ^ a2) ^ a2 ^ a3 ^ a0;
+					u[i + 2] = aes_xtime(a2 ^ a3) ^ a3 ^ a0 ^ a1;
+					u[i + 3] = aes_xtime(a3 ^ a0) ^ a0 ^ a1 ^ a2;
+				}
+			}
+			for (i = 0; i < 16; ++i) {
+				s[i] = u[i] ^ aes->round_keys[r][i];
+			}
+		}
+
+		memcpy(out, s, sizeof(s));
+		in += 16;
+		out += 16;
+		--blocks;
+	}
+}
+
+static void
+aes_xor(uint8_t *out, const uint8_t *in, const uint8_t *keystream, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; ++i) {
+		out[i] = in[i] ^ keystream[i];
+	}
+}
+#endif
+
+int
+atcac_neon_aes_init(struct atcac_neon_aes *aes, const uint8_t *key,
+    size_t key_len)
+{
+	uint8_t *w = &aes->round_keys[0][0];
+	size_t nk = key_len / 4;
+	size_t words;
+	size_t i;
+	uint8_t rcon = 1;
+
+	if (key_len != 16 && key_len != 24 && key_len != 32) {
+		return -1;
+	}
+
+	aes->rounds = (unsigned)nk + 6;
+	words = 4 * (aes->rounds + 1);
+	memcpy(w, key, key_len);
+
+	for (i = nk; i < words; ++i) {
+		uint8_t t[4];
+		size_t j;
+
+		memcpy(t, &w[4 * (i - 1)], sizeof(t));
+		if (i % nk == 0) {
+			uint8_t t0 = t[0];
+
+			t[0] = aes_sub_byte(t[1]) ^ rcon;
+			t[1] = aes_sub_byte(t[2]);
+			t[2] = aes_sub_byte(t[3]);
+			t[3] = aes_sub_byte(t0);
+			rcon = aes_xtime(rcon);
+		} else if (nk > 6 && i % nk == 4) {
+			for (j = 0; j < 4; ++j) {
+				t[j] = aes_sub_byte(t[j]);
+			}
+		}
+		for (j = 0; j < 4; ++j) {
+			w[4 * i + j] = w[4 * (i - nk) + j] ^ t[j];
+		}
+	}
+
+	return 0;
+}
+
+void
+atcac_neon_aes_encrypt(const struct atcac_neon_aes *aes,
+    const uint8_t in[ATCAC_NEON_AES_BLOCK_SIZE],
+    uint8_t out[ATCAC_NEON_AES_BLOCK_SIZE])
+{
+	aes_encrypt_blocks(aes, in, out, 1);
+}
+
+static void
+aes_ctr(const struct atcac_neon_aes *aes,
+    uint8_t counter[ATCAC_NEON_AES_BLOCK_SIZE], const uint8_t *in,
+    uint8_t *out, size_t len, int counter_bytes)
+{
+	uint8_t keystream[AES_CTR_BLOCKS * ATCAC_NEON_AES_BLOCK_SIZE];
+
+	while (len > 0) {
+		size_t blocks = (len + 15) / 16;
+		size_t n;
+		size_t i;
+
+		if (blocks > AES_CTR_BLOCKS) {
+			blocks = AES_CTR_BLOCKS;
+		}
+		for (i = 0; i < blocks; ++i) {
+			int j;
+
+			memcpy(&keystream[16 * i], counter, 16);
+			for (j = 15; j >= 16 - counter_bytes; --j) {
+				++counter[j];
+				if (counter[j] != 0) {
+					break;
+				}
+			}
+		}
+		aes_encrypt_blocks(aes, keystream, keystream, blocks);
+
+		n = len < 16 * blocks ? len : 16 * blocks;
+		aes_xor(out, in, keystream, n);
+		in += n;
+		out += n;
+		len -= n;
+	}
+}
+
+void
+atcac_neon_aes_ctr(const struct atcac_neon_aes *aes,
+    uint8_t counter[ATCAC_NEON_AES_BLOCK_SIZE], const uint8_t *in,
+    uint8_t *out, size_t len)
+{
+	aes_ctr(aes, counter, in, out, len, 16);
+}
+
+void
+atcac_neon_aes_ctr32(const struct atcac_neon_aes *aes,
+    uint8_t counter[ATCAC_NEON_AES_BLOCK_SIZE], const uint8_t *in,
+    uint8_t *out, size_t len)
+{
+	aes_ctr(aes, counter, in, out, len, 4);
+}
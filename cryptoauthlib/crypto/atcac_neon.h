@@ -0,0 +1,198 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ATCAC_NEON_H
+#define ATCAC_NEON_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Software crypto for the GRiSP2 when cryptoauthlib is built without OpenSSL
+ * or mbedTLS, e.g. to check the SHA-256 and signature of an application image
+ * before it is started.
+ *
+ * The Cortex-A7 has NEON but no crypto extensions:
+ *
+ * - SHA-256 computes the message schedule with NEON, four words at a time,
+ *   the rounds are plain C,
+ *
+ * - AES uses no lookup tables in memory. SubBytes computes the inverse in
+ *   GF(2^4)^2 with 16 byte tables held in NEON registers (vtbl), so the time
+ *   doesn't depend on the key or the data. CTR encrypts two blocks at a time,
+ *
+ * - GHASH multiplies with vmull.p8 and reduces with shifts, also constant
+ *   time,
+ *
+ * - P-256 verification uses Montgomery arithmetic with 32 bit limbs. It only
+ *   handles public values and isn't constant time.
+ *
+ * Other targets (and a host, for the self test) get the same results in plain
+ * C. The constant time property of AES only holds for the NEON version: the C
+ * SubBytes reads the same 160 bytes of tables from memory with indices that
+ * depend on the key and the data, so its timing can leak them through the
+ * data cache. The C GHASH uses masks instead of branches and table lookups.
+ * Nothing here needs cryptoauthlib. The library additionally provides
+ * atcac_sw_ecdsa_verify_p256() of cryptoauthlib, which only exists there
+ * together with OpenSSL or mbedTLS.
+ */
+
+/* SHA-256 */
+
+#define ATCAC_NEON_SHA256_DIGEST_SIZE 32
+
+struct atcac_neon_sha256 {
+	uint32_t state[8];
+	uint64_t len;
+	uint8_t block[64];
+	size_t used;
+};
+
+void atcac_neon_sha256_init(struct atcac_neon_sha256 *ctx);
+
+void atcac_neon_sha256_update(struct atcac_neon_sha256 *ctx,
+    const void *data, size_t len);
+
+void atcac_neon_sha256_finish(struct atcac_neon_sha256 *ctx,
+    uint8_t digest[ATCAC_NEON_SHA256_DIGEST_SIZE]);
+
+void atcac_neon_sha256(const void *data, size_t len,
+    uint8_t digest[ATCAC_NEON_SHA256_DIGEST_SIZE]);
+
+/* AES */
+
+#define ATCAC_NEON_AES_BLOCK_SIZE 16
+
+struct atcac_neon_aes {
+	uint8_t round_keys[15][ATCAC_NEON_AES_BLOCK_SIZE];
+	unsigned rounds;
+};
+
+/* Expand a key of 16, 24 or 32 bytes. Returns 0 or -1 for other lengths. */
+int atcac_neon_aes_init(struct atcac_neon_aes *aes, const uint8_t *key,
+    size_t key_len);
+
+void atcac_neon_aes_encrypt(const struct atcac_neon_aes *aes,
+    const uint8_t in[ATCAC_NEON_AES_BLOCK_SIZE],
+    uint8_t out[ATCAC_NEON_AES_BLOCK_SIZE]);
+
+/*
+ * Encrypt or decrypt in CTR mode. The counter is a 128 bit big endian number
+ * and points to the next unused block afterwards, so a message can be
+ * processed in pieces that are multiples of the block size. in and out may be
+ * the same.
+ */
+void atcac_neon_aes_ctr(const struct atcac_neon_aes *aes,
+    uint8_t counter[ATCAC_NEON_AES_BLOCK_SIZE], const uint8_t *in,
+    uint8_t *out, size_t len);
+
+/* AES-GCM */
+
+#define ATCAC_NEON_GCM_TAG_SIZE 16
+
+struct atcac_neon_gcm {
+	struct atcac_neon_aes aes;
+	/* Hash key and hash as 128 bit numbers, low half first */
+	uint64_t h[2];
+	uint64_t hash[2];
+	uint8_t j0[ATCAC_NEON_AES_BLOCK_SIZE];
+	uint8_t counter[ATCAC_NEON_AES_BLOCK_SIZE];
+	uint8_t keystream[ATCAC_NEON_AES_BLOCK_SIZE];
+	/* Not yet hashed bytes of the AAD or the ciphertext */
+	uint8_t partial[ATCAC_NEON_AES_BLOCK_SIZE];
+	size_t partial_len;
+	uint64_t aad_len;
+	uint64_t text_len;
+};
+
+/*
+ * Start a message. The usual IV has 12 bytes, others are hashed as the
+ * standard describes. Returns -1 for a wrong key length or an empty IV.
+ */
+int atcac_neon_gcm_init(struct atcac_neon_gcm *gcm, const uint8_t *key,
+    size_t key_len, const uint8_t *iv, size_t iv_len);
+
+/*
+ * Add additional authenticated data. Can be called several times, but not
+ * after the first atcac_neon_gcm_encrypt() or atcac_neon_gcm_decrypt(), then
+ * it returns -1.
+ */
+int atcac_neon_gcm_aad(struct atcac_neon_gcm *gcm, const uint8_t *aad,
+    size_t len);
+
+/* Pieces of any length, in and out may be the same */
+void atcac_neon_gcm_encrypt(struct atcac_neon_gcm *gcm, const uint8_t *in,
+    uint8_t *out, size_t len);
+
+void atcac_neon_gcm_decrypt(struct atcac_neon_gcm *gcm, const uint8_t *in,
+    uint8_t *out, size_t len);
+
+/* Finish the message, afterwards the context needs a new init */
+void atcac_neon_gcm_tag(struct atcac_neon_gcm *gcm,
+    uint8_t tag[ATCAC_NEON_GCM_TAG_SIZE]);
+
+/* Shorter tags make forgeries too likely (see NIST SP 800-38D) */
+#define ATCAC_NEON_GCM_MIN_TAG_SIZE 12
+
+/*
+ * Finish the message and compare the tag in constant time. tag_len may be
+ * from ATCAC_NEON_GCM_MIN_TAG_SIZE to ATCAC_NEON_GCM_TAG_SIZE. Returns 0 if
+ * it matches, otherwise (also for an invalid tag_len) -1 and the decrypted
+ * data must be discarded.
+ */
+int atcac_neon_gcm_check_tag(struct atcac_neon_gcm *gcm, const uint8_t *tag,
+    size_t tag_len);
+
+/* ECDSA with P-256 */
+
+/*
+ * Verify the signature (r and s, big endian) of a message digest with the
+ * public key (x and y, big endian). Public keys that are not on the curve
+ * fail.
+ */
+bool atcac_neon_p256_verify(const uint8_t public_key[64],
+    const uint8_t digest[32], const uint8_t signature[64]);
+
+/*
+ * Known answer tests of all of the above. Returns 0 or -1 and the name of the
+ * first test that failed. Build with ATCAC_NEON_SELFTEST_MAIN to run them on
+ * the host:
+ *
+ *   cc -DATCAC_NEON_SELFTEST_MAIN sha256.c aes.c gcm.c p256.c selftest.c
+ */
+int atcac_neon_selftest(const char **failed);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* ATCAC_NEON_H */
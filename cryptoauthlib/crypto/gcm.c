@@ -0,0 +1,485 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "atcac-neon-internal.h"
+
+#include <string.h>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+/*
+ * GHASH treats a block as a polynomial with the bits in reverse order. As a
+ * big endian 128 bit number the carry-less product of two blocks is the
+ * reversed product shifted right by one, so it is shifted back and reduced
+ * with shifts as in the Intel whitepaper on carry-less multiplication.
+ */
+
+/* Bytes encrypted and hashed per pass, small enough to stay in the cache */
+#define GCM_CHUNK 512
+
+static void
+gcm_load_scalar(const uint8_t *block, uint64_t v[2])
+{
+	int i;
+
+	v[0] = 0;
+	v[1] = 0;
+	for (i = 0; i < 8; ++i) {
+		v[1] = (v[1] << 8) | block[i];
+		v[0] = (v[0] << 8) | block[8 + i];
+	}
+}
+
+static void
+gcm_store_scalar(uint8_t *block, const uint64_t v[2])
+{
+	int i;
+
+	for (i = 0; i < 8; ++i) {
+		block[i] = (uint8_t)(v[1] >> (56 - 8 * i));
+		block[8 + i] = (uint8_t)(v[0] >> (56 - 8 * i));
+	}
+}
+
+#ifdef __ARM_NEON
+static inline uint8x16_t
+gcm_vmull(uint8x8_t a, uint8x8_t b)
+{
+	return vreinterpretq_u8_p16(vmull_p8(vreinterpret_p8_u8(a),
+	    vreinterpret_p8_u8(b)));
+}
+
+/*
+ * Fold the middle term of one of the partial products below: the upper half
+ * is added to the lower one and masked to the bits that remain in it.
+ */
+static inline uint8x16_t
+gcm_fold(uint8x16_t t, uint64x1_t mask)
+{
+	uint64x2_t v = vreinterpretq_u64_u8(t);
+	uint64x1_t lo = vget_low_u64(v);
+	uint64x1_t hi = vget_high_u64(v);
+
+	lo = veor_u64(lo, hi);
+	hi = vand_u64(hi, mask);
+	lo = veor_u64(lo, hi);
+
+	return vreinterpretq_u8_u64(vcombine_u64(lo, hi));
+}
+
+/*
+ * 64 x 64 bit carry-less multiplication with the 8 x 8 bit vmull.p8: the
+ * products of a with b rotated by one to four bytes and of b with a rotated
+ * likewise give all byte pairs, see "Fast Software Polynomial Multiplication
+ * on ARM Processors Using the NEON Engine" by Camara, Gouvea, Lopez and Dahab.
+ */
+static inline uint64x2_t
+gcm_clmul(uint64x1_t a64, uint64x1_t b64)
+{
+	uint8x8_t a = vreinterpret_u8_u64(a64);
+	uint8x8_t b = vreinterpret_u8_u64(b64);
+	uint8x16_t t0;
+	uint8x16_t t1;
+	uint8x16_t t2;
+	uint8x16_t t3;
+	uint8x16_t r;
+
+	/* L = E + F, M = G + H, N = I + J and K */
+	t0 = veorq_u8(gcm_vmull(vext_u8(a, a, 1), b),
+	    gcm_vmull(a, vext_u8(b, b, 1)));
+	t1 = veorq_u8(gcm_vmull(vext_u8(a, a, 2), b),
+	    gcm_vmull(a, vext_u8(b, b, 2)));
+	t2 = veorq_u8(gcm_vmull(vext_u8(a, a, 3), b),
+	    gcm_vmull(a, vext_u8(b, b, 3)));
+	t3 = gcm_vmull(a, vext_u8(b, b, 4));
+
+	t0 = gcm_fold(t0, vdup_n_u64(0x0000ffffffffffff));
+	t1 = gcm_fold(t1, vdup_n_u64(0x00000000ffffffff));
+	t2 = gcm_fold(t2, vdup_n_u64(0x000000000000ffff));
+	t3 = gcm_fold(t3, vdup_n_u64(0));
+
+	/* Shift them into place */
+	t0 = vextq_u8(t0, t0, 15);
+	t1 = vextq_u8(t1, t1, 14);
+	t2 = vextq_u8(t2, t2, 13);
+	t3 = vextq_u8(t3, t3, 12);
+
+	r = veorq_u8(gcm_vmull(a, b), veorq_u8(t0, t1));
+	r = veorq_u8(r, veorq_u8(t2, t3));
+
+	return vreinterpretq_u64_u8(r);
+}
+
+static inline uint64x2_t
+gcm_mul(uint64x2_t x, uint64x2_t h)
+{
+	const uint64x1_t zero = vdup_n_u64(0);
+	uint64x1_t x0 = vget_low_u64(x);
+	uint64x1_t x1 = vget_high_u64(x);
+	uint64x1_t h0 = vget_low_u64(h);
+	uint64x1_t h1 = vget_high_u64(h);
+	uint64x2_t lo;
+	uint64x2_t hi;
+	uint64x2_t mid;
+	uint64x2_t t;
+	uint64x1_t d;
+
+	/* Karatsuba */
+	lo = gcm_clmul(x0, h0);
+	hi = gcm_clmul(x1, h1);
+	mid = gcm_clmul(veor_u64(x0, x1), veor_u64(h0, h1));
+	mid = veorq_u64(mid, veorq_u64(lo, hi));
+	lo = veorq_u64(lo, vcombine_u64(zero, vget_low_u64(mid)));
+	hi = veorq_u64(hi, vcombine_u64(vget_high_u64(mid), zero));
+
+	/* Shift the 256 bit product left by one */
+	hi = vorrq_u64(vshlq_n_u64(hi, 1),
+	    vshrq_n_u64(vextq_u64(lo, hi, 1), 63));
+	lo = vorrq_u64(vshlq_n_u64(lo, 1),
+	    vshrq_n_u64(vextq_u64(vdupq_n_u64(0), lo, 1), 63));
+
+	/* Reduce modulo x^128 + x^7 + x^2 + x + 1 */
+	x0 = vget_low_u64(lo);
+	d = veor_u64(vshl_n_u64(x0, 63), vshl_n_u64(x0, 62));
+	d = veor_u64(vget_high_u64(lo), veor_u64(d, vshl_n_u64(x0, 57)));
+	t = vcombine_u64(x0, d);
+	t = veorq_u64(veorq_u64(t, vshrq_n_u64(t, 1)),
+	    veorq_u64(vshrq_n_u64(t, 2), vshrq_n_u64(t, 7)));
+	d = veor_u64(veor_u64(vshl_n_u64(d, 63), vshl_n_u64(d, 62)),
+	    vshl_n_u64(d, 57));
+	t = veorq_u64(t, vcombine_u64(d, zero));
+
+	return veorq_u64(hi, t);
+}
+
+static void
+gcm_ghash(struct atcac_neon_gcm *gcm, const uint8_t *data, size_t blocks)
+{
+	uint64x2_t h = vld1q_u64(gcm->h);
+	uint64x2_t x = vld1q_u64(gcm->hash);
+
+	while (blocks > 0) {
+		/* The block as a big endian number, low half first */
+		uint64x2_t v = vreinterpretq_u64_u8(vrev64q_u8(vld1q_u8(data)));
+
+		x = gcm_mul(veorq_u64(x, vextq_u64(v, v, 1)), h);
+		data += 16;
+		--blocks;
+	}
+
+	vst1q_u64(gcm->hash, x);
+}
+#else
+static void
+gcm_clmul(uint64_t a, uint64_t b, uint64_t r[2])
+{
+	uint64_t lo = 0;
+	uint64_t hi = 0;
+	int i;
+
+	/* Masks instead of branches to keep it constant time */
+	lo = a & (0 - (b & 1));
+	for (i = 1; i < 64; ++i) {
+		uint64_t mask = 0 - ((b >> i) & 1);
+
+		lo ^= (a << i) & mask;
+		hi ^= (a >> (64 - i)) & mask;
+	}
+
+	r[0] = lo;
+	r[1] = hi;
+}
+
+static void
+gcm_mul(uint64_t x[2], const uint64_t h[2])
+{
+	uint64_t lo[2];
+	uint64_t hi[2];
+	uint64_t mid[2];
+	uint64_t x0;
+	uint64_t x1;
+	uint64_t x2;
+	uint64_t x3;
+	uint64_t d;
+
+	gcm_clmul(x[0], h[0], lo);
+	gcm_clmul(x[1], h[1], hi);
+	gcm_clmul(x[0] ^ x[1], h[0] ^ h[1], mid);
+	x0 = lo[0];
+	x1 = lo[1] ^ mid[0] ^ lo[0] ^ hi[0];
+	x2 = hi[0] ^ mid[1] ^ lo[1] ^ hi[1];
+	x3 = hi[1];
+
+	x3 = (x3 << 1) | (x2 >> 63);
+	x2 = (x2 << 1) | (x1 >> 63);
+	x1 = (x1 << 1) | (x0 >> 63);
+	x0 <<= 1;
+
+	d = x1 ^ (x0 << 63) ^ (x0 << 62) ^ (x0 << 57);
+	x[0] = x2 ^ x0 ^ (x0 >> 1) ^ (x0 >> 2) ^ (x0 >> 7) ^
+	    (d << 63) ^ (d << 62) ^ (d << 57);
+	x[1] = x3 ^ d ^ (d >> 1) ^ (d >> 2) ^ (d >> 7);
+}
+
+static void
+gcm_ghash(struct atcac_neon_gcm *gcm, const uint8_t *data, size_t blocks)
+{
+	while (blocks > 0) {
+		uint64_t v[2];
+
+		gcm_load_scalar(data, v);
+		gcm->hash[0] ^= v[0];
+		gcm->hash[1] ^= v[1];
+		gcm_mul(gcm->hash, gcm->h);
+		data += 16;
+		--blocks;
+	}
+}
+#endif
+
+static void
+gcm_hash_bytes(struct atcac_neon_gcm *gcm, const uint8_t *data, size_t len)
+{
+	if (len == 0) {
+		return;
+	}
+	if (gcm->partial_len > 0) {
+		size_t n = sizeof(gcm->partial) - gcm->partial_len;
+
+		if (n > len) {
+			n = len;
+		}
+		memcpy(&gcm->partial[gcm->partial_len], data, n);
+		gcm->partial_len += n;
+		data += n;
+		len -= n;
+		if (gcm->partial_len < sizeof(gcm->partial)) {
+			return;
+		}
+		gcm_ghash(gcm, gcm->partial, 1);
+		gcm->partial_len = 0;
+	}
+
+	gcm_ghash(gcm, data, len / 16);
+	data += len & ~(size_t)15;
+	len &= 15;
+
+	memcpy(gcm->partial, data, len);
+	gcm->partial_len = len;
+}
+
+/* Hash the last partial block padded with zeros */
+static void
+gcm_hash_pad(struct atcac_neon_gcm *gcm)
+{
+	if (gcm->partial_len > 0) {
+		memset(&gcm->partial[gcm->partial_len], 0,
+		    sizeof(gcm->partial) - gcm->partial_len);
+		gcm_ghash(gcm, gcm->partial, 1);
+		gcm->partial_len = 0;
+	}
+}
+
+static void
+gcm_hash_lengths(struct atcac_neon_gcm *gcm, uint64_t a_len, uint64_t b_len)
+{
+	uint64_t bits[2] = { b_len * 8, a_len * 8 };
+	uint8_t block[16];
+
+	gcm_store_scalar(block, bits);
+	gcm_ghash(gcm, block, 1);
+}
+
+static void
+gcm_inc32(uint8_t counter[ATCAC_NEON_AES_BLOCK_SIZE])
+{
+	int i;
+
+	for (i = 15; i >= 12; --i) {
+		++counter[i];
+		if (counter[i] != 0) {
+			break;
+		}
+	}
+}
+
+int
+atcac_neon_gcm_init(struct atcac_neon_gcm *gcm, const uint8_t *key,
+    size_t key_len, const uint8_t *iv, size_t iv_len)
+{
+	uint8_t block[ATCAC_NEON_AES_BLOCK_SIZE];
+
+	if (iv_len == 0 || atcac_neon_aes_init(&gcm->aes, key, key_len) != 0) {
+		return -1;
+	}
+
+	memset(block, 0, sizeof(block));
+	atcac_neon_aes_encrypt(&gcm->aes, block, block);
+	gcm_load_scalar(block, gcm->h);
+	gcm->hash[0] = 0;
+	gcm->hash[1] = 0;
+	gcm->partial_len = 0;
+	gcm->aad_len = 0;
+	gcm->text_len = 0;
+
+	if (iv_len == 12) {
+		memcpy(gcm->j0, iv, iv_len);
+		memset(&gcm->j0[12], 0, 3);
+		gcm->j0[15] = 1;
+	} else {
+		gcm_hash_bytes(gcm, iv, iv_len);
+		gcm_hash_pad(gcm);
+		gcm_hash_lengths(gcm, 0, iv_len);
+		gcm_store_scalar(gcm->j0, gcm->hash);
+		gcm->hash[0] = 0;
+		gcm->hash[1] = 0;
+	}
+
+	memcpy(gcm->counter, gcm->j0, sizeof(gcm->counter));
+	gcm_inc32(gcm->counter);
+
+	return 0;
+}
+
+int
+atcac_neon_gcm_aad(struct atcac_neon_gcm *gcm, const uint8_t *aad,
+    size_t len)
+{
+	if (gcm->text_len > 0) {
+		return -1;
+	}
+
+	gcm_hash_bytes(gcm, aad, len);
+	gcm->aad_len += len;
+
+	return 0;
+}
+
+static void
+gcm_crypt(struct atcac_neon_gcm *gcm, const uint8_t *in, uint8_t *out,
+    size_t len, int encrypt)
+{
+	if (len == 0) {
+		return;
+	}
+	if (gcm->text_len == 0) {
+		/* The AAD ends here */
+		gcm_hash_pad(gcm);
+	}
+	gcm->text_len += len;
+
+	while (len > 0) {
+		if (gcm->partial_len == 0 && len >= 16) {
+			size_t n = len < GCM_CHUNK ? len & ~(size_t)15 : GCM_CHUNK;
+
+			/* The ciphertext is hashed, in and out may be the same */
+			if (!encrypt) {
+				gcm_ghash(gcm, in, n / 16);
+			}
+			atcac_neon_aes_ctr32(&gcm->aes, gcm->counter, in, out, n);
+			if (encrypt) {
+				gcm_ghash(gcm, out, n / 16);
+			}
+			in += n;
+			out += n;
+			len -= n;
+		} else {
+			uint8_t c;
+
+			if (gcm->partial_len == 0) {
+				atcac_neon_aes_encrypt(&gcm->aes, gcm->counter,
+				    gcm->keystream);
+				gcm_inc32(gcm->counter);
+			}
+			c = *in;
+			*out = c ^ gcm->keystream[gcm->partial_len];
+			gcm->partial[gcm->partial_len] = encrypt ? *out : c;
+			++gcm->partial_len;
+			if (gcm->partial_len == sizeof(gcm->partial)) {
+				gcm_ghash(gcm, gcm->partial, 1);
+				gcm->partial_len = 0;
+			}
+			++in;
+			++out;
+			--len;
+		}
+	}
+}
+
+void
+atcac_neon_gcm_encrypt(struct atcac_neon_gcm *gcm, const uint8_t *in,
+    uint8_t *out, size_t len)
+{
+	gcm_crypt(gcm, in, out, len, 1);
+}
+
+void
+atcac_neon_gcm_decrypt(struct atcac_neon_gcm *gcm, const uint8_t *in,
+    uint8_t *out, size_t len)
+{
+	gcm_crypt(gcm, in, out, len, 0);
+}
+
+void
+atcac_neon_gcm_tag(struct atcac_neon_gcm *gcm,
+    uint8_t tag[ATCAC_NEON_GCM_TAG_SIZE])
+{
+	uint8_t block[ATCAC_NEON_AES_BLOCK_SIZE];
+	int i;
+
+	gcm_hash_pad(gcm);
+	gcm_hash_lengths(gcm, gcm->aad_len, gcm->text_len);
+
+	atcac_neon_aes_encrypt(&gcm->aes, gcm->j0, block);
+	gcm_store_scalar(tag, gcm->hash);
+	for (i = 0; i < ATCAC_NEON_GCM_TAG_SIZE; ++i) {
+		tag[i] ^= block[i];
+	}
+}
+
+int
+atcac_neon_gcm_check_tag(struct atcac_neon_gcm *gcm, const uint8_t *tag,
+    size_t tag_len)
+{
+	uint8_t expected[ATCAC_NEON_GCM_TAG_SIZE];
+	uint8_t diff = 0;
+	size_t i;
+
+	if (tag_len < ATCAC_NEON_GCM_MIN_TAG_SIZE ||
+	    tag_len > sizeof(expected)) {
+		return -1;
+	}
+
+	atcac_neon_gcm_tag(gcm, expected);
+	for (i = 0; i < tag_len; ++i) {
+		diff |= expected[i] ^ tag[i];
+	}
+
+	return diff == 0 ? 0 : -1;
+}
@@ -0,0 +1,524 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "atcac_neon.h"
+
+#include <string.h>
+
+/*
+ * Numbers are eight 32 bit limbs, least significant first. Field elements
+ * and the scalars for the inversion of s are in Montgomery form (times 2^256)
+ * and multiplied with CIOS. Points are Jacobian (X / Z^2, Y / Z^3), Z zero is
+ * the point at infinity. All of it handles public values only.
+ */
+
+#define P256_LIMBS 8
+
+struct p256_mod {
+	uint32_t m[P256_LIMBS];
+	/* 2^512 mod m */
+	uint32_t rr[P256_LIMBS];
+	/* -m^-1 mod 2^32 */
+	uint32_t m0inv;
+	/* m - 2, the exponent of the inversion */
+	uint32_t m_minus_2[P256_LIMBS];
+};
+
+struct p256_point {
+	uint32_t x[P256_LIMBS];
+	uint32_t y[P256_LIMBS];
+	uint32_t z[P256_LIMBS];
+};
+
+struct p256_affine {
+	uint32_t x[P256_LIMBS];
+	uint32_t y[P256_LIMBS];
+	bool infinity;
+};
+
+static const struct p256_mod p256_p = {
+	.m = {
+		0xffffffff, 0xffffffff, 0xffffffff, 0x00000000,
+		0x00000000, 0x00000000, 0x00000001, 0xffffffff,
+	},
+	.rr = {
+		0x00000003, 0x00000000, 0xffffffff, 0xfffffffb,
+		0xfffffffe, 0xffffffff, 0xfffffffd, 0x00000004,
+	},
+	.m0inv = 0x00000001,
+	.m_minus_2 = {
+		0xfffffffd, 0xffffffff, 0xffffffff, 0x00000000,
+		0x00000000, 0x00000000, 0x00000001, 0xffffffff,
+	},
+};
+
+static const struct p256_mod p256_n = {
+	.m = {
+		0xfc632551, 0xf3b9cac2, 0xa7179e84, 0xbce6faad,
+		0xffffffff, 0xffffffff, 0x00000000, 0xffffffff,
+	},
+	.rr = {
+		0xbe79eea2, 0x83244c95, 0x49bd6fa6, 0x4699799c,
+		0x2b6bec59, 0x2845b239, 0xf3d95620, 0x66e12d94,
+	},
+	.m0inv = 0xee00bc4f,
+	.m_minus_2 = {
+		0xfc63254f, 0xf3b9cac2, 0xa7179e84, 0xbce6faad,
+		0xffffffff, 0xffffffff, 0x00000000, 0xffffffff,
+	},
+};
+
+/* The constants of the curve in Montgomery form */
+static const uint32_t p256_one[P256_LIMBS] = {
+	0x00000001, 0x00000000, 0x00000000, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xfffffffe, 0x00000000,
+};
+
+static const uint32_t p256_b[P256_LIMBS] = {
+	0x29c4bddf, 0xd89cdf62, 0x78843090, 0xacf005cd,
+	0xf7212ed6, 0xe5a220ab, 0x04874834, 0xdc30061d,
+};
+
+static const struct p256_affine p256_g = {
+	.x = {
+		0x18a9143c, 0x79e730d4, 0x5fedb601, 0x75ba95fc,
+		0x77622510, 0x79fb732b, 0xa53755c6, 0x18905f76,
+	},
+	.y = {
+		0xce95560a, 0xddf25357, 0xba19e45c, 0x8b4ab8e4,
+		0xdd21f325, 0xd2e88688, 0x25885d85, 0x8571ff18,
+	},
+	.infinity = false,
+};
+
+static void
+p256_from_bytes(uint32_t r[P256_LIMBS], const uint8_t bytes[32])
+{
+	int i;
+
+	for (i = 0; i < P256_LIMBS; ++i) {
+		const uint8_t *b = &bytes[28 - 4 * i];
+
+		r[i] = ((uint32_t)b[0] << 24) | ((uint32_t)b[1] << 16) |
+		    ((uint32_t)b[2] << 8) | b[3];
+	}
+}
+
+static int
+p256_cmp(const uint32_t a[P256_LIMBS], const uint32_t b[P256_LIMBS])
+{
+	int i;
+
+	for (i = P256_LIMBS - 1; i >= 0; --i) {
+		if (a[i] != b[i]) {
+			return a[i] < b[i] ? -1 : 1;
+		}
+	}
+
+	return 0;
+}
+
+static bool
+p256_is_zero(const uint32_t a[P256_LIMBS])
+{
+	uint32_t bits = 0;
+	int i;
+
+	for (i = 0; i < P256_LIMBS; ++i) {
+		bits |= a[i];
+	}
+
+	return bits == 0;
+}
+
+static uint32_t
+p256_add_raw(uint32_t r[P256_LIMBS], const uint32_t a[P256_LIMBS],
+    const uint32_t b[P256_LIMBS])
+{
+	uint64_t c = 0;
+	int i;
+
+	for (i = 0; i < P256_LIMBS; ++i) {
+		c += (uint64_t)a[i] + b[i];
+		r[i] = (uint32_t)c;
+		c >>= 32;
+	}
+
+	return (uint32_t)c;
+}
+
+static uint32_t
+p256_sub_raw(uint32_t r[P256_LIMBS], const uint32_t a[P256_LIMBS],
+    const uint32_t b[P256_LIMBS])
+{
+	uint64_t c = 0;
+	int i;
+
+	for (i = 0; i < P256_LIMBS; ++i) {
+		c = (uint64_t)a[i] - b[i] - c;
+		r[i] = (uint32_t)c;
+		c = (c >> 32) & 1;
+	}
+
+	return (uint32_t)c;
+}
+
+static void
+p256_add(uint32_t r[P256_LIMBS], const uint32_t a[P256_LIMBS],
+    const uint32_t b[P256_LIMBS], const struct p256_mod *mod)
+{
+	if (p256_add_raw(r, a, b) != 0 || p256_cmp(r, mod->m) >= 0) {
+		(void)p256_sub_raw(r, r, mod->m);
+	}
+}
+
+static void
+p256_sub(uint32_t r[P256_LIMBS], const uint32_t a[P256_LIMBS],
+    const uint32_t b[P256_LIMBS], const struct p256_mod *mod)
+{
+	if (p256_sub_raw(r, a, b) != 0) {
+		(void)p256_add_raw(r, r, mod->m);
+	}
+}
+
+/* a * b / 2^256 mod m, r may be a or b */
+static void
+p256_mul(uint32_t r[P256_LIMBS], const uint32_t a[P256_LIMBS],
+    const uint32_t b[P256_LIMBS], const struct p256_mod *mod)
+{
+	uint32_t t[P256_LIMBS + 2];
+	int i;
+	int j;
+
+	memset(t, 0, sizeof(t));
+
+	for (i = 0; i < P256_LIMBS; ++i) {
+		uint64_t c = 0;
+		uint32_t m;
+
+		for (j = 0; j < P256_LIMBS; ++j) {
+			c += (uint64_t)a[j] * b[i] + t[j];
+			t[j] = (uint32_t)c;
+			c >>= 32;
+		}
+		c += t[P256_LIMBS];
+		t[P256_LIMBS] = (uint32_t)c;
+		t[P256_LIMBS + 1] = (uint32_t)(c >> 32);
+
+		/* Add m times a multiple that clears the lowest limb, shift */
+		m = t[0] * mod->m0inv;
+		c = ((uint64_t)m * mod->m[0] + t[0]) >> 32;
+		for (j = 1; j < P256_LIMBS; ++j) {
+			c += (uint64_t)m * mod->m[j] + t[j];
+			t[j - 1] = (uint32_t)c;
+			c >>= 32;
+		}
+		c += t[P256_LIMBS];
+		t[P256_LIMBS - 1] = (uint32_t)c;
+		t[P256_LIMBS] = t[P256_LIMBS + 1] + (uint32_t)(c >> 32);
+	}
+
+	if (t[P256_LIMBS] != 0 || p256_cmp(t, mod->m) >= 0) {
+		(void)p256_sub_raw(r, t, mod->m);
+	} else {
+		memcpy(r, t, sizeof(t[0]) * P256_LIMBS);
+	}
+}
+
+/* a^(m - 2) = a^-1, in and out in Montgomery form */
+static void
+p256_inv(uint32_t r[P256_LIMBS], const uint32_t a[P256_LIMBS],
+    const struct p256_mod *mod)
+{
+	uint32_t x[P256_LIMBS];
+	int bit;
+
+	/* The top bit of m - 2 is set for both moduli */
+	memcpy(x, a, sizeof(x));
+	for (bit = 254; bit >= 0; --bit) {
+		p256_mul(x, x, x, mod);
+		if (((mod->m_minus_2[bit / 32] >> (bit % 32)) & 1) != 0) {
+			p256_mul(x, x, a, mod);
+		}
+	}
+
+	memcpy(r, x, sizeof(x));
+}
+
+#define FMUL(r, a, b) p256_mul(r, a, b, &p256_p)
+#define FADD(r, a, b) p256_add(r, a, b, &p256_p)
+#define FSUB(r, a, b) p256_sub(r, a, b, &p256_p)
+
+/* dbl-2001-b for a = -3, r may be a */
+static void
+p256_double(struct p256_point *r, const struct p256_point *a)
+{
+	uint32_t delta[P256_LIMBS];
+	uint32_t gamma[P256_LIMBS];
+	uint32_t beta[P256_LIMBS];
+	uint32_t alpha[P256_LIMBS];
+	uint32_t t[P256_LIMBS];
+	uint32_t u[P256_LIMBS];
+
+	FMUL(delta, a->z, a->z);
+	FMUL(gamma, a->y, a->y);
+	FMUL(beta, a->x, gamma);
+
+	/* alpha = 3 * (X1 - delta) * (X1 + delta) */
+	FSUB(t, a->x, delta);
+	FADD(u, a->x, delta);
+	FMUL(t, t, u);
+	FADD(alpha, t, t);
+	FADD(alpha, alpha, t);
+
+	/* Z3 = (Y1 + Z1)^2 - gamma - delta */
+	FADD(t, a->y, a->z);
+	FMUL(t, t, t);
+	FSUB(t, t, gamma);
+	FSUB(r->z, t, delta);
+
+	/* X3 = alpha^2 - 8 * beta */
+	FADD(beta, beta, beta);
+	FADD(beta, beta, beta);
+	FADD(u, beta, beta);
+	FMUL(t, alpha, alpha);
+	FSUB(r->x, t, u);
+
+	/* Y3 = alpha * (4 * beta - X3) - 8 * gamma^2 */
+	FSUB(t, beta, r->x);
+	FMUL(t, alpha, t);
+	FMUL(gamma, gamma, gamma);
+	FADD(gamma, gamma, gamma);
+	FADD(gamma, gamma, gamma);
+	FADD(gamma, gamma, gamma);
+	FSUB(r->y, t, gamma);
+}
+
+/* madd-2007-bl plus the special cases, r may be a */
+static void
+p256_add_affine(struct p256_point *r, const struct p256_point *a,
+    const struct p256_affine *b)
+{
+	uint32_t z1z1[P256_LIMBS];
+	uint32_t u2[P256_LIMBS];
+	uint32_t s2[P256_LIMBS];
+	uint32_t h[P256_LIMBS];
+	uint32_t hh[P256_LIMBS];
+	uint32_t i[P256_LIMBS];
+	uint32_t j[P256_LIMBS];
+	uint32_t rr[P256_LIMBS];
+	uint32_t v[P256_LIMBS];
+	uint32_t t[P256_LIMBS];
+
+	if (p256_is_zero(a->z)) {
+		memcpy(r->x, b->x, sizeof(r->x));
+		memcpy(r->y, b->y, sizeof(r->y));
+		memcpy(r->z, p256_one, sizeof(r->z));
+		return;
+	}
+
+	FMUL(z1z1, a->z, a->z);
+	FMUL(u2, b->x, z1z1);
+	FMUL(s2, b->y, a->z);
+	FMUL(s2, s2, z1z1);
+	FSUB(h, u2, a->x);
+	FSUB(rr, s2, a->y);
+
+	if (p256_is_zero(h)) {
+		if (p256_is_zero(rr)) {
+			p256_double(r, a);
+		} else {
+			memset(r->z, 0, sizeof(r->z));
+		}
+		return;
+	}
+
+	FADD(rr, rr, rr);
+	FMUL(hh, h, h);
+	FADD(i, hh, hh);
+	FADD(i, i, i);
+	FMUL(j, h, i);
+	FMUL(v, a->x, i);
+
+	/* Z3 = (Z1 + H)^2 - Z1Z1 - HH */
+	FADD(t, a->z, h);
+	FMUL(t, t, t);
+	FSUB(t, t, z1z1);
+	FSUB(r->z, t, hh);
+
+	/* 2 * Y1 * J before Y1 may be overwritten */
+	FMUL(s2, a->y, j);
+	FADD(s2, s2, s2);
+
+	/* X3 = r^2 - J - 2 * V */
+	FMUL(t, rr, rr);
+	FSUB(t, t, j);
+	FSUB(t, t, v);
+	FSUB(r->x, t, v);
+
+	/* Y3 = r * (V - X3) - 2 * Y1 * J */
+	FSUB(t, v, r->x);
+	FMUL(t, rr, t);
+	FSUB(r->y, t, s2);
+}
+
+/* Load a public key and check that it is on the curve */
+static bool
+p256_load_point(struct p256_affine *r, const uint8_t bytes[64])
+{
+	uint32_t lhs[P256_LIMBS];
+	uint32_t rhs[P256_LIMBS];
+	uint32_t t[P256_LIMBS];
+
+	p256_from_bytes(r->x, bytes);
+	p256_from_bytes(r->y, bytes + 32);
+	if (p256_cmp(r->x, p256_p.m) >= 0 || p256_cmp(r->y, p256_p.m) >= 0) {
+		return false;
+	}
+	FMUL(r->x, r->x, p256_p.rr);
+	FMUL(r->y, r->y, p256_p.rr);
+	r->infinity = false;
+
+	/* y^2 = x^3 - 3 * x + b */
+	FMUL(lhs, r->y, r->y);
+	FMUL(rhs, r->x, r->x);
+	FMUL(rhs, rhs, r->x);
+	FADD(t, r->x, r->x);
+	FADD(t, t, r->x);
+	FSUB(rhs, rhs, t);
+	FADD(rhs, rhs, p256_b);
+
+	return p256_cmp(lhs, rhs) == 0;
+}
+
+static void
+p256_to_affine(struct p256_affine *r, const struct p256_point *a)
+{
+	uint32_t zinv[P256_LIMBS];
+	uint32_t zinv2[P256_LIMBS];
+
+	r->infinity = p256_is_zero(a->z);
+	if (r->infinity) {
+		return;
+	}
+
+	p256_inv(zinv, a->z, &p256_p);
+	FMUL(zinv2, zinv, zinv);
+	FMUL(r->x, a->x, zinv2);
+	FMUL(zinv2, zinv2, zinv);
+	FMUL(r->y, a->y, zinv2);
+}
+
+/* x == r * Z^2, with x the X coordinate of the point in Montgomery form */
+static bool
+p256_x_equals(const struct p256_point *a, const uint32_t r[P256_LIMBS])
+{
+	uint32_t zz[P256_LIMBS];
+	uint32_t t[P256_LIMBS];
+
+	FMUL(zz, a->z, a->z);
+	FMUL(t, r, p256_p.rr);
+	FMUL(t, t, zz);
+
+	return p256_cmp(t, a->x) == 0;
+}
+
+bool
+atcac_neon_p256_verify(const uint8_t public_key[64], const uint8_t digest[32],
+    const uint8_t signature[64])
+{
+	uint32_t r[P256_LIMBS];
+	uint32_t s[P256_LIMBS];
+	uint32_t e[P256_LIMBS];
+	uint32_t w[P256_LIMBS];
+	uint32_t u1[P256_LIMBS];
+	uint32_t u2[P256_LIMBS];
+	struct p256_affine table[3];
+	struct p256_point acc;
+	int bit;
+
+	p256_from_bytes(r, signature);
+	p256_from_bytes(s, signature + 32);
+	if (p256_is_zero(r) || p256_is_zero(s) ||
+	    p256_cmp(r, p256_n.m) >= 0 || p256_cmp(s, p256_n.m) >= 0) {
+		return false;
+	}
+
+	if (!p256_load_point(&table[1], public_key)) {
+		return false;
+	}
+
+	p256_from_bytes(e, digest);
+	if (p256_cmp(e, p256_n.m) >= 0) {
+		(void)p256_sub_raw(e, e, p256_n.m);
+	}
+
+	/* u1 = e / s and u2 = r / s mod n, w is 1 / s in Montgomery form */
+	p256_mul(w, s, p256_n.rr, &p256_n);
+	p256_inv(w, w, &p256_n);
+	p256_mul(u1, e, w, &p256_n);
+	p256_mul(u2, r, w, &p256_n);
+
+	/* u1 * G + u2 * Q with a table of G, Q and G + Q (Shamir's trick) */
+	table[0] = p256_g;
+	memcpy(acc.x, p256_g.x, sizeof(acc.x));
+	memcpy(acc.y, p256_g.y, sizeof(acc.y));
+	memcpy(acc.z, p256_one, sizeof(acc.z));
+	p256_add_affine(&acc, &acc, &table[1]);
+	p256_to_affine(&table[2], &acc);
+
+	memset(acc.z, 0, sizeof(acc.z));
+	for (bit = 255; bit >= 0; --bit) {
+		unsigned index = ((u1[bit / 32] >> (bit % 32)) & 1) |
+		    (((u2[bit / 32] >> (bit % 32)) & 1) << 1);
+
+		if (!p256_is_zero(acc.z)) {
+			p256_double(&acc, &acc);
+		}
+		if (index != 0 && !table[index - 1].infinity) {
+			p256_add_affine(&acc, &acc, &table[index - 1]);
+		}
+	}
+
+	if (p256_is_zero(acc.z)) {
+		return false;
+	}
+
+	/*
+	 * The x coordinate modulo n has to be r. It is below p < 2 * n, so it is
+	 * either r or r + n. Compare in Jacobian coordinates to save the
+	 * inversion of Z.
+	 */
+	if (p256_x_equals(&acc, r)) {
+		return true;
+	}
+	if (p256_add_raw(w, r, p256_n.m) == 0 && p256_cmp(w, p256_p.m) < 0) {
+		return p256_x_equals(&acc, w);
+	}
+
+	return false;
+}
@@ -0,0 +1,423 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "atcac_neon.h"
+
+#include <string.h>
+
+#ifdef ATCAC_NEON_SELFTEST_MAIN
+#include <stdio.h>
+#endif
+
+/*
+ * Vectors of FIPS 180-2, FIPS 197, SP 800-38A, the GCM specification (test
+ * cases 2, 4 and 6) and RFC 6979 (A.2.5, "sample" with SHA-256).
+ */
+
+static const char sha256_abc[] =
+    "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad";
+static const char sha256_empty[] =
+    "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+static const char sha256_448_msg[] =
+    "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+static const char sha256_448[] =
+    "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1";
+static const char sha256_million_a[] =
+    "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0";
+
+static const char aes_key[] =
+    "000102030405060708090a0b0c0d0e0f1011121314151617"
+    "18191a1b1c1d1e1f";
+static const char aes_plaintext[] = "00112233445566778899aabbccddeeff";
+static const char *const aes_ciphertext[] = {
+	"69c4e0d86a7b0430d8cdb78070b4c55a",
+	"dda97ca4864cdfe06eaf70a0ec0d7191",
+	"8ea2b7ca516745bfeafc49904b496089",
+};
+
+static const char ctr_key[] = "2b7e151628aed2a6abf7158809cf4f3c";
+static const char ctr_counter[] = "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+static const char ctr_plaintext[] =
+    "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51"
+    "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710";
+static const char ctr_ciphertext[] =
+    "874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff"
+    "5ae4df3edbd5d35e5b4f09020db03eab1e031dda2fbe03d1792170a0f3009cee";
+
+struct gcm_vector {
+	const char *name;
+	const char *key;
+	const char *iv;
+	const char *plaintext;
+	const char *aad;
+	const char *ciphertext;
+	const char *tag;
+};
+
+static const struct gcm_vector gcm_vectors[] = {
+	{
+		.name = "gcm 2",
+		.key = "00000000000000000000000000000000",
+		.iv = "000000000000000000000000",
+		.plaintext = "00000000000000000000000000000000",
+		.aad = "",
+		.ciphertext = "0388dace60b6a392f328c2b971b2fe78",
+		.tag = "ab6e47d42cec13bdf53a67b21257bddf",
+	}, {
+		.name = "gcm 4",
+		.key = "feffe9928665731c6d6a8f9467308308",
+		.iv = "cafebabefacedbaddecaf888",
+		.plaintext =
+		    "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d"
+		    "8a318a721c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657"
+		    "ba637b39",
+		.aad = "feedfacedeadbeeffeedfacedeadbeefabaddad2",
+		.ciphertext =
+		    "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e23"
+		    "29aca12e21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac97"
+		    "3d58e091",
+		.tag = "5bc94fbc3221a5db94fae95ae7121a47",
+	}, {
+		.name = "gcm 6",
+		.key = "feffe9928665731c6d6a8f9467308308",
+		.iv =
+		    "9313225df88406e555909c5aff5269aa6a7a9538534f7da1e4c303d2"
+		    "a318a728c3c0c95156809539fcf0e2429a6b525416aedbf5a0de6a57"
+		    "a637b39b",
+		.plaintext =
+		    "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d"
+		    "8a318a721c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657"
+		    "ba637b39",
+		.aad = "feedfacedeadbeeffeedfacedeadbeefabaddad2",
+		.ciphertext =
+		    "8ce24998625615b603a033aca13fb894be9112a5c3a211a8ba262a3c"
+		    "ca7e2ca701e4a9a4fba43c90ccdcb281d48c7c6fd62875d2aca41703"
+		    "4c34aee5",
+		.tag = "619cc5aefffe0bfa462af43c1699d050",
+	},
+};
+
+static const char p256_public_key[] =
+    "60fed4ba255a9d31c961eb74c6356d68c049b8923b61fa6ce669622e60f29fb6"
+    "7903fe1008b8bc99a41ae9e95628bc64f2f1b20c2d7e9f5177a3c294d4462299";
+static const char p256_signature[] =
+    "efd48b2aacb6a8fd1140dd9cd45e81d69d2c877b56aaf991c34d0ea84eaf3716"
+    "f7cb1c942d657c41d436c7a1b6e29f65f3e900dbb9aff4064dc4ab2f843acda8";
+
+static int
+selftest_fail(const char **failed, const char *name)
+{
+	if (failed != NULL) {
+		*failed = name;
+	}
+
+	return -1;
+}
+
+/* Returns the number of bytes */
+static size_t
+selftest_hex(uint8_t *out, size_t size, const char *hex)
+{
+	size_t n = 0;
+
+	while (hex[0] != '\0' && hex[1] != '\0' && n < size) {
+		int i;
+		uint8_t byte = 0;
+
+		for (i = 0; i < 2; ++i) {
+			char c = hex[i];
+
+			byte = (uint8_t)(byte << 4);
+			if (c >= '0' && c <= '9') {
+				byte |= (uint8_t)(c - '0');
+			} else {
+				byte |= (uint8_t)(c - 'a' + 10);
+			}
+		}
+		out[n] = byte;
+		++n;
+		hex += 2;
+	}
+
+	return n;
+}
+
+static bool
+selftest_equal(const uint8_t *data, size_t len, const char *hex)
+{
+	uint8_t expected[64];
+
+	return selftest_hex(expected, sizeof(expected), hex) == len &&
+	    memcmp(data, expected, len) == 0;
+}
+
+static int
+selftest_sha256(const char **failed)
+{
+	struct atcac_neon_sha256 ctx;
+	uint8_t digest[ATCAC_NEON_SHA256_DIGEST_SIZE];
+	uint8_t a[1000];
+	size_t done;
+
+	atcac_neon_sha256("abc", 3, digest);
+	if (!selftest_equal(digest, sizeof(digest), sha256_abc)) {
+		return selftest_fail(failed, "sha256 abc");
+	}
+
+	atcac_neon_sha256(NULL, 0, digest);
+	if (!selftest_equal(digest, sizeof(digest), sha256_empty)) {
+		return selftest_fail(failed, "sha256 empty");
+	}
+
+	atcac_neon_sha256(sha256_448_msg, strlen(sha256_448_msg), digest);
+	if (!selftest_equal(digest, sizeof(digest), sha256_448)) {
+		return selftest_fail(failed, "sha256 448 bit");
+	}
+
+	/* Pieces that are no multiple of the block size */
+	memset(a, 'a', sizeof(a));
+	atcac_neon_sha256_init(&ctx);
+	for (done = 0; done < 1000000; done += 997) {
+		size_t n = 1000000 - done < 997 ? 1000000 - done : 997;
+
+		atcac_neon_sha256_update(&ctx, a, n);
+	}
+	atcac_neon_sha256_finish(&ctx, digest);
+	if (!selftest_equal(digest, sizeof(digest), sha256_million_a)) {
+		return selftest_fail(failed, "sha256 million a");
+	}
+
+	return 0;
+}
+
+static int
+selftest_aes(const char **failed)
+{
+	static const char *const names[] = { "aes 128", "aes 192", "aes 256" };
+	struct atcac_neon_aes aes;
+	uint8_t key[32];
+	uint8_t block[16];
+	int i;
+
+	(void)selftest_hex(key, sizeof(key), aes_key);
+	for (i = 0; i < 3; ++i) {
+		(void)selftest_hex(block, sizeof(block), aes_plaintext);
+		if (atcac_neon_aes_init(&aes, key, 16 + 8 * (size_t)i) != 0) {
+			return selftest_fail(failed, names[i]);
+		}
+		atcac_neon_aes_encrypt(&aes, block, block);
+		if (!selftest_equal(block, sizeof(block), aes_ciphertext[i])) {
+			return selftest_fail(failed, names[i]);
+		}
+	}
+
+	if (atcac_neon_aes_init(&aes, key, 20) == 0) {
+		return selftest_fail(failed, "aes key length");
+	}
+
+	return 0;
+}
+
+static int
+selftest_ctr(const char **failed)
+{
+	struct atcac_neon_aes aes;
+	uint8_t key[16];
+	uint8_t counter[16];
+	uint8_t data[64];
+
+	(void)selftest_hex(key, sizeof(key), ctr_key);
+	(void)atcac_neon_aes_init(&aes, key, sizeof(key));
+
+	/* In place, in two pieces */
+	(void)selftest_hex(counter, sizeof(counter), ctr_counter);
+	(void)selftest_hex(data, sizeof(data), ctr_plaintext);
+	atcac_neon_aes_ctr(&aes, counter, data, data, 16);
+	atcac_neon_aes_ctr(&aes, counter, data + 16, data + 16, 48);
+	if (!selftest_equal(data, sizeof(data), ctr_ciphertext)) {
+		return selftest_fail(failed, "aes ctr");
+	}
+
+	/* The counter wraps from ff...ff to 00...00 after the first block */
+	memset(counter, 0xff, sizeof(counter));
+	memset(data, 0, sizeof(data));
+	atcac_neon_aes_ctr(&aes, counter, data, data, 32);
+	memset(counter, 0, sizeof(counter));
+	atcac_neon_aes_encrypt(&aes, counter, counter);
+	if (memcmp(&data[16], counter, 16) != 0) {
+		return selftest_fail(failed, "aes ctr carry");
+	}
+
+	return 0;
+}
+
+static int
+selftest_gcm_one(const struct gcm_vector *v, size_t piece)
+{
+	struct atcac_neon_gcm gcm;
+	uint8_t key[16];
+	uint8_t iv[64];
+	uint8_t aad[64];
+	uint8_t plaintext[64];
+	uint8_t data[64];
+	uint8_t tag[16];
+	size_t iv_len = selftest_hex(iv, sizeof(iv), v->iv);
+	size_t aad_len = selftest_hex(aad, sizeof(aad), v->aad);
+	size_t len = selftest_hex(plaintext, sizeof(plaintext), v->plaintext);
+	size_t done;
+
+	(void)selftest_hex(key, sizeof(key), v->key);
+	(void)selftest_hex(tag, sizeof(tag), v->tag);
+
+	if (atcac_neon_gcm_init(&gcm, key, sizeof(key), iv, iv_len) != 0) {
+		return -1;
+	}
+	for (done = 0; done < aad_len; done += piece) {
+		size_t n = aad_len - done < piece ? aad_len - done : piece;
+
+		(void)atcac_neon_gcm_aad(&gcm, aad + done, n);
+	}
+	for (done = 0; done < len; done += piece) {
+		size_t n = len - done < piece ? len - done : piece;
+
+		atcac_neon_gcm_encrypt(&gcm, plaintext + done, data + done, n);
+	}
+	if (atcac_neon_gcm_aad(&gcm, aad, 1) == 0 ||
+	    !selftest_equal(data, len, v->ciphertext) ||
+	    atcac_neon_gcm_check_tag(&gcm, tag, sizeof(tag)) != 0) {
+		return -1;
+	}
+
+	/* Decrypt in place, then with a too short and a wrong tag */
+	(void)atcac_neon_gcm_init(&gcm, key, sizeof(key), iv, iv_len);
+	(void)atcac_neon_gcm_aad(&gcm, aad, aad_len);
+	atcac_neon_gcm_decrypt(&gcm, data, data, len);
+	if (memcmp(data, plaintext, len) != 0 ||
+	    atcac_neon_gcm_check_tag(&gcm, tag, ATCAC_NEON_GCM_MIN_TAG_SIZE) !=
+	    0) {
+		return -1;
+	}
+	(void)selftest_hex(data, sizeof(data), v->ciphertext);
+	(void)atcac_neon_gcm_init(&gcm, key, sizeof(key), iv, iv_len);
+	(void)atcac_neon_gcm_aad(&gcm, aad, aad_len);
+	atcac_neon_gcm_decrypt(&gcm, data, data, len);
+	if (atcac_neon_gcm_check_tag(&gcm, tag, 4) == 0) {
+		return -1;
+	}
+	tag[15] ^= 1;
+	(void)selftest_hex(data, sizeof(data), v->ciphertext);
+	(void)atcac_neon_gcm_init(&gcm, key, sizeof(key), iv, iv_len);
+	(void)atcac_neon_gcm_aad(&gcm, aad, aad_len);
+	atcac_neon_gcm_decrypt(&gcm, data, data, len);
+
+	return atcac_neon_gcm_check_tag(&gcm, tag, sizeof(tag)) != 0 ? 0 : -1;
+}
+
+static int
+selftest_gcm(const char **failed)
+{
+	size_t i;
+
+	for (i = 0; i < sizeof(gcm_vectors) / sizeof(gcm_vectors[0]); ++i) {
+		/* At once and in pieces across the block boundaries */
+		if (selftest_gcm_one(&gcm_vectors[i], 64) != 0 ||
+		    selftest_gcm_one(&gcm_vectors[i], 7) != 0) {
+			return selftest_fail(failed, gcm_vectors[i].name);
+		}
+	}
+
+	return 0;
+}
+
+static int
+selftest_p256(const char **failed)
+{
+	uint8_t public_key[64];
+	uint8_t signature[64];
+	uint8_t digest[32];
+
+	(void)selftest_hex(public_key, sizeof(public_key), p256_public_key);
+	(void)selftest_hex(signature, sizeof(signature), p256_signature);
+	atcac_neon_sha256("sample", 6, digest);
+
+	if (!atcac_neon_p256_verify(public_key, digest, signature)) {
+		return selftest_fail(failed, "p256 verify");
+	}
+
+	digest[0] ^= 1;
+	if (atcac_neon_p256_verify(public_key, digest, signature)) {
+		return selftest_fail(failed, "p256 wrong digest");
+	}
+	digest[0] ^= 1;
+
+	signature[63] ^= 1;
+	if (atcac_neon_p256_verify(public_key, digest, signature)) {
+		return selftest_fail(failed, "p256 wrong signature");
+	}
+	signature[63] ^= 1;
+
+	public_key[63] ^= 1;
+	if (atcac_neon_p256_verify(public_key, digest, signature)) {
+		return selftest_fail(failed, "p256 not on curve");
+	}
+	public_key[63] ^= 1;
+
+	memset(signature, 0, 32);
+	if (atcac_neon_p256_verify(public_key, digest, signature)) {
+		return selftest_fail(failed, "p256 zero r");
+	}
+
+	return 0;
+}
+
+int
+atcac_neon_selftest(const char **failed)
+{
+	if (selftest_sha256(failed) != 0 || selftest_aes(failed) != 0 ||
+	    selftest_ctr(failed) != 0 || selftest_gcm(failed) != 0 ||
+	    selftest_p256(failed) != 0) {
+		return -1;
+	}
+
+	return 0;
+}
+
+#ifdef ATCAC_NEON_SELFTEST_MAIN
+int
+main(void)
+{
+	const char *failed;
+
+	if (atcac_neon_selftest(&failed) != 0) {
+		printf("FAILED: %s\n", failed);
+		return 1;
+	}
+
+	puts("All tests passed");
+	return 0;
+}
+#endif
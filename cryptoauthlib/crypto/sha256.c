@@ -0,0 +1,283 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "atcac_neon.h"
+
+#include <string.h>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+static const uint32_t sha256_k[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+	0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+	0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+	0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+	0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+	0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+	0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+	0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+#define SHA256_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define SHA256_S0(x) \
+    (SHA256_ROTR(x, 2) ^ SHA256_ROTR(x, 13) ^ SHA256_ROTR(x, 22))
+#define SHA256_S1(x) \
+    (SHA256_ROTR(x, 6) ^ SHA256_ROTR(x, 11) ^ SHA256_ROTR(x, 25))
+#define SHA256_CH(x, y, z) (((x) & ((y) ^ (z))) ^ (z))
+#define SHA256_MAJ(x, y, z) (((x) & (y)) | ((z) & ((x) | (y))))
+
+#define SHA256_ROUND(a, b, c, d, e, f, g, h, i) \
+	do { \
+		uint32_t t1 = h + SHA256_S1(e) + SHA256_CH(e, f, g) + wk[i]; \
+		uint32_t t2 = SHA256_S0(a) + SHA256_MAJ(a, b, c); \
+		d += t1; \
+		h = t1 + t2; \
+	} while (0)
+
+#ifdef __ARM_NEON
+/* The shifts have to be constants, hence macros */
+#define SHA256_ROTR_Q(x, n) vsriq_n_u32(vshlq_n_u32(x, 32 - (n)), x, n)
+#define SHA256_ROTR_D(x, n) vsri_n_u32(vshl_n_u32(x, 32 - (n)), x, n)
+
+static inline uint32x4_t
+sha256_sigma0(uint32x4_t x)
+{
+	return veorq_u32(veorq_u32(SHA256_ROTR_Q(x, 7), SHA256_ROTR_Q(x, 18)),
+	    vshrq_n_u32(x, 3));
+}
+
+static inline uint32x2_t
+sha256_sigma1(uint32x2_t x)
+{
+	return veor_u32(veor_u32(SHA256_ROTR_D(x, 17), SHA256_ROTR_D(x, 19)),
+	    vshr_n_u32(x, 10));
+}
+
+/*
+ * W[t] + K[t] of a block. Four words of the schedule depend on the 16 before
+ * them, except for the sigma1 term of the upper two, which needs the lower
+ * two. So they are computed in two halves.
+ */
+static void
+sha256_schedule(const uint8_t *block, uint32_t wk[64])
+{
+	uint32x4_t x0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(block)));
+	uint32x4_t x1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(block + 16)));
+	uint32x4_t x2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(block + 32)));
+	uint32x4_t x3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(block + 48)));
+	int t;
+
+	vst1q_u32(&wk[0], vaddq_u32(x0, vld1q_u32(&sha256_k[0])));
+	vst1q_u32(&wk[4], vaddq_u32(x1, vld1q_u32(&sha256_k[4])));
+	vst1q_u32(&wk[8], vaddq_u32(x2, vld1q_u32(&sha256_k[8])));
+	vst1q_u32(&wk[12], vaddq_u32(x3, vld1q_u32(&sha256_k[12])));
+
+	for (t = 16; t < 64; t += 4) {
+		uint32x4_t w;
+		uint32x2_t lo;
+		uint32x2_t hi;
+
+		w = vaddq_u32(x0, sha256_sigma0(vextq_u32(x0, x1, 1)));
+		w = vaddq_u32(w, vextq_u32(x2, x3, 1));
+		lo = vadd_u32(vget_low_u32(w), sha256_sigma1(vget_high_u32(x3)));
+		hi = vadd_u32(vget_high_u32(w), sha256_sigma1(lo));
+		w = vcombine_u32(lo, hi);
+
+		vst1q_u32(&wk[t], vaddq_u32(w, vld1q_u32(&sha256_k[t])));
+		x0 = x1;
+		x1 = x2;
+		x2 = x3;
+		x3 = w;
+	}
+}
+#else
+static void
+sha256_schedule(const uint8_t *block, uint32_t wk[64])
+{
+	uint32_t w[64];
+	int t;
+
+	for (t = 0; t < 16; ++t) {
+		w[t] = ((uint32_t)block[4 * t] << 24) |
+		    ((uint32_t)block[4 * t + 1] << 16) |
+		    ((uint32_t)block[4 * t + 2] << 8) | block[4 * t + 3];
+	}
+	for (t = 16; t < 64; ++t) {
+		uint32_t s0 = SHA256_ROTR(w[t - 15], 7) ^
+		    SHA256_ROTR(w[t - 15], 18) ^ (w[t - 15] >> 3);
+		uint32_t s1 = SHA256_ROTR(w[t - 2], 17) ^
+		    SHA256_ROTR(w[t - 2], 19) ^ (w[t - 2] >> 10);
+
+		w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+	}
+	for (t = 0; t < 64; ++t) {
+		wk[t] = w[t] + sha256_k[t];
+	}
+}
+#endif
+
+static void
+sha256_blocks(uint32_t state[8], const uint8_t *data, size_t blocks)
+{
+	uint32_t wk[64];
+
+	while (blocks > 0) {
+		uint32_t a = state[0];
+		uint32_t b = state[1];
+		uint32_t c = state[2];
+		uint32_t d = state[3];
+		uint32_t e = state[4];
+		uint32_t f = state[5];
+		uint32_t g = state[6];
+		uint32_t h = state[7];
+		int i;
+
+		sha256_schedule(data, wk);
+
+		for (i = 0; i < 64; i += 8) {
+			SHA256_ROUND(a, b, c, d, e, f, g, h, i);
+			SHA256_ROUND(h, a, b, c, d, e, f, g, i + 1);
+			SHA256_ROUND(g, h, a, b, c, d, e, f, i + 2);
+			SHA256_ROUND(f, g, h, a, b, c, d, e, i + 3);
+			SHA256_ROUND(e, f, g, h, a, b, c, d, i + 4);
+			SHA256_ROUND(d, e, f, g, h, a, b, c, i + 5);
+			SHA256_ROUND(c, d, e, f, g, h, a, b, i + 6);
+			SHA256_ROUND(b, c, d, e, f, g, h, a, i + 7);
+		}
+
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+		state[4] += e;
+		state[5] += f;
+		state[6] += g;
+		state[7] += h;
+
+		data += 64;
+		--blocks;
+	}
+}
+
+void
+atcac_neon_sha256_init(struct atcac_neon_sha256 *ctx)
+{
+	static const uint32_t initial[8] = {
+		0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+		0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+	};
+
+	memcpy(ctx->state, initial, sizeof(ctx->state));
+	ctx->len = 0;
+	ctx->used = 0;
+}
+
+void
+atcac_neon_sha256_update(struct atcac_neon_sha256 *ctx, const void *data,
+    size_t len)
+{
+	const uint8_t *in = data;
+
+	if (len == 0) {
+		return;
+	}
+	ctx->len += len;
+
+	if (ctx->used > 0) {
+		size_t n = sizeof(ctx->block) - ctx->used;
+
+		if (n > len) {
+			n = len;
+		}
+		memcpy(&ctx->block[ctx->used], in, n);
+		ctx->used += n;
+		in += n;
+		len -= n;
+		if (ctx->used < sizeof(ctx->block)) {
+			return;
+		}
+		sha256_blocks(ctx->state, ctx->block, 1);
+		ctx->used = 0;
+	}
+
+	/* Full blocks directly from the caller's buffer */
+	sha256_blocks(ctx->state, in, len / 64);
+	in += len & ~(size_t)63;
+	len &= 63;
+
+	memcpy(ctx->block, in, len);
+	ctx->used = len;
+}
+
+void
+atcac_neon_sha256_finish(struct atcac_neon_sha256 *ctx,
+    uint8_t digest[ATCAC_NEON_SHA256_DIGEST_SIZE])
+{
+	uint64_t bits = ctx->len * 8;
+	int i;
+
+	ctx->block[ctx->used] = 0x80;
+	++ctx->used;
+	if (ctx->used > 56) {
+		memset(&ctx->block[ctx->used], 0, 64 - ctx->used);
+		sha256_blocks(ctx->state, ctx->block, 1);
+		ctx->used = 0;
+	}
+	memset(&ctx->block[ctx->used], 0, 56 - ctx->used);
+	for (i = 0; i < 8; ++i) {
+		ctx->block[56 + i] = (uint8_t)(bits >> (56 - 8 * i));
+	}
+	sha256_blocks(ctx->state, ctx->block, 1);
+
+	for (i = 0; i < 8; ++i) {
+		digest[4 * i] = (uint8_t)(ctx->state[i] >> 24);
+		digest[4 * i + 1] = (uint8_t)(ctx->state[i] >> 16);
+		digest[4 * i + 2] = (uint8_t)(ctx->state[i] >> 8);
+		digest[4 * i + 3] = (uint8_t)ctx->state[i];
+	}
+}
+
+void
+atcac_neon_sha256(const void *data, size_t len,
+    uint8_t digest[ATCAC_NEON_SHA256_DIGEST_SIZE])
+{
+	struct atcac_neon_sha256 ctx;
+
+	atcac_neon_sha256_init(&ctx);
+	atcac_neon_sha256_update(&ctx, data, len);
+	atcac_neon_sha256_finish(&ctx, digest);
+}
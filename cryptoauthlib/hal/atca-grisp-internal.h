@@ -0,0 +1,66 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ATCA_GRISP_INTERNAL_H
+#define ATCA_GRISP_INTERNAL_H
+
+#include "atca_grisp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Used by the cryptoauthlib HAL callbacks, all with the lock held */
+
+void atca_grisp_lock(void);
+
+void atca_grisp_unlock(void);
+
+bool atca_grisp_in_burst(void);
+
+/* Open the default bus unless it is open already */
+ATCA_STATUS atca_grisp_open_default(void);
+
+/* Wake the device unless it is awake already */
+ATCA_STATUS atca_grisp_awake(void);
+
+ATCA_STATUS atca_grisp_idle(void);
+
+/*
+ * Send a command packet (count, opcode, parameters, data and CRC). Wakes the
+ * device again first if the watchdog could expire during the command.
+ */
+ATCA_STATUS atca_grisp_send_packet(const uint8_t *packet, size_t len);
+
+/* Read from the device, the first read after a command polls */
+ATCA_STATUS atca_grisp_read(uint8_t *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* ATCA_GRISP_INTERNAL_H */
@@ -0,0 +1,822 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "atca-grisp-internal.h"
+
+#include <dev/i2c/i2c.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/config.h>
+#include <rtems/thread.h>
+
+#define ATCA_GRISP_WORD_SLEEP 0x01
+#define ATCA_GRISP_WORD_IDLE 0x02
+#define ATCA_GRISP_WORD_COMMAND 0x03
+
+/* Count, opcode, param1, param2 and CRC */
+#define ATCA_GRISP_CMD_OVERHEAD 7
+/* Count and CRC */
+#define ATCA_GRISP_RSP_OVERHEAD 3
+#define ATCA_GRISP_MAX_RESPONSE 155
+
+/* Time from the wake condition until the device accepts a command */
+#define ATCA_GRISP_WAKE_HIGH_US 1500
+#define ATCA_GRISP_WAKE_TRIES 3
+
+/*
+ * The watchdog sends the device to sleep about 1.3 s after the wake. A command
+ * is only started if it ends before this budget is used up.
+ */
+#define ATCA_GRISP_WATCHDOG_US 1000000
+
+#define ATCA_GRISP_POLL_US 250
+#define ATCA_GRISP_TIMEOUT_MARGIN_US 10000
+
+/*
+ * Maximum execution times of the ATECC608 with the default clock divider
+ * (the same as in cryptoauthlib) and the measured time of the last commands.
+ */
+struct atca_grisp_timing {
+	uint8_t opcode;
+	uint16_t max_ms;
+	uint32_t typical_us;
+};
+
+static struct atca_grisp_timing atca_grisp_timings[] = {
+	{ 0x51, 27, 0 },	/* AES */
+	{ 0x28, 40, 0 },	/* CheckMac */
+	{ 0x24, 25, 0 },	/* Counter */
+	{ 0x1c, 50, 0 },	/* DeriveKey */
+	{ 0x43, 75, 0 },	/* ECDH */
+	{ 0x15, 25, 0 },	/* GenDig */
+	{ 0x40, 115, 0 },	/* GenKey */
+	{ 0x30, 5, 0 },		/* Info */
+	{ 0x56, 165, 0 },	/* KDF */
+	{ 0x17, 35, 0 },	/* Lock */
+	{ 0x08, 55, 0 },	/* MAC */
+	{ 0x16, 20, 0 },	/* Nonce */
+	{ 0x46, 50, 0 },	/* PrivWrite */
+	{ 0x1b, 23, 0 },	/* Random */
+	{ 0x02, 5, 0 },		/* Read */
+	{ 0x80, 80, 0 },	/* SecureBoot */
+	{ 0x77, 250, 0 },	/* SelfTest */
+	{ 0x41, 60, 0 },	/* Sign */
+	{ 0x47, 25, 0 },	/* SHA */
+	{ 0x20, 10, 0 },	/* UpdateExtra */
+	{ 0x45, 72, 0 },	/* Verify */
+	{ 0x12, 45, 0 },	/* Write */
+};
+
+/* For opcodes that aren't in the table */
+static struct atca_grisp_timing atca_grisp_unknown_timing = { 0, 250, 0 };
+
+static void atca_grisp_default_delay_us(uint32_t us);
+
+static struct {
+	rtems_recursive_mutex mutex;
+	int fd;
+	uint16_t address;
+	bool awake;
+	unsigned burst;
+	bool polling;
+	void (*delay_us)(uint32_t us);
+	uint64_t wake_ns;
+	/* The command that waits for its response */
+	struct atca_grisp_timing *pending;
+	uint64_t sent_ns;
+	uint8_t packet[1 + ATCA_GRISP_CMD_OVERHEAD + ATCA_GRISP_MAX_DATA];
+	uint8_t response[ATCA_GRISP_MAX_RESPONSE];
+} atca_grisp = {
+	.mutex = RTEMS_RECURSIVE_MUTEX_INITIALIZER("ATCA"),
+	.fd = -1,
+	.polling = true,
+	.delay_us = atca_grisp_default_delay_us,
+};
+
+static uint64_t
+atca_grisp_now_ns(void)
+{
+	return rtems_clock_get_uptime_nanoseconds();
+}
+
+/*
+ * A sleep of n ticks ends between n - 1 and n ticks later. Sleep for the full
+ * ticks that surely fit and busy wait for the rest.
+ */
+static void
+atca_grisp_default_delay_us(uint32_t us)
+{
+	uint64_t end = atca_grisp_now_ns() + (uint64_t)us * 1000;
+	uint32_t us_per_tick = rtems_configuration_get_microseconds_per_tick();
+
+	if (us >= us_per_tick) {
+		(void)rtems_task_wake_after(us / us_per_tick);
+	}
+	while (atca_grisp_now_ns() < end) {
+		/* Busy wait */
+	}
+}
+
+static struct atca_grisp_timing *
+atca_grisp_timing(uint8_t opcode)
+{
+	size_t i;
+
+	for (i = 0; i < RTEMS_ARRAY_SIZE(atca_grisp_timings); ++i) {
+		if (atca_grisp_timings[i].opcode == opcode) {
+			return &atca_grisp_timings[i];
+		}
+	}
+
+	return &atca_grisp_unknown_timing;
+}
+
+/* CRC-16 of the device, polynomial 0x8005, bits in reversed order */
+static void
+atca_grisp_crc(const uint8_t *data, size_t len, uint8_t crc_le[2])
+{
+	uint16_t crc = 0;
+	size_t i;
+
+	for (i = 0; i < len; ++i) {
+		uint8_t bit;
+
+		for (bit = 0x01; bit != 0; bit = (uint8_t)(bit << 1)) {
+			bool data_bit = (data[i] & bit) != 0;
+			bool crc_bit = (crc >> 15) != 0;
+
+			crc = (uint16_t)(crc << 1);
+			if (data_bit != crc_bit) {
+				crc ^= 0x8005;
+			}
+		}
+	}
+
+	crc_le[0] = (uint8_t)crc;
+	crc_le[1] = (uint8_t)(crc >> 8);
+}
+
+static int
+atca_grisp_transfer(uint16_t address, uint16_t flags, uint8_t *buf,
+    size_t len)
+{
+	struct i2c_msg msg = {
+		.addr = address,
+		.flags = flags,
+		.len = (uint16_t)len,
+		.buf = buf,
+	};
+	struct i2c_rdwr_ioctl_data work_queue = {
+		.msgs = &msg,
+		.nmsgs = 1,
+	};
+
+	return ioctl(atca_grisp.fd, I2C_RDWR, &work_queue);
+}
+
+static ATCA_STATUS
+atca_grisp_write_word(uint8_t word)
+{
+	if (atca_grisp_transfer(atca_grisp.address, 0, &word, 1) != 0) {
+		return ATCA_COMM_FAIL;
+	}
+
+	return ATCA_SUCCESS;
+}
+
+static ATCA_STATUS
+atca_grisp_wake(void)
+{
+	static const uint8_t wake_response[] = { 0x04, 0x11, 0x33, 0x43 };
+	int try;
+
+	for (try = 0; try < ATCA_GRISP_WAKE_TRIES; ++try) {
+		uint8_t buf[sizeof(wake_response)] = { 0 };
+
+		/*
+		 * The address 0 holds SDA low for 80 us at the 100 kHz of the
+		 * bus, longer than the 60 us of the wake condition. Nobody
+		 * acknowledges it.
+		 */
+		(void)atca_grisp_transfer(0, 0, buf, 1);
+		(*atca_grisp.delay_us)(ATCA_GRISP_WAKE_HIGH_US);
+
+		if (atca_grisp_transfer(atca_grisp.address, I2C_M_RD, buf,
+		    sizeof(buf)) == 0) {
+			if (memcmp(buf, wake_response, sizeof(buf)) == 0) {
+				atca_grisp.awake = true;
+				atca_grisp.wake_ns = atca_grisp_now_ns();
+				return ATCA_SUCCESS;
+			}
+
+			/*
+			 * It was awake already (e.g. after a restart of the
+			 * application), so the watchdog time is unknown.
+			 */
+			(void)atca_grisp_write_word(ATCA_GRISP_WORD_IDLE);
+		}
+	}
+
+	atca_grisp.awake = false;
+	return ATCA_WAKE_FAILED;
+}
+
+void
+atca_grisp_lock(void)
+{
+	rtems_recursive_mutex_lock(&atca_grisp.mutex);
+}
+
+void
+atca_grisp_unlock(void)
+{
+	rtems_recursive_mutex_unlock(&atca_grisp.mutex);
+}
+
+bool
+atca_grisp_in_burst(void)
+{
+	return atca_grisp.burst > 0;
+}
+
+ATCA_STATUS
+atca_grisp_open(const char *bus, uint8_t address)
+{
+	ATCA_STATUS status = ATCA_SUCCESS;
+	int fd;
+
+	atca_grisp_lock();
+	fd = open(bus, O_RDWR);
+	if (fd >= 0) {
+		if (atca_grisp.fd >= 0) {
+			close(atca_grisp.fd);
+		}
+		atca_grisp.fd = fd;
+		atca_grisp.address = address;
+		atca_grisp.awake = false;
+		atca_grisp.pending = NULL;
+	} else {
+		status = ATCA_COMM_FAIL;
+	}
+	atca_grisp_unlock();
+
+	return status;
+}
+
+ATCA_STATUS
+atca_grisp_open_default(void)
+{
+	if (atca_grisp.fd >= 0) {
+		return ATCA_SUCCESS;
+	}
+
+	return atca_grisp_open(ATCA_GRISP_I2C_BUS, ATCA_GRISP_I2C_ADDRESS);
+}
+
+void
+atca_grisp_close(void)
+{
+	atca_grisp_lock();
+	if (atca_grisp.fd >= 0) {
+		(void)atca_grisp_sleep();
+		close(atca_grisp.fd);
+		atca_grisp.fd = -1;
+	}
+	atca_grisp_unlock();
+}
+
+void
+atca_grisp_set_delay(void (*delay_us)(uint32_t us))
+{
+	atca_grisp_lock();
+	atca_grisp.delay_us = delay_us != NULL ? delay_us :
+	    atca_grisp_default_delay_us;
+	atca_grisp_unlock();
+}
+
+void
+atca_grisp_set_polling(bool enable)
+{
+	atca_grisp_lock();
+	atca_grisp.polling = enable;
+	atca_grisp_unlock();
+}
+
+ATCA_STATUS
+atca_grisp_awake(void)
+{
+	if (atca_grisp.awake) {
+		return ATCA_SUCCESS;
+	}
+
+	return atca_grisp_wake();
+}
+
+ATCA_STATUS
+atca_grisp_idle(void)
+{
+	if (!atca_grisp.awake) {
+		return ATCA_SUCCESS;
+	}
+
+	atca_grisp.awake = false;
+	return atca_grisp_write_word(ATCA_GRISP_WORD_IDLE);
+}
+
+ATCA_STATUS
+atca_grisp_sleep(void)
+{
+	ATCA_STATUS status;
+
+	atca_grisp_lock();
+	/* Wake it up to make sure it is sleeping afterwards */
+	status = atca_grisp_open_default();
+	if (status == ATCA_SUCCESS) {
+		status = atca_grisp_awake();
+	}
+	if (status == ATCA_SUCCESS) {
+		atca_grisp.awake = false;
+		status = atca_grisp_write_word(ATCA_GRISP_WORD_SLEEP);
+	}
+	atca_grisp_unlock();
+
+	return status;
+}
+
+void
+atca_grisp_burst_begin(void)
+{
+	atca_grisp_lock();
+	++atca_grisp.burst;
+}
+
+ATCA_STATUS
+atca_grisp_burst_end(void)
+{
+	ATCA_STATUS status = ATCA_SUCCESS;
+
+	--atca_grisp.burst;
+	if (atca_grisp.burst == 0) {
+		status = atca_grisp_idle();
+	}
+	atca_grisp_unlock();
+
+	return status;
+}
+
+ATCA_STATUS
+atca_grisp_send_packet(const uint8_t *packet, size_t len)
+{
+	struct atca_grisp_timing *timing;
+	ATCA_STATUS status;
+
+	if (len < ATCA_GRISP_CMD_OVERHEAD ||
+	    len > sizeof(atca_grisp.packet) - 1) {
+		return ATCA_BAD_PARAM;
+	}
+	timing = atca_grisp_timing(packet[1]);
+
+	if (atca_grisp.awake) {
+		uint64_t awake_us = (atca_grisp_now_ns() - atca_grisp.wake_ns) /
+		    1000;
+
+		/* Idle restarts the watchdog and keeps the TempKey */
+		if (awake_us + timing->max_ms * 1000U >
+		    ATCA_GRISP_WATCHDOG_US) {
+			(void)atca_grisp_idle();
+		}
+	}
+	status = atca_grisp_awake();
+	if (status != ATCA_SUCCESS) {
+		return status;
+	}
+
+	if (packet != &atca_grisp.packet[1]) {
+		memcpy(&atca_grisp.packet[1], packet, len);
+	}
+	atca_grisp.packet[0] = ATCA_GRISP_WORD_COMMAND;
+	if (atca_grisp_transfer(atca_grisp.address, 0, atca_grisp.packet,
+	    len + 1) != 0) {
+		atca_grisp.pending = NULL;
+		return ATCA_TX_FAIL;
+	}
+
+	atca_grisp.pending = timing;
+	atca_grisp.sent_ns = atca_grisp_now_ns();
+	return ATCA_SUCCESS;
+}
+
+/*
+ * The device doesn't acknowledge its address until the command is done. The
+ * first poll is at 7/8 of the average execution time. If it succeeds, the
+ * average moves down, so it follows changes in both directions.
+ */
+static ATCA_STATUS
+atca_grisp_poll(struct atca_grisp_timing *timing, uint8_t *buf, size_t len)
+{
+	uint32_t max_us = timing->max_ms * 1000U;
+	uint32_t first_us;
+
+	if (!atca_grisp.polling) {
+		first_us = max_us;
+	} else {
+		first_us = timing->typical_us - timing->typical_us / 8;
+	}
+
+	for (;;) {
+		uint64_t now = atca_grisp_now_ns();
+		uint32_t elapsed_us = (uint32_t)((now - atca_grisp.sent_ns) /
+		    1000);
+
+		if (elapsed_us < first_us) {
+			(*atca_grisp.delay_us)(first_us - elapsed_us);
+			continue;
+		}
+
+		if (atca_grisp_transfer(atca_grisp.address, I2C_M_RD, buf,
+		    len) == 0) {
+			if (!atca_grisp.polling) {
+				/* The maximum says nothing */
+			} else if (timing->typical_us == 0) {
+				timing->typical_us = elapsed_us;
+			} else {
+				timing->typical_us = (uint32_t)(
+				    (int32_t)timing->typical_us +
+				    ((int32_t)elapsed_us -
+				    (int32_t)timing->typical_us) / 4);
+			}
+			return ATCA_SUCCESS;
+		}
+
+		if (elapsed_us > max_us + ATCA_GRISP_TIMEOUT_MARGIN_US) {
+			return ATCA_RX_TIMEOUT;
+		}
+		(*atca_grisp.delay_us)(ATCA_GRISP_POLL_US);
+	}
+}
+
+ATCA_STATUS
+atca_grisp_read(uint8_t *buf, size_t len)
+{
+	struct atca_grisp_timing *timing = atca_grisp.pending;
+
+	if (timing != NULL) {
+		atca_grisp.pending = NULL;
+		return atca_grisp_poll(timing, buf, len);
+	}
+
+	if (atca_grisp_transfer(atca_grisp.address, I2C_M_RD, buf, len) != 0) {
+		return ATCA_RX_NO_RESPONSE;
+	}
+
+	return ATCA_SUCCESS;
+}
+
+static ATCA_STATUS
+atca_grisp_status(uint8_t status)
+{
+	switch (status) {
+	case 0x00:
+		return ATCA_SUCCESS;
+	case 0x01:
+		return ATCA_CHECKMAC_VERIFY_FAILED;
+	case 0x03:
+		return ATCA_PARSE_ERROR;
+	case 0x05:
+		return ATCA_STATUS_ECC;
+	case 0x07:
+		return ATCA_STATUS_SELFTEST_ERROR;
+	case 0x08:
+		return ATCA_HEALTH_TEST_ERROR;
+	case 0x0f:
+		return ATCA_EXECUTION_ERROR;
+	case 0x11:
+		return ATCA_WAKE_SUCCESS;
+	case 0xee:
+		return ATCA_WATCHDOG_ABOUT_TO_EXPIRE;
+	case 0xff:
+		return ATCA_STATUS_CRC;
+	default:
+		return ATCA_STATUS_UNKNOWN;
+	}
+}
+
+static ATCA_STATUS
+atca_grisp_receive_response(struct atca_grisp_cmd *cmd)
+{
+	uint8_t *rsp = atca_grisp.response;
+	uint8_t crc[2];
+	size_t count;
+	size_t data_len;
+	ATCA_STATUS status;
+
+	/* The count first, the rest follows in a second read */
+	status = atca_grisp_read(&rsp[0], 1);
+	if (status != ATCA_SUCCESS) {
+		return status;
+	}
+	count = rsp[0];
+	if (count < ATCA_GRISP_RSP_OVERHEAD + 1 ||
+	    count > sizeof(atca_grisp.response)) {
+		return ATCA_RX_FAIL;
+	}
+	status = atca_grisp_read(&rsp[1], count - 1);
+	if (status != ATCA_SUCCESS) {
+		return status;
+	}
+
+	atca_grisp_crc(rsp, count - 2, crc);
+	if (memcmp(crc, &rsp[count - 2], sizeof(crc)) != 0) {
+		return ATCA_RX_CRC_ERROR;
+	}
+
+	data_len = count - ATCA_GRISP_RSP_OVERHEAD;
+	if (data_len == 1) {
+		status = atca_grisp_status(rsp[1]);
+		if (status != ATCA_SUCCESS) {
+			return status;
+		}
+	}
+	if (data_len > cmd->response_size) {
+		return ATCA_SMALL_BUFFER;
+	}
+	memcpy(cmd->response, &rsp[1], data_len);
+	cmd->response_len = data_len;
+
+	return ATCA_SUCCESS;
+}
+
+static ATCA_STATUS
+atca_grisp_run(struct atca_grisp_cmd *cmd)
+{
+	uint8_t *packet = &atca_grisp.packet[1];
+	size_t count = ATCA_GRISP_CMD_OVERHEAD + cmd->data_len;
+	ATCA_STATUS status;
+	int try;
+
+	if (cmd->data_len > ATCA_GRISP_MAX_DATA) {
+		return ATCA_BAD_PARAM;
+	}
+
+	for (try = 0; try < 2; ++try) {
+		packet[0] = (uint8_t)count;
+		packet[1] = cmd->opcode;
+		packet[2] = cmd->param1;
+		packet[3] = (uint8_t)cmd->param2;
+		packet[4] = (uint8_t)(cmd->param2 >> 8);
+		if (cmd->data_len > 0) {
+			memcpy(&packet[5], cmd->data, cmd->data_len);
+		}
+		atca_grisp_crc(packet, count - 2, &packet[count - 2]);
+
+		status = atca_grisp_send_packet(packet, count);
+		if (status == ATCA_SUCCESS) {
+			status = atca_grisp_receive_response(cmd);
+		}
+
+		/*
+		 * The device refused to start the command because of the
+		 * watchdog. Once more with a fresh wake.
+		 */
+		if (status != ATCA_WATCHDOG_ABOUT_TO_EXPIRE) {
+			break;
+		}
+		(void)atca_grisp_idle();
+	}
+
+	return status;
+}
+
+ATCA_STATUS
+atca_grisp_execute(struct atca_grisp_cmd *cmds, size_t count)
+{
+	ATCA_STATUS status;
+	size_t i;
+
+	for (i = 0; i < count; ++i) {
+		cmds[i].response_len = 0;
+	}
+
+	atca_grisp_lock();
+	status = atca_grisp_open_default();
+	for (i = 0; i < count && status == ATCA_SUCCESS; ++i) {
+		status = atca_grisp_run(&cmds[i]);
+	}
+	if (atca_grisp.burst == 0) {
+		ATCA_STATUS idle_status = atca_grisp_idle();
+
+		if (status == ATCA_SUCCESS) {
+			status = idle_status;
+		}
+	}
+	atca_grisp_unlock();
+
+	return status;
+}
+
+ATCA_STATUS
+atca_grisp_get_pubkey(uint16_t key_id, uint8_t public_key[64])
+{
+	struct atca_grisp_cmd cmd = {
+		.opcode = ATCA_GRISP_OP_GENKEY,
+		.param1 = 0x00,	/* Public key of the private key */
+		.param2 = key_id,
+		.response = public_key,
+		.response_size = 64,
+	};
+	ATCA_STATUS status;
+
+	status = atca_grisp_execute(&cmd, 1);
+	if (status == ATCA_SUCCESS && cmd.response_len != 64) {
+		status = ATCA_RX_FAIL;
+	}
+
+	return status;
+}
+
+ATCA_STATUS
+atca_grisp_sign(uint16_t key_id, const uint8_t message[32],
+    uint8_t signature[64])
+{
+	uint8_t nonce_status;
+	struct atca_grisp_cmd cmds[] = {
+		{
+			.opcode = ATCA_GRISP_OP_NONCE,
+			.param1 = 0x03,	/* Pass-through to the TempKey */
+			.data = message,
+			.data_len = 32,
+			.response = &nonce_status,
+			.response_size = 1,
+		}, {
+			.opcode = ATCA_GRISP_OP_SIGN,
+			.param1 = 0x80,	/* External message in the TempKey */
+			.param2 = key_id,
+			.response = signature,
+			.response_size = 64,
+		}
+	};
+	ATCA_STATUS status;
+
+	status = atca_grisp_execute(cmds, RTEMS_ARRAY_SIZE(cmds));
+	if (status == ATCA_SUCCESS && cmds[1].response_len != 64) {
+		status = ATCA_RX_FAIL;
+	}
+
+	return status;
+}
+
+ATCA_STATUS
+atca_grisp_verify_extern(const uint8_t message[32],
+    const uint8_t signature[64], const uint8_t public_key[64],
+    bool *verified)
+{
+	uint8_t nonce_status;
+	uint8_t verify_status;
+	uint8_t data[128];
+	struct atca_grisp_cmd cmds[] = {
+		{
+			.opcode = ATCA_GRISP_OP_NONCE,
+			.param1 = 0x03,	/* Pass-through to the TempKey */
+			.data = message,
+			.data_len = 32,
+			.response = &nonce_status,
+			.response_size = 1,
+		}, {
+			.opcode = ATCA_GRISP_OP_VERIFY,
+			.param1 = 0x02,	/* External public key */
+			.param2 = 0x0004,	/* P-256 */
+			.data = data,
+			.data_len = sizeof(data),
+			.response = &verify_status,
+			.response_size = 1,
+		}
+	};
+	ATCA_STATUS status;
+
+	memcpy(&data[0], signature, 64);
+	memcpy(&data[64], public_key, 64);
+
+	status = atca_grisp_execute(cmds, RTEMS_ARRAY_SIZE(cmds));
+	*verified = status == ATCA_SUCCESS;
+	if (status == ATCA_CHECKMAC_VERIFY_FAILED) {
+		status = ATCA_SUCCESS;
+	}
+
+	return status;
+}
+
+ATCA_STATUS
+atca_grisp_ecdh(uint16_t key_id, const uint8_t public_key[64],
+    uint8_t pms[32])
+{
+	struct atca_grisp_cmd cmd = {
+		.opcode = ATCA_GRISP_OP_ECDH,
+		.param1 = 0x00,	/* Output like atcab_ecdh() */
+		.param2 = key_id,
+		.data = public_key,
+		.data_len = 64,
+		.response = pms,
+		.response_size = 32,
+	};
+	ATCA_STATUS status;
+
+	status = atca_grisp_execute(&cmd, 1);
+	if (status == ATCA_SUCCESS && cmd.response_len != 32) {
+		/* The slot configuration writes the secret to a slot */
+		status = ATCA_RX_FAIL;
+	}
+
+	return status;
+}
+
+/* Commands per atca_grisp_execute() call, they all run in one burst */
+#define ATCA_GRISP_SHA_BATCH 8
+
+ATCA_STATUS
+atca_grisp_sha256(const uint8_t *data, size_t len, uint8_t digest[32])
+{
+	struct atca_grisp_cmd cmds[ATCA_GRISP_SHA_BATCH];
+	uint8_t block_status[ATCA_GRISP_SHA_BATCH];
+	size_t queued = 0;
+	size_t digest_len = 0;
+	bool start = true;
+	bool end = false;
+	ATCA_STATUS status = ATCA_SUCCESS;
+
+	atca_grisp_burst_begin();
+	while (!end && status == ATCA_SUCCESS) {
+		struct atca_grisp_cmd *cmd = &cmds[queued];
+
+		memset(cmd, 0, sizeof(*cmd));
+		cmd->opcode = ATCA_GRISP_OP_SHA;
+		cmd->response = &block_status[queued];
+		cmd->response_size = 1;
+		if (start) {
+			cmd->param1 = 0x00;
+			start = false;
+		} else if (len >= 64) {
+			cmd->param1 = 0x01;
+			cmd->param2 = 64;
+			cmd->data = data;
+			cmd->data_len = 64;
+			data += 64;
+			len -= 64;
+		} else {
+			/* The rest of the message, the padding is done inside */
+			cmd->param1 = 0x02;
+			cmd->param2 = (uint16_t)len;
+			cmd->data = data;
+			cmd->data_len = len;
+			cmd->response = digest;
+			cmd->response_size = 32;
+			end = true;
+		}
+		++queued;
+
+		if (queued == ATCA_GRISP_SHA_BATCH || end) {
+			status = atca_grisp_execute(cmds, queued);
+			digest_len = cmds[queued - 1].response_len;
+			queued = 0;
+		}
+	}
+	if (status == ATCA_SUCCESS && digest_len != 32) {
+		status = ATCA_RX_FAIL;
+	}
+	{
+		ATCA_STATUS idle_status = atca_grisp_burst_end();
+
+		if (status == ATCA_SUCCESS) {
+			status = idle_status;
+		}
+	}
+
+	return status;
+}
@@ -0,0 +1,174 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ATCA_GRISP_H
+#define ATCA_GRISP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cryptoauthlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * ATECC608 access for the GRiSP2 (microchip,atecc608 on i2c1 in the FDT).
+ *
+ * The stock I2C HAL of cryptoauthlib wakes the device for every atcab_*()
+ * call, waits the maximum execution time of the command from the datasheet
+ * and sends it back to idle afterwards. This HAL instead
+ *
+ * - keeps the device awake between atca_grisp_burst_begin() and
+ *   atca_grisp_burst_end() and only wakes it again when the watchdog of the
+ *   device (about 1.3 s after the wake) would expire during a command,
+ *
+ * - polls for the response: the device doesn't acknowledge its address while
+ *   it executes a command. The first poll is shortly before the execution
+ *   time measured for the last command with the same opcode,
+ *
+ * - runs a queue of commands (e.g. Nonce and Sign or the blocks of a SHA-256)
+ *   back to back with atca_grisp_execute(), without a wake and idle for each
+ *   of them.
+ *
+ * Idle keeps the TempKey of the device, sleep clears it. Commands that depend
+ * on each other therefore work across bursts as long as nothing calls
+ * atca_grisp_sleep() in between.
+ *
+ * All functions return the status codes of cryptoauthlib. The functions of
+ * this HAL are serialized with a mutex and a burst holds it, so other tasks
+ * wait until the burst ends. The atcab_*() functions of cryptoauthlib aren't
+ * thread safe and need the usual locking of the application.
+ */
+
+#define ATCA_GRISP_I2C_BUS "/dev/i2c-1"
+#define ATCA_GRISP_I2C_ADDRESS 0x36
+
+/* Opcodes of the commands used by the helpers below */
+#define ATCA_GRISP_OP_GENKEY 0x40
+#define ATCA_GRISP_OP_NONCE 0x16
+#define ATCA_GRISP_OP_SIGN 0x41
+#define ATCA_GRISP_OP_VERIFY 0x45
+#define ATCA_GRISP_OP_ECDH 0x43
+#define ATCA_GRISP_OP_SHA 0x47
+
+/* Largest data of a command (Verify with an external public key) */
+#define ATCA_GRISP_MAX_DATA 128
+
+/*
+ * Configuration for atcab_init(). cryptoauthlib has to be built with
+ * ATCA_HAL_CUSTOM.
+ */
+extern ATCAIfaceCfg cfg_atecc608_grisp;
+
+/*
+ * Open the I2C bus. Called by atcab_init() through cfg_atecc608_grisp and by
+ * the first function below, so calling it is only necessary for another bus
+ * or address (7 bit).
+ */
+ATCA_STATUS atca_grisp_open(const char *bus, uint8_t address);
+
+/* Send the device to sleep and close the bus */
+void atca_grisp_close(void);
+
+/*
+ * Replace the delay function. The default one sleeps for full clock ticks and
+ * busy waits the rest, so a driver with a finer timer (e.g. the hrtimer of
+ * the demo application) saves CPU time here.
+ */
+void atca_grisp_set_delay(void (*delay_us)(uint32_t us));
+
+/*
+ * With polling disabled every command waits the maximum execution time like
+ * the stock HAL does. Only useful to compare both. Enabled by default.
+ */
+void atca_grisp_set_polling(bool enable);
+
+/*
+ * Keep the device awake until the matching atca_grisp_burst_end(). Bursts can
+ * be nested. The caller owns the device for the whole burst.
+ */
+void atca_grisp_burst_begin(void);
+
+/* End a burst. The outermost one sends the device to idle. */
+ATCA_STATUS atca_grisp_burst_end(void);
+
+/* Send the device to sleep. This clears the TempKey. */
+ATCA_STATUS atca_grisp_sleep(void);
+
+/* One command of a queue */
+struct atca_grisp_cmd {
+	uint8_t opcode;
+	uint8_t param1;
+	uint16_t param2;
+	const uint8_t *data;
+	size_t data_len;
+	/* Response without count and CRC, status only responses included */
+	uint8_t *response;
+	size_t response_size;
+	/* Set to the length of the response */
+	size_t response_len;
+};
+
+/*
+ * Execute the commands in order within one wake. Stops at the first command
+ * that fails or returns a status other than success in a one byte response.
+ * The commands after it have a response_len of zero. Outside of a burst the
+ * device goes to idle afterwards.
+ */
+ATCA_STATUS atca_grisp_execute(struct atca_grisp_cmd *cmds, size_t count);
+
+/* Public key of the private key in a slot (GenKey) */
+ATCA_STATUS atca_grisp_get_pubkey(uint16_t key_id, uint8_t public_key[64]);
+
+/* Sign a message digest with the key in a slot (Nonce and Sign) */
+ATCA_STATUS atca_grisp_sign(uint16_t key_id, const uint8_t message[32],
+    uint8_t signature[64]);
+
+/*
+ * Verify a signature with an external P-256 public key (Nonce and Verify).
+ * A wrong signature isn't an error, it sets verified to false.
+ */
+ATCA_STATUS atca_grisp_verify_extern(const uint8_t message[32],
+    const uint8_t signature[64], const uint8_t public_key[64],
+    bool *verified);
+
+/* ECDH with the private key in a slot, the shared secret is returned clear */
+ATCA_STATUS atca_grisp_ecdh(uint16_t key_id, const uint8_t public_key[64],
+    uint8_t pms[32]);
+
+/* SHA-256 with the SHA commands of all blocks in one burst */
+ATCA_STATUS atca_grisp_sha256(const uint8_t *data, size_t len,
+    uint8_t digest[32]);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* ATCA_GRISP_H */
@@ -0,0 +1,168 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Callbacks for the custom interface of cryptoauthlib, so that the atcab_*()
+ * functions get the bursts and the polling, too.
+ */
+
+#include "atca-grisp-internal.h"
+
+#define HAL_GRISP_WORD_COMMAND 0x03
+
+static ATCA_STATUS
+hal_grisp_init(void *hal, void *cfg)
+{
+	ATCA_STATUS status;
+
+	(void)hal;
+	(void)cfg;
+
+	atca_grisp_lock();
+	status = atca_grisp_open_default();
+	atca_grisp_unlock();
+
+	return status;
+}
+
+static ATCA_STATUS
+hal_grisp_post_init(void *iface)
+{
+	(void)iface;
+
+	return ATCA_SUCCESS;
+}
+
+/*
+ * Depending on the version of cryptoauthlib the packet starts with the word
+ * address or with the count. The count is at least 7, so they can be told
+ * apart.
+ */
+static ATCA_STATUS
+hal_grisp_send(void *iface, uint8_t word_address, uint8_t *txdata,
+    int txlength)
+{
+	ATCA_STATUS status;
+
+	(void)iface;
+	(void)word_address;
+
+	if (txlength > 0 && txdata[0] == HAL_GRISP_WORD_COMMAND) {
+		++txdata;
+		--txlength;
+	}
+	if (txlength <= 0) {
+		return ATCA_BAD_PARAM;
+	}
+
+	atca_grisp_lock();
+	status = atca_grisp_send_packet(txdata, (size_t)txlength);
+	atca_grisp_unlock();
+
+	return status;
+}
+
+static ATCA_STATUS
+hal_grisp_receive(void *iface, uint8_t word_address, uint8_t *rxdata,
+    uint16_t *rxlength)
+{
+	ATCA_STATUS status;
+
+	(void)iface;
+	(void)word_address;
+
+	atca_grisp_lock();
+	status = atca_grisp_read(rxdata, *rxlength);
+	atca_grisp_unlock();
+
+	return status;
+}
+
+static ATCA_STATUS
+hal_grisp_wake(void *iface)
+{
+	ATCA_STATUS status;
+
+	(void)iface;
+
+	atca_grisp_lock();
+	status = atca_grisp_awake();
+	atca_grisp_unlock();
+
+	return status;
+}
+
+/* cryptoauthlib sends the device to idle after every command */
+static ATCA_STATUS
+hal_grisp_idle(void *iface)
+{
+	ATCA_STATUS status = ATCA_SUCCESS;
+
+	(void)iface;
+
+	atca_grisp_lock();
+	if (!atca_grisp_in_burst()) {
+		status = atca_grisp_idle();
+	}
+	atca_grisp_unlock();
+
+	return status;
+}
+
+static ATCA_STATUS
+hal_grisp_sleep(void *iface)
+{
+	(void)iface;
+
+	return atca_grisp_sleep();
+}
+
+static ATCA_STATUS
+hal_grisp_release(void *hal_data)
+{
+	(void)hal_data;
+
+	atca_grisp_close();
+
+	return ATCA_SUCCESS;
+}
+
+ATCAIfaceCfg cfg_atecc608_grisp = {
+	.iface_type = ATCA_CUSTOM_IFACE,
+	.devtype = ATECC608,
+	.atcacustom.halinit = hal_grisp_init,
+	.atcacustom.halpostinit = hal_grisp_post_init,
+	.atcacustom.halsend = hal_grisp_send,
+	.atcacustom.halreceive = hal_grisp_receive,
+	.atcacustom.halwake = hal_grisp_wake,
+	.atcacustom.halidle = hal_grisp_idle,
+	.atcacustom.halsleep = hal_grisp_sleep,
+	.atcacustom.halrelease = hal_grisp_release,
+	.wake_delay = 1500,
+	.rx_retries = 20,
+	.cfg_data = NULL,
+};
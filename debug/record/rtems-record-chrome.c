@@ -0,0 +1,407 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Convert the event records of an RTEMS application to the Chrome trace event
+ * format. The result can be opened with https://ui.perfetto.dev or
+ * chrome://tracing.
+ *
+ * The records are either received from the record server of the target or
+ * read from a file written by the record dump shell command of the demo.
+ */
+
+#include <rtems/recordclient.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <netdb.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#define MAX_CPUS		32
+#define MAX_IRQ_NESTING		8
+#define MAX_THREADS		4096
+#define THREAD_NAME_SIZE	32
+
+struct thread {
+	uint32_t id;
+	char name[THREAD_NAME_SIZE];
+};
+
+struct cpu {
+	bool seen;
+	uint32_t thread_id;
+	uint64_t thread_begin;
+	size_t irq_depth;
+	uint64_t irq_begin[MAX_IRQ_NESTING];
+	uint32_t irq_vector[MAX_IRQ_NESTING];
+	struct thread *name_target;
+};
+
+struct converter {
+	FILE *out;
+	bool first;
+	uint64_t event_count;
+	struct cpu cpus[MAX_CPUS];
+	struct thread threads[MAX_THREADS];
+};
+
+static volatile sig_atomic_t stop;
+
+static void
+on_signal(int sig)
+{
+	(void)sig;
+	stop = 1;
+}
+
+/* The record client delivers a binary time: seconds and 2^-32 fractions */
+static double
+bt_to_us(uint64_t bt)
+{
+	uint64_t ns;
+
+	ns = (bt >> 32) * 1000000000ULL +
+	    (((bt & 0xffffffffULL) * 1000000000ULL) >> 32);
+	return (double)ns / 1000.0;
+}
+
+static struct thread *
+thread_get(struct converter *cv, uint32_t id)
+{
+	size_t i = (id ^ (id >> 16)) % MAX_THREADS;
+	size_t n;
+
+	for (n = 0; n < MAX_THREADS; ++n) {
+		struct thread *t = &cv->threads[(i + n) % MAX_THREADS];
+
+		if (t->id == id) {
+			return t;
+		}
+		if (t->id == 0) {
+			t->id = id;
+			snprintf(t->name, sizeof(t->name), "0x%08" PRIx32, id);
+			return t;
+		}
+	}
+
+	return NULL;
+}
+
+static void
+emit_begin(struct converter *cv)
+{
+	fprintf(cv->out, "%s\n  ", cv->first ? "" : ",");
+	cv->first = false;
+}
+
+static void
+emit_cpu_name(struct converter *cv, uint32_t cpu)
+{
+	emit_begin(cv);
+	fprintf(cv->out, "{\"ph\": \"M\", \"name\": \"thread_name\", "
+	    "\"pid\": 0, \"tid\": %" PRIu32 ", "
+	    "\"args\": {\"name\": \"CPU %" PRIu32 "\"}}", cpu, cpu);
+}
+
+static void
+emit_slice(struct converter *cv, uint32_t cpu, const char *cat,
+    const char *name, uint64_t begin, uint64_t end, uint32_t value)
+{
+	emit_begin(cv);
+	fprintf(cv->out, "{\"ph\": \"X\", \"cat\": \"%s\", \"name\": \"%s\", "
+	    "\"pid\": 0, \"tid\": %" PRIu32 ", \"ts\": %.3f, \"dur\": %.3f, "
+	    "\"args\": {\"id\": \"0x%08" PRIx32 "\"}}",
+	    cat, name, cpu, bt_to_us(begin), bt_to_us(end) - bt_to_us(begin),
+	    value);
+}
+
+static void
+emit_instant(struct converter *cv, uint32_t cpu, uint64_t bt,
+    rtems_record_event event, uint64_t data)
+{
+	emit_begin(cv);
+	fprintf(cv->out, "{\"ph\": \"i\", \"s\": \"t\", \"cat\": \"event\", "
+	    "\"name\": \"%s\", \"pid\": 0, \"tid\": %" PRIu32 ", "
+	    "\"ts\": %.3f, \"args\": {\"data\": \"0x%" PRIx64 "\"}}",
+	    rtems_record_event_text(event), cpu, bt_to_us(bt), data);
+}
+
+static void
+append_name(struct thread *t, uint64_t data)
+{
+	size_t len = strlen(t->name);
+	size_t i;
+
+	for (i = 0; i < sizeof(data) && len < sizeof(t->name) - 1; ++i) {
+		char c = (char)(data >> (8 * i));
+
+		/* Only printable characters, they end up in a JSON string */
+		if (c >= ' ' && c <= '~' && c != '"' && c != '\\') {
+			t->name[len] = c;
+			++len;
+		}
+	}
+	t->name[len] = '\0';
+}
+
+static rtems_record_client_status
+handler(uint64_t bt, uint32_t cpu, rtems_record_event event, uint64_t data,
+    void *arg)
+{
+	struct converter *cv = arg;
+	struct cpu *c;
+
+	if (cpu >= MAX_CPUS) {
+		return RTEMS_RECORD_CLIENT_SUCCESS;
+	}
+
+	c = &cv->cpus[cpu];
+	if (!c->seen) {
+		c->seen = true;
+		emit_cpu_name(cv, cpu);
+	}
+	++cv->event_count;
+
+	switch (event) {
+	case RTEMS_RECORD_THREAD_SWITCH_OUT:
+		if (c->thread_id != 0) {
+			struct thread *t = thread_get(cv, c->thread_id);
+
+			emit_slice(cv, cpu, "thread",
+			    t != NULL ? t->name : "?",
+			    c->thread_begin, bt, c->thread_id);
+			c->thread_id = 0;
+		}
+		break;
+	case RTEMS_RECORD_THREAD_SWITCH_IN:
+		c->thread_id = (uint32_t)data;
+		c->thread_begin = bt;
+		break;
+	case RTEMS_RECORD_INTERRUPT_ENTRY:
+		if (c->irq_depth < MAX_IRQ_NESTING) {
+			c->irq_begin[c->irq_depth] = bt;
+			c->irq_vector[c->irq_depth] = (uint32_t)data;
+		}
+		++c->irq_depth;
+		break;
+	case RTEMS_RECORD_INTERRUPT_EXIT:
+		if (c->irq_depth > 0) {
+			--c->irq_depth;
+			if (c->irq_depth < MAX_IRQ_NESTING) {
+				char name[32];
+
+				snprintf(name, sizeof(name), "IRQ %" PRIu32,
+				    c->irq_vector[c->irq_depth]);
+				emit_slice(cv, cpu, "irq", name,
+				    c->irq_begin[c->irq_depth], bt,
+				    c->irq_vector[c->irq_depth]);
+			}
+		}
+		break;
+	case RTEMS_RECORD_THREAD_ID:
+		c->name_target = thread_get(cv, (uint32_t)data);
+		if (c->name_target != NULL) {
+			c->name_target->name[0] = '\0';
+		}
+		break;
+	case RTEMS_RECORD_THREAD_NAME:
+		if (c->name_target != NULL) {
+			append_name(c->name_target, data);
+		}
+		break;
+	case RTEMS_RECORD_PROCESSOR:
+	case RTEMS_RECORD_PROCESSOR_MAXIMUM:
+	case RTEMS_RECORD_PER_CPU_COUNT:
+	case RTEMS_RECORD_PER_CPU_HEAD:
+	case RTEMS_RECORD_PER_CPU_TAIL:
+	case RTEMS_RECORD_UPTIME_LOW:
+	case RTEMS_RECORD_UPTIME_HIGH:
+	case RTEMS_RECORD_FREQUENCY:
+	case RTEMS_RECORD_VERSION:
+		/* Stream bookkeeping, already consumed by the record client */
+		break;
+	default:
+		emit_instant(cv, cpu, bt, event, data);
+		break;
+	}
+
+	return RTEMS_RECORD_CLIENT_SUCCESS;
+}
+
+static int
+connect_to_server(const char *host, const char *port)
+{
+	struct addrinfo hints;
+	struct addrinfo *res;
+	struct addrinfo *ai;
+	int fd = -1;
+	int rv;
+
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	rv = getaddrinfo(host, port, &hints, &res);
+	if (rv != 0) {
+		fprintf(stderr, "ERROR: %s: %s\n", host, gai_strerror(rv));
+		return -1;
+	}
+
+	for (ai = res; ai != NULL; ai = ai->ai_next) {
+		fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+		if (fd < 0) {
+			continue;
+		}
+		if (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0) {
+			break;
+		}
+		close(fd);
+		fd = -1;
+	}
+	freeaddrinfo(res);
+
+	if (fd < 0) {
+		fprintf(stderr, "ERROR: Can't connect to %s:%s\n", host, port);
+	}
+	return fd;
+}
+
+static void
+usage(const char *prog)
+{
+	fprintf(stderr,
+	    "Usage: %s [-H <host>] [-p <port>] [-i <file>] [-o <file>]\n"
+	    "  -H: Host of the record server (default: localhost)\n"
+	    "  -p: Port of the record server (default: 1234)\n"
+	    "  -i: Read a file written by 'record dump' instead\n"
+	    "  -o: Output file (default: stdout)\n"
+	    "When connected to a server, stop with Ctrl-C.\n", prog);
+}
+
+int
+main(int argc, char *argv[])
+{
+	static struct converter cv;
+	static char buf[65536];
+	rtems_record_client_context ctx;
+	rtems_record_client_status status = RTEMS_RECORD_CLIENT_SUCCESS;
+	struct sigaction sa;
+	const char *host = "localhost";
+	const char *port = "1234";
+	const char *input = NULL;
+	const char *output = NULL;
+	int fd;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "H:p:i:o:h")) != -1) {
+		switch (opt) {
+		case 'H':
+			host = optarg;
+			break;
+		case 'p':
+			port = optarg;
+			break;
+		case 'i':
+			input = optarg;
+			break;
+		case 'o':
+			output = optarg;
+			break;
+		default:
+			usage(argv[0]);
+			return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+
+	if (input != NULL) {
+		fd = open(input, O_RDONLY);
+		if (fd < 0) {
+			fprintf(stderr, "ERROR: %s: %s\n", input,
+			    strerror(errno));
+			return EXIT_FAILURE;
+		}
+	} else {
+		fd = connect_to_server(host, port);
+		if (fd < 0) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	cv.out = stdout;
+	if (output != NULL) {
+		cv.out = fopen(output, "w");
+		if (cv.out == NULL) {
+			fprintf(stderr, "ERROR: %s: %s\n", output,
+			    strerror(errno));
+			return EXIT_FAILURE;
+		}
+	}
+	cv.first = true;
+
+	/* No SA_RESTART so that Ctrl-C interrupts a blocking read */
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = on_signal;
+	sigaction(SIGINT, &sa, NULL);
+	sigaction(SIGTERM, &sa, NULL);
+
+	fprintf(cv.out, "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [");
+	rtems_record_client_init(&ctx, handler, &cv);
+
+	while (!stop && status == RTEMS_RECORD_CLIENT_SUCCESS) {
+		ssize_t n = read(fd, buf, sizeof(buf));
+
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n <= 0) {
+			break;
+		}
+		status = rtems_record_client_run(&ctx, buf, (size_t)n);
+	}
+
+	fprintf(cv.out, "\n]}\n");
+	close(fd);
+	if (cv.out != stdout) {
+		fclose(cv.out);
+	}
+
+	if (status != RTEMS_RECORD_CLIENT_SUCCESS) {
+		fprintf(stderr, "ERROR: Invalid record stream (status %d)\n",
+		    (int)status);
+		return EXIT_FAILURE;
+	}
+	fprintf(stderr, "%" PRIu64 " events converted\n", cv.event_count);
+
+	return EXIT_SUCCESS;
+}
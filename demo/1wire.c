@@ -36,6 +36,8 @@
 #include <unistd.h>
 
 #include "1wire.h"
+#include "applog.h"
+#include "hrtimer.h"
 
 #define DS2482_ADDR 0x18
 
@@ -66,6 +68,10 @@
 #define DS2482_STATUS_PPD 0x02
 #define DS2482_STATUS_1WB 0x01
 
+/* Duration of 1-Wire operations at standard speed including some margin */
+#define DS2482_1W_RESET_US 1300
+#define DS2482_1W_BYTE_US 700
+
 static bool
 ds2482_master_reset(int bus)
 {
@@ -90,12 +96,12 @@ ds2482_master_reset(int bus)
 	work_queue.nmsgs = sizeof(msg)/sizeof(msg[0]);
 
 	if (ioctl(bus, I2C_RDWR, &work_queue) < 0) {
-		puts("Resetting 1-Wire master failed.");
+		APPLOG_ERROR("Resetting 1-Wire master failed.");
 		return false;
 	}
 
 	if ((rd[0] & DS2482_STATUS_RST) == 0) {
-		printf("Reset bit of 1-Wire not set: 0x%02x\n", rd[0]);
+		APPLOG_ERROR("Reset bit of 1-Wire not set: 0x%02x", rd[0]);
 		return false;
 	}
 
@@ -126,12 +132,12 @@ ds2482_master_set_config(int bus)
 	work_queue.nmsgs = sizeof(msg)/sizeof(msg[0]);
 
 	if (ioctl(bus, I2C_RDWR, &work_queue) < 0) {
-		puts("Setting config failed.");
+		APPLOG_ERROR("Setting config failed.");
 		return false;
 	}
 
 	if (rd[0] != 0) {
-		printf("Setting config failed: %02x", rd[0]);
+		APPLOG_ERROR("Setting config failed: %02x", rd[0]);
 		return false;
 	}
 
@@ -165,17 +171,17 @@ ds2482_master_1wire_reset(int bus)
 	work_queue.nmsgs = sizeof(msg)/sizeof(msg[0]);
 
 	if (ioctl(bus, I2C_RDWR, &work_queue) < 0) {
-		puts("1 Wire reset failed.");
+		APPLOG_ERROR("1 Wire reset failed.");
 		return false;
 	}
 
-	rtems_task_wake_after(RTEMS_MILLISECONDS_TO_TICKS(10));
+	hrtimer_sleep_us(DS2482_1W_RESET_US);
 
 	work_queue.msgs = get_status;
 	work_queue.nmsgs = sizeof(get_status)/sizeof(get_status[0]);
 
 	ioctl(bus, I2C_RDWR, &work_queue);
-	printf("1 wire status: %02x\n", rd[0]);
+	APPLOG_DEBUG("1 wire status: %02x", rd[0]);
 
 	return true;
 }
@@ -198,11 +204,11 @@ ds2482_master_1wire_write_byte(int bus, uint8_t byte)
 	work_queue.nmsgs = sizeof(msg)/sizeof(msg[0]);
 
 	if (ioctl(bus, I2C_RDWR, &work_queue) < 0) {
-		puts("1 Wire write byte failed.");
+		APPLOG_ERROR("1 Wire write byte failed.");
 		return false;
 	}
 
-	rtems_task_wake_after(RTEMS_MILLISECONDS_TO_TICKS(10));
+	hrtimer_sleep_us(DS2482_1W_BYTE_US);
 
 	return true;
 }
@@ -239,17 +245,17 @@ ds2482_master_1wire_read_byte(int bus, uint8_t *byte)
 	work_queue.nmsgs = sizeof(msg)/sizeof(msg[0]);
 
 	if (ioctl(bus, I2C_RDWR, &work_queue) < 0) {
-		puts("1 Wire read byte failed.");
+		APPLOG_ERROR("1 Wire read byte failed.");
 		return false;
 	}
 
-	rtems_task_wake_after(RTEMS_MILLISECONDS_TO_TICKS(10));
+	hrtimer_sleep_us(DS2482_1W_BYTE_US);
 
 	work_queue.msgs = msg_read;
 	work_queue.nmsgs = sizeof(msg_read)/sizeof(msg_read[0]);
 
 	if (ioctl(bus, I2C_RDWR, &work_queue) < 0) {
-		puts("1 Wire read result failed.");
+		APPLOG_ERROR("1 Wire read result failed.");
 		return false;
 	}
 
@@ -303,6 +309,8 @@ read_MAX31820(int argc, char *argv[])
 		}
 		printf("\n");
 	} else {
+		/* Show the logged cause first */
+		applog_flush();
 		printf("Something went wrong\n");
 	}
 
@@ -0,0 +1,659 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Each task that logs gets a single producer, single consumer byte ring from
+ * a fixed pool on its first message. The ring is found again by the task id,
+ * so producers never take a lock and never block. Interrupts and tasks that
+ * find the pool exhausted use a shared ring protected by an interrupt lock.
+ *
+ * An entry is a header with the time stamp and the level followed by the
+ * formatted text. The drain task merges the rings by time stamp, so the
+ * output has the order in which the messages have been logged. Rings of
+ * deleted tasks are given back to the pool once they are empty.
+ */
+
+#include "applog.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <rtems/thread.h>
+
+/* Has to be a power of two */
+#define APPLOG_RING_SIZE	2048
+#define APPLOG_TASK_RINGS	16
+#define APPLOG_SHARED_RING	APPLOG_TASK_RINGS
+#define APPLOG_DRAIN_MS		10
+#define APPLOG_TASK_STACK	(8 * 1024)
+#define APPLOG_NAME_SIZE	8
+/* Enough for the time stamp, level and task name in front of a message */
+#define APPLOG_MAX_LINE		(APPLOG_MAX_MESSAGE + 32)
+
+struct applog_entry {
+	uint64_t time_ns;
+	uint16_t len;
+	uint8_t level;
+	uint8_t reserved;
+};
+
+struct applog_ring {
+	/* Task id of the producer, 0 if the ring is free */
+	atomic_uint owner;
+	char name[APPLOG_NAME_SIZE];
+	/* Written by the producer only */
+	atomic_uint head;
+	atomic_uint dropped;
+	/* Written by the drain only */
+	atomic_uint tail;
+	unsigned reported;
+	uint8_t data[APPLOG_RING_SIZE];
+};
+
+int applog_level = APPLOG_LEVEL_INFO;
+
+static struct applog_ring applog_rings[APPLOG_TASK_RINGS + 1];
+
+RTEMS_INTERRUPT_LOCK_DEFINE(static, applog_shared_lock, "applog");
+
+static struct {
+	/* Serializes the drain and the sink configuration */
+	rtems_mutex mutex;
+	bool console;
+	int file;
+	int sock;
+	rtems_id task;
+	uint64_t written;
+	char line[APPLOG_MAX_LINE];
+} applog = {
+	.mutex = RTEMS_MUTEX_INITIALIZER("applog"),
+	.console = true,
+	.file = -1,
+	.sock = -1,
+};
+
+static const char applog_level_chars[] = "EWIDT";
+
+static const char * const applog_level_names[] = {
+	"error", "warn", "info", "debug", "trace"
+};
+
+static struct applog_ring *
+applog_get_ring(void)
+{
+	rtems_id self;
+	size_t i;
+
+	if (rtems_interrupt_is_in_progress()) {
+		return NULL;
+	}
+
+	self = rtems_task_self();
+	for (i = 0; i < APPLOG_TASK_RINGS; ++i) {
+		if (atomic_load_explicit(&applog_rings[i].owner,
+		    memory_order_relaxed) == self) {
+			return &applog_rings[i];
+		}
+	}
+
+	for (i = 0; i < APPLOG_TASK_RINGS; ++i) {
+		struct applog_ring *ring = &applog_rings[i];
+		unsigned expected = 0;
+
+		if (atomic_compare_exchange_strong(&ring->owner, &expected,
+		    self)) {
+			/* Published to the drain with the head of the entry */
+			if (rtems_object_get_name(self, sizeof(ring->name),
+			    ring->name) == NULL) {
+				strlcpy(ring->name, "?", sizeof(ring->name));
+			}
+			return ring;
+		}
+	}
+
+	return NULL;
+}
+
+static void
+applog_ring_copy_in(struct applog_ring *ring, unsigned pos, const void *src,
+    size_t len)
+{
+	size_t offset = pos % APPLOG_RING_SIZE;
+	size_t first = APPLOG_RING_SIZE - offset;
+
+	if (first > len) {
+		first = len;
+	}
+	memcpy(&ring->data[offset], src, first);
+	memcpy(&ring->data[0], (const uint8_t *)src + first, len - first);
+}
+
+static void
+applog_ring_copy_out(const struct applog_ring *ring, unsigned pos, void *dst,
+    size_t len)
+{
+	size_t offset = pos % APPLOG_RING_SIZE;
+	size_t first = APPLOG_RING_SIZE - offset;
+
+	if (first > len) {
+		first = len;
+	}
+	memcpy(dst, &ring->data[offset], first);
+	memcpy((uint8_t *)dst + first, &ring->data[0], len - first);
+}
+
+static void
+applog_ring_put(struct applog_ring *ring, const struct applog_entry *entry,
+    const char *text)
+{
+	unsigned head = atomic_load_explicit(&ring->head,
+	    memory_order_relaxed);
+	unsigned tail = atomic_load_explicit(&ring->tail,
+	    memory_order_acquire);
+	size_t size = sizeof(*entry) + entry->len;
+
+	if (APPLOG_RING_SIZE - (head - tail) < size) {
+		atomic_fetch_add_explicit(&ring->dropped, 1,
+		    memory_order_relaxed);
+		return;
+	}
+
+	applog_ring_copy_in(ring, head, entry, sizeof(*entry));
+	applog_ring_copy_in(ring, head + sizeof(*entry), text, entry->len);
+	atomic_store_explicit(&ring->head, head + size, memory_order_release);
+}
+
+static void
+applog_put(int level, const char *text, size_t len)
+{
+	struct applog_entry entry;
+	struct applog_ring *ring;
+
+	/* The drain terminates each line */
+	while (len > 0 && (text[len - 1] == '\n' || text[len - 1] == '\r')) {
+		--len;
+	}
+
+	entry.time_ns = rtems_clock_get_uptime_nanoseconds();
+	entry.len = (uint16_t)len;
+	entry.level = (uint8_t)level;
+	entry.reserved = 0;
+
+	ring = applog_get_ring();
+	if (ring != NULL) {
+		applog_ring_put(ring, &entry, text);
+	} else {
+		rtems_interrupt_lock_context lock_context;
+
+		rtems_interrupt_lock_acquire(&applog_shared_lock,
+		    &lock_context);
+		applog_ring_put(&applog_rings[APPLOG_SHARED_RING], &entry,
+		    text);
+		rtems_interrupt_lock_release(&applog_shared_lock,
+		    &lock_context);
+	}
+}
+
+void
+applog_vprintf(int level, const char *fmt, va_list ap)
+{
+	char text[APPLOG_MAX_MESSAGE];
+	int len;
+
+	if (level > applog_level) {
+		return;
+	}
+
+	len = vsnprintf(text, sizeof(text), fmt, ap);
+	if (len < 0) {
+		return;
+	}
+	if ((size_t)len >= sizeof(text)) {
+		len = sizeof(text) - 1;
+	}
+	applog_put(level, text, (size_t)len);
+}
+
+void
+applog_printf(int level, const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	applog_vprintf(level, fmt, ap);
+	va_end(ap);
+}
+
+void
+applog_puts(int level, const char *text)
+{
+	if (level > applog_level) {
+		return;
+	}
+
+	applog_put(level, text, strnlen(text, APPLOG_MAX_MESSAGE - 1));
+}
+
+void
+applog_set_level(int level)
+{
+	if (level < APPLOG_LEVEL_ERROR) {
+		level = APPLOG_LEVEL_ERROR;
+	} else if (level > APPLOG_LEVEL_TRACE) {
+		level = APPLOG_LEVEL_TRACE;
+	}
+	applog_level = level;
+}
+
+static void
+applog_write_line(uint64_t time_ns, int level, const char *name,
+    const char *text, size_t len)
+{
+	int n;
+
+	n = snprintf(applog.line, sizeof(applog.line), "[%5lu.%06lu] %c %s: ",
+	    (unsigned long)(time_ns / 1000000000),
+	    (unsigned long)(time_ns % 1000000000 / 1000),
+	    applog_level_chars[level], name);
+	if (n < 0) {
+		return;
+	}
+	if ((size_t)n + len + 1 > sizeof(applog.line)) {
+		len = sizeof(applog.line) - (size_t)n - 1;
+	}
+	memcpy(&applog.line[n], text, len);
+	len += (size_t)n;
+	applog.line[len] = '\n';
+	++len;
+
+	if (applog.console) {
+		(void)write(STDOUT_FILENO, applog.line, len);
+	}
+	if (applog.file >= 0) {
+		(void)write(applog.file, applog.line, len);
+	}
+	if (applog.sock >= 0) {
+		(void)send(applog.sock, applog.line, len, 0);
+	}
+	++applog.written;
+}
+
+static void
+applog_report_drops(struct applog_ring *ring)
+{
+	unsigned dropped = atomic_load_explicit(&ring->dropped,
+	    memory_order_relaxed);
+	char text[64];
+	int len;
+
+	if (dropped == ring->reported) {
+		return;
+	}
+
+	len = snprintf(text, sizeof(text), "%u messages of %s dropped",
+	    dropped - ring->reported,
+	    ring == &applog_rings[APPLOG_SHARED_RING] ? "IRQ/shared" :
+	    ring->name);
+	ring->reported = dropped;
+	applog_write_line(rtems_clock_get_uptime_nanoseconds(),
+	    APPLOG_LEVEL_WARN, "applog", text, (size_t)len);
+}
+
+/*
+ * Give the ring of a deleted task back to the pool. Head and tail stay as
+ * they are, the ring is empty and the next owner just continues there.
+ */
+static void
+applog_release_ring(struct applog_ring *ring, rtems_id owner)
+{
+	if (rtems_task_is_suspended(owner) != RTEMS_INVALID_ID) {
+		return;
+	}
+
+	atomic_store_explicit(&ring->owner, 0, memory_order_release);
+}
+
+/* Write everything that is queued, oldest entry first. Call with mutex. */
+static void
+applog_drain(void)
+{
+	unsigned heads[APPLOG_TASK_RINGS + 1];
+	size_t i;
+
+	for (i = 0; i <= APPLOG_TASK_RINGS; ++i) {
+		heads[i] = atomic_load_explicit(&applog_rings[i].head,
+		    memory_order_acquire);
+	}
+
+	while (true) {
+		struct applog_ring *oldest = NULL;
+		struct applog_entry oldest_entry;
+		char text[APPLOG_MAX_MESSAGE];
+		unsigned tail;
+
+		for (i = 0; i <= APPLOG_TASK_RINGS; ++i) {
+			struct applog_ring *ring = &applog_rings[i];
+			struct applog_entry entry;
+
+			tail = atomic_load_explicit(&ring->tail,
+			    memory_order_relaxed);
+			if (tail == heads[i]) {
+				continue;
+			}
+			applog_ring_copy_out(ring, tail, &entry,
+			    sizeof(entry));
+			if (oldest == NULL ||
+			    entry.time_ns < oldest_entry.time_ns) {
+				oldest = ring;
+				oldest_entry = entry;
+			}
+		}
+
+		if (oldest == NULL) {
+			break;
+		}
+
+		tail = atomic_load_explicit(&oldest->tail,
+		    memory_order_relaxed);
+		applog_ring_copy_out(oldest, tail + sizeof(oldest_entry), text,
+		    oldest_entry.len);
+		atomic_store_explicit(&oldest->tail,
+		    tail + sizeof(oldest_entry) + oldest_entry.len,
+		    memory_order_release);
+		applog_write_line(oldest_entry.time_ns, oldest_entry.level,
+		    oldest == &applog_rings[APPLOG_SHARED_RING] ? "IRQ" :
+		    oldest->name, text, oldest_entry.len);
+	}
+
+	for (i = 0; i <= APPLOG_TASK_RINGS; ++i) {
+		struct applog_ring *ring = &applog_rings[i];
+		unsigned owner = atomic_load_explicit(&ring->owner,
+		    memory_order_acquire);
+
+		applog_report_drops(ring);
+		if (i != APPLOG_SHARED_RING && owner != 0 &&
+		    atomic_load(&ring->head) == atomic_load(&ring->tail)) {
+			applog_release_ring(ring, owner);
+		}
+	}
+}
+
+void
+applog_flush(void)
+{
+	rtems_mutex_lock(&applog.mutex);
+	applog_drain();
+	rtems_mutex_unlock(&applog.mutex);
+}
+
+static void
+applog_task(rtems_task_argument arg)
+{
+	rtems_interval ticks = RTEMS_MILLISECONDS_TO_TICKS(APPLOG_DRAIN_MS);
+
+	(void)arg;
+
+	if (ticks == 0) {
+		ticks = 1;
+	}
+
+	while (true) {
+		rtems_task_wake_after(ticks);
+		applog_flush();
+	}
+}
+
+rtems_status_code
+applog_start(rtems_task_priority priority)
+{
+	rtems_status_code sc;
+
+	if (applog.task != 0) {
+		return RTEMS_RESOURCE_IN_USE;
+	}
+
+	sc = rtems_task_create(rtems_build_name('L', 'O', 'G', 'D'), priority,
+	    APPLOG_TASK_STACK, RTEMS_DEFAULT_MODES, RTEMS_DEFAULT_ATTRIBUTES,
+	    &applog.task);
+	if (sc != RTEMS_SUCCESSFUL) {
+		applog.task = 0;
+		return sc;
+	}
+
+	return rtems_task_start(applog.task, applog_task, 0);
+}
+
+void
+applog_set_console(bool enable)
+{
+	rtems_mutex_lock(&applog.mutex);
+	applog.console = enable;
+	rtems_mutex_unlock(&applog.mutex);
+}
+
+int
+applog_set_file(const char *path)
+{
+	int fd = -1;
+	int old;
+
+	if (path != NULL) {
+		fd = open(path, O_WRONLY | O_CREAT | O_APPEND, 0644);
+		if (fd < 0) {
+			return -1;
+		}
+	}
+
+	rtems_mutex_lock(&applog.mutex);
+	old = applog.file;
+	applog.file = fd;
+	rtems_mutex_unlock(&applog.mutex);
+
+	if (old >= 0) {
+		close(old);
+	}
+
+	return 0;
+}
+
+int
+applog_set_udp(const char *host, uint16_t port)
+{
+	struct sockaddr_in addr;
+	int sock = -1;
+	int old;
+
+	if (host != NULL) {
+		memset(&addr, 0, sizeof(addr));
+		addr.sin_len = sizeof(addr);
+		addr.sin_family = AF_INET;
+		addr.sin_port = htons(port);
+		if (inet_pton(AF_INET, host, &addr.sin_addr) != 1) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		sock = socket(AF_INET, SOCK_DGRAM, 0);
+		if (sock < 0) {
+			return -1;
+		}
+		if (connect(sock, (struct sockaddr *)&addr,
+		    sizeof(addr)) != 0) {
+			close(sock);
+			return -1;
+		}
+	}
+
+	rtems_mutex_lock(&applog.mutex);
+	old = applog.sock;
+	applog.sock = sock;
+	rtems_mutex_unlock(&applog.mutex);
+
+	if (old >= 0) {
+		close(old);
+	}
+
+	return 0;
+}
+
+static void
+applog_print_status(void)
+{
+	size_t i;
+
+	rtems_mutex_lock(&applog.mutex);
+	printf("level:   %s (compiled up to %s)\n",
+	    applog_level_names[applog_level],
+	    applog_level_names[APPLOG_COMPILE_LEVEL]);
+	printf("console: %s\n", applog.console ? "on" : "off");
+	printf("file:    %s\n", applog.file >= 0 ? "on" : "off");
+	printf("udp:     %s\n", applog.sock >= 0 ? "on" : "off");
+	printf("written: %llu lines\n", (unsigned long long)applog.written);
+	rtems_mutex_unlock(&applog.mutex);
+
+	printf("ring task fill    dropped\n");
+	for (i = 0; i <= APPLOG_TASK_RINGS; ++i) {
+		struct applog_ring *ring = &applog_rings[i];
+		unsigned fill = atomic_load(&ring->head) -
+		    atomic_load(&ring->tail);
+
+		if (i != APPLOG_SHARED_RING && atomic_load(&ring->owner) == 0) {
+			continue;
+		}
+		printf("%4zu %-4s %4u/%u %u\n", i,
+		    i == APPLOG_SHARED_RING ? "IRQ" : ring->name, fill,
+		    APPLOG_RING_SIZE, atomic_load(&ring->dropped));
+	}
+}
+
+static int
+applog_parse_level(const char *arg)
+{
+	size_t i;
+	char *end;
+	long level;
+
+	for (i = 0; i < RTEMS_ARRAY_SIZE(applog_level_names); ++i) {
+		if (strcmp(arg, applog_level_names[i]) == 0) {
+			return (int)i;
+		}
+	}
+
+	level = strtol(arg, &end, 0);
+	if (*end != '\0' || level < APPLOG_LEVEL_ERROR ||
+	    level > APPLOG_LEVEL_TRACE) {
+		return -1;
+	}
+
+	return (int)level;
+}
+
+static int
+command_applog(int argc, char *argv[])
+{
+	int i;
+
+	for (i = 1; i < argc; i += 2) {
+		const char *arg;
+
+		if (i + 1 >= argc) {
+			puts(shell_APPLOG_Command.usage);
+			return -1;
+		}
+		arg = argv[i + 1];
+
+		if (strcmp(argv[i], "level") == 0) {
+			int level = applog_parse_level(arg);
+
+			if (level < 0) {
+				puts(shell_APPLOG_Command.usage);
+				return -1;
+			}
+			applog_set_level(level);
+		} else if (strcmp(argv[i], "console") == 0) {
+			applog_set_console(strcmp(arg, "off") != 0);
+		} else if (strcmp(argv[i], "file") == 0) {
+			if (applog_set_file(strcmp(arg, "off") == 0 ?
+			    NULL : arg) != 0) {
+				printf("Couldn't open %s: %s\n", arg,
+				    strerror(errno));
+				return -1;
+			}
+		} else if (strcmp(argv[i], "udp") == 0) {
+			uint16_t port = 0;
+
+			if (strcmp(arg, "off") == 0) {
+				arg = NULL;
+			} else if (i + 2 < argc) {
+				port = (uint16_t)strtoul(argv[i + 2], NULL, 0);
+				++i;
+			} else {
+				puts(shell_APPLOG_Command.usage);
+				return -1;
+			}
+			if (applog_set_udp(arg, port) != 0) {
+				printf("Couldn't send to %s: %s\n", arg,
+				    strerror(errno));
+				return -1;
+			}
+		} else {
+			puts(shell_APPLOG_Command.usage);
+			return -1;
+		}
+	}
+
+	applog_flush();
+	applog_print_status();
+
+	return 0;
+}
+
+rtems_shell_cmd_t shell_APPLOG_Command = {
+	.name = "applog",
+	.usage = "Use with: applog [level <level>] [console on|off] "
+	    "[file <path>|off] [udp <ip> <port>|off]\n"
+	    "Configure the application log. Without arguments, show the status.\n"
+	    "  level: error, warn, info, debug or trace (or 0 to 4)\n"
+	    "  console: write to the console\n"
+	    "  file: append to a file\n"
+	    "  udp: send each line as a datagram (e.g. to: nc -klu <port>)\n",
+	.topic = "misc",
+	.command = command_applog,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
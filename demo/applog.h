@@ -0,0 +1,150 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DEMO_APPLOG_H
+#define DEMO_APPLOG_H
+
+#include <stdarg.h>
+
+#include <rtems.h>
+#include <rtems/shell.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Logging that never waits for I/O. A message is formatted by the caller and
+ * copied into a ring buffer of the calling task. A low priority task drains
+ * all rings in time order to the console, a file and/or UDP. If a ring is
+ * full, the message is dropped and counted.
+ *
+ * Each task gets its own lock-free ring on its first message. Interrupts and
+ * tasks that get no ring anymore share one ring protected by an interrupt
+ * lock.
+ *
+ * applog_printf() and the APPLOG_*() macros format with vsnprintf() of
+ * newlib, which is not safe in interrupt context (it uses the reentrancy
+ * structure of the interrupted task and may allocate for floating point
+ * conversions). Interrupt handlers have to use applog_puts() with a constant
+ * or preformatted message.
+ */
+
+#define APPLOG_LEVEL_ERROR	0
+#define APPLOG_LEVEL_WARN	1
+#define APPLOG_LEVEL_INFO	2
+#define APPLOG_LEVEL_DEBUG	3
+#define APPLOG_LEVEL_TRACE	4
+
+/* Messages above this level are removed by the preprocessor */
+#ifndef APPLOG_COMPILE_LEVEL
+#define APPLOG_COMPILE_LEVEL	APPLOG_LEVEL_DEBUG
+#endif
+
+/* Longer messages are truncated */
+#define APPLOG_MAX_MESSAGE	120
+
+/* Messages above this level are discarded at run time. Use applog_set_level(). */
+extern int applog_level;
+
+void applog_printf(int level, const char *fmt, ...)
+    __attribute__((format(printf, 2, 3)));
+
+void applog_vprintf(int level, const char *fmt, va_list ap);
+
+/*
+ * Log a message as it is, without formatting. Can be used from interrupt
+ * handlers. Messages longer than APPLOG_MAX_MESSAGE - 1 are truncated.
+ */
+void applog_puts(int level, const char *text);
+
+#define APPLOG_IF(level, ...) \
+	do { \
+		if ((level) <= applog_level) { \
+			applog_printf(level, __VA_ARGS__); \
+		} \
+	} while (0)
+
+#define APPLOG_NOTHING(...) do { } while (0)
+
+#if APPLOG_COMPILE_LEVEL >= APPLOG_LEVEL_ERROR
+#define APPLOG_ERROR(...) APPLOG_IF(APPLOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define APPLOG_ERROR(...) APPLOG_NOTHING(__VA_ARGS__)
+#endif
+
+#if APPLOG_COMPILE_LEVEL >= APPLOG_LEVEL_WARN
+#define APPLOG_WARN(...) APPLOG_IF(APPLOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define APPLOG_WARN(...) APPLOG_NOTHING(__VA_ARGS__)
+#endif
+
+#if APPLOG_COMPILE_LEVEL >= APPLOG_LEVEL_INFO
+#define APPLOG_INFO(...) APPLOG_IF(APPLOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define APPLOG_INFO(...) APPLOG_NOTHING(__VA_ARGS__)
+#endif
+
+#if APPLOG_COMPILE_LEVEL >= APPLOG_LEVEL_DEBUG
+#define APPLOG_DEBUG(...) APPLOG_IF(APPLOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define APPLOG_DEBUG(...) APPLOG_NOTHING(__VA_ARGS__)
+#endif
+
+#if APPLOG_COMPILE_LEVEL >= APPLOG_LEVEL_TRACE
+#define APPLOG_TRACE(...) APPLOG_IF(APPLOG_LEVEL_TRACE, __VA_ARGS__)
+#else
+#define APPLOG_TRACE(...) APPLOG_NOTHING(__VA_ARGS__)
+#endif
+
+void applog_set_level(int level);
+
+/*
+ * Start the drain task. Messages logged before are kept and written as soon
+ * as the task runs.
+ */
+rtems_status_code applog_start(rtems_task_priority priority);
+
+/* Write all pending messages in the context of the caller. */
+void applog_flush(void);
+
+/* Enable or disable the console output (enabled by default). */
+void applog_set_console(bool enable);
+
+/* Append to a file, NULL stops. Returns 0 on success, -1 otherwise. */
+int applog_set_file(const char *path);
+
+/* Send each message as a UDP datagram, NULL stops. Returns 0 on success. */
+int applog_set_udp(const char *host, uint16_t port);
+
+extern rtems_shell_cmd_t shell_APPLOG_Command;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DEMO_APPLOG_H */
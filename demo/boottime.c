@@ -0,0 +1,166 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "boottime.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#if __has_include(<grisp/grisp-buildinfo.h>)
+#include <grisp/grisp-buildinfo.h>
+#endif
+
+#ifndef GRISP_TOOLCHAIN_REVISION
+#define GRISP_TOOLCHAIN_REVISION "unknown"
+#endif
+
+#define BOOTTIME_MAX_MARKS 32
+
+struct boottime_entry {
+	const char *name;
+	uint64_t uptime_ns;
+};
+
+static struct {
+	struct boottime_entry entries[BOOTTIME_MAX_MARKS];
+	size_t count;
+	size_t dropped;
+} boottime;
+
+RTEMS_INTERRUPT_LOCK_DEFINE(static, boottime_lock, "boottime")
+
+void
+boottime_mark(const char *name)
+{
+	rtems_interrupt_lock_context lock_context;
+	uint64_t now;
+
+	rtems_interrupt_lock_acquire(&boottime_lock, &lock_context);
+	now = rtems_clock_get_uptime_nanoseconds();
+	if (boottime.count < BOOTTIME_MAX_MARKS) {
+		boottime.entries[boottime.count].name = name;
+		boottime.entries[boottime.count].uptime_ns = now;
+		++boottime.count;
+	} else {
+		++boottime.dropped;
+	}
+	rtems_interrupt_lock_release(&boottime_lock, &lock_context);
+}
+
+/* Take a consistent copy so that printing doesn't happen with the lock held. */
+static size_t
+boottime_snapshot(struct boottime_entry *entries, size_t *dropped)
+{
+	rtems_interrupt_lock_context lock_context;
+	size_t count;
+
+	rtems_interrupt_lock_acquire(&boottime_lock, &lock_context);
+	count = boottime.count;
+	memcpy(entries, boottime.entries, count * sizeof(entries[0]));
+	*dropped = boottime.dropped;
+	rtems_interrupt_lock_release(&boottime_lock, &lock_context);
+
+	return count;
+}
+
+static void
+boottime_print_table(const struct boottime_entry *entries, size_t count,
+    size_t dropped)
+{
+	uint64_t last = 0;
+
+	printf("  uptime [ms]   delta [ms]  phase\n");
+	for (size_t i = 0; i < count; ++i) {
+		uint64_t now = entries[i].uptime_ns;
+		printf("%9" PRIu64 ".%03" PRIu64 " %8" PRIu64 ".%03" PRIu64 "  %s\n",
+		    now / 1000000, (now / 1000) % 1000,
+		    (now - last) / 1000000, ((now - last) / 1000) % 1000,
+		    entries[i].name);
+		last = now;
+	}
+	if (dropped > 0) {
+		printf("%zu marks dropped (buffer full)\n", dropped);
+	}
+}
+
+static void
+boottime_print_json(const struct boottime_entry *entries, size_t count,
+    size_t dropped)
+{
+	printf("{\n"
+	    "  \"revision\": \"%s\",\n"
+	    "  \"dropped\": %zu,\n"
+	    "  \"marks\": [",
+	    GRISP_TOOLCHAIN_REVISION, dropped);
+	for (size_t i = 0; i < count; ++i) {
+		printf("%s\n    {\"name\": \"%s\", \"uptime_ns\": %" PRIu64 "}",
+		    i == 0 ? "" : ",", entries[i].name, entries[i].uptime_ns);
+	}
+	printf("\n  ]\n}\n");
+}
+
+static int
+command_boottime(int argc, char *argv[])
+{
+	static struct boottime_entry entries[BOOTTIME_MAX_MARKS];
+	size_t count;
+	size_t dropped;
+	bool json = false;
+
+	for (int i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "-j") == 0) {
+			json = true;
+		} else {
+			puts(shell_BOOTTIME_Command.usage);
+			return -1;
+		}
+	}
+
+	count = boottime_snapshot(entries, &dropped);
+	if (json) {
+		boottime_print_json(entries, count, dropped);
+	} else {
+		boottime_print_table(entries, count, dropped);
+	}
+
+	return 0;
+}
+
+rtems_shell_cmd_t shell_BOOTTIME_Command = {
+	.name = "boottime",
+	.usage = "Use with: boottime [-j]\n"
+	    "Print the boot phases recorded since system start.\n"
+	    "  -j: Print as JSON, e.g. 'boottime -j > /media/mmcsd-0-0/boot.json'\n",
+	.topic = "misc",
+	.command = command_boottime,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
@@ -0,0 +1,134 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "bringup.h"
+
+#include <rtems/thread.h>
+
+#define BRINGUP_MAX_JOBS 8
+
+struct bringup_job_ctx {
+	uint32_t depends;
+	uint32_t provides;
+	bringup_job job;
+};
+
+static struct {
+	rtems_mutex mutex;
+	rtems_condition_variable changed;
+	uint32_t ready;
+	size_t job_count;
+	struct bringup_job_ctx jobs[BRINGUP_MAX_JOBS];
+} bringup = {
+	.mutex = RTEMS_MUTEX_INITIALIZER("bringup"),
+	.changed = RTEMS_CONDITION_VARIABLE_INITIALIZER("bringup"),
+};
+
+void
+bringup_signal(uint32_t ready)
+{
+	rtems_mutex_lock(&bringup.mutex);
+	bringup.ready |= ready;
+	rtems_condition_variable_broadcast(&bringup.changed);
+	rtems_mutex_unlock(&bringup.mutex);
+}
+
+void
+bringup_wait(uint32_t ready)
+{
+	rtems_mutex_lock(&bringup.mutex);
+	while ((bringup.ready & ready) != ready) {
+		rtems_condition_variable_wait(&bringup.changed, &bringup.mutex);
+	}
+	rtems_mutex_unlock(&bringup.mutex);
+}
+
+uint32_t
+bringup_get_ready(void)
+{
+	uint32_t ready;
+
+	rtems_mutex_lock(&bringup.mutex);
+	ready = bringup.ready;
+	rtems_mutex_unlock(&bringup.mutex);
+
+	return ready;
+}
+
+static void
+bringup_job_task(rtems_task_argument arg)
+{
+	const struct bringup_job_ctx *ctx = (const struct bringup_job_ctx *)arg;
+
+	bringup_wait(ctx->depends);
+	(*ctx->job)();
+	bringup_signal(ctx->provides);
+
+	rtems_task_exit();
+}
+
+rtems_status_code
+bringup_start_job(
+	rtems_name name,
+	rtems_task_priority prio,
+	size_t stack_size,
+	uint32_t depends,
+	uint32_t provides,
+	bringup_job job
+)
+{
+	struct bringup_job_ctx *ctx;
+	rtems_status_code sc;
+	rtems_id id;
+
+	rtems_mutex_lock(&bringup.mutex);
+	if (bringup.job_count >= BRINGUP_MAX_JOBS) {
+		rtems_mutex_unlock(&bringup.mutex);
+		return RTEMS_TOO_MANY;
+	}
+	ctx = &bringup.jobs[bringup.job_count];
+	++bringup.job_count;
+	rtems_mutex_unlock(&bringup.mutex);
+
+	ctx->depends = depends;
+	ctx->provides = provides;
+	ctx->job = job;
+
+	sc = rtems_task_create(
+		name,
+		prio,
+		stack_size,
+		RTEMS_DEFAULT_MODES,
+		RTEMS_FLOATING_POINT,
+		&id
+	);
+	if (sc != RTEMS_SUCCESSFUL) {
+		return sc;
+	}
+
+	return rtems_task_start(id, bringup_job_task, (rtems_task_argument)ctx);
+}
@@ -0,0 +1,77 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DEMO_BRINGUP_H
+#define DEMO_BRINGUP_H
+
+#include <rtems.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Readiness flags of the system services. A job signals its flag when it is
+ * done, regardless whether it was successful. Jobs that depend on the result
+ * have to check the state of the service themselves.
+ */
+#define BRINGUP_STORAGE	(1u << 0)
+#define BRINGUP_NETWORK	(1u << 1)
+#define BRINGUP_WLAN	(1u << 2)
+#define BRINGUP_LED	(1u << 3)
+#define BRINGUP_PROFILE	(1u << 4)
+
+typedef void (*bringup_job)(void);
+
+/* Mark the given services as ready and wake up everyone waiting for them. */
+void bringup_signal(uint32_t ready);
+
+/* Block until all of the given services are ready. */
+void bringup_wait(uint32_t ready);
+
+/* Return the services that are ready so far. */
+uint32_t bringup_get_ready(void);
+
+/*
+ * Start a job in a task of its own. The job is executed as soon as all
+ * services in depends are ready. After the job returned, the services in
+ * provides are signaled and the task is deleted.
+ */
+rtems_status_code bringup_start_job(
+	rtems_name name,
+	rtems_task_priority prio,
+	size_t stack_size,
+	uint32_t depends,
+	uint32_t provides,
+	bringup_job job
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DEMO_BRINGUP_H */
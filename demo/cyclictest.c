@@ -0,0 +1,698 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Each measurement task sleeps until absolute deadlines that are interval
+ * microseconds apart, so a late wake up doesn't shift the following ones.
+ * After each wake up it records:
+ *
+ *   wake-up:    deadline to task running (what a control loop sees)
+ *   irq:        deadline to the timer interrupt handling it
+ *   irq->task:  timer interrupt to task running (dispatch and scheduling)
+ *
+ * The histograms have a resolution of one microsecond. Values beyond the
+ * histogram are counted as overflows but still go into min, avg and max.
+ */
+
+#include "cyclictest.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <netinet/in.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <grisp/led.h>
+
+#include "applog.h"
+#include "dmabuf.h"
+#include "hrtimer.h"
+
+#define CYCLICTEST_MAX_THREADS	8
+#define CYCLICTEST_TASK_STACK	(8 * 1024)
+#define CYCLICTEST_SD_FILE	"/media/mmcsd-0-0/cyclictest.tmp"
+#define CYCLICTEST_SD_CHUNK	(32 * 1024)
+/* Larger than the bdbuf cache, so reads go to the card */
+#define CYCLICTEST_SD_SIZE	(4 * 1024 * 1024)
+#define CYCLICTEST_NET_SIZE	1400
+#define CYCLICTEST_DISCARD_PORT	9
+
+#define CYCLICTEST_STRESS_SD	(1u << 0)
+#define CYCLICTEST_STRESS_NET	(1u << 1)
+#define CYCLICTEST_STRESS_LED	(1u << 2)
+
+struct cyclictest_stat {
+	uint32_t min;
+	uint32_t max;
+	uint64_t sum;
+	uint32_t overflow;
+	uint32_t *hist;
+};
+
+struct cyclictest_thread {
+	rtems_task_priority priority;
+	uint32_t interval_us;
+	/* Read by the shell for the progress output */
+	atomic_uint cycles;
+	uint32_t overruns;
+	struct cyclictest_stat wakeup;
+	struct cyclictest_stat irq;
+	struct cyclictest_stat task;
+};
+
+struct cyclictest_config {
+	unsigned threads;
+	rtems_task_priority priority;
+	uint32_t interval_us;
+	uint32_t distance_us;
+	uint32_t loops;
+	uint32_t duration_s;
+	uint32_t hist_size;
+	rtems_task_priority stress_priority;
+	unsigned stress;
+	const char *net_host;
+	bool histogram;
+	bool quiet;
+};
+
+static struct {
+	atomic_bool busy;
+	atomic_bool stop;
+	atomic_uint threads_running;
+	atomic_uint stress_running;
+	uint32_t loops;
+	uint32_t hist_size;
+	const char *net_host;
+	struct cyclictest_thread threads[CYCLICTEST_MAX_THREADS];
+} cyclictest;
+
+/*
+ * Record the difference of two counter values. A negative one means a
+ * wake up before the deadline, which hrtimer_sleep_until_us() rules out. It
+ * would wrap around as an unsigned value, so it is recorded as zero.
+ */
+static void
+cyclictest_record(struct cyclictest_stat *stat, uint32_t end, uint32_t start)
+{
+	int32_t diff = (int32_t)(end - start);
+	uint32_t us = diff > 0 ? (uint32_t)diff : 0;
+
+	if (us < stat->min) {
+		stat->min = us;
+	}
+	if (us > stat->max) {
+		stat->max = us;
+	}
+	stat->sum += us;
+	if (us < cyclictest.hist_size) {
+		++stat->hist[us];
+	} else {
+		++stat->overflow;
+	}
+}
+
+static void
+cyclictest_thread(rtems_task_argument arg)
+{
+	struct cyclictest_thread *t = &cyclictest.threads[arg];
+	uint32_t next = hrtimer_now_us() + t->interval_us;
+	uint32_t cycles = 0;
+
+	while (!atomic_load(&cyclictest.stop) &&
+	    (cyclictest.loops == 0 || cycles < cyclictest.loops)) {
+		uint32_t expired_at = hrtimer_sleep_until_us(next);
+		uint32_t now = hrtimer_now_us();
+
+		cyclictest_record(&t->wakeup, now, next);
+		cyclictest_record(&t->irq, expired_at, next);
+		cyclictest_record(&t->task, now, expired_at);
+		++cycles;
+		atomic_store_explicit(&t->cycles, cycles,
+		    memory_order_release);
+
+		next += t->interval_us;
+		if ((int32_t)(next - now) <= 0) {
+			/* Missed at least one period, don't try to catch up */
+			++t->overruns;
+			next = now + t->interval_us;
+		}
+	}
+
+	atomic_fetch_sub(&cyclictest.threads_running, 1);
+	rtems_task_exit();
+}
+
+/* Write and read back a file larger than the block cache */
+static void
+cyclictest_stress_sd(rtems_task_argument arg)
+{
+	uint8_t *buf;
+	int fd = -1;
+
+	(void)arg;
+
+	buf = dmabuf_alloc(CYCLICTEST_SD_CHUNK);
+	if (buf != NULL) {
+		memset(buf, 0x5a, CYCLICTEST_SD_CHUNK);
+		fd = open(CYCLICTEST_SD_FILE, O_RDWR | O_CREAT | O_TRUNC,
+		    0644);
+	}
+	if (fd < 0) {
+		APPLOG_ERROR("cyclictest: SD stress: can't open "
+		    CYCLICTEST_SD_FILE);
+	}
+
+	while (fd >= 0 && !atomic_load(&cyclictest.stop)) {
+		off_t pos;
+		bool ok = true;
+
+		for (pos = 0; ok && pos < CYCLICTEST_SD_SIZE &&
+		    !atomic_load(&cyclictest.stop); pos += CYCLICTEST_SD_CHUNK) {
+			ok = pwrite(fd, buf, CYCLICTEST_SD_CHUNK, pos) ==
+			    CYCLICTEST_SD_CHUNK;
+		}
+		ok = ok && fsync(fd) == 0;
+		for (pos = 0; ok && pos < CYCLICTEST_SD_SIZE &&
+		    !atomic_load(&cyclictest.stop); pos += CYCLICTEST_SD_CHUNK) {
+			ok = pread(fd, buf, CYCLICTEST_SD_CHUNK, pos) ==
+			    CYCLICTEST_SD_CHUNK;
+		}
+		if (!ok) {
+			APPLOG_ERROR("cyclictest: SD stress: %s",
+			    strerror(errno));
+			break;
+		}
+	}
+
+	if (fd >= 0) {
+		close(fd);
+		unlink(CYCLICTEST_SD_FILE);
+	}
+	dmabuf_free(buf);
+	atomic_fetch_sub(&cyclictest.stress_running, 1);
+	rtems_task_exit();
+}
+
+/*
+ * Send UDP datagrams as fast as possible. Without a host they go through the
+ * loopback interface and are received again, which loads the network stack.
+ * With a host they go to its discard port, which loads the Ethernet or WLAN
+ * driver and its interrupts.
+ */
+static void
+cyclictest_stress_net(rtems_task_argument arg)
+{
+	static uint8_t buf[CYCLICTEST_NET_SIZE];
+	struct sockaddr_in addr;
+	socklen_t len = sizeof(addr);
+	int rx = -1;
+	int tx;
+	bool ok;
+
+	(void)arg;
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_len = sizeof(addr);
+	addr.sin_family = AF_INET;
+	tx = socket(AF_INET, SOCK_DGRAM, 0);
+	ok = tx >= 0;
+
+	if (ok && cyclictest.net_host != NULL) {
+		addr.sin_port = htons(CYCLICTEST_DISCARD_PORT);
+		ok = inet_pton(AF_INET, cyclictest.net_host,
+		    &addr.sin_addr) == 1;
+	} else if (ok) {
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		rx = socket(AF_INET, SOCK_DGRAM, 0);
+		ok = rx >= 0 &&
+		    bind(rx, (struct sockaddr *)&addr, sizeof(addr)) == 0 &&
+		    getsockname(rx, (struct sockaddr *)&addr, &len) == 0;
+	}
+	ok = ok && connect(tx, (struct sockaddr *)&addr, sizeof(addr)) == 0;
+	if (!ok) {
+		APPLOG_ERROR("cyclictest: network stress: %s",
+		    strerror(errno));
+	}
+
+	while (ok && !atomic_load(&cyclictest.stop)) {
+		/* Full socket buffers (ENOBUFS) are expected */
+		(void)send(tx, buf, sizeof(buf), 0);
+		if (rx >= 0) {
+			while (recv(rx, buf, sizeof(buf), MSG_DONTWAIT) > 0) {
+				/* Drain */
+			}
+		} else {
+			rtems_task_wake_after(RTEMS_YIELD_PROCESSOR);
+		}
+	}
+
+	if (rx >= 0) {
+		close(rx);
+	}
+	if (tx >= 0) {
+		close(tx);
+	}
+	atomic_fetch_sub(&cyclictest.stress_running, 1);
+	rtems_task_exit();
+}
+
+/* Toggle the LEDs as fast as possible */
+static void
+cyclictest_stress_led(rtems_task_argument arg)
+{
+	unsigned state = 0;
+
+	(void)arg;
+
+	while (!atomic_load(&cyclictest.stop)) {
+		grisp_led_set1((state & 1) != 0, (state & 2) != 0,
+		    (state & 4) != 0);
+		grisp_led_set2((state & 4) != 0, (state & 2) != 0,
+		    (state & 1) != 0);
+		++state;
+		rtems_task_wake_after(RTEMS_YIELD_PROCESSOR);
+	}
+
+	grisp_led_set1(false, false, false);
+	grisp_led_set2(false, false, false);
+	atomic_fetch_sub(&cyclictest.stress_running, 1);
+	rtems_task_exit();
+}
+
+static rtems_status_code
+cyclictest_start_task(rtems_name name, rtems_task_priority priority,
+    rtems_task_entry entry, rtems_task_argument arg, atomic_uint *running)
+{
+	rtems_status_code sc;
+	rtems_id id;
+
+	sc = rtems_task_create(name, priority, CYCLICTEST_TASK_STACK,
+	    RTEMS_DEFAULT_MODES, RTEMS_DEFAULT_ATTRIBUTES, &id);
+	if (sc != RTEMS_SUCCESSFUL) {
+		return sc;
+	}
+
+	atomic_fetch_add(running, 1);
+	sc = rtems_task_start(id, entry, arg);
+	if (sc != RTEMS_SUCCESSFUL) {
+		atomic_fetch_sub(running, 1);
+		(void)rtems_task_delete(id);
+	}
+
+	return sc;
+}
+
+static uint32_t
+cyclictest_percentile(const struct cyclictest_stat *stat, uint32_t count,
+    unsigned percent)
+{
+	uint64_t target = ((uint64_t)count * percent + 99) / 100;
+	uint64_t sum = 0;
+	uint32_t us;
+
+	for (us = 0; us < cyclictest.hist_size; ++us) {
+		sum += stat->hist[us];
+		if (sum >= target) {
+			return us;
+		}
+	}
+
+	return UINT32_MAX;
+}
+
+static void
+cyclictest_print_stat(const char *name, const struct cyclictest_stat *stat,
+    uint32_t count)
+{
+	uint32_t p99;
+
+	if (count == 0) {
+		return;
+	}
+
+	p99 = cyclictest_percentile(stat, count, 99);
+	printf("  %-10s min %6" PRIu32 " avg %6" PRIu64, name, stat->min,
+	    stat->sum / count);
+	if (p99 == UINT32_MAX) {
+		printf(" p99 >%5" PRIu32, cyclictest.hist_size);
+	} else {
+		printf(" p99 %6" PRIu32, p99);
+	}
+	printf(" max %6" PRIu32 " us", stat->max);
+	if (stat->overflow > 0) {
+		printf(" (%" PRIu32 " beyond histogram)", stat->overflow);
+	}
+	printf("\n");
+}
+
+static void
+cyclictest_print_progress(unsigned threads)
+{
+	unsigned i;
+
+	for (i = 0; i < threads; ++i) {
+		struct cyclictest_thread *t = &cyclictest.threads[i];
+		uint32_t cycles = atomic_load_explicit(&t->cycles,
+		    memory_order_acquire);
+
+		/* The values might be from slightly different cycles */
+		printf("T:%2u P:%3" PRIu32 " I:%6" PRIu32 " C:%8" PRIu32
+		    " Min:%6" PRIu32 " Avg:%6" PRIu64 " Max:%6" PRIu32 "\n",
+		    i, t->priority, t->interval_us, cycles,
+		    cycles > 0 ? t->wakeup.min : 0,
+		    cycles > 0 ? t->wakeup.sum / cycles : 0, t->wakeup.max);
+	}
+}
+
+static void
+cyclictest_print_results(unsigned threads, bool histogram)
+{
+	unsigned i;
+	uint32_t us;
+
+	for (i = 0; i < threads; ++i) {
+		struct cyclictest_thread *t = &cyclictest.threads[i];
+		uint32_t cycles = atomic_load(&t->cycles);
+
+		printf("T:%2u P:%3" PRIu32 " I:%6" PRIu32 " C:%8" PRIu32
+		    " overruns: %" PRIu32 "\n", i, t->priority,
+		    t->interval_us, cycles, t->overruns);
+		cyclictest_print_stat("wake-up", &t->wakeup, cycles);
+		cyclictest_print_stat("irq", &t->irq, cycles);
+		cyclictest_print_stat("irq->task", &t->task, cycles);
+	}
+
+	if (!histogram) {
+		return;
+	}
+
+	printf("Histogram of the wake-up latency\n    us");
+	for (i = 0; i < threads; ++i) {
+		printf("      T:%-2u", i);
+	}
+	printf("\n");
+	for (us = 0; us < cyclictest.hist_size; ++us) {
+		bool used = false;
+
+		for (i = 0; i < threads; ++i) {
+			used = used || cyclictest.threads[i].wakeup.hist[us] != 0;
+		}
+		if (!used) {
+			continue;
+		}
+		printf("%6" PRIu32, us);
+		for (i = 0; i < threads; ++i) {
+			printf(" %9" PRIu32,
+			    cyclictest.threads[i].wakeup.hist[us]);
+		}
+		printf("\n");
+	}
+	printf(" >%4" PRIu32, cyclictest.hist_size - 1);
+	for (i = 0; i < threads; ++i) {
+		printf(" %9" PRIu32, cyclictest.threads[i].wakeup.overflow);
+	}
+	printf("\n");
+}
+
+static void
+cyclictest_init_stat(struct cyclictest_stat *stat, uint32_t *hist)
+{
+	stat->min = UINT32_MAX;
+	stat->max = 0;
+	stat->sum = 0;
+	stat->overflow = 0;
+	stat->hist = hist;
+}
+
+static int
+cyclictest_run(const struct cyclictest_config *config)
+{
+	static const struct {
+		unsigned flag;
+		char name[5];
+		rtems_task_entry entry;
+	} stressors[] = {
+		{ CYCLICTEST_STRESS_SD, "STSD", cyclictest_stress_sd },
+		{ CYCLICTEST_STRESS_NET, "STNT", cyclictest_stress_net },
+		{ CYCLICTEST_STRESS_LED, "STLD", cyclictest_stress_led },
+	};
+	uint32_t *hist;
+	rtems_status_code sc = RTEMS_SUCCESSFUL;
+	uint32_t elapsed_s = 0;
+	unsigned started = 0;
+	size_t i;
+
+	hist = calloc((size_t)config->threads * 3 * config->hist_size,
+	    sizeof(*hist));
+	if (hist == NULL) {
+		printf("Not enough memory for the histograms\n");
+		return -1;
+	}
+
+	atomic_store(&cyclictest.stop, false);
+	cyclictest.loops = config->loops;
+	cyclictest.hist_size = config->hist_size;
+	cyclictest.net_host = config->net_host;
+
+	for (i = 0; i < RTEMS_ARRAY_SIZE(stressors); ++i) {
+		if ((config->stress & stressors[i].flag) == 0) {
+			continue;
+		}
+		sc = cyclictest_start_task(rtems_build_name(
+		    stressors[i].name[0], stressors[i].name[1],
+		    stressors[i].name[2], stressors[i].name[3]),
+		    config->stress_priority, stressors[i].entry, 0,
+		    &cyclictest.stress_running);
+		if (sc != RTEMS_SUCCESSFUL) {
+			printf("Couldn't start stress task: %s\n",
+			    rtems_status_text(sc));
+			break;
+		}
+	}
+
+	printf("timer: %s\n", hrtimer_init() == 0 ? "GPT" :
+	    "clock tick (irq->task is not available)");
+
+	for (i = 0; sc == RTEMS_SUCCESSFUL && i < config->threads; ++i) {
+		struct cyclictest_thread *t = &cyclictest.threads[i];
+		uint32_t *thread_hist = &hist[i * 3 * config->hist_size];
+
+		t->priority = config->priority + (rtems_task_priority)i;
+		t->interval_us = config->interval_us +
+		    (uint32_t)i * config->distance_us;
+		atomic_store(&t->cycles, 0);
+		t->overruns = 0;
+		cyclictest_init_stat(&t->wakeup, thread_hist);
+		cyclictest_init_stat(&t->irq,
+		    thread_hist + config->hist_size);
+		cyclictest_init_stat(&t->task,
+		    thread_hist + 2 * config->hist_size);
+
+		sc = cyclictest_start_task(
+		    rtems_build_name('C', 'T', '0' + i / 10, '0' + i % 10),
+		    t->priority, cyclictest_thread, i,
+		    &cyclictest.threads_running);
+		if (sc != RTEMS_SUCCESSFUL) {
+			printf("Couldn't start measurement task: %s\n",
+			    rtems_status_text(sc));
+		} else {
+			++started;
+		}
+	}
+
+	if (sc != RTEMS_SUCCESSFUL) {
+		atomic_store(&cyclictest.stop, true);
+	}
+
+	while (atomic_load(&cyclictest.threads_running) > 0) {
+		rtems_task_wake_after(RTEMS_MILLISECONDS_TO_TICKS(1000));
+		++elapsed_s;
+		if (config->duration_s != 0 && elapsed_s >= config->duration_s) {
+			atomic_store(&cyclictest.stop, true);
+		}
+		if (!config->quiet) {
+			cyclictest_print_progress(started);
+		}
+	}
+
+	atomic_store(&cyclictest.stop, true);
+	while (atomic_load(&cyclictest.stress_running) > 0) {
+		rtems_task_wake_after(RTEMS_MILLISECONDS_TO_TICKS(10));
+	}
+
+	applog_flush();
+	cyclictest_print_results(started, config->histogram);
+	free(hist);
+
+	return sc == RTEMS_SUCCESSFUL ? 0 : -1;
+}
+
+static bool
+cyclictest_parse_stress(struct cyclictest_config *config, const char *arg)
+{
+	if (strcmp(arg, "sd") == 0) {
+		config->stress |= CYCLICTEST_STRESS_SD;
+	} else if (strcmp(arg, "net") == 0) {
+		config->stress |= CYCLICTEST_STRESS_NET;
+	} else if (strncmp(arg, "net=", 4) == 0) {
+		config->stress |= CYCLICTEST_STRESS_NET;
+		config->net_host = arg + 4;
+	} else if (strcmp(arg, "led") == 0) {
+		config->stress |= CYCLICTEST_STRESS_LED;
+	} else {
+		return false;
+	}
+
+	return true;
+}
+
+static int
+command_cyclictest(int argc, char *argv[])
+{
+	struct cyclictest_config config = {
+		.threads = 1,
+		.priority = 10,
+		.interval_us = 1000,
+		.distance_us = 500,
+		.loops = 10000,
+		.hist_size = 1000,
+		.stress_priority = 160,
+	};
+	int rv;
+	int i;
+
+	for (i = 1; i < argc; ++i) {
+		unsigned long value = 0;
+		char *end = NULL;
+
+		if (strcmp(argv[i], "-H") == 0) {
+			config.histogram = true;
+			continue;
+		}
+		if (strcmp(argv[i], "-q") == 0) {
+			config.quiet = true;
+			continue;
+		}
+		if (i + 1 >= argc) {
+			puts(shell_CYCLICTEST_Command.usage);
+			return -1;
+		}
+		if (strcmp(argv[i], "-s") == 0) {
+			if (!cyclictest_parse_stress(&config, argv[i + 1])) {
+				puts(shell_CYCLICTEST_Command.usage);
+				return -1;
+			}
+			++i;
+			continue;
+		}
+
+		value = strtoul(argv[i + 1], &end, 0);
+		if (*end != '\0') {
+			puts(shell_CYCLICTEST_Command.usage);
+			return -1;
+		}
+		if (strcmp(argv[i], "-t") == 0) {
+			config.threads = (unsigned)value;
+		} else if (strcmp(argv[i], "-p") == 0) {
+			config.priority = (rtems_task_priority)value;
+		} else if (strcmp(argv[i], "-i") == 0) {
+			config.interval_us = (uint32_t)value;
+		} else if (strcmp(argv[i], "-d") == 0) {
+			config.distance_us = (uint32_t)value;
+		} else if (strcmp(argv[i], "-l") == 0) {
+			config.loops = (uint32_t)value;
+		} else if (strcmp(argv[i], "-D") == 0) {
+			config.duration_s = (uint32_t)value;
+			config.loops = 0;
+		} else if (strcmp(argv[i], "-h") == 0) {
+			config.hist_size = (uint32_t)value;
+		} else if (strcmp(argv[i], "-S") == 0) {
+			config.stress_priority = (rtems_task_priority)value;
+		} else {
+			puts(shell_CYCLICTEST_Command.usage);
+			return -1;
+		}
+		++i;
+	}
+
+	if (config.threads == 0 || config.threads > CYCLICTEST_MAX_THREADS ||
+	    config.priority == 0 ||
+	    config.priority + config.threads > RTEMS_MAXIMUM_PRIORITY ||
+	    config.stress_priority == 0 ||
+	    config.stress_priority >= RTEMS_MAXIMUM_PRIORITY ||
+	    config.interval_us == 0 || config.interval_us > INT32_MAX / 2 ||
+	    config.hist_size == 0 ||
+	    (config.loops == 0 && config.duration_s == 0)) {
+		puts(shell_CYCLICTEST_Command.usage);
+		return -1;
+	}
+
+	if (atomic_exchange(&cyclictest.busy, true)) {
+		printf("cyclictest is already running\n");
+		return -1;
+	}
+	rv = cyclictest_run(&config);
+	atomic_store(&cyclictest.busy, false);
+
+	return rv;
+}
+
+rtems_shell_cmd_t shell_CYCLICTEST_Command = {
+	.name = "cyclictest",
+	.usage = "Use with: cyclictest [-t <threads>] [-p <prio>] "
+	    "[-i <us>] [-d <us>] [-l <loops>|-D <s>] [-h <us>] [-H] [-q]\n"
+	    "    [-s sd|net|net=<ip>|led ...] [-S <prio>]\n"
+	    "Measure the wake up latency of periodic high priority tasks.\n"
+	    "  -t: Number of measurement tasks (default: 1, max: 8)\n"
+	    "  -p: Priority of the first task, the next ones get lower ones\n"
+	    "      (default: 10)\n"
+	    "  -i: Interval of the first task (default: 1000 us)\n"
+	    "  -d: Interval distance between the tasks (default: 500 us)\n"
+	    "  -l: Number of wake ups per task (default: 10000)\n"
+	    "  -D: Run for the given time instead\n"
+	    "  -h: Histogram size in microseconds (default: 1000)\n"
+	    "  -H: Print the histogram of the wake-up latency\n"
+	    "  -q: Only print the results\n"
+	    "  -s: Stress load, can be given multiple times:\n"
+	    "      sd: write and read " CYCLICTEST_SD_FILE "\n"
+	    "      net: UDP via loopback, net=<ip>: UDP to the discard port\n"
+	    "      led: toggle the LEDs\n"
+	    "  -S: Priority of the stress tasks (default: 160)\n",
+	.topic = "rtems",
+	.command = command_cyclictest,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
@@ -0,0 +1,397 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dmabuf.h"
+
+#include <err.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+#include <rtems/blkdev.h>
+#include <rtems/diskdevs.h>
+
+#include <dev/spi/spi.h>
+
+#define DMABUF_DEFAULT_ALIGNMENT	32
+
+size_t
+dmabuf_get_alignment(void)
+{
+	size_t line = rtems_cache_get_data_line_size();
+
+	return line != 0 ? line : DMABUF_DEFAULT_ALIGNMENT;
+}
+
+size_t
+dmabuf_round(size_t size)
+{
+	return RTEMS_ALIGN_UP(size, dmabuf_get_alignment());
+}
+
+void *
+dmabuf_alloc(size_t size)
+{
+	if (size == 0) {
+		return NULL;
+	}
+	return rtems_cache_coherent_allocate(dmabuf_round(size),
+	    dmabuf_get_alignment(), 0);
+}
+
+void
+dmabuf_free(void *buf)
+{
+	if (buf != NULL) {
+		rtems_cache_coherent_free(buf);
+	}
+}
+
+int
+dmabuf_pool_init(struct mempool *pool, const char *name,
+    size_t block_size, size_t count)
+{
+	size_t area_size = dmabuf_round(block_size) * count;
+	void *area;
+
+	area = dmabuf_alloc(area_size);
+	if (area == NULL) {
+		return -1;
+	}
+
+	return mempool_init(pool, name, area, area_size,
+	    dmabuf_round(block_size), dmabuf_get_alignment());
+}
+
+/*
+ * The benchmark compares a heap buffer that is deliberately not cache line
+ * aligned (the usual case for stack or malloc buffers inside structures)
+ * with a DMA buffer.
+ */
+struct dmabench_bufs {
+	void *heap;
+	uint8_t *unaligned;
+	uint8_t *dma;
+};
+
+static int
+dmabench_alloc(struct dmabench_bufs *bufs, size_t size)
+{
+	bufs->heap = malloc(size + 1);
+	bufs->unaligned = (uint8_t *)bufs->heap + 1;
+	bufs->dma = dmabuf_alloc(size);
+	if (bufs->heap == NULL || bufs->dma == NULL) {
+		free(bufs->heap);
+		dmabuf_free(bufs->dma);
+		return -1;
+	}
+	return 0;
+}
+
+static void
+dmabench_free(struct dmabench_bufs *bufs)
+{
+	free(bufs->heap);
+	dmabuf_free(bufs->dma);
+}
+
+static void
+dmabench_print(const char *what, uint64_t bytes, uint64_t ns)
+{
+	printf("%-10s %10llu bytes in %6llu ms -> %.1f kiByte/s\n", what,
+	    (unsigned long long)bytes, (unsigned long long)(ns / 1000000),
+	    ns > 0 ? ((double)bytes / 1024.) / ((double)ns / 1e9) : 0.);
+}
+
+/* A block device request with room for one buffer */
+struct dmabench_request {
+	rtems_blkdev_request req;
+	rtems_blkdev_sg_buffer sg;
+};
+
+static void
+dmabench_request_done(rtems_blkdev_request *req, rtems_status_code status)
+{
+	req->status = status;
+	(void)rtems_event_transient_send(req->io_task);
+}
+
+/*
+ * Read directly from the device driver into buf, bypassing bdbuf. This is
+ * where the buffer reaches the DMA of the SD host controller.
+ */
+static int
+dmabench_sd_direct(rtems_disk_device *dd, rtems_blkdev_bnum block,
+    uint64_t size, uint8_t *buf, size_t block_size, const char *what)
+{
+	rtems_disk_device *phys = dd->phys_dev;
+	rtems_blkdev_bnum media_blocks = block_size / dd->media_block_size;
+	uint64_t start;
+	uint64_t total;
+
+	start = rtems_clock_get_uptime_nanoseconds();
+	for (total = 0; total < size; total += block_size) {
+		struct dmabench_request r;
+		int rv;
+
+		memset(&r, 0, sizeof(r));
+		r.req.req = RTEMS_BLKDEV_REQ_READ;
+		r.req.done = dmabench_request_done;
+		r.req.bufnum = 1;
+		r.req.io_task = rtems_task_self();
+		r.req.bufs[0].block = dd->start + block;
+		r.req.bufs[0].length = (uint32_t)block_size;
+		r.req.bufs[0].buffer = buf;
+
+		rv = (*phys->ioctl)(phys, RTEMS_BLKIO_REQUEST, &r.req);
+		if (rv == 0) {
+			(void)rtems_event_transient_receive(RTEMS_WAIT,
+			    RTEMS_NO_TIMEOUT);
+		}
+		if (rv != 0 || r.req.status != RTEMS_SUCCESSFUL) {
+			warnx("Read failed at block %" PRIu32, block);
+			return -1;
+		}
+		block += media_blocks;
+	}
+	dmabench_print(what, total, rtems_clock_get_uptime_nanoseconds() - start);
+
+	return 0;
+}
+
+/* Read through bdbuf as the file systems do, with a cold cache */
+static int
+dmabench_sd_bdbuf(int fd, rtems_disk_device *dd, uint64_t size,
+    uint8_t *buf, size_t block_size)
+{
+	uint64_t start;
+	uint64_t total;
+	ssize_t rd;
+
+	rtems_bdbuf_purge_dev(dd);
+	if (lseek(fd, 0, SEEK_SET) != 0) {
+		warn("Couldn't seek");
+		return -1;
+	}
+
+	start = rtems_clock_get_uptime_nanoseconds();
+	for (total = 0; total < size; total += (uint64_t)rd) {
+		rd = read(fd, buf, block_size);
+		if (rd <= 0) {
+			warn("Read failed");
+			return -1;
+		}
+	}
+	dmabench_print("bdbuf:", total,
+	    rtems_clock_get_uptime_nanoseconds() - start);
+
+	return 0;
+}
+
+static int
+dmabench_sd(int argc, char *argv[])
+{
+	struct dmabench_bufs bufs;
+	rtems_disk_device *dd;
+	rtems_blkdev_bnum blocks;
+	uint64_t size = 8 * 1024 * 1024;
+	size_t block_size = 32 * 1024;
+	int fd;
+	int rv;
+
+	if (argc < 3 || argc > 5) {
+		return -1;
+	}
+	if (argc > 3) {
+		size = strtoull(argv[3], NULL, 0);
+	}
+	if (argc > 4) {
+		block_size = strtoul(argv[4], NULL, 0);
+	}
+
+	fd = open(argv[2], O_RDONLY);
+	if (fd < 0) {
+		warn("Couldn't open %s", argv[2]);
+		return -1;
+	}
+	if (rtems_disk_fd_get_disk_device(fd, &dd) != 0) {
+		warnx("%s is no block device", argv[2]);
+		close(fd);
+		return -1;
+	}
+	if (block_size == 0 || block_size % dd->media_block_size != 0 ||
+	    size < block_size) {
+		warnx("block_size must be a multiple of %" PRIu32
+		    " and at most size", dd->media_block_size);
+		close(fd);
+		return -1;
+	}
+	size -= size % block_size;
+	blocks = (rtems_blkdev_bnum)(size / dd->media_block_size);
+	if (3 * (uint64_t)blocks > dd->size) {
+		warnx("The device is too small for three times %" PRIu64
+		    " bytes", size);
+		close(fd);
+		return -1;
+	}
+	if (dmabench_alloc(&bufs, block_size) != 0) {
+		warnx("Not enough memory");
+		close(fd);
+		return -1;
+	}
+
+	/* Each pass reads another area, so no pass profits from a cache */
+	rv = dmabench_sd_bdbuf(fd, dd, size, bufs.dma, block_size);
+	if (rv == 0) {
+		rv = dmabench_sd_direct(dd, blocks, size, bufs.unaligned,
+		    block_size, "heap:");
+	}
+	if (rv == 0) {
+		rv = dmabench_sd_direct(dd, 2 * blocks, size, bufs.dma,
+		    block_size, "dmabuf:");
+	}
+
+	dmabench_free(&bufs);
+	close(fd);
+	return rv;
+}
+
+static int
+dmabench_spi_once(int bus, uint8_t cs, uint8_t *buf, size_t len,
+    unsigned count, const char *what)
+{
+	spi_ioc_transfer msg = {
+		.len = len,
+		.rx_buf = buf,
+		.tx_buf = buf,
+		.speed_hz = 10000000,
+		.bits_per_word = 8,
+		.mode = SPI_MODE_0,
+		.cs = cs,
+	};
+	uint64_t start;
+	unsigned i;
+
+	memset(buf, 0, len);
+	start = rtems_clock_get_uptime_nanoseconds();
+	for (i = 0; i < count; ++i) {
+		if (ioctl(bus, SPI_IOC_MESSAGE(1), &msg) != 0) {
+			warn("SPI transfer failed");
+			return -1;
+		}
+	}
+	dmabench_print(what, (uint64_t)len * count,
+	    rtems_clock_get_uptime_nanoseconds() - start);
+
+	return 0;
+}
+
+static int
+dmabench_spi(int argc, char *argv[])
+{
+	struct dmabench_bufs bufs;
+	size_t len = 64;
+	unsigned count = 1000;
+	uint8_t cs;
+	int bus;
+	int rv;
+
+	if (argc < 4 || argc > 6) {
+		return -1;
+	}
+	cs = (uint8_t)strtoul(argv[3], NULL, 0);
+	if (argc > 4) {
+		len = strtoul(argv[4], NULL, 0);
+	}
+	if (argc > 5) {
+		count = (unsigned)strtoul(argv[5], NULL, 0);
+	}
+	if (len == 0 || count == 0) {
+		return -1;
+	}
+
+	bus = open(argv[2], O_RDWR);
+	if (bus < 0) {
+		warn("Couldn't open %s", argv[2]);
+		return -1;
+	}
+	if (dmabench_alloc(&bufs, len) != 0) {
+		warnx("Not enough memory");
+		close(bus);
+		return -1;
+	}
+
+	rv = dmabench_spi_once(bus, cs, bufs.unaligned, len, count, "heap:");
+	if (rv == 0) {
+		rv = dmabench_spi_once(bus, cs, bufs.dma, len, count, "dmabuf:");
+	}
+
+	dmabench_free(&bufs);
+	close(bus);
+	return rv;
+}
+
+static int
+command_dmabench(int argc, char *argv[])
+{
+	int rv = -1;
+
+	if (argc >= 2 && strcmp(argv[1], "sd") == 0) {
+		rv = dmabench_sd(argc, argv);
+	} else if (argc >= 2 && strcmp(argv[1], "spi") == 0) {
+		rv = dmabench_spi(argc, argv);
+	}
+
+	if (rv != 0) {
+		puts(shell_DMABENCH_Command.usage);
+	}
+	return rv;
+}
+
+rtems_shell_cmd_t shell_DMABENCH_Command = {
+	.name = "dmabench",
+	.usage = "Use with: dmabench sd <device> [<size> [<block_size>]]\n"
+	    "           dmabench spi <bus> <cs> [<len> [<count>]]\n"
+	    "Compare the throughput of an unaligned heap buffer with a DMA\n"
+	    "buffer, for example 'dmabench sd /dev/mmcsd-0' or\n"
+	    "'dmabench spi /dev/spibus 2 256 1000'. The sd variant reads\n"
+	    "size bytes (default: 8 MiB) through bdbuf with a purged cache\n"
+	    "and then directly from the driver into each buffer.\n"
+	    "CAUTION: The spi variant sends zeros to the given chip select.\n",
+	.topic = "misc",
+	.command = command_dmabench,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
@@ -0,0 +1,77 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DEMO_DMABUF_H
+#define DEMO_DMABUF_H
+
+#include <rtems.h>
+#include <rtems/shell.h>
+
+#include "mempool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Buffers for DMA capable drivers (SPI, I2C, SD). They start and end on a
+ * cache line boundary, so cache maintenance of a buffer never touches
+ * neighbouring data and drivers don't need bounce buffers.
+ *
+ * The buffers come from the cache coherent heap. On GRiSP1 that is the
+ * no-cache region (ATSAM_MEMORY_NOCACHE_SIZE), so no cache maintenance is
+ * necessary at all. If the BSP provides no coherent area (GRiSP2), they come
+ * from the normal heap and are still cache line aligned.
+ */
+
+/* Return the data cache line size used for the alignment. */
+size_t dmabuf_get_alignment(void);
+
+/* Round size up to a multiple of the cache line size. */
+size_t dmabuf_round(size_t size);
+
+/* Allocate a buffer of at least size bytes. Returns NULL on error. */
+void *dmabuf_alloc(size_t size);
+
+/* Free a buffer from dmabuf_alloc(). NULL is ignored. */
+void dmabuf_free(void *buf);
+
+/*
+ * Initialize a pool with count DMA buffers of block_size bytes each. The area
+ * is allocated once with dmabuf_alloc() and never freed. Use this for buffers
+ * that are allocated per transfer. Returns 0 on success.
+ */
+int dmabuf_pool_init(struct mempool *pool, const char *name,
+    size_t block_size, size_t count);
+
+extern rtems_shell_cmd_t shell_DMABENCH_Command;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DEMO_DMABUF_H */
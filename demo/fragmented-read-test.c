@@ -26,6 +26,9 @@
  */
 
 #include "fragmented-read-test.h"
+#include "applog.h"
+#include "mempool.h"
+#include "profile.h"
 
 #include <dirent.h>
 #include <errno.h>
@@ -39,6 +42,8 @@
 #include <unistd.h>
 
 #define TEST_SUBDIR "test-dir"
+/* Files between two progress messages at the info level */
+#define PROGRESS_INTERVAL 1000
 
 static const char small_content[] = "I'm a small file";
 static const char big_content[1024] = "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Morbi ligula tellus, euismod nec faucibus in, ultrices at odio. Nunc mollis luctus turpis, at tempus tortor hendrerit eget. Nulla at dapibus libero, nec consequat magna. Nulla mattis lacus semper sollicitudin eleifend. Morbi arcu lacus, volutpat ac dolor eget, pretium lacinia neque. Pellentesque habitant morbi tristique senectus et netus et malesuada fames ac turpis egestas. Sed eget augue sed lacus ultricies ultricies in lobortis sem. Nunc mauris urna, maximus et odio eget, commodo lacinia sem. Curabitur molestie dolor et augue suscipit porttitor. Pellentesque quis diam imperdiet, suscipit ex eget, aliquam enim. Pellentesque nec porttitor risus, id viverra justo. In ultrices est egestas elit venenatis, eu iaculis sapien ullamcorper. Aenean sed ligula a libero pulvinar maximus. Fusce bibendum, risus sit amet dapibus pharetra, arcu libero lobortis sapien, quis varius enim mi ut nisl. Quisque a augue dapibus, portt.";
@@ -112,7 +117,10 @@ fill_disk_with_small_files(const char *dir)
 	printf("Fill disk with small test files\n");
 
 	while(written == sizeof(small_content)) {
-		printf("Working on file %d    \r", i);
+		APPLOG_DEBUG("Working on file %d", i);
+		if (i % PROGRESS_INTERVAL == 0) {
+			APPLOG_INFO("%u small files written", i);
+		}
 		rv = snprint_small(path, sizeof(path), dir, i);
 		if (rv < 0) {
 			return rv;
@@ -227,12 +235,15 @@ remove_some_small_files_and_create_big_file(const char *dir, unsigned nr_files)
 			i = pseudo_random(&rnd_state, nr_files);
 			rv = remove_small_file(dir, i);
 			if (rv < 0) {
-				printf("Error while deleting file\n");
+				APPLOG_ERROR("Error while deleting file");
 				return rv;
 			}
 		} while(rv != 0);
 		deleted += 1;
-		printf("deleted: %d / %d    \r", deleted, to_delete);
+		APPLOG_DEBUG("deleted: %d / %d", deleted, to_delete);
+		if (deleted % PROGRESS_INTERVAL == 0) {
+			APPLOG_INFO("deleted: %u / %u", deleted, to_delete);
+		}
 
 		if (fd < 0) {
 			/* big file not yet opened */
@@ -270,14 +281,15 @@ check_read_speed_of_big_file(const char *dir, unsigned tries, size_t block_size)
 
 	printf("== Read big file and measure time\n");
 
-	content = malloc(block_size);
+	content = mempool_io_alloc(block_size);
 	if (content == NULL) {
-		perror("Not enough space for read blocks.");
+		printf("Couldn't allocate the read buffer\n");
 		return -1;
 	}
 
 	rv = snprint_big(path, sizeof(path), dir);
 	if (rv < 0) {
+		mempool_io_free(content);
 		return rv;
 	}
 
@@ -292,6 +304,7 @@ check_read_speed_of_big_file(const char *dir, unsigned tries, size_t block_size)
 		fd = open(path, O_RDONLY);
 		if (fd < 0) {
 			perror("Couldn't open big file\n");
+			mempool_io_free(content);
 			return rv;
 		}
 
@@ -320,6 +333,7 @@ check_read_speed_of_big_file(const char *dir, unsigned tries, size_t block_size)
 	printf("== Total: %.1f kiByte/s\n",
 	    (total_bytes / 1024.) / (total_ns / 1000. / 1000. / 1000.));
 
+	mempool_io_free(content);
 	return 0;
 }
 
@@ -336,7 +350,7 @@ do_cleanup(const char *dir, unsigned nr_files)
 	for (i = 0; i < nr_files; ++i) {
 		rv = remove_small_file(dir, i);
 		if (rv < 0) {
-			printf("Error removing small file %d\n", i);
+			APPLOG_ERROR("Error removing small file %d", i);
 			error = rv;
 		}
 	}
@@ -374,7 +388,7 @@ command_fragmented_read_test(int argc, char *argv[])
 	int nr_files;
 	bool cleanup = true;
 	const unsigned tries = 6;
-	const size_t read_block_size = 8 * 1024;
+	const size_t read_block_size = profile.read_block_size;
 	int i;
 
 	for (i = 1; i < argc; ++i) {
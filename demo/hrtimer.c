@@ -0,0 +1,597 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <bsp.h>
+#ifdef LIBBSP_ARM_ATSAM_BSP_H
+#define IS_GRISP1 1
+#else
+#define IS_GRISP2 1
+#endif
+
+#include "hrtimer.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/config.h>
+
+#ifdef IS_GRISP2
+#include <bsp/fdt.h>
+#include <libfdt.h>
+#endif /* IS_GRISP2 */
+
+/* Delays up to this are done with a busy wait */
+#define HRTIMER_SPIN_US		20
+
+/* Waiters that are woken up with one lock acquisition */
+#define HRTIMER_WAKE_BATCH	8
+
+/* i.MX6UL GPT registers */
+#define GPT_CR			0x00
+#define GPT_CR_EN		(1u << 0)
+#define GPT_CR_ENMOD		(1u << 1)
+#define GPT_CR_DBGEN		(1u << 2)
+#define GPT_CR_WAITEN		(1u << 3)
+#define GPT_CR_CLKSRC_24M	(5u << 6)
+#define GPT_CR_FRR		(1u << 9)
+#define GPT_CR_EN_24M		(1u << 10)
+#define GPT_CR_SWR		(1u << 15)
+#define GPT_PR			0x04
+#define GPT_PR_PRESCALER(x)	((uint32_t)(x) & 0xfffu)
+#define GPT_PR_PRESCALER24M(x)	(((uint32_t)(x) & 0xfu) << 12)
+#define GPT_SR			0x08
+#define GPT_SR_ALL		0x3fu
+#define GPT_IR			0x0c
+#define GPT_IR_OF1IE		(1u << 0)
+#define GPT_OCR1		0x10
+#define GPT_CNT			0x24
+
+/* Time of the counter rate check and the accepted deviation */
+#define HRTIMER_CHECK_US	2000
+#define HRTIMER_CHECK_PERMILLE	20
+
+/* GPT2 clock gates in CCM_CCGR0 */
+#define CCM_CCGR0		0x68
+#define CCM_CCGR0_GPT2		(0xfu << 24)
+
+struct hrtimer_waiter {
+	struct hrtimer_waiter *next;
+	uint32_t deadline;
+	uint32_t expired_at;
+	rtems_id task;
+	bool transient;
+	bool expired;
+};
+
+static struct {
+	volatile uint8_t *regs;
+	struct hrtimer_waiter *head;
+} hrtimer;
+
+RTEMS_INTERRUPT_LOCK_DEFINE(static, hrtimer_lock, "hrtimer")
+
+static inline uint32_t
+hrtimer_read(uint32_t reg)
+{
+	return *(volatile uint32_t *)(hrtimer.regs + reg);
+}
+
+static inline void
+hrtimer_write(uint32_t reg, uint32_t value)
+{
+	*(volatile uint32_t *)(hrtimer.regs + reg) = value;
+}
+
+static inline bool
+hrtimer_is_expired(uint32_t deadline, uint32_t now)
+{
+	return (int32_t)(deadline - now) <= 0;
+}
+
+uint32_t
+hrtimer_now_us(void)
+{
+	if (hrtimer.regs == NULL) {
+		return (uint32_t)(rtems_clock_get_uptime_nanoseconds() / 1000);
+	}
+	return hrtimer_read(GPT_CNT);
+}
+
+/*
+ * Remove expired waiters from the list and program the compare register for
+ * the next one. The tasks of the expired waiters are returned in wake. A
+ * waiter must not be accessed after it has been marked expired because its
+ * task might return and release it. Events can't be sent with the lock held
+ * in thread context, so the caller does it after releasing the lock.
+ */
+static size_t
+hrtimer_expire_locked(rtems_id wake[HRTIMER_WAKE_BATCH],
+    bool transient[HRTIMER_WAKE_BATCH])
+{
+	size_t count = 0;
+
+	while (hrtimer.head != NULL) {
+		struct hrtimer_waiter *w = hrtimer.head;
+
+		if (!hrtimer_is_expired(w->deadline, hrtimer_read(GPT_CNT))) {
+			hrtimer_write(GPT_OCR1, w->deadline);
+
+			/* Don't miss a deadline that passed meanwhile */
+			if (!hrtimer_is_expired(w->deadline,
+			    hrtimer_read(GPT_CNT))) {
+				break;
+			}
+		}
+		if (count == HRTIMER_WAKE_BATCH) {
+			break;
+		}
+
+		hrtimer.head = w->next;
+		wake[count] = w->task;
+		transient[count] = w->transient;
+		++count;
+		w->expired_at = hrtimer_read(GPT_CNT);
+		w->expired = true;
+	}
+
+	return count;
+}
+
+static void
+hrtimer_wake(const rtems_id wake[HRTIMER_WAKE_BATCH],
+    const bool transient[HRTIMER_WAKE_BATCH], size_t count)
+{
+	size_t i;
+
+	for (i = 0; i < count; ++i) {
+		if (transient[i]) {
+			(void)rtems_event_transient_send(wake[i]);
+		} else {
+			(void)rtems_event_send(wake[i], HRTIMER_EVENT_TIMEOUT);
+		}
+	}
+}
+
+static void
+hrtimer_process(void)
+{
+	rtems_interrupt_lock_context lock_context;
+	rtems_id wake[HRTIMER_WAKE_BATCH];
+	bool transient[HRTIMER_WAKE_BATCH];
+	size_t count;
+
+	do {
+		rtems_interrupt_lock_acquire(&hrtimer_lock, &lock_context);
+		count = hrtimer_expire_locked(wake, transient);
+		rtems_interrupt_lock_release(&hrtimer_lock, &lock_context);
+		hrtimer_wake(wake, transient, count);
+	} while (count == HRTIMER_WAKE_BATCH);
+}
+
+static void
+hrtimer_interrupt(void *arg)
+{
+	(void)arg;
+	hrtimer_write(GPT_SR, GPT_SR_ALL);
+	hrtimer_process();
+}
+
+static void
+hrtimer_insert_locked(struct hrtimer_waiter *w)
+{
+	struct hrtimer_waiter **prev;
+
+	prev = &hrtimer.head;
+	while (*prev != NULL &&
+	    (int32_t)((*prev)->deadline - w->deadline) <= 0) {
+		prev = &(*prev)->next;
+	}
+	w->next = *prev;
+	*prev = w;
+}
+
+static void
+hrtimer_add(struct hrtimer_waiter *w, uint32_t us)
+{
+	rtems_interrupt_lock_context lock_context;
+
+	w->task = rtems_task_self();
+	w->expired = false;
+
+	rtems_interrupt_lock_acquire(&hrtimer_lock, &lock_context);
+	w->deadline = hrtimer_read(GPT_CNT) + us;
+	hrtimer_insert_locked(w);
+	rtems_interrupt_lock_release(&hrtimer_lock, &lock_context);
+
+	/* Programs the compare register or wakes up immediately */
+	hrtimer_process();
+}
+
+static void
+hrtimer_add_at(struct hrtimer_waiter *w, uint32_t deadline)
+{
+	rtems_interrupt_lock_context lock_context;
+
+	w->task = rtems_task_self();
+	w->expired = false;
+	w->deadline = deadline;
+
+	rtems_interrupt_lock_acquire(&hrtimer_lock, &lock_context);
+	hrtimer_insert_locked(w);
+	rtems_interrupt_lock_release(&hrtimer_lock, &lock_context);
+
+	hrtimer_process();
+}
+
+/* Returns true if the waiter has expired before it could be removed. */
+static bool
+hrtimer_cancel(struct hrtimer_waiter *w)
+{
+	rtems_interrupt_lock_context lock_context;
+	struct hrtimer_waiter **prev;
+	bool expired;
+
+	rtems_interrupt_lock_acquire(&hrtimer_lock, &lock_context);
+	expired = w->expired;
+	if (!expired) {
+		prev = &hrtimer.head;
+		while (*prev != w) {
+			prev = &(*prev)->next;
+		}
+		*prev = w->next;
+	}
+	rtems_interrupt_lock_release(&hrtimer_lock, &lock_context);
+
+	return expired;
+}
+
+/*
+ * Ticks for a wait of at least us. A wait of n ticks ends at the n-th tick
+ * boundary and the first one might be right after the call, hence one more.
+ */
+static rtems_interval
+hrtimer_us_to_ticks(uint32_t us)
+{
+	uint32_t us_per_tick = rtems_configuration_get_microseconds_per_tick();
+
+	return us / us_per_tick + (us % us_per_tick != 0 ? 1 : 0) + 1;
+}
+
+static void
+hrtimer_spin_us(uint32_t us)
+{
+	uint32_t start = hrtimer_now_us();
+
+	while (hrtimer_now_us() - start < us) {
+		/* Busy wait */
+	}
+}
+
+void
+hrtimer_sleep_us(uint32_t us)
+{
+	struct hrtimer_waiter w;
+
+	if (us <= HRTIMER_SPIN_US) {
+		hrtimer_spin_us(us);
+		return;
+	}
+
+	if (hrtimer.regs == NULL) {
+		rtems_task_wake_after(hrtimer_us_to_ticks(us));
+		return;
+	}
+
+	w.transient = true;
+	hrtimer_add(&w, us);
+	(void)rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+}
+
+uint32_t
+hrtimer_sleep_until_us(uint32_t deadline)
+{
+	struct hrtimer_waiter w;
+
+	if (hrtimer.regs == NULL) {
+		uint32_t now = hrtimer_now_us();
+
+		/* Never return before the deadline */
+		while (!hrtimer_is_expired(deadline, now)) {
+			rtems_task_wake_after(
+			    hrtimer_us_to_ticks(deadline - now));
+			now = hrtimer_now_us();
+		}
+		return now;
+	}
+
+	w.transient = true;
+	hrtimer_add_at(&w, deadline);
+	(void)rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+
+	return w.expired_at;
+}
+
+rtems_status_code
+hrtimer_event_receive(
+	rtems_event_set event_in,
+	rtems_option option_set,
+	uint32_t timeout_us,
+	rtems_event_set *event_out
+)
+{
+	struct hrtimer_waiter w;
+	rtems_event_set pending = 0;
+	rtems_event_set received;
+	rtems_status_code sc;
+	bool all = (option_set & RTEMS_EVENT_ANY) == 0;
+
+	if (event_out == NULL) {
+		return RTEMS_INVALID_ADDRESS;
+	}
+
+	event_in &= ~HRTIMER_EVENT_TIMEOUT;
+	if ((option_set & RTEMS_NO_WAIT) != 0 || timeout_us == 0 ||
+	    hrtimer.regs == NULL) {
+		rtems_interval ticks = RTEMS_NO_TIMEOUT;
+
+		if (timeout_us != 0) {
+			ticks = hrtimer_us_to_ticks(timeout_us);
+		}
+		return rtems_event_receive(event_in, option_set, ticks,
+		    event_out);
+	}
+
+	/* Discard a timeout that is left over from an earlier call */
+	(void)rtems_event_receive(HRTIMER_EVENT_TIMEOUT,
+	    RTEMS_EVENT_ANY | RTEMS_NO_WAIT, 0, &received);
+
+	w.transient = false;
+	hrtimer_add(&w, timeout_us);
+
+	/*
+	 * Collect the events one by one until the condition is satisfied. This
+	 * way, the timeout event can be received together with the others.
+	 */
+	for (;;) {
+		(void)rtems_event_receive((event_in & ~pending) |
+		    HRTIMER_EVENT_TIMEOUT, RTEMS_EVENT_ANY | RTEMS_WAIT,
+		    RTEMS_NO_TIMEOUT, &received);
+		pending |= received & event_in;
+
+		if (all ? pending == event_in : pending != 0) {
+			sc = RTEMS_SUCCESSFUL;
+			break;
+		}
+		if ((received & HRTIMER_EVENT_TIMEOUT) != 0) {
+			sc = RTEMS_TIMEOUT;
+			break;
+		}
+	}
+
+	if ((received & HRTIMER_EVENT_TIMEOUT) == 0 && hrtimer_cancel(&w)) {
+		/* Has been sent already, consume it */
+		(void)rtems_event_receive(HRTIMER_EVENT_TIMEOUT,
+		    RTEMS_EVENT_ANY | RTEMS_WAIT, RTEMS_NO_TIMEOUT, &received);
+	}
+
+	if (sc == RTEMS_SUCCESSFUL) {
+		*event_out = pending;
+	} else {
+		/* Give back what has been received so far */
+		*event_out = 0;
+		if (pending != 0) {
+			(void)rtems_event_send(RTEMS_SELF, pending);
+		}
+	}
+
+	return sc;
+}
+
+#ifdef IS_GRISP2
+/*
+ * Compare the counter against the uptime of the clock driver. A wrong
+ * prescaler would make every timeout too short or too long.
+ */
+static bool
+hrtimer_rate_is_valid(void)
+{
+	rtems_interrupt_level level;
+	uint64_t start_ns;
+	uint64_t end_ns;
+	uint32_t start;
+	uint32_t end;
+	uint32_t expected;
+	uint32_t counted;
+	uint32_t tolerance;
+
+	rtems_interrupt_local_disable(level);
+	start_ns = rtems_clock_get_uptime_nanoseconds();
+	start = hrtimer_read(GPT_CNT);
+	rtems_interrupt_local_enable(level);
+
+	do {
+		end_ns = rtems_clock_get_uptime_nanoseconds();
+	} while (end_ns - start_ns < HRTIMER_CHECK_US * 1000);
+
+	rtems_interrupt_local_disable(level);
+	end_ns = rtems_clock_get_uptime_nanoseconds();
+	end = hrtimer_read(GPT_CNT);
+	rtems_interrupt_local_enable(level);
+
+	expected = (uint32_t)((end_ns - start_ns) / 1000);
+	counted = end - start;
+	tolerance = expected * HRTIMER_CHECK_PERMILLE / 1000 + 2;
+
+	return counted + tolerance >= expected &&
+	    counted <= expected + tolerance;
+}
+#endif /* IS_GRISP2 */
+
+int
+hrtimer_init(void)
+{
+#ifdef IS_GRISP2
+	const void *fdt;
+	const char *path;
+	volatile uint8_t *ccm;
+	volatile uint8_t *regs;
+	rtems_vector_number irq;
+	rtems_status_code sc;
+	int node;
+
+	if (hrtimer.regs != NULL) {
+		return 0;
+	}
+
+	fdt = bsp_fdt_get();
+	path = fdt_get_alias(fdt, "hrtimer");
+	if (path == NULL) {
+		return -1;
+	}
+	node = fdt_path_offset(fdt, path);
+	if (node < 0) {
+		return -1;
+	}
+	regs = imx_get_reg_of_node(fdt, node);
+	irq = imx_get_irq_of_node(fdt, node, 0);
+	if (regs == NULL) {
+		return -1;
+	}
+
+	node = fdt_node_offset_by_compatible(fdt, -1, "fsl,imx6ul-ccm");
+	if (node < 0) {
+		return -1;
+	}
+	ccm = imx_get_reg_of_node(fdt, node);
+	if (ccm == NULL) {
+		return -1;
+	}
+	*(volatile uint32_t *)(ccm + CCM_CCGR0) |= CCM_CCGR0_GPT2;
+
+	hrtimer.regs = regs;
+	hrtimer_write(GPT_CR, 0);
+	hrtimer_write(GPT_CR, GPT_CR_SWR);
+	while ((hrtimer_read(GPT_CR) & GPT_CR_SWR) != 0) {
+		/* Wait for reset */
+	}
+
+	/*
+	 * The 24 MHz crystal divided by 12 and by 2 gives a microsecond
+	 * counter. PRESCALER24M only divides by 1 to 16.
+	 */
+	hrtimer_write(GPT_PR, GPT_PR_PRESCALER24M(12 - 1) |
+	    GPT_PR_PRESCALER(2 - 1));
+	hrtimer_write(GPT_CR, GPT_CR_CLKSRC_24M | GPT_CR_EN_24M | GPT_CR_FRR |
+	    GPT_CR_ENMOD | GPT_CR_WAITEN | GPT_CR_DBGEN);
+	hrtimer_write(GPT_SR, GPT_SR_ALL);
+	hrtimer_write(GPT_CR, hrtimer_read(GPT_CR) | GPT_CR_EN);
+
+	if (!hrtimer_rate_is_valid()) {
+		hrtimer_write(GPT_CR, 0);
+		hrtimer.regs = NULL;
+		return -1;
+	}
+	hrtimer_write(GPT_IR, GPT_IR_OF1IE);
+
+	sc = rtems_interrupt_handler_install(irq, "hrtimer",
+	    RTEMS_INTERRUPT_UNIQUE, hrtimer_interrupt, NULL);
+	if (sc != RTEMS_SUCCESSFUL) {
+		hrtimer_write(GPT_CR, 0);
+		hrtimer.regs = NULL;
+		return -1;
+	}
+
+	return 0;
+#else /* IS_GRISP2 */
+	return -1;
+#endif /* IS_GRISP2 */
+}
+
+static int
+command_hrtimer(int argc, char *argv[])
+{
+	unsigned long us;
+	unsigned long count = 100;
+	uint32_t min = UINT32_MAX;
+	uint32_t max = 0;
+	uint64_t sum = 0;
+	unsigned long i;
+	char *end;
+
+	if (argc < 2 || argc > 3) {
+		puts(shell_HRTIMER_Command.usage);
+		return -1;
+	}
+	us = strtoul(argv[1], &end, 0);
+	if (*end != '\0' || us == 0 || us > INT32_MAX) {
+		puts(shell_HRTIMER_Command.usage);
+		return -1;
+	}
+	if (argc == 3) {
+		count = strtoul(argv[2], &end, 0);
+		if (*end != '\0' || count == 0) {
+			puts(shell_HRTIMER_Command.usage);
+			return -1;
+		}
+	}
+
+	for (i = 0; i < count; ++i) {
+		uint32_t start = hrtimer_now_us();
+		uint32_t delta;
+
+		hrtimer_sleep_us((uint32_t)us);
+		delta = hrtimer_now_us() - start;
+		sum += delta;
+		if (delta < min) {
+			min = delta;
+		}
+		if (delta > max) {
+			max = delta;
+		}
+	}
+
+	printf("timer: %s\n", hrtimer.regs != NULL ? "GPT" : "clock tick");
+	printf("sleep %lu us: min %" PRIu32 " us, avg %" PRIu64 " us, "
+	    "max %" PRIu32 " us\n", us, min, sum / count, max);
+
+	return 0;
+}
+
+rtems_shell_cmd_t shell_HRTIMER_Command = {
+	.name = "hrtimer",
+	.usage = "Use with: hrtimer <us> [<count>]\n"
+	    "Sleep count times (default: 100) and print the actual durations.\n",
+	.topic = "misc",
+	.command = command_hrtimer,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
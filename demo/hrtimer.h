@@ -0,0 +1,95 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DEMO_HRTIMER_H
+#define DEMO_HRTIMER_H
+
+#include <rtems.h>
+#include <rtems/shell.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * High resolution sleeps and timeouts for drivers.
+ *
+ * The service uses a dedicated hardware timer (GPT referenced by the
+ * "hrtimer" alias in the FDT) that runs with 1 MHz. The clock tick is not
+ * affected. Without the timer (for example on GRiSP1) all functions fall
+ * back to the clock tick with the timeout rounded up to full ticks.
+ *
+ * Timeouts must be less than 2^31 microseconds.
+ */
+
+/*
+ * Event that is reserved for hrtimer_event_receive(). Don't use it for other
+ * purposes in tasks that call this function.
+ */
+#define HRTIMER_EVENT_TIMEOUT RTEMS_EVENT_31
+
+/* Set up the timer. Returns 0 on success or -1 if the fallback is used. */
+int hrtimer_init(void);
+
+/* Return a free running microsecond counter that wraps around at 2^32. */
+uint32_t hrtimer_now_us(void);
+
+/*
+ * Block the calling task for at least the given time. Very short delays are
+ * busy waits because a context switch would take longer. Uses the transient
+ * event of the task.
+ */
+void hrtimer_sleep_us(uint32_t us);
+
+/*
+ * Block the calling task until hrtimer_now_us() reaches the deadline. Unlike
+ * repeated hrtimer_sleep_us() calls, periodic wake ups don't drift. Returns
+ * the counter value at which the timer interrupt handled the deadline (with
+ * the clock tick fallback the time after the wake up), so the caller can tell
+ * the interrupt latency from the scheduling latency. Uses the transient event
+ * of the task.
+ */
+uint32_t hrtimer_sleep_until_us(uint32_t deadline);
+
+/*
+ * Like rtems_event_receive() but with a timeout in microseconds. A timeout of
+ * zero waits forever like RTEMS_NO_TIMEOUT.
+ */
+rtems_status_code hrtimer_event_receive(
+	rtems_event_set event_in,
+	rtems_option option_set,
+	uint32_t timeout_us,
+	rtems_event_set *event_out
+);
+
+extern rtems_shell_cmd_t shell_HRTIMER_Command;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DEMO_HRTIMER_H */
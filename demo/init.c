@@ -33,6 +33,9 @@
 
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/sysctl.h>
 
 #include <rtems.h>
 #include <rtems/bsd/bsd.h>
@@ -45,10 +48,6 @@
 #include <rtems/stringto.h>
 #include <rtems/ftpd.h>
 #include <machine/rtems-bsd-commands.h>
-#ifdef EVENT_RECORDING
-#include <rtems/record.h>
-#include <rtems/recordserver.h>
-#endif /* EVENT_RECORDING */
 
 #include <bsp.h>
 #ifdef LIBBSP_ARM_ATSAM_BSP_H
@@ -65,6 +64,21 @@
 #include <grisp/init.h>
 #include <grisp/eeprom.h>
 
+#include "applog.h"
+#include "boottime.h"
+#include "bringup.h"
+#include "cyclictest.h"
+#include "dmabuf.h"
+#include "hrtimer.h"
+#include "iperf.h"
+#include "mempool.h"
+#include "metrics.h"
+#include "pgo.h"
+#include "profile.h"
+#include "sensorstream.h"
+#include "tasktop.h"
+#include "tracing.h"
+#include "tslog.h"
 #include "fragmented-read-test.h"
 #include "sd-card-test.h"
 #include "1wire.h"
@@ -72,11 +86,14 @@
 
 #define STACK_SIZE_INIT_TASK	(64 * 1024)
 #define STACK_SIZE_SHELL	(64 * 1024)
+#define STACK_SIZE_BRINGUP	(32 * 1024)
 
-#define PRIO_SHELL		150
-#define PRIO_LED_TASK		(RTEMS_MAXIMUM_PRIORITY - 1)
-#define PRIO_DHCP		(RTEMS_MAXIMUM_PRIORITY - 1)
-#define PRIO_WPA		(RTEMS_MAXIMUM_PRIORITY - 1)
+/* The other priorities are part of the profile (see profile.h) */
+#define PRIO_BRINGUP		100
+
+#define WLAN_DEVICE		"rtwn0"
+#define WLAN_DEVICE_POLL_MS	50
+#define WLAN_DEVICE_TIMEOUT_MS	5000
 
 #define SPI_FDT_NAME "spi0"
 #define SPI_BUS "/dev/spibus"
@@ -91,6 +108,12 @@ const size_t atsam_pin_config_count = PIO_LISTSIZE(atsam_pin_config);
 const uint32_t atsam_matrix_ccfg_sysio = GRISP_MATRIX_CCFG_SYSIO;
 #endif /* IS_GRISP1 */
 
+/*
+ * RETR copies the data from bdbuf into a buffer and from there into mbufs.
+ * Avoiding that needs mbufs with external storage holding bdbuf buffers and
+ * a RETR in the FTP server that uses them. Both are changes in the RTEMS and
+ * libbsd sources, not in this application.
+ */
 struct rtems_ftpd_configuration rtems_ftpd_configuration = {
 	.priority = 100,
 	.max_hook_filesize = 0,
@@ -108,7 +131,7 @@ start_shell(void)
 	rtems_status_code sc = rtems_shell_init(
 		"SHLL",
 		STACK_SIZE_SHELL,
-		PRIO_SHELL,
+		profile.shell_priority,
 		CONSOLE_DEVICE_NAME,
 		false,
 		true,
@@ -181,7 +204,8 @@ led_task(rtems_task_argument arg)
 		grisp_led_set1(r1, g1, b1);
 		grisp_led_set2(r2, g2, b2);
 
-		rtems_task_wake_after(RTEMS_MILLISECONDS_TO_TICKS(250));
+		rtems_task_wake_after(
+		    RTEMS_MILLISECONDS_TO_TICKS(profile.led_period_ms));
 	}
 }
 
@@ -193,8 +217,8 @@ init_led(void)
 
 	sc = rtems_task_create(
 		rtems_build_name('L', 'E', 'D', ' '),
-		PRIO_LED_TASK,
-		RTEMS_MINIMUM_STACK_SIZE,
+		profile.led_priority,
+		profile.led_stack_size,
 		RTEMS_DEFAULT_MODES,
 		RTEMS_DEFAULT_ATTRIBUTES,
 		&id
@@ -205,6 +229,138 @@ init_led(void)
 	assert(sc == RTEMS_SUCCESSFUL);
 }
 
+/*
+ * The WLAN adapter is connected via USB. It shows up some time after libbsd
+ * has been initialized. Wait for it instead of sleeping for a fixed time.
+ */
+static bool
+wait_for_wlan_device(void)
+{
+	char devices[64];
+	size_t len;
+	unsigned waited;
+
+	for (waited = 0; waited < WLAN_DEVICE_TIMEOUT_MS;
+	    waited += WLAN_DEVICE_POLL_MS) {
+		len = sizeof(devices) - 1;
+		if (sysctlbyname("net.wlan.devices", devices, &len,
+		    NULL, 0) == 0) {
+			devices[len] = '\0';
+			if (strstr(devices, WLAN_DEVICE) != NULL) {
+				return true;
+			}
+		}
+		rtems_task_wake_after(
+		    RTEMS_MILLISECONDS_TO_TICKS(WLAN_DEVICE_POLL_MS));
+	}
+
+	return false;
+}
+
+static void
+bringup_storage(void)
+{
+	rtems_status_code sc;
+
+	sc = grisp_init_wait_for_sd();
+	if (sc == RTEMS_SUCCESSFUL) {
+		printf("SD: OK\n");
+	} else {
+		printf("ERROR: SD could not be mounted after timeout\n");
+		grisp_led_set1(true, false, false);
+	}
+	boottime_mark("sd-card");
+
+	if (profile_load(PROFILE_DEFAULT_PATH) == 0) {
+		printf("Profile: %s\n", profile.name);
+	}
+	profile_apply();
+	boottime_mark("profile");
+}
+
+static void
+bringup_network(void)
+{
+	grisp_init_dhcpcd(profile.dhcp_priority);
+	boottime_mark("dhcpcd");
+}
+
+static void
+bringup_metrics(void)
+{
+	rtems_status_code sc;
+
+	if (profile.metrics_port != 0) {
+		sc = metrics_start_server((uint16_t)profile.metrics_port);
+		if (sc != RTEMS_SUCCESSFUL) {
+			printf("WARNING: No metrics endpoint: %s\n",
+			    rtems_status_text(sc));
+		}
+	}
+}
+
+static void
+bringup_wlan(void)
+{
+	grisp_led_set2(false, false, true);
+	if (wait_for_wlan_device()) {
+		boottime_mark("wlan-device");
+	} else {
+		printf("WARNING: No " WLAN_DEVICE " after %d ms\n",
+		    WLAN_DEVICE_TIMEOUT_MS);
+	}
+	grisp_init_wpa_supplicant(wpa_supplicant_conf, profile.wpa_priority,
+	    create_wlandev);
+	boottime_mark("wpa_supplicant");
+}
+
+/* The LED pattern starts as soon as everything else is up. */
+static void
+bringup_led(void)
+{
+	init_led();
+	boottime_mark("led");
+}
+
+static void
+start_bringup_jobs(void)
+{
+	rtems_status_code sc;
+
+	/* The profile is on the SD card */
+	sc = bringup_start_job(rtems_build_name('B', 'S', 'T', 'O'),
+	    PRIO_BRINGUP, STACK_SIZE_BRINGUP,
+	    0, BRINGUP_STORAGE | BRINGUP_PROFILE, bringup_storage);
+	assert(sc == RTEMS_SUCCESSFUL);
+
+	/*
+	 * dhcpcd doesn't wait for the SD card. It starts with the built-in
+	 * priority and profile_apply() changes it once the profile is read.
+	 */
+	sc = bringup_start_job(rtems_build_name('B', 'N', 'E', 'T'),
+	    PRIO_BRINGUP, STACK_SIZE_BRINGUP,
+	    0, BRINGUP_NETWORK, bringup_network);
+	assert(sc == RTEMS_SUCCESSFUL);
+
+	/* The metrics port is part of the profile */
+	sc = bringup_start_job(rtems_build_name('B', 'M', 'T', 'R'),
+	    PRIO_BRINGUP, STACK_SIZE_BRINGUP,
+	    BRINGUP_PROFILE | BRINGUP_NETWORK, 0, bringup_metrics);
+	assert(sc == RTEMS_SUCCESSFUL);
+
+	/* wpa_supplicant reads its configuration from the SD card */
+	sc = bringup_start_job(rtems_build_name('B', 'W', 'L', 'N'),
+	    PRIO_BRINGUP, STACK_SIZE_BRINGUP,
+	    BRINGUP_STORAGE, BRINGUP_WLAN, bringup_wlan);
+	assert(sc == RTEMS_SUCCESSFUL);
+
+	sc = bringup_start_job(rtems_build_name('B', 'L', 'E', 'D'),
+	    PRIO_BRINGUP, STACK_SIZE_BRINGUP,
+	    BRINGUP_STORAGE | BRINGUP_NETWORK | BRINGUP_WLAN, BRINGUP_LED,
+	    bringup_led);
+	assert(sc == RTEMS_SUCCESSFUL);
+}
+
 static int
 command_startftp(int argc, char *argv[])
 {
@@ -236,13 +392,15 @@ rtems_shell_cmd_t rtems_shell_STARTFTP_Command = {
 static void
 Init(rtems_task_argument arg)
 {
-	rtems_status_code sc;
 	int rv;
 	struct grisp_eeprom eeprom = {0};
 
 	(void)arg;
 
+	boottime_mark("init");
 	puts("\nGRiSP2 RTEMS Demo\n");
+	profile_init();
+	(void)applog_start(profile.log_priority);
 
 #ifdef IS_GRISP1
 	rv = atsam_register_i2c_0();
@@ -259,6 +417,21 @@ Init(rtems_task_argument arg)
 	assert(rv == 0);
 #endif /* IS_GRISP2 */
 
+	if (hrtimer_init() != 0) {
+		printf("WARNING: No high resolution timer, using clock tick\n");
+	}
+
+	grisp_init_sd_card();
+	grisp_init_lower_self_prio();
+	grisp_init_libbsd();
+	boottime_mark("libbsd");
+
+	/*
+	 * Storage, Ethernet, WLAN and the LEDs are brought up in parallel. The
+	 * shell only needs libbsd and can be started right away.
+	 */
+	start_bringup_jobs();
+
 	printf("Init EEPROM\n");
 	grisp_eeprom_init();
 	rv = grisp_eeprom_get(&eeprom);
@@ -271,37 +444,19 @@ Init(rtems_task_argument arg)
 		printf("ERROR: Invalid EEPROM\n");
 	}
 #endif
-
-	grisp_init_sd_card();
-	grisp_init_lower_self_prio();
-	grisp_init_libbsd();
-
-	/* Wait for the SD card */
-	sc = grisp_init_wait_for_sd();
-	if (sc == RTEMS_SUCCESSFUL) {
-		printf("SD: OK\n");
-	} else {
-		printf("ERROR: SD could not be mounted after timeout\n");
-		grisp_led_set1(true, false, false);
-	}
-
-	sleep(1);
-	grisp_init_dhcpcd(PRIO_DHCP);
-
-	grisp_led_set2(false, false, true);
-	sleep(3);
-	grisp_init_wpa_supplicant(wpa_supplicant_conf, PRIO_WPA, create_wlandev);
+	boottime_mark("eeprom");
 
 #ifdef EVENT_RECORDING
-	rtems_record_start_server(10, 1234, 10);
-	rtems_record_line();
+	/* Record from the start. Otherwise use the record shell command. */
+	tracing_start(TRACING_CLASS_ALL);
+	tracing_start_server(TRACING_DEFAULT_PORT);
 #endif /* EVENT_RECORDING */
 
-	init_led();
 #ifdef IS_GRISP2
 	// uncomment for testing RFID
 	//pmod_rfid_init(SPI_BUS, 1);
 #endif /* IS_GRISP2 */
+	boottime_mark("shell");
 	start_shell();
 
 	exit(0);
@@ -328,11 +483,13 @@ Init(rtems_task_argument arg)
 #define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
 
 #define CONFIGURE_FILESYSTEM_DOSFS
-#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 32
+/* Enough for an iperf3 server and client with 16 streams each on lo0 */
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 64
 
 #define CONFIGURE_UNLIMITED_OBJECTS
 #define CONFIGURE_UNIFIED_WORK_AREAS
-#define CONFIGURE_MAXIMUM_USER_EXTENSIONS 1
+/* Two of them are created by the event recording (see tracing.c) */
+#define CONFIGURE_MAXIMUM_USER_EXTENSIONS 3
 
 #define CONFIGURE_INIT_TASK_STACK_SIZE STACK_SIZE_INIT_TASK
 #define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
@@ -345,10 +502,28 @@ Init(rtems_task_argument arg)
 #define CONFIGURE_SWAPOUT_TASK_PRIORITY 97
 
 //#define CONFIGURE_STACK_CHECKER_ENABLED
+/* Stack high-water marks and context switches for tasktop */
+#define CONFIGURE_INITIAL_EXTENSIONS TASKTOP_EXTENSION
+/*
+ * Which events are recorded is selected at run time with the record command
+ * (see tracing.c). Without EVENT_RECORDING the buffers are only big enough
+ * for the record server, which drains them continuously. The dump of the
+ * buffers on a fatal error takes minutes on the console, so it is only
+ * enabled together with the big buffers.
+ */
 #ifdef EVENT_RECORDING
-#define CONFIGURE_RECORD_EXTENSIONS_ENABLED
+#ifdef IS_GRISP1
+#define CONFIGURE_RECORD_PER_PROCESSOR_ITEMS (16 * 1024)
+#else
 #define CONFIGURE_RECORD_PER_PROCESSOR_ITEMS (128 * 1024)
+#endif
 #define CONFIGURE_RECORD_FATAL_DUMP_BASE64
+#else /* EVENT_RECORDING */
+#ifdef IS_GRISP1
+#define CONFIGURE_RECORD_PER_PROCESSOR_ITEMS (2 * 1024)
+#else
+#define CONFIGURE_RECORD_PER_PROCESSOR_ITEMS (8 * 1024)
+#endif
 #endif /* EVENT_RECORDING */
 
 #define CONFIGURE_RTEMS_INIT_TASKS_TABLE
@@ -378,6 +553,20 @@ Init(rtems_task_argument arg)
   &rtems_shell_WLANSTATS_Command, \
   &rtems_shell_STARTFTP_Command, \
   &rtems_shell_BLKSTATS_Command, \
+  &shell_BOOTTIME_Command, \
+  &shell_RECORD_Command, \
+  &shell_HRTIMER_Command, \
+  &shell_CYCLICTEST_Command, \
+  &shell_TASKTOP_Command, \
+  &shell_HEAPSTAT_Command, \
+  &shell_DMABENCH_Command, \
+  &shell_IPERF3_Command, \
+  &shell_METRICS_Command, \
+  &shell_SENSORSTREAM_Command, \
+  &shell_TSLOG_Command, \
+  &shell_PROFILE_Command, \
+  &shell_APPLOG_Command, \
+  &shell_PGO_Command, \
   &rtems_shell_WPA_SUPPLICANT_Command, \
   &rtems_shell_WPA_SUPPLICANT_FORK_Command, \
   &shell_PATTERN_FILL_Command, \
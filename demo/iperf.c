@@ -0,0 +1,1291 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * The control connection and the result exchange follow the iperf3 protocol:
+ * The client sends a cookie, the test parameters as length prefixed JSON and
+ * state changes as single bytes. Data streams are opened with the same
+ * cookie (TCP) or a connect message (UDP). After the test, both sides
+ * exchange their results as JSON.
+ */
+
+#include "iperf.h"
+
+#include <arpa/inet.h>
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/endian.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+/* Version of the iperf3 protocol implemented here */
+#define IPERF_VERSION		"3.1.3"
+#define IPERF_DEFAULT_PORT	5201
+#define IPERF_COOKIE_SIZE	37
+#define IPERF_MAX_STREAMS	16
+#define IPERF_MAX_JSON		(8 * 1024)
+#define IPERF_DEFAULT_TCP_LEN	(128 * 1024)
+#define IPERF_DEFAULT_UDP_LEN	1460
+#define IPERF_MIN_UDP_LEN	16
+#define IPERF_DEFAULT_UDP_RATE	(1000 * 1000)
+#define IPERF_DEFAULT_TIME	10
+#define IPERF_UDP_BURST		64
+#define IPERF_ACCEPT_TIMEOUT_S	10
+#define IPERF_DAEMON_PRIO	120
+#define IPERF_DAEMON_STACK	(32 * 1024)
+
+/* States of the control connection */
+#define IPERF_TEST_START	1
+#define IPERF_TEST_RUNNING	2
+#define IPERF_TEST_END		4
+#define IPERF_PARAM_EXCHANGE	9
+#define IPERF_CREATE_STREAMS	10
+#define IPERF_SERVER_TERMINATE	11
+#define IPERF_CLIENT_TERMINATE	12
+#define IPERF_EXCHANGE_RESULTS	13
+#define IPERF_DISPLAY_RESULTS	14
+#define IPERF_DONE		16
+#define IPERF_ACCESS_DENIED	(-1)
+#define IPERF_SERVER_ERROR	(-2)
+
+/* Sent in host byte order like iperf3 does */
+#define IPERF_UDP_CONNECT_MSG	0x36373839
+#define IPERF_UDP_CONNECT_REPLY	0x39383736
+
+struct iperf_stream {
+	int sock;
+	int id;
+	bool closed;
+	uint64_t bytes;
+	uint64_t interval_bytes;
+	uint64_t packet_count;
+	int64_t cnt_error;
+	uint64_t outoforder;
+	double jitter;
+	double prev_transit;
+	bool have_transit;
+};
+
+struct iperf_test {
+	bool client;
+	bool udp;
+	bool reverse;
+	bool udp64;
+	bool once;
+	unsigned parallel;
+	unsigned duration;
+	unsigned interval_ms;
+	size_t len;
+	uint64_t rate;
+	int window;
+	char port[8];
+	char host[64];
+	char cookie[IPERF_COOKIE_SIZE];
+	int ctrl;
+	int listener;
+	uint8_t *buf;
+	uint64_t start_ns;
+	uint64_t end_ns;
+	unsigned stream_count;
+	struct iperf_stream streams[IPERF_MAX_STREAMS];
+	uint64_t peer_bytes;
+	uint64_t peer_packets;
+	int64_t peer_errors;
+	double peer_jitter;
+	char json[IPERF_MAX_JSON];
+};
+
+static uint64_t
+iperf_now_ns(void)
+{
+	return rtems_clock_get_uptime_nanoseconds();
+}
+
+static double
+iperf_seconds(uint64_t ns)
+{
+	return (double)ns / 1e9;
+}
+
+/* iperf3 numbers stream IDs 1, 3, 4, 5 and so on */
+static int
+iperf_stream_id(unsigned index)
+{
+	return index == 0 ? 1 : (int)index + 2;
+}
+
+static int
+iperf_read_all(int fd, void *buf, size_t len)
+{
+	uint8_t *p = buf;
+
+	while (len > 0) {
+		ssize_t n = read(fd, p, len);
+
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n <= 0) {
+			return -1;
+		}
+		p += n;
+		len -= (size_t)n;
+	}
+
+	return 0;
+}
+
+static int
+iperf_write_all(int fd, const void *buf, size_t len)
+{
+	const uint8_t *p = buf;
+
+	while (len > 0) {
+		ssize_t n = write(fd, p, len);
+
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n <= 0) {
+			return -1;
+		}
+		p += n;
+		len -= (size_t)n;
+	}
+
+	return 0;
+}
+
+static int
+iperf_send_state(struct iperf_test *t, int8_t state)
+{
+	return iperf_write_all(t->ctrl, &state, sizeof(state));
+}
+
+static int
+iperf_recv_state(struct iperf_test *t, int8_t *state)
+{
+	return iperf_read_all(t->ctrl, state, sizeof(*state));
+}
+
+/* Wait for the given state. Everything else is an error. */
+static int
+iperf_expect_state(struct iperf_test *t, int8_t expected)
+{
+	int8_t state;
+
+	if (iperf_recv_state(t, &state) != 0) {
+		warnx("iperf3: Control connection closed");
+		return -1;
+	}
+	if (state != expected) {
+		warnx("iperf3: Unexpected state %d (expected %d)", state,
+		    expected);
+		return -1;
+	}
+
+	return 0;
+}
+
+static int
+iperf_send_json(struct iperf_test *t)
+{
+	uint32_t len = (uint32_t)strlen(t->json);
+	uint32_t nlen = htonl(len);
+
+	if (iperf_write_all(t->ctrl, &nlen, sizeof(nlen)) != 0) {
+		return -1;
+	}
+	return iperf_write_all(t->ctrl, t->json, len);
+}
+
+static int
+iperf_recv_json(struct iperf_test *t)
+{
+	uint32_t len;
+
+	if (iperf_read_all(t->ctrl, &len, sizeof(len)) != 0) {
+		return -1;
+	}
+	len = ntohl(len);
+	if (len >= sizeof(t->json)) {
+		warnx("iperf3: JSON message too long (%" PRIu32 ")", len);
+		return -1;
+	}
+	if (iperf_read_all(t->ctrl, t->json, len) != 0) {
+		return -1;
+	}
+	t->json[len] = '\0';
+
+	return 0;
+}
+
+/*
+ * Minimal JSON access that is sufficient for the flat objects of iperf3.
+ * Returns true if the key exists. Booleans are returned as 0 or 1.
+ */
+static bool
+iperf_json_number(const char *json, const char *key, double *value)
+{
+	char pattern[32];
+	const char *p;
+	char *end;
+
+	snprintf(pattern, sizeof(pattern), "\"%s\"", key);
+	p = strstr(json, pattern);
+	if (p == NULL) {
+		return false;
+	}
+	p += strlen(pattern);
+	while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n' ||
+	    *p == ':') {
+		++p;
+	}
+	if (strncmp(p, "true", 4) == 0) {
+		*value = 1;
+		return true;
+	}
+	if (strncmp(p, "false", 5) == 0) {
+		*value = 0;
+		return true;
+	}
+	*value = strtod(p, &end);
+
+	return end != p;
+}
+
+static double
+iperf_json_get(const char *json, const char *key, double fallback)
+{
+	double value;
+
+	return iperf_json_number(json, key, &value) ? value : fallback;
+}
+
+static void
+iperf_json_append(struct iperf_test *t, const char *fmt, ...)
+	__attribute__((format(printf, 2, 3)));
+
+static void
+iperf_json_append(struct iperf_test *t, const char *fmt, ...)
+{
+	size_t used = strlen(t->json);
+	va_list ap;
+
+	va_start(ap, fmt);
+	vsnprintf(t->json + used, sizeof(t->json) - used, fmt, ap);
+	va_end(ap);
+}
+
+static void
+iperf_build_params(struct iperf_test *t)
+{
+	t->json[0] = '\0';
+	iperf_json_append(t, "{\"%s\":true,\"omit\":0,\"time\":%u,"
+	    "\"num\":0,\"blockcount\":0,\"parallel\":%u,\"len\":%zu,"
+	    "\"pacing_timer\":1000,\"client_version\":\"" IPERF_VERSION "\"",
+	    t->udp ? "udp" : "tcp", t->duration, t->parallel, t->len);
+	if (t->reverse) {
+		iperf_json_append(t, ",\"reverse\":true");
+	}
+	if (t->udp) {
+		iperf_json_append(t, ",\"bandwidth\":%" PRIu64, t->rate);
+	}
+	if (t->window > 0) {
+		iperf_json_append(t, ",\"window\":%d", t->window);
+	}
+	iperf_json_append(t, "}");
+}
+
+static int
+iperf_parse_params(struct iperf_test *t)
+{
+	t->udp = iperf_json_get(t->json, "udp", 0) != 0;
+	t->reverse = iperf_json_get(t->json, "reverse", 0) != 0;
+	t->udp64 = iperf_json_get(t->json, "udp_counters_64bit", 0) != 0;
+	t->parallel = (unsigned)iperf_json_get(t->json, "parallel", 1);
+	t->duration = (unsigned)iperf_json_get(t->json, "time",
+	    IPERF_DEFAULT_TIME);
+	t->len = (size_t)iperf_json_get(t->json, "len",
+	    t->udp ? IPERF_DEFAULT_UDP_LEN : IPERF_DEFAULT_TCP_LEN);
+	t->rate = (uint64_t)iperf_json_get(t->json, "bandwidth",
+	    IPERF_DEFAULT_UDP_RATE);
+	t->window = (int)iperf_json_get(t->json, "window", 0);
+
+	if (t->parallel == 0 || t->parallel > IPERF_MAX_STREAMS) {
+		warnx("iperf3: Unsupported number of streams %u", t->parallel);
+		return -1;
+	}
+	if (t->len == 0 || (t->udp && t->len < IPERF_MIN_UDP_LEN)) {
+		warnx("iperf3: Unsupported length %zu", t->len);
+		return -1;
+	}
+
+	return 0;
+}
+
+static void
+iperf_build_results(struct iperf_test *t)
+{
+	bool sender = t->client != t->reverse;
+	double duration = iperf_seconds(t->end_ns - t->start_ns);
+	unsigned i;
+
+	t->json[0] = '\0';
+	iperf_json_append(t, "{\"cpu_util_total\":0,\"cpu_util_user\":0,"
+	    "\"cpu_util_system\":0,\"sender_has_retransmits\":0,"
+	    "\"streams\":[");
+	for (i = 0; i < t->stream_count; ++i) {
+		const struct iperf_stream *s = &t->streams[i];
+
+		iperf_json_append(t, "%s{\"id\":%d,\"bytes\":%" PRIu64 ","
+		    "\"retransmits\":0,\"jitter\":%.6f,\"errors\":%" PRId64 ","
+		    "\"packets\":%" PRIu64 ",\"start_time\":0,"
+		    "\"end_time\":%.6f}",
+		    i == 0 ? "" : ",", s->id, s->bytes,
+		    sender ? 0.0 : s->jitter, sender ? (int64_t)0 : s->cnt_error,
+		    s->packet_count, duration);
+	}
+	iperf_json_append(t, "]}");
+}
+
+/* Sum up the stream results of the peer */
+static void
+iperf_parse_results(struct iperf_test *t)
+{
+	const char *p = strstr(t->json, "\"streams\"");
+
+	t->peer_bytes = 0;
+	t->peer_packets = 0;
+	t->peer_errors = 0;
+	t->peer_jitter = 0;
+
+	while (p != NULL && (p = strchr(p, '{')) != NULL) {
+		const char *end = strchr(p, '}');
+		char object[512];
+		size_t len;
+		double jitter;
+
+		if (end == NULL) {
+			break;
+		}
+		len = (size_t)(end - p + 1);
+		if (len >= sizeof(object)) {
+			len = sizeof(object) - 1;
+		}
+		memcpy(object, p, len);
+		object[len] = '\0';
+
+		t->peer_bytes += (uint64_t)iperf_json_get(object, "bytes", 0);
+		t->peer_packets += (uint64_t)iperf_json_get(object, "packets", 0);
+		t->peer_errors += (int64_t)iperf_json_get(object, "errors", 0);
+		jitter = iperf_json_get(object, "jitter", 0);
+		if (jitter > t->peer_jitter) {
+			t->peer_jitter = jitter;
+		}
+		p = end;
+	}
+}
+
+static void
+iperf_set_window(struct iperf_test *t, int sock)
+{
+	if (t->window > 0) {
+		(void)setsockopt(sock, SOL_SOCKET, SO_SNDBUF, &t->window,
+		    sizeof(t->window));
+		(void)setsockopt(sock, SOL_SOCKET, SO_RCVBUF, &t->window,
+		    sizeof(t->window));
+	}
+}
+
+static void
+iperf_set_nonblocking(int sock)
+{
+	int flags = fcntl(sock, F_GETFL, 0);
+
+	(void)fcntl(sock, F_SETFL, flags | O_NONBLOCK);
+}
+
+static bool
+iperf_wait_readable(int sock, unsigned seconds)
+{
+	struct timeval tv = { .tv_sec = seconds };
+	fd_set fds;
+
+	FD_ZERO(&fds);
+	FD_SET(sock, &fds);
+
+	return select(sock + 1, &fds, NULL, NULL, &tv) > 0;
+}
+
+static int
+iperf_connect(struct iperf_test *t, int type)
+{
+	struct addrinfo hints;
+	struct addrinfo *res;
+	int sock;
+	int rv;
+
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_INET;
+	hints.ai_socktype = type;
+	rv = getaddrinfo(t->host, t->port, &hints, &res);
+	if (rv != 0) {
+		warnx("iperf3: %s: %s", t->host, gai_strerror(rv));
+		return -1;
+	}
+
+	sock = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+	if (sock >= 0) {
+		iperf_set_window(t, sock);
+		if (connect(sock, res->ai_addr, res->ai_addrlen) != 0) {
+			warn("iperf3: Couldn't connect to %s:%s", t->host,
+			    t->port);
+			close(sock);
+			sock = -1;
+		}
+	}
+	freeaddrinfo(res);
+
+	return sock;
+}
+
+static int
+iperf_bind(struct iperf_test *t, int type)
+{
+	struct sockaddr_in addr;
+	int sock;
+	int one = 1;
+
+	sock = socket(AF_INET, type, 0);
+	if (sock < 0) {
+		return -1;
+	}
+	(void)setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+	(void)setsockopt(sock, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one));
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_len = sizeof(addr);
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons((uint16_t)atoi(t->port));
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+		warn("iperf3: Couldn't bind to port %s", t->port);
+		close(sock);
+		return -1;
+	}
+
+	return sock;
+}
+
+static struct iperf_stream *
+iperf_add_stream(struct iperf_test *t, int sock)
+{
+	struct iperf_stream *s = &t->streams[t->stream_count];
+
+	memset(s, 0, sizeof(*s));
+	s->sock = sock;
+	s->id = iperf_stream_id(t->stream_count);
+	++t->stream_count;
+	iperf_set_nonblocking(sock);
+
+	return s;
+}
+
+static void
+iperf_close_streams(struct iperf_test *t)
+{
+	unsigned i;
+
+	for (i = 0; i < t->stream_count; ++i) {
+		close(t->streams[i].sock);
+	}
+	t->stream_count = 0;
+}
+
+static int
+iperf_client_create_streams(struct iperf_test *t)
+{
+	unsigned i;
+
+	for (i = 0; i < t->parallel; ++i) {
+		int sock = iperf_connect(t, t->udp ? SOCK_DGRAM : SOCK_STREAM);
+
+		if (sock < 0) {
+			return -1;
+		}
+
+		if (t->udp) {
+			uint32_t msg = IPERF_UDP_CONNECT_MSG;
+
+			if (write(sock, &msg, sizeof(msg)) != sizeof(msg) ||
+			    !iperf_wait_readable(sock, IPERF_ACCEPT_TIMEOUT_S) ||
+			    read(sock, &msg, sizeof(msg)) != sizeof(msg)) {
+				warnx("iperf3: No reply for UDP stream");
+				close(sock);
+				return -1;
+			}
+		} else if (iperf_write_all(sock, t->cookie,
+		    sizeof(t->cookie)) != 0) {
+			close(sock);
+			return -1;
+		}
+
+		iperf_add_stream(t, sock);
+	}
+
+	return 0;
+}
+
+static int
+iperf_server_create_streams(struct iperf_test *t)
+{
+	while (t->stream_count < t->parallel) {
+		int sock;
+
+		if (t->udp) {
+			struct sockaddr_storage peer;
+			socklen_t peer_len = sizeof(peer);
+			uint32_t msg;
+
+			/* Each UDP stream is a socket connected to the peer */
+			sock = iperf_bind(t, SOCK_DGRAM);
+			if (sock < 0) {
+				return -1;
+			}
+			iperf_set_window(t, sock);
+			if (!iperf_wait_readable(sock, IPERF_ACCEPT_TIMEOUT_S) ||
+			    recvfrom(sock, &msg, sizeof(msg), 0,
+			    (struct sockaddr *)&peer, &peer_len) < 0 ||
+			    connect(sock, (struct sockaddr *)&peer,
+			    peer_len) != 0) {
+				warnx("iperf3: UDP stream not connected");
+				close(sock);
+				return -1;
+			}
+			msg = IPERF_UDP_CONNECT_REPLY;
+			if (write(sock, &msg, sizeof(msg)) != sizeof(msg)) {
+				close(sock);
+				return -1;
+			}
+		} else {
+			char cookie[IPERF_COOKIE_SIZE];
+
+			if (!iperf_wait_readable(t->listener,
+			    IPERF_ACCEPT_TIMEOUT_S)) {
+				warnx("iperf3: TCP stream not connected");
+				return -1;
+			}
+			sock = accept(t->listener, NULL, NULL);
+			if (sock < 0) {
+				return -1;
+			}
+			if (iperf_read_all(sock, cookie, sizeof(cookie)) != 0 ||
+			    memcmp(cookie, t->cookie, sizeof(cookie)) != 0) {
+				/* Another client, we are busy */
+				int8_t denied = IPERF_ACCESS_DENIED;
+
+				(void)write(sock, &denied, sizeof(denied));
+				close(sock);
+				continue;
+			}
+			iperf_set_window(t, sock);
+		}
+
+		iperf_add_stream(t, sock);
+	}
+
+	return 0;
+}
+
+static void
+iperf_print_line(const char *id, double from, double to, uint64_t bytes,
+    const char *suffix)
+{
+	double secs = to - from;
+
+	printf("[%3s] %6.2f-%-6.2f sec %8.2f MBytes %8.2f Mbits/sec%s\n",
+	    id, from, to, (double)bytes / (1024. * 1024.),
+	    secs > 0 ? (double)bytes * 8. / secs / 1e6 : 0., suffix);
+}
+
+static void
+iperf_report_interval(struct iperf_test *t, uint64_t from_ns, uint64_t to_ns)
+{
+	double from = iperf_seconds(from_ns - t->start_ns);
+	double to = iperf_seconds(to_ns - t->start_ns);
+	uint64_t sum = 0;
+	unsigned i;
+
+	for (i = 0; i < t->stream_count; ++i) {
+		struct iperf_stream *s = &t->streams[i];
+		char id[8];
+
+		if (t->stream_count > 1) {
+			snprintf(id, sizeof(id), "%d", s->id);
+			iperf_print_line(id, from, to, s->interval_bytes, "");
+		}
+		sum += s->interval_bytes;
+		s->interval_bytes = 0;
+	}
+	iperf_print_line("SUM", from, to, sum, "");
+}
+
+static void
+iperf_udp_receive(struct iperf_stream *s, const uint8_t *buf, size_t len,
+    bool udp64)
+{
+	struct timeval now;
+	uint32_t sec;
+	uint32_t usec;
+	uint64_t pcount;
+	double transit;
+	double d;
+
+	if (len < (udp64 ? 16 : 12)) {
+		return;
+	}
+
+	memcpy(&sec, buf, sizeof(sec));
+	memcpy(&usec, buf + 4, sizeof(usec));
+	if (udp64) {
+		memcpy(&pcount, buf + 8, sizeof(pcount));
+		pcount = be64toh(pcount);
+	} else {
+		uint32_t pcount32;
+
+		memcpy(&pcount32, buf + 8, sizeof(pcount32));
+		pcount = ntohl(pcount32);
+	}
+
+	/* Loss and jitter computed the same way as iperf3 (RFC 1889) */
+	if (pcount >= s->packet_count + 1) {
+		if (pcount > s->packet_count + 1) {
+			s->cnt_error += (int64_t)(pcount - 1 - s->packet_count);
+		}
+		s->packet_count = pcount;
+	} else {
+		++s->outoforder;
+		if (s->cnt_error > 0) {
+			--s->cnt_error;
+		}
+	}
+
+	gettimeofday(&now, NULL);
+	transit = ((double)now.tv_sec + (double)now.tv_usec / 1e6) -
+	    ((double)ntohl(sec) + (double)ntohl(usec) / 1e6);
+	if (s->have_transit) {
+		d = transit - s->prev_transit;
+		if (d < 0) {
+			d = -d;
+		}
+		s->jitter += (d - s->jitter) / 16.0;
+	}
+	s->prev_transit = transit;
+	s->have_transit = true;
+}
+
+/* Send as many packets as the rate allows at this point in time */
+static void
+iperf_udp_send(struct iperf_test *t, struct iperf_stream *s, uint64_t now)
+{
+	uint64_t elapsed = now - t->start_ns;
+	uint64_t allowed;
+	unsigned burst;
+
+	/* Split the time so that rate * time can't overflow on long tests */
+	allowed = t->rate * (elapsed / 1000000000) / 8 +
+	    t->rate * (elapsed % 1000000000) / 8 / 1000000000;
+
+	for (burst = 0; burst < IPERF_UDP_BURST && s->bytes < allowed;
+	    ++burst) {
+		struct timeval tv;
+		uint32_t sec;
+		uint32_t usec;
+		ssize_t n;
+
+		gettimeofday(&tv, NULL);
+		sec = htonl((uint32_t)tv.tv_sec);
+		usec = htonl((uint32_t)tv.tv_usec);
+		memcpy(t->buf, &sec, sizeof(sec));
+		memcpy(t->buf + 4, &usec, sizeof(usec));
+		if (t->udp64) {
+			uint64_t pcount = htobe64(s->packet_count + 1);
+
+			memcpy(t->buf + 8, &pcount, sizeof(pcount));
+		} else {
+			uint32_t pcount = htonl((uint32_t)s->packet_count + 1);
+
+			memcpy(t->buf + 8, &pcount, sizeof(pcount));
+		}
+
+		n = send(s->sock, t->buf, t->len, 0);
+		if (n <= 0) {
+			/* Socket buffer full, try again later */
+			break;
+		}
+		++s->packet_count;
+		s->bytes += (uint64_t)n;
+		s->interval_bytes += (uint64_t)n;
+	}
+}
+
+static void
+iperf_stream_io(struct iperf_test *t, struct iperf_stream *s, bool sender)
+{
+	ssize_t n;
+
+	if (sender) {
+		n = send(s->sock, t->buf, t->len, 0);
+	} else {
+		n = recv(s->sock, t->buf, t->len, 0);
+		if (n == 0) {
+			s->closed = true;
+		}
+	}
+
+	if (n > 0) {
+		if (t->udp && !sender) {
+			iperf_udp_receive(s, t->buf, (size_t)n, t->udp64);
+		}
+		s->bytes += (uint64_t)n;
+		s->interval_bytes += (uint64_t)n;
+	}
+}
+
+/*
+ * Move data until the test ends. The client ends the test after the
+ * configured time, the server when it gets TEST_END from the client.
+ */
+static int
+iperf_run(struct iperf_test *t)
+{
+	bool sender = t->client != t->reverse;
+	uint64_t interval_ns = (uint64_t)t->interval_ms * 1000000;
+	uint64_t interval_start;
+	uint64_t now;
+	bool done = false;
+
+	t->start_ns = iperf_now_ns();
+	interval_start = t->start_ns;
+
+	while (!done) {
+		struct timeval tv = { .tv_sec = 0, .tv_usec = 10000 };
+		fd_set rfds;
+		fd_set wfds;
+		int maxfd = t->ctrl;
+		unsigned i;
+		int n;
+
+		FD_ZERO(&rfds);
+		FD_ZERO(&wfds);
+		FD_SET(t->ctrl, &rfds);
+		for (i = 0; i < t->stream_count; ++i) {
+			struct iperf_stream *s = &t->streams[i];
+
+			if (s->closed || (sender && t->udp)) {
+				continue;
+			}
+			FD_SET(s->sock, sender ? &wfds : &rfds);
+			if (s->sock > maxfd) {
+				maxfd = s->sock;
+			}
+		}
+
+		n = select(maxfd + 1, &rfds, &wfds, NULL, &tv);
+		if (n < 0 && errno != EINTR) {
+			warn("iperf3: select() failed");
+			return -1;
+		}
+
+		if (n > 0 && FD_ISSET(t->ctrl, &rfds)) {
+			int8_t state;
+
+			if (iperf_recv_state(t, &state) != 0) {
+				warnx("iperf3: Control connection closed");
+				return -1;
+			}
+			if (!t->client && state == IPERF_TEST_END) {
+				done = true;
+			} else {
+				warnx("iperf3: Peer terminated the test (%d)",
+				    state);
+				return -1;
+			}
+		}
+
+		now = iperf_now_ns();
+		for (i = 0; i < t->stream_count; ++i) {
+			struct iperf_stream *s = &t->streams[i];
+
+			if (sender && t->udp) {
+				iperf_udp_send(t, s, now);
+			} else if (n > 0 && (FD_ISSET(s->sock, &rfds) ||
+			    FD_ISSET(s->sock, &wfds))) {
+				iperf_stream_io(t, s, sender);
+			}
+		}
+
+		now = iperf_now_ns();
+		if (interval_ns > 0 && now - interval_start >= interval_ns) {
+			iperf_report_interval(t, interval_start, now);
+			interval_start = now;
+		}
+		if (t->client &&
+		    now - t->start_ns >= (uint64_t)t->duration * 1000000000) {
+			done = true;
+		}
+	}
+
+	t->end_ns = iperf_now_ns();
+	if (interval_ns > 0 && t->end_ns - interval_start >= interval_ns / 10) {
+		iperf_report_interval(t, interval_start, t->end_ns);
+	}
+
+	return 0;
+}
+
+static void
+iperf_summary(struct iperf_test *t)
+{
+	bool sender = t->client != t->reverse;
+	double duration = iperf_seconds(t->end_ns - t->start_ns);
+	uint64_t own = 0;
+	uint64_t own_packets = 0;
+	int64_t own_errors = 0;
+	double own_jitter = 0;
+	unsigned i;
+
+	for (i = 0; i < t->stream_count; ++i) {
+		own += t->streams[i].bytes;
+		own_packets += t->streams[i].packet_count;
+		own_errors += t->streams[i].cnt_error;
+		if (t->streams[i].jitter > own_jitter) {
+			own_jitter = t->streams[i].jitter;
+		}
+	}
+
+	printf("- - - - - - - - - - - - - - - - - - - - - - - - -\n");
+	if (!t->client) {
+		iperf_print_line("SUM", 0, duration, own,
+		    sender ? "  sender" : "  receiver");
+	} else {
+		iperf_print_line("SUM", 0, duration, sender ? own : t->peer_bytes,
+		    "  sender");
+		iperf_print_line("SUM", 0, duration, sender ? t->peer_bytes : own,
+		    "  receiver");
+	}
+
+	if (t->udp) {
+		uint64_t packets = sender ? t->peer_packets : own_packets;
+		int64_t errors = sender ? t->peer_errors : own_errors;
+		double jitter = sender ? t->peer_jitter : own_jitter;
+
+		if (!t->client && sender) {
+			return;
+		}
+		printf("UDP: jitter %.3f ms, lost %" PRId64 "/%" PRIu64
+		    " datagrams (%.2f%%)\n", jitter * 1000., errors, packets,
+		    packets > 0 ? (double)errors * 100. / (double)packets : 0.);
+	}
+}
+
+static int
+iperf_exchange_results(struct iperf_test *t)
+{
+	/* The client sends first */
+	if (t->client) {
+		iperf_build_results(t);
+		if (iperf_send_json(t) != 0 || iperf_recv_json(t) != 0) {
+			return -1;
+		}
+		iperf_parse_results(t);
+	} else {
+		if (iperf_recv_json(t) != 0) {
+			return -1;
+		}
+		iperf_parse_results(t);
+		iperf_build_results(t);
+		if (iperf_send_json(t) != 0) {
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static void
+iperf_make_cookie(char cookie[IPERF_COOKIE_SIZE])
+{
+	static const char chars[] = "abcdefghijklmnopqrstuvwxyz234567";
+	size_t i;
+
+	for (i = 0; i < IPERF_COOKIE_SIZE - 1; ++i) {
+		cookie[i] = chars[random() % (sizeof(chars) - 1)];
+	}
+	cookie[IPERF_COOKIE_SIZE - 1] = '\0';
+}
+
+static int
+iperf_alloc_buf(struct iperf_test *t)
+{
+	t->buf = malloc(t->len);
+	if (t->buf == NULL) {
+		warnx("iperf3: Not enough memory for %zu byte buffer", t->len);
+		return -1;
+	}
+	memset(t->buf, 0x55, t->len);
+
+	return 0;
+}
+
+static int
+iperf_client(struct iperf_test *t)
+{
+	int rv = -1;
+
+	iperf_make_cookie(t->cookie);
+	t->ctrl = iperf_connect(t, SOCK_STREAM);
+	if (t->ctrl < 0) {
+		return -1;
+	}
+	printf("Connecting to host %s, port %s\n", t->host, t->port);
+
+	if (iperf_alloc_buf(t) != 0 ||
+	    iperf_write_all(t->ctrl, t->cookie, sizeof(t->cookie)) != 0 ||
+	    iperf_expect_state(t, IPERF_PARAM_EXCHANGE) != 0) {
+		goto out;
+	}
+	iperf_build_params(t);
+	if (iperf_send_json(t) != 0 ||
+	    iperf_expect_state(t, IPERF_CREATE_STREAMS) != 0 ||
+	    iperf_client_create_streams(t) != 0 ||
+	    iperf_expect_state(t, IPERF_TEST_START) != 0 ||
+	    iperf_expect_state(t, IPERF_TEST_RUNNING) != 0 ||
+	    iperf_run(t) != 0 ||
+	    iperf_send_state(t, IPERF_TEST_END) != 0 ||
+	    iperf_expect_state(t, IPERF_EXCHANGE_RESULTS) != 0 ||
+	    iperf_exchange_results(t) != 0 ||
+	    iperf_expect_state(t, IPERF_DISPLAY_RESULTS) != 0) {
+		goto out;
+	}
+	iperf_summary(t);
+	(void)iperf_send_state(t, IPERF_DONE);
+	rv = 0;
+
+out:
+	iperf_close_streams(t);
+	close(t->ctrl);
+	free(t->buf);
+	t->buf = NULL;
+
+	return rv;
+}
+
+static int
+iperf_server_test(struct iperf_test *t)
+{
+	int rv = -1;
+
+	if (iperf_read_all(t->ctrl, t->cookie, sizeof(t->cookie)) != 0 ||
+	    iperf_send_state(t, IPERF_PARAM_EXCHANGE) != 0 ||
+	    iperf_recv_json(t) != 0) {
+		return -1;
+	}
+	if (iperf_parse_params(t) != 0) {
+		(void)iperf_send_state(t, IPERF_SERVER_ERROR);
+		return -1;
+	}
+	printf("Accepted %s test with %u stream(s)%s\n",
+	    t->udp ? "UDP" : "TCP", t->parallel,
+	    t->reverse ? " in reverse mode" : "");
+
+	if (iperf_alloc_buf(t) != 0) {
+		(void)iperf_send_state(t, IPERF_SERVER_ERROR);
+		return -1;
+	}
+	if (iperf_send_state(t, IPERF_CREATE_STREAMS) == 0 &&
+	    iperf_server_create_streams(t) == 0 &&
+	    iperf_send_state(t, IPERF_TEST_START) == 0 &&
+	    iperf_send_state(t, IPERF_TEST_RUNNING) == 0 &&
+	    iperf_run(t) == 0 &&
+	    iperf_send_state(t, IPERF_EXCHANGE_RESULTS) == 0 &&
+	    iperf_exchange_results(t) == 0 &&
+	    iperf_send_state(t, IPERF_DISPLAY_RESULTS) == 0) {
+		iperf_summary(t);
+		/* IPERF_DONE is optional, the client might just close */
+		(void)iperf_wait_readable(t->ctrl, 1);
+		rv = 0;
+	}
+
+	iperf_close_streams(t);
+	free(t->buf);
+	t->buf = NULL;
+
+	return rv;
+}
+
+static int
+iperf_server(struct iperf_test *t)
+{
+	t->listener = iperf_bind(t, SOCK_STREAM);
+	if (t->listener < 0) {
+		return -1;
+	}
+	if (listen(t->listener, 5) != 0) {
+		warn("iperf3: listen() failed");
+		close(t->listener);
+		return -1;
+	}
+
+	do {
+		printf("iperf " IPERF_VERSION " server listening on %s\n",
+		    t->port);
+		t->ctrl = accept(t->listener, NULL, NULL);
+		if (t->ctrl < 0) {
+			warn("iperf3: accept() failed");
+			break;
+		}
+		(void)iperf_server_test(t);
+		close(t->ctrl);
+	} while (!t->once);
+
+	close(t->listener);
+
+	return 0;
+}
+
+static void
+iperf_daemon(rtems_task_argument arg)
+{
+	struct iperf_test *t = (struct iperf_test *)arg;
+
+	(void)iperf_server(t);
+	free(t);
+	rtems_task_exit();
+}
+
+static int
+iperf_start_daemon(struct iperf_test *t)
+{
+	rtems_status_code sc;
+	rtems_id id;
+
+	sc = rtems_task_create(rtems_build_name('I', 'P', 'R', 'F'),
+	    IPERF_DAEMON_PRIO, IPERF_DAEMON_STACK, RTEMS_DEFAULT_MODES,
+	    RTEMS_FLOATING_POINT, &id);
+	if (sc == RTEMS_SUCCESSFUL) {
+		sc = rtems_task_start(id, iperf_daemon,
+		    (rtems_task_argument)t);
+	}
+	if (sc != RTEMS_SUCCESSFUL) {
+		warnx("iperf3: Couldn't start server task: %s",
+		    rtems_status_text(sc));
+		return -1;
+	}
+
+	return 0;
+}
+
+/* Parse numbers with an optional K, M or G suffix */
+static bool
+iperf_parse_size(const char *s, uint64_t unit, uint64_t *value)
+{
+	char *end;
+	double v = strtod(s, &end);
+
+	switch (*end) {
+	case 'k':
+	case 'K':
+		v *= (double)unit;
+		++end;
+		break;
+	case 'm':
+	case 'M':
+		v *= (double)(unit * unit);
+		++end;
+		break;
+	case 'g':
+	case 'G':
+		v *= (double)(unit * unit * unit);
+		++end;
+		break;
+	default:
+		break;
+	}
+	*value = (uint64_t)v;
+
+	return end != s && *end == '\0' && v >= 0;
+}
+
+static int
+command_iperf3(int argc, char *argv[])
+{
+	struct iperf_test *t;
+	bool server = false;
+	bool daemon = false;
+	uint64_t value;
+	int arg;
+	int rv;
+
+	t = calloc(1, sizeof(*t));
+	if (t == NULL) {
+		warnx("iperf3: Not enough memory");
+		return -1;
+	}
+	t->parallel = 1;
+	t->duration = IPERF_DEFAULT_TIME;
+	t->interval_ms = 1000;
+	t->rate = IPERF_DEFAULT_UDP_RATE;
+	t->once = true;
+	snprintf(t->port, sizeof(t->port), "%d", IPERF_DEFAULT_PORT);
+
+	for (arg = 1; arg < argc; ++arg) {
+		const char *opt = argv[arg];
+		const char *val = arg + 1 < argc ? argv[arg + 1] : NULL;
+		bool ok = true;
+
+		if (strcmp(opt, "-s") == 0) {
+			server = true;
+		} else if (strcmp(opt, "-D") == 0) {
+			daemon = true;
+			t->once = false;
+		} else if (strcmp(opt, "-u") == 0) {
+			t->udp = true;
+		} else if (strcmp(opt, "-R") == 0) {
+			t->reverse = true;
+		} else if (val == NULL) {
+			ok = false;
+		} else if (strcmp(opt, "-c") == 0) {
+			t->client = true;
+			snprintf(t->host, sizeof(t->host), "%s", val);
+			++arg;
+		} else if (strcmp(opt, "-p") == 0) {
+			snprintf(t->port, sizeof(t->port), "%s", val);
+			++arg;
+		} else if (strcmp(opt, "-t") == 0) {
+			t->duration = (unsigned)strtoul(val, NULL, 0);
+			ok = t->duration > 0;
+			++arg;
+		} else if (strcmp(opt, "-i") == 0) {
+			t->interval_ms = (unsigned)(strtod(val, NULL) * 1000);
+			++arg;
+		} else if (strcmp(opt, "-P") == 0) {
+			t->parallel = (unsigned)strtoul(val, NULL, 0);
+			ok = t->parallel > 0 && t->parallel <= IPERF_MAX_STREAMS;
+			++arg;
+		} else if (strcmp(opt, "-l") == 0) {
+			ok = iperf_parse_size(val, 1024, &value) && value > 0;
+			t->len = (size_t)value;
+			++arg;
+		} else if (strcmp(opt, "-w") == 0) {
+			ok = iperf_parse_size(val, 1024, &value) &&
+			    value <= INT32_MAX;
+			t->window = (int)value;
+			++arg;
+		} else if (strcmp(opt, "-b") == 0) {
+			ok = iperf_parse_size(val, 1000, &value) && value > 0;
+			t->rate = value;
+			++arg;
+		} else {
+			ok = false;
+		}
+
+		if (!ok) {
+			puts(shell_IPERF3_Command.usage);
+			free(t);
+			return -1;
+		}
+	}
+
+	if (server == t->client) {
+		puts(shell_IPERF3_Command.usage);
+		free(t);
+		return -1;
+	}
+
+	if (t->client) {
+		if (t->len == 0) {
+			t->len = t->udp ? IPERF_DEFAULT_UDP_LEN :
+			    IPERF_DEFAULT_TCP_LEN;
+		}
+		if (t->udp && t->len < IPERF_MIN_UDP_LEN) {
+			puts(shell_IPERF3_Command.usage);
+			free(t);
+			return -1;
+		}
+		rv = iperf_client(t);
+	} else if (daemon) {
+		rv = iperf_start_daemon(t);
+		if (rv == 0) {
+			/* Owned by the server task now */
+			return 0;
+		}
+	} else {
+		rv = iperf_server(t);
+	}
+
+	free(t);
+	return rv;
+}
+
+rtems_shell_cmd_t shell_IPERF3_Command = {
+	.name = "iperf3",
+	.usage = "Use with: iperf3 -s [-p <port>] [-D]\n"
+	    "           iperf3 -c <host> [-p <port>] [-u] [-b <rate>] [-t <s>]\n"
+	    "                  [-i <s>] [-l <len>] [-P <n>] [-w <size>] [-R]\n"
+	    "Measure network throughput against iperf3 on a host or against\n"
+	    "itself, for example 'iperf3 -s -D' and 'iperf3 -c 127.0.0.1'.\n"
+	    "  -s: Server for one test, with -D in the background forever\n"
+	    "  -c: Client connecting to host\n"
+	    "  -p: Port (default: 5201)\n"
+	    "  -u: Use UDP instead of TCP\n"
+	    "  -b: UDP rate in bit/s with K/M/G suffix (default: 1M)\n"
+	    "  -t: Test time in seconds (default: 10)\n"
+	    "  -i: Report interval in seconds, 0 disables (default: 1)\n"
+	    "  -l: Buffer length (default: 128K for TCP, 1460 for UDP)\n"
+	    "  -P: Number of parallel streams (default: 1, max: 16)\n"
+	    "  -w: Socket buffer size (SO_SNDBUF and SO_RCVBUF)\n"
+	    "  -R: Reverse mode, the server sends\n",
+	.topic = "net",
+	.command = command_iperf3,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
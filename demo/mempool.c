@@ -0,0 +1,395 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mempool.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/malloc.h>
+#include <rtems/sysinit.h>
+#include <rtems/score/apimutex.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/heapimpl.h>
+
+/* Free blocks of the heap are counted in power of two size classes */
+#define HEAPSTAT_CLASSES	32
+
+struct heapstat {
+	size_t free_count[HEAPSTAT_CLASSES];
+	uintptr_t free_bytes[HEAPSTAT_CLASSES];
+	uintptr_t total_free;
+	uintptr_t total_used;
+	uintptr_t largest_free;
+	size_t used_count;
+};
+
+/* The lower half of the head is the index of the first free block plus one */
+#define MEMPOOL_INDEX_MASK	0xffffu
+#define MEMPOOL_TAG_ONE		0x10000u
+
+static struct mempool *mempool_list;
+
+struct mempool mempool_io;
+
+MEMPOOL_AREA_DEFINE(mempool_io_area, MEMPOOL_IO_BLOCK_SIZE,
+    MEMPOOL_IO_BLOCK_COUNT, CPU_CACHE_LINE_BYTES);
+
+RTEMS_INTERRUPT_LOCK_DEFINE(static, mempool_list_lock, "mempool list")
+
+int
+mempool_init(struct mempool *pool, const char *name, void *area,
+    size_t area_size, size_t block_size, size_t alignment)
+{
+	rtems_interrupt_lock_context lock_context;
+	uintptr_t begin;
+	uintptr_t end;
+	size_t count;
+	size_t i;
+
+	if ((alignment & (alignment - 1)) != 0 || block_size == 0) {
+		return -1;
+	}
+
+	block_size = MEMPOOL_BLOCK_SIZE(block_size, alignment);
+	begin = RTEMS_ALIGN_UP((uintptr_t)area,
+	    MEMPOOL_BLOCK_SIZE(1, alignment));
+	end = (uintptr_t)area + area_size;
+	if (begin >= end || end - begin < block_size) {
+		return -1;
+	}
+	count = (end - begin) / block_size;
+	if (count > MEMPOOL_MAX_BLOCKS) {
+		count = MEMPOOL_MAX_BLOCKS;
+	}
+
+	memset(pool, 0, sizeof(*pool));
+	pool->name = name;
+	pool->block_size = block_size;
+	pool->block_count = count;
+	pool->begin = (char *)begin;
+	pool->end = pool->begin + count * block_size;
+
+	/* Link the blocks so that they are handed out in address order */
+	for (i = 0; i < count; ++i) {
+		uint32_t *block = (uint32_t *)(pool->begin + i * block_size);
+
+		*block = i + 1 < count ? (uint32_t)(i + 2) : 0;
+	}
+	_Atomic_Init_uint(&pool->head, 1);
+	_Atomic_Init_uint(&pool->free_count, (unsigned int)count);
+	_Atomic_Init_uint(&pool->min_free_count, (unsigned int)count);
+
+	rtems_interrupt_lock_acquire(&mempool_list_lock, &lock_context);
+	pool->next = mempool_list;
+	mempool_list = pool;
+	rtems_interrupt_lock_release(&mempool_list_lock, &lock_context);
+
+	return 0;
+}
+
+static inline char *
+mempool_block(const struct mempool *pool, unsigned int index)
+{
+	return pool->begin + (size_t)(index - 1) * pool->block_size;
+}
+
+void *
+mempool_alloc(struct mempool *pool)
+{
+	unsigned int head;
+	unsigned int next;
+	unsigned int free_count;
+	unsigned int min_free_count;
+	char *block;
+
+	head = _Atomic_Load_uint(&pool->head, ATOMIC_ORDER_ACQUIRE);
+	do {
+		if ((head & MEMPOOL_INDEX_MASK) == 0) {
+			return NULL;
+		}
+		block = mempool_block(pool, head & MEMPOOL_INDEX_MASK);
+
+		/*
+		 * The block might be taken meanwhile and the link be garbage.
+		 * The changed tag lets the exchange fail in this case.
+		 */
+		next = *(volatile uint32_t *)block;
+		next = ((head + MEMPOOL_TAG_ONE) & ~MEMPOOL_INDEX_MASK) |
+		    (next & MEMPOOL_INDEX_MASK);
+	} while (!_Atomic_Compare_exchange_uint(&pool->head, &head, next,
+	    ATOMIC_ORDER_ACQUIRE, ATOMIC_ORDER_ACQUIRE));
+
+	free_count = _Atomic_Fetch_sub_uint(&pool->free_count, 1,
+	    ATOMIC_ORDER_RELAXED) - 1;
+	min_free_count = _Atomic_Load_uint(&pool->min_free_count,
+	    ATOMIC_ORDER_RELAXED);
+	while (free_count < min_free_count &&
+	    !_Atomic_Compare_exchange_uint(&pool->min_free_count,
+	    &min_free_count, free_count, ATOMIC_ORDER_RELAXED,
+	    ATOMIC_ORDER_RELAXED)) {
+		/* Retry with the new minimum */
+	}
+
+	return block;
+}
+
+void
+mempool_free(struct mempool *pool, void *block)
+{
+	size_t offset;
+	unsigned int index;
+	unsigned int head;
+	unsigned int next;
+
+	if (block == NULL) {
+		return;
+	}
+
+	_Assert((char *)block >= pool->begin && (char *)block < pool->end);
+	offset = (size_t)((char *)block - pool->begin);
+	_Assert(offset % pool->block_size == 0);
+
+	index = (unsigned int)(offset / pool->block_size) + 1;
+	head = _Atomic_Load_uint(&pool->head, ATOMIC_ORDER_RELAXED);
+	do {
+		*(uint32_t *)block = head & MEMPOOL_INDEX_MASK;
+		next = ((head + MEMPOOL_TAG_ONE) & ~MEMPOOL_INDEX_MASK) | index;
+	} while (!_Atomic_Compare_exchange_uint(&pool->head, &head, next,
+	    ATOMIC_ORDER_RELEASE, ATOMIC_ORDER_RELAXED));
+
+	_Atomic_Fetch_add_uint(&pool->free_count, 1, ATOMIC_ORDER_RELAXED);
+}
+
+void
+arena_init(struct arena *arena, void *area, size_t area_size)
+{
+	arena->begin = area;
+	arena->end = arena->begin + area_size;
+	arena->current = arena->begin;
+	arena->high_water = 0;
+}
+
+void *
+arena_alloc(struct arena *arena, size_t size, size_t alignment)
+{
+	uintptr_t current;
+
+	current = RTEMS_ALIGN_UP((uintptr_t)arena->current, alignment);
+	if (current > (uintptr_t)arena->end ||
+	    size > (uintptr_t)arena->end - current) {
+		return NULL;
+	}
+
+	arena->current = (char *)(current + size);
+	if (arena_get_used(arena) > arena->high_water) {
+		arena->high_water = arena_get_used(arena);
+	}
+
+	return (void *)current;
+}
+
+void
+arena_reset(struct arena *arena)
+{
+	arena->current = arena->begin;
+}
+
+size_t
+arena_get_used(const struct arena *arena)
+{
+	return (size_t)(arena->current - arena->begin);
+}
+
+static void
+mempool_io_init(void)
+{
+	int rv;
+
+	rv = mempool_init(&mempool_io, "io", mempool_io_area,
+	    sizeof(mempool_io_area), MEMPOOL_IO_BLOCK_SIZE,
+	    CPU_CACHE_LINE_BYTES);
+	_Assert(rv == 0);
+	(void)rv;
+}
+
+RTEMS_SYSINIT_ITEM(mempool_io_init, RTEMS_SYSINIT_LAST,
+    RTEMS_SYSINIT_ORDER_MIDDLE);
+
+void *
+mempool_io_alloc(size_t size)
+{
+	void *buffer = NULL;
+
+	if (size <= MEMPOOL_IO_BLOCK_SIZE) {
+		buffer = mempool_alloc(&mempool_io);
+	}
+	if (buffer == NULL) {
+		buffer = malloc(size);
+	}
+
+	return buffer;
+}
+
+void
+mempool_io_free(void *buffer)
+{
+	if ((char *)buffer >= mempool_io.begin &&
+	    (char *)buffer < mempool_io.end) {
+		mempool_free(&mempool_io, buffer);
+	} else {
+		free(buffer);
+	}
+}
+
+static size_t
+heapstat_class(uintptr_t size)
+{
+	size_t c = 0;
+
+	while (size > 1 && c < HEAPSTAT_CLASSES - 1) {
+		size >>= 1;
+		++c;
+	}
+
+	return c;
+}
+
+static bool
+heapstat_visitor(const Heap_Block *block, uintptr_t block_size,
+    bool block_is_used, void *arg)
+{
+	struct heapstat *stat = arg;
+
+	(void)block;
+
+	if (block_is_used) {
+		++stat->used_count;
+		stat->total_used += block_size;
+	} else {
+		size_t c = heapstat_class(block_size);
+
+		++stat->free_count[c];
+		stat->free_bytes[c] += block_size;
+		stat->total_free += block_size;
+		if (block_size > stat->largest_free) {
+			stat->largest_free = block_size;
+		}
+	}
+
+	return false;
+}
+
+static void
+heapstat_print_heap(void)
+{
+	static struct heapstat stat;
+	size_t c;
+
+	memset(&stat, 0, sizeof(stat));
+
+	/* Only collect with the allocator locked, print afterwards */
+	_RTEMS_Lock_allocator();
+	_Heap_Iterate(RTEMS_Malloc_Heap, heapstat_visitor, &stat);
+	_RTEMS_Unlock_allocator();
+
+	printf("Heap: %" PRIuPTR " bytes used in %zu blocks, "
+	    "%" PRIuPTR " bytes free\n",
+	    stat.total_used, stat.used_count, stat.total_free);
+	printf("Largest free block: %" PRIuPTR " bytes\n", stat.largest_free);
+	if (stat.total_free > 0) {
+		printf("Fragmentation: %" PRIuPTR "%% "
+		    "(free memory not in the largest block)\n",
+		    100 - stat.largest_free * 100 / stat.total_free);
+	}
+
+	printf("\n     FREE BLOCK SIZE | COUNT |      BYTES\n");
+	for (c = 0; c < HEAPSTAT_CLASSES; ++c) {
+		if (stat.free_count[c] > 0) {
+			printf(" %8zu - %8zu | %5zu | %10" PRIuPTR "\n",
+			    (size_t)1 << c, ((size_t)2 << c) - 1,
+			    stat.free_count[c], stat.free_bytes[c]);
+		}
+	}
+}
+
+static void
+heapstat_print_pools(void)
+{
+	rtems_interrupt_lock_context lock_context;
+	struct mempool *pool;
+
+	rtems_interrupt_lock_acquire(&mempool_list_lock, &lock_context);
+	pool = mempool_list;
+	rtems_interrupt_lock_release(&mempool_list_lock, &lock_context);
+
+	if (pool == NULL) {
+		return;
+	}
+
+	printf("\n POOL             | BLOCK SIZE | BLOCKS |  FREE | MIN FREE\n");
+	/* Pools are never removed, so the list can be walked unlocked */
+	for (; pool != NULL; pool = pool->next) {
+		printf(" %-16s | %10zu | %6zu | %5u | %8u\n",
+		    pool->name, pool->block_size, pool->block_count,
+		    _Atomic_Load_uint(&pool->free_count, ATOMIC_ORDER_RELAXED),
+		    _Atomic_Load_uint(&pool->min_free_count,
+		    ATOMIC_ORDER_RELAXED));
+	}
+}
+
+static int
+command_heapstat(int argc, char *argv[])
+{
+	(void)argv;
+
+	if (argc != 1) {
+		puts(shell_HEAPSTAT_Command.usage);
+		return -1;
+	}
+
+	heapstat_print_heap();
+	heapstat_print_pools();
+
+	return 0;
+}
+
+rtems_shell_cmd_t shell_HEAPSTAT_Command = {
+	.name = "heapstat",
+	.usage = "Use with: heapstat\n"
+	    "Print the size distribution of the free heap blocks, the largest\n"
+	    "free block and the usage of the memory pools.\n",
+	.topic = "rtems",
+	.command = command_heapstat,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
@@ -0,0 +1,140 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DEMO_MEMPOOL_H
+#define DEMO_MEMPOOL_H
+
+#include <rtems.h>
+#include <rtems/shell.h>
+#include <rtems/score/atomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Fixed-size block pool. All blocks are carved out of one area that is
+ * provided at initialization, so the pool never touches the heap afterwards.
+ * Allocate and free are O(1) and lock-free. They can be used from interrupt
+ * context.
+ *
+ * The free list head is a 32-bit word with the index of the first free block
+ * in the lower and a tag in the upper half. The tag changes with every
+ * update, so a compare and swap (LDREX/STREX) detects a head that was taken
+ * and given back meanwhile. This limits a pool to MEMPOOL_MAX_BLOCKS blocks.
+ */
+struct mempool {
+	const char *name;
+	Atomic_Uint head;
+	Atomic_Uint free_count;
+	Atomic_Uint min_free_count;
+	size_t block_size;
+	size_t block_count;
+	char *begin;
+	char *end;
+	struct mempool *next;
+};
+
+#define MEMPOOL_MAX_BLOCKS	0xffffu
+
+/* Free blocks hold the index of the next one */
+#define MEMPOOL_MIN_ALIGNMENT	sizeof(uint32_t)
+
+/* Size of each block of a pool with the given block size and alignment */
+#define MEMPOOL_BLOCK_SIZE(block_size, alignment) \
+	RTEMS_ALIGN_UP(block_size, (alignment) > MEMPOOL_MIN_ALIGNMENT ? \
+	    (alignment) : MEMPOOL_MIN_ALIGNMENT)
+
+/*
+ * Initialize a pool in the given area. Alignment must be a power of two. The
+ * blocks are aligned to it and at least to MEMPOOL_MIN_ALIGNMENT. The pool is
+ * registered for the heapstat command. Returns 0 on success.
+ */
+int mempool_init(struct mempool *pool, const char *name, void *area,
+    size_t area_size, size_t block_size, size_t alignment);
+
+/* Return a block or NULL if the pool is exhausted. */
+void *mempool_alloc(struct mempool *pool);
+
+/* Give a block back to the pool. NULL is ignored. */
+void mempool_free(struct mempool *pool, void *block);
+
+/* Pool with a statically allocated area. */
+#define MEMPOOL_AREA_DEFINE(name, block_size, block_count, alignment) \
+	static char name[MEMPOOL_BLOCK_SIZE(block_size, alignment) * \
+	    (block_count)] RTEMS_ALIGNED(alignment)
+
+/*
+ * Arena (bump) allocator for per-request buffers. Allocations are O(1) and
+ * can't be freed individually. Everything is released at once with
+ * arena_reset() when the request is done, so the arena area never fragments.
+ * An arena is owned by one task and has no locking.
+ */
+struct arena {
+	char *begin;
+	char *end;
+	char *current;
+	size_t high_water;
+};
+
+void arena_init(struct arena *arena, void *area, size_t area_size);
+
+/* Return size bytes aligned to alignment (a power of two) or NULL. */
+void *arena_alloc(struct arena *arena, size_t size, size_t alignment);
+
+/* Release all allocations. */
+void arena_reset(struct arena *arena);
+
+size_t arena_get_used(const struct arena *arena);
+
+/*
+ * Shared pool for the big buffers of file I/O (SD card tests). It is ready
+ * before the Init task starts. Requests that need several buffers take one
+ * block and split it.
+ */
+#define MEMPOOL_IO_BLOCK_SIZE	(128u * 1024u)
+#define MEMPOOL_IO_BLOCK_COUNT	2
+
+extern struct mempool mempool_io;
+
+/*
+ * Return an I/O buffer of size bytes or NULL. It is a block of mempool_io if
+ * it fits and one is free. Bigger requests, which the pool can't serve, and
+ * requests while the pool is exhausted fall back to the heap.
+ */
+void *mempool_io_alloc(size_t size);
+
+/* Give a buffer of mempool_io_alloc() back. NULL is ignored. */
+void mempool_io_free(void *buffer);
+
+extern rtems_shell_cmd_t shell_HEAPSTAT_Command;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DEMO_MEMPOOL_H */
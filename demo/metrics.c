@@ -0,0 +1,632 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * The page is rendered on request into a static buffer. Counters are read
+ * directly from their owners (thread control blocks, heap, block device
+ * statistics and the interface MIB), so the cost of a scrape is roughly
+ * formatting a few hundred lines. Requests are served one after another by
+ * a single low priority task.
+ */
+
+#include "metrics.h"
+
+#include <sys/param.h>
+#include <sys/socket.h>
+#include <sys/sysctl.h>
+#include <sys/time.h>
+#include <net/if.h>
+#include <net/if_mib.h>
+#include <netinet/in.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+#include <rtems/blkdev.h>
+#include <rtems/malloc.h>
+#include <rtems/thread.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/timestampimpl.h>
+
+#define METRICS_PAGE_SIZE	(32 * 1024)
+#define METRICS_REQUEST_SIZE	1024
+#define METRICS_MAX_INTERFACES	8
+#define METRICS_IO_TIMEOUT_S	2
+#define METRICS_TASK_PRIO	200
+#define METRICS_TASK_STACK	(16 * 1024)
+#define METRICS_ACCEPT_DELAY_MS	100
+#define METRICS_ACCEPT_ERRORS	50
+
+static const char *const metrics_block_devices[] = {
+	"/dev/mmcsd-0",
+	"/dev/mmcsd-1",
+};
+
+#define METRICS_BLOCK_DEVICE_COUNT \
+    (sizeof(metrics_block_devices) / sizeof(metrics_block_devices[0]))
+
+struct metrics_field {
+	const char *name;
+	const char *help;
+	const char *type;
+	size_t offset;
+};
+
+#define METRICS_BLKDEV_FIELD(name, help, member) \
+    { name, help, "counter", offsetof(rtems_blkdev_stats, member) }
+
+static const struct metrics_field metrics_blkdev_fields[] = {
+	METRICS_BLKDEV_FIELD("rtems_bdbuf_read_hits_total",
+	    "Block reads served from the bdbuf cache", read_hits),
+	METRICS_BLKDEV_FIELD("rtems_bdbuf_read_misses_total",
+	    "Block reads that missed the bdbuf cache", read_misses),
+	METRICS_BLKDEV_FIELD("rtems_bdbuf_read_ahead_transfers_total",
+	    "Read ahead transfers started by bdbuf", read_ahead_transfers),
+	METRICS_BLKDEV_FIELD("rtems_blkdev_read_blocks_total",
+	    "Blocks read from the device", read_blocks),
+	METRICS_BLKDEV_FIELD("rtems_blkdev_read_errors_total",
+	    "Failed read transfers", read_errors),
+	METRICS_BLKDEV_FIELD("rtems_blkdev_write_transfers_total",
+	    "Write transfers to the device", write_transfers),
+	METRICS_BLKDEV_FIELD("rtems_blkdev_write_blocks_total",
+	    "Blocks written to the device", write_blocks),
+	METRICS_BLKDEV_FIELD("rtems_blkdev_write_errors_total",
+	    "Failed write transfers", write_errors),
+};
+
+#define METRICS_NET_FIELD(name, help, member) \
+    { name, help, "counter", offsetof(struct if_data, member) }
+
+static const struct metrics_field metrics_net_fields[] = {
+	METRICS_NET_FIELD("rtems_net_receive_bytes_total",
+	    "Bytes received", ifi_ibytes),
+	METRICS_NET_FIELD("rtems_net_receive_packets_total",
+	    "Packets received", ifi_ipackets),
+	METRICS_NET_FIELD("rtems_net_receive_errors_total",
+	    "Receive errors", ifi_ierrors),
+	METRICS_NET_FIELD("rtems_net_receive_drops_total",
+	    "Packets dropped on input", ifi_iqdrops),
+	METRICS_NET_FIELD("rtems_net_transmit_bytes_total",
+	    "Bytes sent", ifi_obytes),
+	METRICS_NET_FIELD("rtems_net_transmit_packets_total",
+	    "Packets sent", ifi_opackets),
+	METRICS_NET_FIELD("rtems_net_transmit_errors_total",
+	    "Transmit errors", ifi_oerrors),
+	METRICS_NET_FIELD("rtems_net_transmit_drops_total",
+	    "Packets dropped on output", ifi_oqdrops),
+};
+
+static struct {
+	rtems_mutex mutex;
+	struct metrics_gauge *gauges;
+	rtems_id task;
+	uint16_t port;
+	uint32_t scrapes;
+	size_t len;
+	bool truncated;
+	char page[METRICS_PAGE_SIZE];
+	char request[METRICS_REQUEST_SIZE];
+	rtems_blkdev_stats blkdev[METRICS_BLOCK_DEVICE_COUNT];
+	bool blkdev_valid[METRICS_BLOCK_DEVICE_COUNT];
+	struct ifmibdata ifmib[METRICS_MAX_INTERFACES];
+	size_t ifmib_count;
+} metrics = {
+	.mutex = RTEMS_MUTEX_INITIALIZER("metrics"),
+};
+
+RTEMS_INTERRUPT_LOCK_DEFINE(static, metrics_gauge_lock, "metrics gauges")
+
+void
+metrics_gauge_register(struct metrics_gauge *gauge)
+{
+	rtems_interrupt_lock_context lock_context;
+
+	rtems_interrupt_lock_acquire(&metrics_gauge_lock, &lock_context);
+	gauge->next = metrics.gauges;
+	metrics.gauges = gauge;
+	rtems_interrupt_lock_release(&metrics_gauge_lock, &lock_context);
+}
+
+void
+metrics_gauge_set(struct metrics_gauge *gauge, int64_t value)
+{
+	rtems_interrupt_lock_context lock_context;
+
+	/* A 64 bit store is not atomic on a 32 bit processor */
+	rtems_interrupt_lock_acquire(&metrics_gauge_lock, &lock_context);
+	gauge->value = value;
+	rtems_interrupt_lock_release(&metrics_gauge_lock, &lock_context);
+}
+
+void
+metrics_gauge_add(struct metrics_gauge *gauge, int64_t delta)
+{
+	rtems_interrupt_lock_context lock_context;
+
+	rtems_interrupt_lock_acquire(&metrics_gauge_lock, &lock_context);
+	gauge->value += delta;
+	rtems_interrupt_lock_release(&metrics_gauge_lock, &lock_context);
+}
+
+static void
+metrics_printf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+static void
+metrics_printf(const char *fmt, ...)
+{
+	size_t avail = sizeof(metrics.page) - metrics.len;
+	va_list ap;
+	int n;
+
+	va_start(ap, fmt);
+	n = vsnprintf(&metrics.page[metrics.len], avail, fmt, ap);
+	va_end(ap);
+
+	if (n < 0 || (size_t)n >= avail) {
+		/* Drop the partial line, the page stays well formed */
+		metrics.page[metrics.len] = '\0';
+		metrics.truncated = true;
+	} else {
+		metrics.len += (size_t)n;
+	}
+}
+
+static void
+metrics_family(const char *name, const char *help, const char *type)
+{
+	metrics_printf("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+static bool
+metrics_task_visitor(rtems_tcb *tcb, void *arg)
+{
+	Timestamp_Control cpu;
+	char name[16];
+	uint64_t ns;
+
+	(void)arg;
+
+	rtems_object_get_name(tcb->Object.id, sizeof(name), name);
+	_Thread_Get_CPU_time_used(tcb, &cpu);
+	ns = _Timestamp_Get_as_nanoseconds(&cpu);
+	metrics_printf("rtems_task_cpu_seconds_total{id=\"0x%08" PRIx32
+	    "\",name=\"%s\"} %" PRIu64 ".%09" PRIu64 "\n",
+	    tcb->Object.id, name, ns / 1000000000, ns % 1000000000);
+
+	return false;
+}
+
+static void
+metrics_render_cpu(void)
+{
+	uint64_t ns = rtems_clock_get_uptime_nanoseconds();
+
+	metrics_family("rtems_uptime_seconds", "Time since boot", "counter");
+	metrics_printf("rtems_uptime_seconds %" PRIu64 ".%09" PRIu64 "\n",
+	    ns / 1000000000, ns % 1000000000);
+
+	/* The CPU load is the rate of everything but the IDLE task */
+	metrics_family("rtems_task_cpu_seconds_total",
+	    "CPU time used by the task", "counter");
+	rtems_task_iterate(metrics_task_visitor, NULL);
+}
+
+static void
+metrics_render_heap(void)
+{
+	Heap_Information_block info;
+
+	if (malloc_info(&info) != 0) {
+		return;
+	}
+
+	metrics_family("rtems_heap_free_bytes", "Free bytes in the heap",
+	    "gauge");
+	metrics_printf("rtems_heap_free_bytes %" PRIuPTR "\n", info.Free.total);
+	metrics_family("rtems_heap_used_bytes", "Used bytes in the heap",
+	    "gauge");
+	metrics_printf("rtems_heap_used_bytes %" PRIuPTR "\n", info.Used.total);
+	metrics_family("rtems_heap_largest_free_bytes",
+	    "Largest free block in the heap", "gauge");
+	metrics_printf("rtems_heap_largest_free_bytes %" PRIuPTR "\n",
+	    info.Free.largest);
+	metrics_family("rtems_heap_free_blocks",
+	    "Number of free blocks in the heap (fragmentation)", "gauge");
+	metrics_printf("rtems_heap_free_blocks %" PRIuPTR "\n",
+	    info.Free.number);
+}
+
+static void
+metrics_render_block(void)
+{
+	size_t i;
+	size_t f;
+
+	metrics_family("rtems_bdbuf_cache_bytes",
+	    "Memory configured for the bdbuf cache", "gauge");
+	metrics_printf("rtems_bdbuf_cache_bytes %zu\n",
+	    rtems_bdbuf_configuration.size);
+
+	for (i = 0; i < METRICS_BLOCK_DEVICE_COUNT; ++i) {
+		int fd = open(metrics_block_devices[i], O_RDONLY);
+
+		metrics.blkdev_valid[i] = fd >= 0 &&
+		    rtems_disk_fd_get_device_stats(fd, &metrics.blkdev[i]) == 0;
+		if (fd >= 0) {
+			close(fd);
+		}
+	}
+
+	/* All samples of a metric have to be grouped together */
+	for (f = 0; f < RTEMS_ARRAY_SIZE(metrics_blkdev_fields); ++f) {
+		const struct metrics_field *field = &metrics_blkdev_fields[f];
+
+		metrics_family(field->name, field->help, field->type);
+		for (i = 0; i < METRICS_BLOCK_DEVICE_COUNT; ++i) {
+			const uint32_t *value;
+
+			if (!metrics.blkdev_valid[i]) {
+				continue;
+			}
+			value = (const uint32_t *)
+			    ((const char *)&metrics.blkdev[i] + field->offset);
+			metrics_printf("%s{device=\"%s\"} %" PRIu32 "\n",
+			    field->name, metrics_block_devices[i] + 5, *value);
+		}
+	}
+}
+
+/*
+ * The counters come from the interface MIB. Interface indices are not dense
+ * once an interface was detached (for example the USB WLAN), so all indices
+ * up to the highest one are tried and missing ones (ENOENT) are skipped.
+ */
+static void
+metrics_render_net(void)
+{
+	int count_name[5] = { CTL_NET, PF_LINK, NETLINK_GENERIC, IFMIB_SYSTEM,
+	    IFMIB_IFCOUNT };
+	int name[6] = { CTL_NET, PF_LINK, NETLINK_GENERIC, IFMIB_IFDATA,
+	    0, IFDATA_GENERAL };
+	int ifcount;
+	int index;
+	size_t len;
+	size_t i;
+	size_t f;
+
+	metrics.ifmib_count = 0;
+	len = sizeof(ifcount);
+	if (sysctl(count_name, 5, &ifcount, &len, NULL, 0) != 0) {
+		return;
+	}
+
+	for (index = 1; index <= ifcount &&
+	    metrics.ifmib_count < METRICS_MAX_INTERFACES; ++index) {
+		struct ifmibdata *ifmd = &metrics.ifmib[metrics.ifmib_count];
+
+		name[4] = index;
+		len = sizeof(*ifmd);
+		if (sysctl(name, 6, ifmd, &len, NULL, 0) == 0) {
+			++metrics.ifmib_count;
+		}
+	}
+
+	metrics_family("rtems_net_up", "Interface is administratively up",
+	    "gauge");
+	for (i = 0; i < metrics.ifmib_count; ++i) {
+		metrics_printf("rtems_net_up{interface=\"%s\"} %d\n",
+		    metrics.ifmib[i].ifmd_name,
+		    (metrics.ifmib[i].ifmd_flags & IFF_UP) != 0);
+	}
+
+	for (f = 0; f < RTEMS_ARRAY_SIZE(metrics_net_fields); ++f) {
+		const struct metrics_field *field = &metrics_net_fields[f];
+
+		metrics_family(field->name, field->help, field->type);
+		for (i = 0; i < metrics.ifmib_count; ++i) {
+			const uint64_t *value = (const uint64_t *)
+			    ((const char *)&metrics.ifmib[i].ifmd_data +
+			    field->offset);
+
+			metrics_printf("%s{interface=\"%s\"} %" PRIu64 "\n",
+			    field->name, metrics.ifmib[i].ifmd_name, *value);
+		}
+	}
+}
+
+static void
+metrics_render_gauges(void)
+{
+	struct metrics_gauge *gauge;
+
+	for (gauge = metrics.gauges; gauge != NULL; gauge = gauge->next) {
+		rtems_interrupt_lock_context lock_context;
+		int64_t value;
+
+		rtems_interrupt_lock_acquire(&metrics_gauge_lock, &lock_context);
+		value = gauge->value;
+		rtems_interrupt_lock_release(&metrics_gauge_lock, &lock_context);
+
+		metrics_family(gauge->name, gauge->help, "gauge");
+		metrics_printf("%s %" PRId64 "\n", gauge->name, value);
+	}
+}
+
+/* Has to be called with the mutex held */
+static void
+metrics_render(void)
+{
+	uint64_t start = rtems_clock_get_uptime_nanoseconds();
+	uint64_t ns;
+
+	metrics.len = 0;
+	metrics.truncated = false;
+	metrics.page[0] = '\0';
+	++metrics.scrapes;
+
+	metrics_render_cpu();
+	metrics_render_heap();
+	metrics_render_block();
+	metrics_render_net();
+	metrics_render_gauges();
+
+	metrics_family("metrics_scrapes_total", "Pages rendered", "counter");
+	metrics_printf("metrics_scrapes_total %" PRIu32 "\n", metrics.scrapes);
+	ns = rtems_clock_get_uptime_nanoseconds() - start;
+	metrics_family("metrics_render_seconds",
+	    "Time used to render this page", "gauge");
+	metrics_printf("metrics_render_seconds %" PRIu64 ".%09" PRIu64 "\n",
+	    ns / 1000000000, ns % 1000000000);
+}
+
+static int
+metrics_write_all(int sock, const char *buf, size_t len)
+{
+	while (len > 0) {
+		ssize_t n = write(sock, buf, len);
+
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n <= 0) {
+			return -1;
+		}
+		buf += n;
+		len -= (size_t)n;
+	}
+
+	return 0;
+}
+
+static void
+metrics_respond(int sock, const char *status, const char *body, size_t len)
+{
+	char header[160];
+	int n;
+
+	n = snprintf(header, sizeof(header), "HTTP/1.0 %s\r\n"
+	    "Content-Type: text/plain; version=0.0.4\r\n"
+	    "Content-Length: %zu\r\n"
+	    "Connection: close\r\n\r\n", status, len);
+	if (metrics_write_all(sock, header, (size_t)n) == 0) {
+		(void)metrics_write_all(sock, body, len);
+	}
+}
+
+static void
+metrics_serve(int sock)
+{
+	struct timeval tv = { .tv_sec = METRICS_IO_TIMEOUT_S };
+	char *request = metrics.request;
+	size_t len = 0;
+
+	(void)setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+	(void)setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+	/* Only the request line is of interest, the headers are ignored */
+	while (len < METRICS_REQUEST_SIZE - 1) {
+		ssize_t n = read(sock, &request[len], METRICS_REQUEST_SIZE - 1 - len);
+
+		if (n <= 0) {
+			break;
+		}
+		len += (size_t)n;
+		request[len] = '\0';
+		if (strstr(request, "\r\n\r\n") != NULL ||
+		    strstr(request, "\n\n") != NULL) {
+			break;
+		}
+	}
+	request[len] = '\0';
+
+	if (strncmp(request, "GET /metrics", 12) == 0 &&
+	    (request[12] == ' ' || request[12] == '?')) {
+		metrics_render();
+		metrics_respond(sock, "200 OK", metrics.page, metrics.len);
+	} else if (strncmp(request, "GET ", 4) == 0) {
+		static const char not_found[] = "Try /metrics\n";
+
+		metrics_respond(sock, "404 Not Found", not_found,
+		    sizeof(not_found) - 1);
+	}
+}
+
+/*
+ * Errors of accept() are either about a single connection that was aborted
+ * before it was accepted or the listener is broken (for example no more file
+ * descriptors). The server stops after too many errors in a row.
+ */
+static void
+metrics_task(rtems_task_argument arg)
+{
+	int listener = (int)arg;
+	unsigned errors = 0;
+
+	while (true) {
+		int sock = accept(listener, NULL, NULL);
+
+		if (sock < 0) {
+			if (errno == EINTR || errno == ECONNABORTED) {
+				continue;
+			}
+			if (++errors >= METRICS_ACCEPT_ERRORS) {
+				printf("metrics: accept() failed: %s, "
+				    "server stopped\n", strerror(errno));
+				break;
+			}
+			rtems_task_wake_after(
+			    RTEMS_MILLISECONDS_TO_TICKS(METRICS_ACCEPT_DELAY_MS));
+			continue;
+		}
+		errors = 0;
+		rtems_mutex_lock(&metrics.mutex);
+		metrics_serve(sock);
+		rtems_mutex_unlock(&metrics.mutex);
+		close(sock);
+	}
+
+	close(listener);
+	metrics.task = 0;
+	rtems_task_exit();
+}
+
+rtems_status_code
+metrics_start_server(uint16_t port)
+{
+	struct sockaddr_in addr;
+	rtems_status_code sc;
+	int listener;
+	int one = 1;
+
+	if (metrics.task != 0) {
+		return RTEMS_RESOURCE_IN_USE;
+	}
+
+	listener = socket(AF_INET, SOCK_STREAM, 0);
+	if (listener < 0) {
+		return RTEMS_UNSATISFIED;
+	}
+	(void)setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_len = sizeof(addr);
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(port);
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	if (bind(listener, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+	    listen(listener, 4) != 0) {
+		close(listener);
+		return RTEMS_UNSATISFIED;
+	}
+
+	sc = rtems_task_create(rtems_build_name('M', 'T', 'R', 'C'),
+	    METRICS_TASK_PRIO, METRICS_TASK_STACK, RTEMS_DEFAULT_MODES,
+	    RTEMS_DEFAULT_ATTRIBUTES, &metrics.task);
+	if (sc == RTEMS_SUCCESSFUL) {
+		sc = rtems_task_start(metrics.task, metrics_task,
+		    (rtems_task_argument)listener);
+	}
+	if (sc != RTEMS_SUCCESSFUL) {
+		close(listener);
+		return sc;
+	}
+	metrics.port = port;
+
+	return RTEMS_SUCCESSFUL;
+}
+
+static int
+command_metrics(int argc, char *argv[])
+{
+	if (argc == 1) {
+		if (metrics.task == 0) {
+			printf("Server not running, see 'metrics start' and "
+			    "[network] metrics_port in the profile\n");
+		} else {
+			printf("Serving http://<address>:%u/metrics\n",
+			    metrics.port);
+		}
+		printf("%" PRIu32 " pages rendered\n", metrics.scrapes);
+	} else if (argc == 2 && strcmp(argv[1], "print") == 0) {
+		rtems_mutex_lock(&metrics.mutex);
+		metrics_render();
+		fwrite(metrics.page, 1, metrics.len, stdout);
+		if (metrics.truncated) {
+			printf("# Page truncated at %zu bytes\n", metrics.len);
+		}
+		rtems_mutex_unlock(&metrics.mutex);
+	} else if ((argc == 2 || argc == 3) && strcmp(argv[1], "start") == 0) {
+		unsigned long port = METRICS_DEFAULT_PORT;
+		rtems_status_code sc;
+
+		if (argc == 3) {
+			char *end;
+
+			port = strtoul(argv[2], &end, 0);
+			if (end == argv[2] || *end != '\0' || port == 0 ||
+			    port > UINT16_MAX) {
+				puts(shell_METRICS_Command.usage);
+				return -1;
+			}
+		}
+		sc = metrics_start_server((uint16_t)port);
+		if (sc != RTEMS_SUCCESSFUL) {
+			printf("Couldn't start server: %s\n",
+			    rtems_status_text(sc));
+			return -1;
+		}
+		printf("Serving http://<address>:%lu/metrics\n", port);
+	} else {
+		puts(shell_METRICS_Command.usage);
+		return -1;
+	}
+
+	return 0;
+}
+
+rtems_shell_cmd_t shell_METRICS_Command = {
+	.name = "metrics",
+	.usage = "Use with: metrics [print|start [port]]\n"
+	    "Without arguments, show the state of the Prometheus endpoint.\n"
+	    "  print: Render the /metrics page to the console\n"
+	    "  start: Serve the page on the given port (default: 9100)\n",
+	.topic = "misc",
+	.command = command_metrics,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
@@ -0,0 +1,76 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DEMO_METRICS_H
+#define DEMO_METRICS_H
+
+#include <rtems.h>
+#include <rtems/shell.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define METRICS_DEFAULT_PORT 9100
+
+/*
+ * An application defined value that is exported with every scrape. The
+ * structure is provided by the caller and has to stay valid after it has been
+ * registered. Name and help text are only referenced.
+ */
+struct metrics_gauge {
+	const char *name;
+	const char *help;
+	int64_t value;
+	struct metrics_gauge *next;
+};
+
+#define METRICS_GAUGE_INITIALIZER(name, help) { name, help, 0, NULL }
+
+/* Add a gauge to the exported metrics. Registering a gauge twice is a bug. */
+void metrics_gauge_register(struct metrics_gauge *gauge);
+
+/* Update the gauge. Can be called from any task and from interrupts. */
+void metrics_gauge_set(struct metrics_gauge *gauge, int64_t value);
+
+/* Add delta to the gauge. Same context rules as metrics_gauge_set(). */
+void metrics_gauge_add(struct metrics_gauge *gauge, int64_t delta);
+
+/*
+ * Start the task that serves "GET /metrics" in the Prometheus text format on
+ * the given TCP port. The page is rendered into static buffers, so a scrape
+ * doesn't allocate memory.
+ */
+rtems_status_code metrics_start_server(uint16_t port);
+
+extern rtems_shell_cmd_t shell_METRICS_Command;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DEMO_METRICS_H */
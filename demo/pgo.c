@@ -0,0 +1,332 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "pgo.h"
+
+#include <arpa/inet.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <rtems/thread.h>
+
+/* RAM file system directory used by pgo_send() */
+#define PGO_SEND_DIR	"/pgo"
+#define PGO_TAR_BLOCK	512
+#define PGO_TAR_NAME	100
+
+#ifndef PGO_PREFIX_STRIP
+#define PGO_PREFIX_STRIP 0
+#endif
+
+/*
+ * Provided by libgcov, which is only linked with PGO=generate. The code has
+ * to be the same for PGO=generate and PGO=use, otherwise the profile doesn't
+ * match. So instrumentation is detected at run time.
+ */
+void __gcov_dump(void) __attribute__((weak));
+void __gcov_reset(void) __attribute__((weak));
+
+static rtems_mutex pgo_mutex = RTEMS_MUTEX_INITIALIZER("pgo");
+
+bool
+pgo_is_instrumented(void)
+{
+	return __gcov_dump != NULL && __gcov_reset != NULL;
+}
+
+int
+pgo_dump(const char *dir)
+{
+	char strip[16];
+
+	if (!pgo_is_instrumented()) {
+		errno = ENOTSUP;
+		return -1;
+	}
+
+	/* libgcov creates the subdirectories but doesn't report errors */
+	if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+		return -1;
+	}
+
+	snprintf(strip, sizeof(strip), "%d", PGO_PREFIX_STRIP);
+
+	rtems_mutex_lock(&pgo_mutex);
+	/* Evaluated by libgcov on each dump */
+	setenv("GCOV_PREFIX", dir, 1);
+	setenv("GCOV_PREFIX_STRIP", strip, 1);
+	__gcov_dump();
+	__gcov_reset();
+	rtems_mutex_unlock(&pgo_mutex);
+
+	return 0;
+}
+
+int
+pgo_reset(void)
+{
+	if (!pgo_is_instrumented()) {
+		errno = ENOTSUP;
+		return -1;
+	}
+
+	rtems_mutex_lock(&pgo_mutex);
+	__gcov_reset();
+	rtems_mutex_unlock(&pgo_mutex);
+
+	return 0;
+}
+
+static int
+pgo_write_all(int sock, const void *buf, size_t len)
+{
+	const uint8_t *p = buf;
+
+	while (len > 0) {
+		ssize_t n = write(sock, p, len);
+
+		if (n <= 0) {
+			return -1;
+		}
+		p += n;
+		len -= (size_t)n;
+	}
+
+	return 0;
+}
+
+static void
+pgo_tar_octal(char *field, size_t size, unsigned long value)
+{
+	snprintf(field, size, "%0*lo", (int)size - 1, value);
+}
+
+/* Send a ustar header and the content padded to full blocks */
+static int
+pgo_send_file(int sock, const char *path, const char *name, off_t size)
+{
+	char block[PGO_TAR_BLOCK];
+	unsigned sum = 0;
+	off_t left = size;
+	size_t i;
+	int rv = 0;
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		return -1;
+	}
+
+	memset(block, 0, sizeof(block));
+	memcpy(&block[0], name, strlen(name));
+	pgo_tar_octal(&block[100], 8, 0644);
+	pgo_tar_octal(&block[108], 8, 0);
+	pgo_tar_octal(&block[116], 8, 0);
+	pgo_tar_octal(&block[124], 12, (unsigned long)size);
+	pgo_tar_octal(&block[136], 12, (unsigned long)time(NULL));
+	memset(&block[148], ' ', 8);
+	block[156] = '0';
+	memcpy(&block[257], "ustar", 6);
+	memcpy(&block[263], "00", 2);
+	for (i = 0; i < sizeof(block); ++i) {
+		sum += (unsigned char)block[i];
+	}
+	snprintf(&block[148], 8, "%06o", sum);
+	block[155] = ' ';
+	rv = pgo_write_all(sock, block, sizeof(block));
+
+	while (rv == 0 && left > 0) {
+		size_t fill = 0;
+
+		memset(block, 0, sizeof(block));
+		while (fill < sizeof(block) && (off_t)fill < left) {
+			ssize_t n = read(fd, &block[fill], sizeof(block) - fill);
+
+			if (n <= 0) {
+				rv = -1;
+				break;
+			}
+			fill += (size_t)n;
+		}
+		if (rv == 0) {
+			rv = pgo_write_all(sock, block, sizeof(block));
+			left -= (off_t)fill;
+		}
+	}
+
+	close(fd);
+
+	return rv;
+}
+
+static int
+pgo_send_tree(int sock, const char *root, const char *rel)
+{
+	char path[PATH_MAX];
+	struct dirent *de;
+	DIR *dir;
+	int rv = 0;
+
+	snprintf(path, sizeof(path), "%s/%s", root, rel);
+	dir = opendir(path);
+	if (dir == NULL) {
+		return -1;
+	}
+
+	while (rv == 0 && (de = readdir(dir)) != NULL) {
+		char name[PGO_TAR_NAME];
+		struct stat st;
+		int n;
+
+		if (strcmp(de->d_name, ".") == 0 ||
+		    strcmp(de->d_name, "..") == 0) {
+			continue;
+		}
+
+		n = snprintf(name, sizeof(name), "%s%s%s", rel,
+		    rel[0] != '\0' ? "/" : "", de->d_name);
+		if (n < 0 || (size_t)n >= sizeof(name)) {
+			printf("Name too long for tar: %s\n", de->d_name);
+			continue;
+		}
+		snprintf(path, sizeof(path), "%s/%s", root, name);
+		if (stat(path, &st) != 0) {
+			rv = -1;
+		} else if (S_ISDIR(st.st_mode)) {
+			rv = pgo_send_tree(sock, root, name);
+		} else if (S_ISREG(st.st_mode)) {
+			rv = pgo_send_file(sock, path, name, st.st_size);
+		}
+	}
+
+	closedir(dir);
+
+	return rv;
+}
+
+int
+pgo_send(const char *host, uint16_t port)
+{
+	static const char end[2 * PGO_TAR_BLOCK];
+	struct sockaddr_in addr;
+	int sock;
+	int rv;
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_len = sizeof(addr);
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(port);
+	if (inet_pton(AF_INET, host, &addr.sin_addr) != 1) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (pgo_dump(PGO_SEND_DIR) != 0) {
+		return -1;
+	}
+
+	sock = socket(AF_INET, SOCK_STREAM, 0);
+	if (sock < 0) {
+		return -1;
+	}
+	rv = connect(sock, (struct sockaddr *)&addr, sizeof(addr));
+	if (rv == 0) {
+		rv = pgo_send_tree(sock, PGO_SEND_DIR, "");
+	}
+	if (rv == 0) {
+		rv = pgo_write_all(sock, end, sizeof(end));
+	}
+	close(sock);
+
+	return rv;
+}
+
+static int
+command_pgo(int argc, char *argv[])
+{
+	const char *dir = PGO_DEFAULT_DIR;
+	int rv;
+
+	if (argc == 1) {
+		printf("instrumented: %s\n", pgo_is_instrumented() ? "yes" :
+		    "no (build with: make PGO=generate)");
+		return 0;
+	}
+
+	if (strcmp(argv[1], "dump") == 0 && argc <= 3) {
+		if (argc == 3) {
+			dir = argv[2];
+		}
+		rv = pgo_dump(dir);
+	} else if (strcmp(argv[1], "reset") == 0 && argc == 2) {
+		rv = pgo_reset();
+	} else if (strcmp(argv[1], "send") == 0 && (argc == 3 || argc == 4)) {
+		uint16_t port = PGO_DEFAULT_PORT;
+
+		if (argc == 4) {
+			port = (uint16_t)strtoul(argv[3], NULL, 0);
+		}
+		rv = pgo_send(argv[2], port);
+	} else {
+		puts(shell_PGO_Command.usage);
+		return -1;
+	}
+
+	if (rv != 0) {
+		printf("Failed: %s\n", strerror(errno));
+		return -1;
+	}
+
+	return 0;
+}
+
+rtems_shell_cmd_t shell_PGO_Command = {
+	.name = "pgo",
+	.usage = "Use with: pgo [dump [<dir>]|reset|send <ip> [<port>]]\n"
+	    "Write the profile of an application built with make PGO=generate.\n"
+	    "  dump: write the .gcda files below dir\n"
+	    "        (default: " PGO_DEFAULT_DIR ")\n"
+	    "  reset: clear the counters\n"
+	    "  send: send the files as tar archive via TCP (default port: 5401)\n"
+	    "        receive with: nc -l 5401 > pgo.tar\n",
+	.topic = "misc",
+	.command = command_pgo,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
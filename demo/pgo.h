@@ -0,0 +1,81 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DEMO_PGO_H
+#define DEMO_PGO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <rtems.h>
+#include <rtems/shell.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Runtime support for profile guided optimization (make PGO=generate, see
+ * src/bsp.mk). An RTEMS application never exits, so the gcov profile that
+ * libgcov normally writes at exit is written on request instead.
+ *
+ * The files are written below a directory with the same layout as the build
+ * directory of the application, e.g. <dir>/b-imx7/init.gcda. Copy the tree
+ * to $(PGO_DIR) on the host and build with make PGO=use.
+ *
+ * In builds without PGO=generate, the functions do nothing and return -1.
+ */
+
+#define PGO_DEFAULT_DIR "/media/mmcsd-0-0/pgo"
+#define PGO_DEFAULT_PORT 5401
+
+/* Return true if the application has been built with PGO=generate. */
+bool pgo_is_instrumented(void);
+
+/*
+ * Write the profile below dir. Existing files are merged, so repeated dumps
+ * accumulate. The counters are reset afterwards. Returns 0 on success.
+ */
+int pgo_dump(const char *dir);
+
+/* Reset the counters, e.g. to exclude the start of the application. */
+int pgo_reset(void);
+
+/*
+ * Dump the profile to a RAM file system and send it as tar archive via TCP,
+ * e.g. to: nc -l 5401 > pgo.tar. Useful without an SD card, for example in
+ * QEMU. Returns 0 on success.
+ */
+int pgo_send(const char *host, uint16_t port);
+
+extern rtems_shell_cmd_t shell_PGO_Command;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DEMO_PGO_H */
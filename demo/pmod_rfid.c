@@ -42,12 +42,17 @@
 #include <assert.h>
 #include <dev/spi/spi.h>
 #include <err.h>
+#include <errno.h>
 #include <fcntl.h>
 #include <libfdt.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
 
+#include "applog.h"
+#include "dmabuf.h"
+#include "hrtimer.h"
 #include "pmod_rfid.h"
 
 /* Address command word */
@@ -157,16 +162,26 @@
 #define TRF7970_REG_TX_LENGTH2			0x1E
 #define TRF7970_REG_FIFO_IO_REG			0x1F
 
+/* Driver messages go to the application log, so SPI timing isn't disturbed */
 #define verb_print(ctx, level, ...) \
 	do { \
 		if (ctx->verbose >= level) { \
-			printf(__VA_ARGS__); \
+			APPLOG_INFO(__VA_ARGS__); \
 		} \
 	} while(0)
 
+/* Longest transfer: the register dump */
+#define PMOD_RFID_BUF_SIZE (TRF7970_REG_TX_LENGTH2 + 1)
+
 struct pmod_rfid_ctx {
 	int bus;
 	uint8_t cs;
+	/*
+	 * Messages are composed and received in place in this DMA buffer, so
+	 * the SPI driver needs neither bounce copies nor cache maintenance
+	 * that touches other data.
+	 */
+	uint8_t *buf;
 	bool initialized;
 	enum {
 		VERBOSE_FEW = 0,
@@ -209,16 +224,36 @@ input_available(long int timeout_ms)
 }
 
 /*
- * Note: txbuf or rxbuf might can be NULL. They also might can be the same.
+ * Log a buffer as hex in one message. A NULL buffer is logged as zeros like it
+ * is sent. Long buffers are truncated.
+ */
+static void
+pmod_rfid_dump(const char *prefix, const uint8_t *buf, size_t len)
+{
+	char line[APPLOG_MAX_MESSAGE];
+	size_t pos;
+
+	pos = (size_t)snprintf(line, sizeof(line), "%s:", prefix);
+	for (size_t i = 0; i < len && pos + 4 <= sizeof(line); ++i) {
+		pos += (size_t)snprintf(&line[pos], sizeof(line) - pos,
+		    " %02x", buf != NULL ? buf[i] : 0);
+	}
+	APPLOG_INFO("%s", line);
+}
+
+/*
+ * Send the first len bytes of ctx->buf. If receive is set, the received bytes
+ * replace them.
  */
 static int
 pmod_rfid_transfer(
 	struct pmod_rfid_ctx *ctx,
-	const uint8_t *txbuf,
-	uint8_t *rxbuf,
-	size_t len
+	size_t len,
+	bool receive
 )
 {
+	const uint8_t *txbuf = ctx->buf;
+	uint8_t *rxbuf = receive ? ctx->buf : NULL;
 	int error;
 	spi_ioc_transfer msg = {
 		.len = len,
@@ -230,26 +265,35 @@ pmod_rfid_transfer(
 		.cs = ctx->cs,
 	};
 
-	verb_print(ctx, VERBOSE_ALL, "Tx: ");
-	for (size_t i = 0; i < len; ++i) {
-		verb_print(ctx, VERBOSE_ALL, "%02x ",
-		    txbuf != NULL ? txbuf[i] : 0);
+	if (ctx->verbose >= VERBOSE_ALL) {
+		pmod_rfid_dump("Tx", txbuf, len);
 	}
-	verb_print(ctx, VERBOSE_ALL, "\n");
 
 	error = ioctl(ctx->bus, SPI_IOC_MESSAGE(1), &msg);
 	if (error != 0) {
-		warn("PMOD_RFID: Error during transfer: ");
-	} else if (rxbuf != NULL) {
-		verb_print(ctx, VERBOSE_ALL, "Rx: ");
-		for (size_t i = 0; i < len; ++i) {
-			verb_print(ctx, VERBOSE_ALL, "%02x ", rxbuf[i]);
-		}
-		verb_print(ctx, VERBOSE_ALL, "\n");
+		APPLOG_ERROR("PMOD_RFID: Error during transfer: %s",
+		    strerror(errno));
+	} else if (rxbuf != NULL && ctx->verbose >= VERBOSE_ALL) {
+		pmod_rfid_dump("Rx", rxbuf, len);
 	}
 	return error;
 }
 
+static int
+pmod_rfid_command(struct pmod_rfid_ctx *ctx, uint8_t command)
+{
+	ctx->buf[0] = command;
+	return pmod_rfid_transfer(ctx, 1, false);
+}
+
+static int
+pmod_rfid_write_reg(struct pmod_rfid_ctx *ctx, uint8_t reg, uint8_t value)
+{
+	ctx->buf[0] = (uint8_t)(TRF7970_AC_WRITE | reg);
+	ctx->buf[1] = value;
+	return pmod_rfid_transfer(ctx, 2, false);
+}
+
 static int
 pmod_rfid_check_irq_status(
 	struct pmod_rfid_ctx *ctx,
@@ -258,17 +302,19 @@ pmod_rfid_check_irq_status(
 	unsigned verbosity
 )
 {
-	uint8_t buf[] = {TRF7970_AC_READ | TRF7970_REG_IRQ_STATUS, 0};
+	uint8_t *buf = ctx->buf;
 	int error;
 
-	verb_print(ctx, verbosity, "Check IRQ status\n");
-	error = pmod_rfid_transfer(ctx, buf, buf, sizeof(buf));
+	verb_print(ctx, verbosity, "Check IRQ status");
+	buf[0] = TRF7970_AC_READ | TRF7970_REG_IRQ_STATUS;
+	buf[1] = 0;
+	error = pmod_rfid_transfer(ctx, 2, true);
 	if (error == 0) {
 		if (received_flags != NULL) {
 			*received_flags = buf[1];
 		}
 		if ((buf[1] & ~expected_flags) != 0) {
-			printf("Unexpected IRQ status: 0x%02x\n", buf[1]);
+			APPLOG_WARN("Unexpected IRQ status: 0x%02x", buf[1]);
 			error = -1;
 		}
 	}
@@ -290,13 +336,14 @@ pmod_rfid_cmd_regdump_func(int argc, char **argv)
 {
 	struct pmod_rfid_ctx *ctx = pmod_rfid_get_context();
 	int error;
-	uint8_t buf[TRF7970_REG_TX_LENGTH2 + 1] = {
-	    TRF7970_AC_CONT_READ | TRF7970_AC_ADDRESS(0)};
+	uint8_t *buf = ctx->buf;
 
 	(void) argc;
 	(void) argv;
 
-	error = pmod_rfid_transfer(ctx, buf, buf, sizeof(buf));
+	memset(buf, 0, PMOD_RFID_BUF_SIZE);
+	buf[0] = TRF7970_AC_CONT_READ | TRF7970_AC_ADDRESS(0);
+	error = pmod_rfid_transfer(ctx, PMOD_RFID_BUF_SIZE, true);
 	if (error == 0) {
 		printf("=== Main Control Registers\n"
 		    "CHIP_STATUS_CONTROL            0x%02x\n"
@@ -386,13 +433,13 @@ pmod_rfid_cmd_init_func(int argc, char **argv)
 	bool use_5V = false;
 
 	if (ctx->initialized) {
-		verb_print(ctx, VERBOSE_FEW, "Reinitializing\n");
+		verb_print(ctx, VERBOSE_FEW, "Reinitializing");
 		ctx->initialized = false;
 	}
 	if (argc >= 2) {
 		if(strcmp(argv[1], "5") == 0) {
 			use_5V = true;
-			verb_print(ctx, VERBOSE_FEW, "Use 5V\n");
+			verb_print(ctx, VERBOSE_FEW, "Use 5V");
 		} else {
 			printf("Unknown parameter: %s\n", argv[1]);
 			return -1;
@@ -401,72 +448,58 @@ pmod_rfid_cmd_init_func(int argc, char **argv)
 
 	if (error == 0) {
 		/* Software reset */
-		uint8_t buf[] = {TRF7970_AC_CMD_SW_INIT};
-		verb_print(ctx, VERBOSE_SOME, "Initiate software reset\n");
-		error = pmod_rfid_transfer(ctx, buf, NULL, sizeof(buf));
+		verb_print(ctx, VERBOSE_SOME, "Initiate software reset");
+		error = pmod_rfid_command(ctx, TRF7970_AC_CMD_SW_INIT);
 	}
 	if (error == 0) {
-		uint8_t buf[] = {TRF7970_AC_CMD_IDLE};
-		verb_print(ctx, VERBOSE_SOME, "Wait cycles for reset\n");
-		error = pmod_rfid_transfer(ctx, buf, NULL, sizeof(buf));
+		verb_print(ctx, VERBOSE_SOME, "Wait cycles for reset");
+		error = pmod_rfid_command(ctx, TRF7970_AC_CMD_IDLE);
 	}
-	rtems_task_wake_after(RTEMS_MILLISECONDS_TO_TICKS(1));
+	hrtimer_sleep_us(1000);
 	if (error == 0) {
-		uint8_t buf[] = {TRF7970_AC_CMD_RESET_FIFO};
-		verb_print(ctx, VERBOSE_SOME, "Reset FIFO\n");
-		error = pmod_rfid_transfer(ctx, buf, NULL, sizeof(buf));
+		verb_print(ctx, VERBOSE_SOME, "Reset FIFO");
+		error = pmod_rfid_command(ctx, TRF7970_AC_CMD_RESET_FIFO);
 	}
 	if (error == 0) {
-		uint8_t buf[] = {
-		    TRF7970_AC_WRITE | TRF7970_REG_CHIP_STATUS_CONTROL,
-		    TRF7970_STAT_CTRL_RF_ON
-		    };
-		verb_print(ctx, VERBOSE_SOME, "Setup status control\n");
+		uint8_t value = TRF7970_STAT_CTRL_RF_ON;
+		verb_print(ctx, VERBOSE_SOME, "Setup status control");
 		if (use_5V) {
-			buf[1] |= TRF7970_STAT_CTRL_VRS5_3;
+			value |= TRF7970_STAT_CTRL_VRS5_3;
 		}
-		error = pmod_rfid_transfer(ctx, buf, NULL, sizeof(buf));
+		error = pmod_rfid_write_reg(ctx,
+		    TRF7970_REG_CHIP_STATUS_CONTROL, value);
 	}
 	if (error == 0) {
-		uint8_t buf[] = {
-		    TRF7970_AC_WRITE | TRF7970_REG_ISO_CONTROL,
-		    TRF7970_ISO_CTRL_ISO_1
-		    };
-		verb_print(ctx, VERBOSE_SOME, "Setup ISO control\n");
-		error = pmod_rfid_transfer(ctx, buf, NULL, sizeof(buf));
+		verb_print(ctx, VERBOSE_SOME, "Setup ISO control");
+		error = pmod_rfid_write_reg(ctx, TRF7970_REG_ISO_CONTROL,
+		    TRF7970_ISO_CTRL_ISO_1);
 	}
 	if (error == 0) {
-		uint8_t buf[] = {
-		    TRF7970_AC_WRITE | TRF7970_REG_MODULAR_AND_SYS_CLK_CTRL,
-		    TRF7970_MODSCK_PM2 | TRF7970_MODSCK_PM1 | TRF7970_MODSCK_PM0
-		    };
-		verb_print(ctx, VERBOSE_SOME, "Setup Modulator and Clock control\n");
-		error = pmod_rfid_transfer(ctx, buf, NULL, sizeof(buf));
+		verb_print(ctx, VERBOSE_SOME, "Setup Modulator and Clock control");
+		error = pmod_rfid_write_reg(ctx,
+		    TRF7970_REG_MODULAR_AND_SYS_CLK_CTRL,
+		    TRF7970_MODSCK_PM2 | TRF7970_MODSCK_PM1 | TRF7970_MODSCK_PM0);
 	}
 	if (error == 0) {
-		uint8_t buf[] = {
-		    TRF7970_AC_WRITE | TRF7970_REG_REGULATOR_AND_IO_CTRL,
-		    TRF7970_REGIOCTL_AUTO_REG
-		    };
-		verb_print(ctx, VERBOSE_SOME, "Setup Regulator and I/O Control\n");
-		error = pmod_rfid_transfer(ctx, buf, NULL, sizeof(buf));
+		verb_print(ctx, VERBOSE_SOME, "Setup Regulator and I/O Control");
+		error = pmod_rfid_write_reg(ctx,
+		    TRF7970_REG_REGULATOR_AND_IO_CTRL,
+		    TRF7970_REGIOCTL_AUTO_REG);
 	}
 	if (error == 0) {
-		uint8_t buf[] = {
-		    TRF7970_AC_WRITE | TRF7970_REG_NFC_TARGET_DETECTION_LVL,
-		    0 /* according to data sheet! */
-		    };
-		verb_print(ctx, VERBOSE_SOME, "Set NFC Target detection level to 0\n");
-		error = pmod_rfid_transfer(ctx, buf, NULL, sizeof(buf));
+		verb_print(ctx, VERBOSE_SOME, "Set NFC Target detection level to 0");
+		/* 0 according to data sheet! */
+		error = pmod_rfid_write_reg(ctx,
+		    TRF7970_REG_NFC_TARGET_DETECTION_LVL, 0);
 	}
 	if (error == 0) {
 		error = pmod_rfid_check_irq_status(ctx, 0, NULL, VERBOSE_SOME);
 	}
 	if (error == 0) {
-		verb_print(ctx, VERBOSE_FEW, "Success\n");
+		verb_print(ctx, VERBOSE_FEW, "Success");
 		ctx->initialized = true;
 	} else {
-		verb_print(ctx, VERBOSE_FEW, "Failure\n");
+		verb_print(ctx, VERBOSE_FEW, "Failure");
 	}
 
 	return error;
@@ -493,7 +526,7 @@ pmod_rfid_cmd_detect_func(int argc, char **argv)
 	(void) argv;
 
 	if (!ctx->initialized) {
-		verb_print(ctx, VERBOSE_FEW, "Not yet initialized. Doing that now ...\n");
+		verb_print(ctx, VERBOSE_FEW, "Not yet initialized. Doing that now ...");
 		pmod_rfid_cmd_init_func(argc, argv);
 	}
 
@@ -507,20 +540,21 @@ pmod_rfid_cmd_detect_func(int argc, char **argv)
 		++activity;
 
 		if (error == 0) {
-			uint8_t buf[] = {
+			static const uint8_t msg[] = {
 				TRF7970_AC_CMD_RESET_FIFO,
 				TRF7970_AC_CMD_TRANSM_WITH_CRC,
 				TRF7970_AC_CONT_WRITE | TRF7970_REG_TX_LENGTH1,
 				0x00, 0x30, /* both length registers */
 				0x26, 0x01, 0x00 /* all three will go into FIFO data */
 				};
-			verb_print(ctx, VERBOSE_MORE, "Setup for tag detection and prepare data for tag\n");
-			error = pmod_rfid_transfer(ctx, buf, NULL, sizeof(buf));
+			verb_print(ctx, VERBOSE_MORE, "Setup for tag detection and prepare data for tag");
+			memcpy(ctx->buf, msg, sizeof(msg));
+			error = pmod_rfid_transfer(ctx, sizeof(msg), false);
 		}
 		while (error == 0 && retry_count > 0 &&
 		    (irq_status & TRF7970_IRQ_SRX) == 0) {
 			--retry_count;
-			rtems_task_wake_after(RTEMS_MILLISECONDS_TO_TICKS(1));
+			hrtimer_sleep_us(1000);
 			error = pmod_rfid_check_irq_status(ctx,
 			    TRF7970_IRQ_TX | TRF7970_IRQ_SRX, &irq_status,
 			    VERBOSE_MORE);
@@ -529,13 +563,13 @@ pmod_rfid_cmd_detect_func(int argc, char **argv)
 			if (ctx->led_detection) {
 				pmod_rfid_led_off(ctx);
 			}
-			verb_print(ctx, VERBOSE_FEW, "\r%c No tag      ",
+			printf("\r%c No tag      ",
 			    indicator[act_index]);
 		} else {
 			if (ctx->led_detection) {
 				pmod_rfid_led_on(ctx);
 			}
-			verb_print(ctx, VERBOSE_FEW, "\r%c Tag detected",
+			printf("\r%c Tag detected",
 			    indicator[act_index]);
 		}
 
@@ -543,7 +577,7 @@ pmod_rfid_cmd_detect_func(int argc, char **argv)
 			stop = true;
 		}
 	}
-	verb_print(ctx, VERBOSE_FEW, "\n");
+	printf("\n");
 
 	if (error != 0) {
 		printf("Stopped due to an error.\n");
@@ -654,6 +688,8 @@ pmod_rfid_init(const char *spi_bus, uint8_t cs) {
 	ctx->verbose = VERBOSE_FEW;
 	ctx->bus = open(spi_bus, O_RDWR);
 	assert(ctx->bus >= 0);
+	ctx->buf = dmabuf_alloc(PMOD_RFID_BUF_SIZE);
+	assert(ctx->buf != NULL);
 	sc = pmod_rfid_init_pins(ctx);
 	assert(sc == RTEMS_SUCCESSFUL);
 	ctx->led_detection = true;
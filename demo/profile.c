@@ -0,0 +1,353 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "profile.h"
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <inih/ini.h>
+#include <rtems/bdbuf.h>
+#include <rtems/ftpd.h>
+
+#include "mempool.h"
+#include "sensorstream-proto.h"
+
+enum profile_kind {
+	PROFILE_STRING,
+	PROFILE_PRIORITY,
+	PROFILE_U32,
+	PROFILE_SIZE,
+};
+
+struct profile_key {
+	const char *section;
+	const char *name;
+	enum profile_kind kind;
+	size_t offset;
+	uint32_t min;
+	uint32_t max;
+};
+
+#define PROFILE_KEY(section, name, member, kind, min, max) \
+    { section, name, kind, offsetof(struct profile, member), min, max }
+
+/* The maximum of priorities is checked against the scheduler at run time */
+static const struct profile_key profile_keys[] = {
+	PROFILE_KEY("profile", "name", name, PROFILE_STRING, 0, 0),
+	PROFILE_KEY("tasks", "shell_priority", shell_priority,
+	    PROFILE_PRIORITY, 1, 0),
+	PROFILE_KEY("tasks", "dhcp_priority", dhcp_priority,
+	    PROFILE_PRIORITY, 1, 0),
+	PROFILE_KEY("tasks", "wpa_priority", wpa_priority,
+	    PROFILE_PRIORITY, 1, 0),
+	PROFILE_KEY("tasks", "led_priority", led_priority,
+	    PROFILE_PRIORITY, 1, 0),
+	PROFILE_KEY("tasks", "led_stack_size", led_stack_size,
+	    PROFILE_SIZE, RTEMS_MINIMUM_STACK_SIZE, 1024 * 1024),
+	PROFILE_KEY("tasks", "ftpd_priority", ftpd_priority,
+	    PROFILE_PRIORITY, 1, 0),
+	PROFILE_KEY("tasks", "ftpd_tasks", ftpd_tasks,
+	    PROFILE_U32, 1, 16),
+	PROFILE_KEY("tasks", "log_priority", log_priority,
+	    PROFILE_PRIORITY, 1, 0),
+	PROFILE_KEY("storage", "swapout_priority", swapout_priority,
+	    PROFILE_PRIORITY, 1, 0),
+	PROFILE_KEY("storage", "read_ahead_priority", read_ahead_priority,
+	    PROFILE_PRIORITY, 1, 0),
+	/* Larger buffers than a block of the I/O pool would need the heap */
+	PROFILE_KEY("storage", "read_block_size", read_block_size,
+	    PROFILE_SIZE, 512, MEMPOOL_IO_BLOCK_SIZE),
+	PROFILE_KEY("led", "period_ms", led_period_ms,
+	    PROFILE_U32, 10, 60000),
+	PROFILE_KEY("sensors", "stream_rate", stream_rate,
+	    PROFILE_U32, 0, 1000000),
+	PROFILE_KEY("sensors", "stream_batch", stream_batch,
+	    PROFILE_U32, 1, SENSORSTREAM_MAX_BATCH),
+	PROFILE_KEY("sensors", "stream_flush_ms", stream_flush_ms,
+	    PROFILE_U32, 1, 10000),
+	PROFILE_KEY("network", "metrics_port", metrics_port,
+	    PROFILE_U32, 0, 65535),
+};
+
+struct profile profile;
+
+struct profile_parser {
+	struct profile *profile;
+	const char *path;
+	unsigned errors;
+};
+
+void
+profile_init(void)
+{
+	rtems_task_priority lowest = RTEMS_MAXIMUM_PRIORITY - 1;
+
+	memset(&profile, 0, sizeof(profile));
+	strlcpy(profile.name, "default", sizeof(profile.name));
+
+	profile.shell_priority = 150;
+	profile.dhcp_priority = lowest;
+	profile.wpa_priority = lowest;
+	profile.led_priority = lowest;
+	profile.led_stack_size = RTEMS_MINIMUM_STACK_SIZE;
+	profile.ftpd_priority = rtems_ftpd_configuration.priority;
+	profile.ftpd_tasks = (uint32_t)rtems_ftpd_configuration.tasks_count;
+	profile.log_priority = lowest;
+
+	profile.swapout_priority = rtems_bdbuf_configuration.swapout_priority;
+	profile.read_ahead_priority =
+	    rtems_bdbuf_configuration.read_ahead_priority;
+	profile.read_block_size = 8 * 1024;
+
+	profile.led_period_ms = 250;
+
+	profile.stream_rate = 0;
+	profile.stream_batch = SENSORSTREAM_MAX_BATCH;
+	profile.stream_flush_ms = 10;
+
+	/* The metrics endpoint is only served on request */
+	profile.metrics_port = 0;
+}
+
+static const struct profile_key *
+profile_find_key(const char *section, const char *name)
+{
+	size_t i;
+
+	for (i = 0; i < RTEMS_ARRAY_SIZE(profile_keys); ++i) {
+		if (strcmp(profile_keys[i].section, section) == 0 &&
+		    strcmp(profile_keys[i].name, name) == 0) {
+			return &profile_keys[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Numbers with an optional K or M suffix for sizes */
+static bool
+profile_parse_number(const char *value, enum profile_kind kind,
+    unsigned long *number)
+{
+	char *end;
+
+	*number = strtoul(value, &end, 0);
+	if (end == value) {
+		return false;
+	}
+	if (kind == PROFILE_SIZE && (*end == 'k' || *end == 'K')) {
+		*number *= 1024;
+		++end;
+	} else if (kind == PROFILE_SIZE && (*end == 'm' || *end == 'M')) {
+		*number *= 1024 * 1024;
+		++end;
+	}
+
+	return *end == '\0';
+}
+
+static int
+profile_handler(void *arg, const char *section, const char *name,
+    const char *value)
+{
+	struct profile_parser *parser = arg;
+	const struct profile_key *key = profile_find_key(section, name);
+	char *member;
+	unsigned long number;
+	unsigned long max;
+
+	if (key == NULL) {
+		printf("%s: Unknown key [%s] %s\n", parser->path, section, name);
+		++parser->errors;
+		return 1;
+	}
+
+	member = (char *)parser->profile + key->offset;
+	if (key->kind == PROFILE_STRING) {
+		strlcpy(member, value, sizeof(parser->profile->name));
+		return 1;
+	}
+
+	max = key->kind == PROFILE_PRIORITY ?
+	    RTEMS_MAXIMUM_PRIORITY - 1 : key->max;
+	if (!profile_parse_number(value, key->kind, &number) ||
+	    number < key->min || number > max) {
+		printf("%s: Invalid value for [%s] %s: '%s' (%" PRIu32
+		    "..%lu)\n", parser->path, section, name, value, key->min,
+		    max);
+		++parser->errors;
+		return 1;
+	}
+
+	if (key->kind == PROFILE_SIZE) {
+		*(size_t *)member = (size_t)number;
+	} else {
+		*(uint32_t *)member = (uint32_t)number;
+	}
+
+	/* Never stop, report all errors of the file at once */
+	return 1;
+}
+
+int
+profile_load(const char *path)
+{
+	struct profile next = profile;
+	struct profile_parser parser = {
+		.profile = &next,
+		.path = path,
+		.errors = 0,
+	};
+	int rv;
+
+	rv = ini_parse(path, profile_handler, &parser);
+	if (rv < 0) {
+		return -1;
+	}
+	if (rv > 0) {
+		printf("%s:%d: Syntax error, ignored\n", path, rv);
+	}
+
+	strlcpy(next.path, path, sizeof(next.path));
+	profile = next;
+
+	return 0;
+}
+
+static void
+profile_set_task_priority(rtems_name name, rtems_task_priority priority)
+{
+	rtems_task_priority old;
+	rtems_id id;
+
+	if (rtems_task_ident(name, RTEMS_SEARCH_LOCAL_NODE, &id) ==
+	    RTEMS_SUCCESSFUL) {
+		(void)rtems_task_set_priority(id, priority, &old);
+	}
+}
+
+void
+profile_apply(void)
+{
+	profile_set_task_priority(rtems_build_name('S', 'H', 'L', 'L'),
+	    profile.shell_priority);
+	/* Started by grisp_init_dhcpcd() before the profile is read */
+	profile_set_task_priority(rtems_build_name('D', 'H', 'C', 'P'),
+	    profile.dhcp_priority);
+	profile_set_task_priority(rtems_build_name('L', 'O', 'G', 'D'),
+	    profile.log_priority);
+	profile_set_task_priority(rtems_build_name('B', 'S', 'W', 'P'),
+	    profile.swapout_priority);
+	profile_set_task_priority(rtems_build_name('B', 'R', 'D', 'A'),
+	    profile.read_ahead_priority);
+
+	/* Used when the FTP server is started with startftp */
+	rtems_ftpd_configuration.priority = profile.ftpd_priority;
+	rtems_ftpd_configuration.tasks_count = (int)profile.ftpd_tasks;
+}
+
+static void
+profile_print(void)
+{
+	const char *section = "";
+	size_t i;
+
+	printf("; active profile from %s\n",
+	    profile.path[0] != '\0' ? profile.path : "built-in defaults");
+	for (i = 0; i < RTEMS_ARRAY_SIZE(profile_keys); ++i) {
+		const struct profile_key *key = &profile_keys[i];
+		const char *member = (const char *)&profile + key->offset;
+
+		if (strcmp(section, key->section) != 0) {
+			section = key->section;
+			printf("%s[%s]\n", i == 0 ? "" : "\n", section);
+		}
+		switch (key->kind) {
+		case PROFILE_STRING:
+			printf("%s = %s\n", key->name, member);
+			break;
+		case PROFILE_SIZE:
+			printf("%s = %zu\n", key->name,
+			    *(const size_t *)member);
+			break;
+		default:
+			printf("%s = %" PRIu32 "\n", key->name,
+			    *(const uint32_t *)member);
+			break;
+		}
+	}
+
+	printf("\n; fixed at build time\n"
+	    "; bdbuf cache = %zu, max buffer = %" PRIu32 ", read-ahead blocks = %"
+	    PRIu32 "\n", rtems_bdbuf_configuration.size,
+	    rtems_bdbuf_configuration.buffer_max,
+	    rtems_bdbuf_configuration.max_read_ahead_blocks);
+}
+
+static int
+command_profile(int argc, char *argv[])
+{
+	if (argc == 1) {
+		profile_print();
+		return 0;
+	}
+
+	if ((argc == 2 || argc == 3) && strcmp(argv[1], "load") == 0) {
+		const char *path = argc == 3 ? argv[2] : PROFILE_DEFAULT_PATH;
+
+		if (profile_load(path) != 0) {
+			printf("Couldn't read %s\n", path);
+			return -1;
+		}
+		profile_apply();
+		printf("Loaded profile '%s'. Priorities of running tasks are\n"
+		    "changed, the other values apply when the service starts.\n",
+		    profile.name);
+		return 0;
+	}
+
+	puts(shell_PROFILE_Command.usage);
+	return -1;
+}
+
+rtems_shell_cmd_t shell_PROFILE_Command = {
+	.name = "profile",
+	.usage = "Use with: profile [load [file]]\n"
+	    "Show the active performance profile in INI format or load one\n"
+	    "(default: " PROFILE_DEFAULT_PATH ").\n",
+	.topic = "misc",
+	.command = command_profile,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
@@ -0,0 +1,119 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DEMO_PROFILE_H
+#define DEMO_PROFILE_H
+
+#include <rtems.h>
+#include <rtems/shell.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define PROFILE_DEFAULT_PATH "/media/mmcsd-0-0/profile.ini"
+
+/*
+ * Tuning values of the demo application. They start with the built-in
+ * defaults and can be overwritten by an INI file on the SD card, for example:
+ *
+ *   [profile]
+ *   name = low-latency
+ *
+ *   [tasks]
+ *   shell_priority = 120
+ *   dhcp_priority = 200
+ *
+ *   [storage]
+ *   read_block_size = 32K
+ *
+ *   [network]
+ *   metrics_port = 9100
+ *
+ * The file is read once the SD card is mounted. Tasks that are already
+ * running at that point (shell, dhcpcd, log drain, bdbuf swapout and
+ * read-ahead) get their priorities changed. Everything else is used when it
+ * is started.
+ */
+struct profile {
+	char name[32];
+	char path[64];
+
+	/* [tasks] */
+	rtems_task_priority shell_priority;
+	rtems_task_priority dhcp_priority;
+	rtems_task_priority wpa_priority;
+	rtems_task_priority led_priority;
+	size_t led_stack_size;
+	rtems_task_priority ftpd_priority;
+	uint32_t ftpd_tasks;
+	rtems_task_priority log_priority;
+
+	/* [storage] */
+	rtems_task_priority swapout_priority;
+	rtems_task_priority read_ahead_priority;
+	/* At most MEMPOOL_IO_BLOCK_SIZE */
+	size_t read_block_size;
+
+	/* [led] */
+	uint32_t led_period_ms;
+
+	/* [sensors] */
+	uint32_t stream_rate;
+	uint32_t stream_batch;
+	uint32_t stream_flush_ms;
+
+	/* [network] */
+	uint32_t metrics_port;
+};
+
+/* The active profile. Only changed by profile_init() and profile_load(). */
+extern struct profile profile;
+
+/* Set the built-in defaults. Has to be called before anything uses them. */
+void profile_init(void);
+
+/*
+ * Read the INI file and make it the active profile. Unknown keys and invalid
+ * values are reported and ignored. Returns 0 on success and -1 if the file
+ * couldn't be read, in which case the active profile is not changed.
+ */
+int profile_load(const char *path);
+
+/*
+ * Apply the priorities of the active profile to tasks that are already
+ * running and update the FTP server configuration.
+ */
+void profile_apply(void);
+
+extern rtems_shell_cmd_t shell_PROFILE_Command;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DEMO_PROFILE_H */
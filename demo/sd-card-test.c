@@ -27,6 +27,10 @@
 
 #ifdef __rtems__
 #include "sd-card-test.h"
+#include "mempool.h"
+#else /* __rtems__ */
+#define mempool_io_alloc(size) malloc(size)
+#define mempool_io_free(buffer) free(buffer)
 #endif /* __rtems__ */
 
 #include <arpa/inet.h>
@@ -50,6 +54,7 @@ check_and_process_params(
 	int *fd,
 	size_t *size,
 	size_t *block_size,
+	void **io,
 	uint8_t **block,
 	uint8_t **read_block,
 	int *max_errors,
@@ -57,6 +62,8 @@ check_and_process_params(
 	uint32_t *start_value
 )
 {
+	size_t stride;
+
 	if (argc < 4) {
 		printf("Use with %s <file> <size> <block_size> [<start_value> [<output>]]\n"
 		    "    <size> and <block_size> is in bytes\n"
@@ -103,34 +110,34 @@ check_and_process_params(
 		return -1;
 	}
 
-	if (block != NULL) {
-		*block = malloc(*block_size);
-		if (*block == NULL) {
-			warn("Couldn't allocate block");
-			return -1;
-		}
+	if (*block_size > SIZE_MAX / 2 - sizeof(uint32_t)) {
+		warnx("block_size too big");
+		return -1;
+	}
+
+	/*
+	 * The buffers of one request share an I/O buffer, a block of the pool
+	 * if they fit into it
+	 */
+	stride = (*block_size + sizeof(uint32_t) - 1) &
+	    ~(sizeof(uint32_t) - 1);
+	*io = mempool_io_alloc(read_block != NULL ? 2 * stride : stride);
+	if (*io == NULL) {
+		warnx("Couldn't allocate the buffers");
+		return -1;
 	}
 
+	if (block != NULL) {
+		*block = *io;
+	}
 	if (read_block != NULL) {
-		*read_block = malloc(*block_size);
-		if (*read_block == NULL) {
-			warn("Couldn't allocate read_block");
-			if (block != NULL) {
-				free(*block);
-			}
-			return -1;
-		}
+		*read_block = (uint8_t *)*io + stride;
 	}
 
 	*fd = open(argv[1], open_flags, 0666);
 	if (*fd < 0) {
 		warn("Couldn't open file");
-		if (block != NULL) {
-			free(*block);
-		}
-		if (read_block != NULL) {
-			free(*read_block);
-		}
+		mempool_io_free(*io);
 		return -1;
 	}
 
@@ -178,12 +185,14 @@ command_pattern_fill(int argc, char *argv[])
 	int fd;
 	size_t size;
 	size_t block_size;
+	void *io;
 	uint8_t *block;
 	uint32_t start_value;
 	int rv;
 
 	rv = check_and_process_params(argc, argv, O_WRONLY | O_CREAT,
-	    &fd, &size, &block_size, &block, NULL, NULL, NULL, &start_value);
+	    &fd, &size, &block_size, &io, &block, NULL, NULL, NULL,
+	    &start_value);
 	if (rv != 0) {
 		warnx("Error while processing parameters.\n");
 		return rv;
@@ -202,7 +211,7 @@ command_pattern_fill(int argc, char *argv[])
 		}
 	}
 
-	free(block);
+	mempool_io_free(io);
 	close(fd);
 
 	return 0;
@@ -226,6 +235,7 @@ command_pattern_check(int argc, char *argv[])
 	int fd;
 	size_t size;
 	size_t block_size;
+	void *io;
 	uint8_t *block;
 	uint8_t *read_block;
 	int rv;
@@ -236,7 +246,7 @@ command_pattern_check(int argc, char *argv[])
 	uint32_t start_value;
 
 	rv = check_and_process_params(argc, argv, O_RDONLY,
-	    &fd, &size, &block_size, &block, &read_block,
+	    &fd, &size, &block_size, &io, &block, &read_block,
 	    &max_errors, &short_output, &start_value);
 	if (rv != 0) {
 		warnx("Error while processing parameters.\n");
@@ -277,8 +287,7 @@ command_pattern_check(int argc, char *argv[])
 		}
 	}
 
-	free(read_block);
-	free(block);
+	mempool_io_free(io);
 	close(fd);
 
 	return 0;
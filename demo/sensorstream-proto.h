@@ -0,0 +1,75 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Wire format of the sensor stream. This header is shared with the host
+ * receiver and must not depend on RTEMS. All fields are in network byte order.
+ */
+
+#ifndef DEMO_SENSORSTREAM_PROTO_H
+#define DEMO_SENSORSTREAM_PROTO_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define SENSORSTREAM_MAGIC		0x47535331 /* "GSS1" */
+#define SENSORSTREAM_DEFAULT_PORT	5300
+
+/* Largest UDP payload that fits into an Ethernet frame without fragments */
+#define SENSORSTREAM_MAX_DATAGRAM	1472
+
+struct sensorstream_header {
+	uint32_t magic;
+	/* Incremented per datagram, gaps are lost datagrams */
+	uint32_t seq;
+	/* Samples dropped on the sender because the queue was full (total) */
+	uint32_t dropped;
+	uint16_t count;
+	uint16_t reserved;
+	/* CLOCK_REALTIME of the sender when the datagram was sent */
+	uint64_t send_time_ns;
+} __attribute__((packed));
+
+struct sensorstream_sample {
+	/* CLOCK_REALTIME of the sender when the sample was taken */
+	uint64_t time_ns;
+	uint32_t channel;
+	int32_t value;
+} __attribute__((packed));
+
+#define SENSORSTREAM_MAX_BATCH \
+    ((SENSORSTREAM_MAX_DATAGRAM - sizeof(struct sensorstream_header)) / \
+    sizeof(struct sensorstream_sample))
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DEMO_SENSORSTREAM_PROTO_H */
@@ -0,0 +1,457 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Samples are queued in a single producer, single consumer ring. The sender
+ * task wakes up every flush interval, packs everything that is queued into
+ * as few datagrams as possible and sends them. With high sample rates this
+ * results in full datagrams, with low rates the latency is bounded by the
+ * flush interval.
+ */
+
+#include "sensorstream.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <netinet/in.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/endian.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <rtems/thread.h>
+
+#include "profile.h"
+
+/* Has to be a power of two */
+#define SENSORSTREAM_QUEUE_SIZE	4096
+#define SENSORSTREAM_TASK_PRIO	110
+#define SENSORSTREAM_GEN_PRIO	105
+#define SENSORSTREAM_TASK_STACK	(8 * 1024)
+
+struct sensorstream_entry {
+	uint64_t time_ns;
+	uint32_t channel;
+	int32_t value;
+};
+
+static struct {
+	/* Written by the producer only */
+	atomic_uint head;
+	atomic_uint dropped;
+	/* Written by the sender task only */
+	atomic_uint tail;
+	struct sensorstream_entry entries[SENSORSTREAM_QUEUE_SIZE];
+} sensorstream_queue;
+
+static struct {
+	rtems_mutex mutex;
+	struct sensorstream_config config;
+	struct sensorstream_stats stats;
+	atomic_bool running;
+	atomic_bool stop;
+	rtems_id stopper;
+	int sock;
+	uint32_t seq;
+	unsigned last_head;
+	unsigned last_dropped;
+	uint32_t gen_rate;
+	uint8_t datagram[SENSORSTREAM_MAX_DATAGRAM];
+} sensorstream = {
+	.mutex = RTEMS_MUTEX_INITIALIZER("sensorstream"),
+};
+
+static uint64_t
+sensorstream_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+bool
+sensorstream_push(uint32_t channel, int32_t value)
+{
+	unsigned head = atomic_load_explicit(&sensorstream_queue.head,
+	    memory_order_relaxed);
+	unsigned tail = atomic_load_explicit(&sensorstream_queue.tail,
+	    memory_order_acquire);
+	struct sensorstream_entry *entry;
+
+	if (head - tail >= SENSORSTREAM_QUEUE_SIZE) {
+		atomic_fetch_add_explicit(&sensorstream_queue.dropped, 1,
+		    memory_order_relaxed);
+		return false;
+	}
+
+	entry = &sensorstream_queue.entries[head % SENSORSTREAM_QUEUE_SIZE];
+	entry->time_ns = sensorstream_now_ns();
+	entry->channel = channel;
+	entry->value = value;
+	atomic_store_explicit(&sensorstream_queue.head, head + 1,
+	    memory_order_release);
+
+	return true;
+}
+
+void
+sensorstream_get_stats(struct sensorstream_stats *stats)
+{
+	rtems_mutex_lock(&sensorstream.mutex);
+	*stats = sensorstream.stats;
+	rtems_mutex_unlock(&sensorstream.mutex);
+}
+
+/* Pack up to count samples from the queue and send them in one datagram */
+static void
+sensorstream_send_batch(unsigned tail, unsigned count, uint32_t dropped)
+{
+	struct sensorstream_header *header =
+	    (struct sensorstream_header *)sensorstream.datagram;
+	struct sensorstream_sample *samples =
+	    (struct sensorstream_sample *)(header + 1);
+	size_t len;
+	unsigned i;
+	ssize_t n;
+
+	for (i = 0; i < count; ++i) {
+		const struct sensorstream_entry *entry =
+		    &sensorstream_queue.entries[(tail + i) %
+		    SENSORSTREAM_QUEUE_SIZE];
+
+		samples[i].time_ns = htobe64(entry->time_ns);
+		samples[i].channel = htonl(entry->channel);
+		samples[i].value = (int32_t)htonl((uint32_t)entry->value);
+	}
+
+	header->magic = htonl(SENSORSTREAM_MAGIC);
+	header->seq = htonl(sensorstream.seq);
+	header->dropped = htonl(dropped);
+	header->count = htons((uint16_t)count);
+	header->reserved = 0;
+	header->send_time_ns = htobe64(sensorstream_now_ns());
+	++sensorstream.seq;
+
+	len = sizeof(*header) + count * sizeof(*samples);
+	n = send(sensorstream.sock, sensorstream.datagram, len, 0);
+
+	rtems_mutex_lock(&sensorstream.mutex);
+	if (n == (ssize_t)len) {
+		++sensorstream.stats.sent_datagrams;
+		sensorstream.stats.sent_samples += count;
+	} else {
+		++sensorstream.stats.send_errors;
+	}
+	rtems_mutex_unlock(&sensorstream.mutex);
+}
+
+static void
+sensorstream_drain(void)
+{
+	unsigned head = atomic_load_explicit(&sensorstream_queue.head,
+	    memory_order_acquire);
+	unsigned tail = atomic_load_explicit(&sensorstream_queue.tail,
+	    memory_order_relaxed);
+	unsigned dropped = atomic_load_explicit(&sensorstream_queue.dropped,
+	    memory_order_relaxed);
+	unsigned fill = head - tail;
+
+	rtems_mutex_lock(&sensorstream.mutex);
+	sensorstream.stats.pushed += head - sensorstream.last_head;
+	sensorstream.stats.dropped += dropped - sensorstream.last_dropped;
+	if (fill > sensorstream.stats.max_fill) {
+		sensorstream.stats.max_fill = fill;
+	}
+	rtems_mutex_unlock(&sensorstream.mutex);
+	sensorstream.last_head = head;
+	sensorstream.last_dropped = dropped;
+
+	while (tail != head) {
+		unsigned count = head - tail;
+
+		if (count > sensorstream.config.batch) {
+			count = sensorstream.config.batch;
+		}
+		sensorstream_send_batch(tail, count, dropped);
+		tail += count;
+		/* Give the slots back early, the producer might be waiting */
+		atomic_store_explicit(&sensorstream_queue.tail, tail,
+		    memory_order_release);
+	}
+}
+
+static void
+sensorstream_task(rtems_task_argument arg)
+{
+	rtems_interval ticks = RTEMS_MILLISECONDS_TO_TICKS(
+	    sensorstream.config.flush_ms);
+
+	(void)arg;
+
+	if (ticks == 0) {
+		ticks = 1;
+	}
+
+	while (!atomic_load(&sensorstream.stop)) {
+		rtems_task_wake_after(ticks);
+		sensorstream_drain();
+	}
+
+	/* Everything that has been pushed so far gets sent */
+	sensorstream_drain();
+	close(sensorstream.sock);
+	atomic_store(&sensorstream.running, false);
+	rtems_event_transient_send(sensorstream.stopper);
+	rtems_task_exit();
+}
+
+/* Synthetic load for testing: a counter on channel 0 at a fixed rate */
+static void
+sensorstream_generator(rtems_task_argument arg)
+{
+	uint32_t rate = (uint32_t)arg;
+	uint64_t start = rtems_clock_get_uptime_nanoseconds();
+	uint64_t pushed = 0;
+
+	while (atomic_load(&sensorstream.running) &&
+	    !atomic_load(&sensorstream.stop)) {
+		uint64_t elapsed = rtems_clock_get_uptime_nanoseconds() - start;
+		uint64_t target = elapsed * rate / 1000000000;
+
+		while (pushed < target) {
+			(void)sensorstream_push(0, (int32_t)pushed);
+			++pushed;
+		}
+		rtems_task_wake_after(1);
+	}
+
+	rtems_task_exit();
+}
+
+static rtems_status_code
+sensorstream_start_task(rtems_name name, rtems_task_priority prio,
+    rtems_task_entry entry, rtems_task_argument arg)
+{
+	rtems_status_code sc;
+	rtems_id id;
+
+	sc = rtems_task_create(name, prio, SENSORSTREAM_TASK_STACK,
+	    RTEMS_DEFAULT_MODES, RTEMS_DEFAULT_ATTRIBUTES, &id);
+	if (sc != RTEMS_SUCCESSFUL) {
+		return sc;
+	}
+
+	return rtems_task_start(id, entry, arg);
+}
+
+rtems_status_code
+sensorstream_start(const struct sensorstream_config *config)
+{
+	struct sockaddr_in addr;
+	rtems_status_code sc;
+	unsigned head;
+	int sock;
+
+	if (config->batch == 0 || config->batch > SENSORSTREAM_MAX_BATCH) {
+		return RTEMS_INVALID_NUMBER;
+	}
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_len = sizeof(addr);
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(config->port);
+	if (inet_pton(AF_INET, config->host, &addr.sin_addr) != 1) {
+		return RTEMS_INVALID_ADDRESS;
+	}
+
+	if (atomic_exchange(&sensorstream.running, true)) {
+		return RTEMS_RESOURCE_IN_USE;
+	}
+
+	sock = socket(AF_INET, SOCK_DGRAM, 0);
+	if (sock < 0 ||
+	    connect(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+		if (sock >= 0) {
+			close(sock);
+		}
+		atomic_store(&sensorstream.running, false);
+		return RTEMS_UNSATISFIED;
+	}
+
+	/* Discard what has been pushed while the stream was stopped */
+	head = atomic_load(&sensorstream_queue.head);
+	atomic_store(&sensorstream_queue.tail, head);
+	sensorstream.last_head = head;
+	sensorstream.last_dropped = atomic_load(&sensorstream_queue.dropped);
+
+	rtems_mutex_lock(&sensorstream.mutex);
+	memset(&sensorstream.stats, 0, sizeof(sensorstream.stats));
+	rtems_mutex_unlock(&sensorstream.mutex);
+
+	sensorstream.config = *config;
+	sensorstream.sock = sock;
+	sensorstream.seq = 0;
+	atomic_store(&sensorstream.stop, false);
+
+	sc = sensorstream_start_task(rtems_build_name('S', 'S', 'N', 'D'),
+	    SENSORSTREAM_TASK_PRIO, sensorstream_task, 0);
+	if (sc != RTEMS_SUCCESSFUL) {
+		close(sock);
+		atomic_store(&sensorstream.running, false);
+	}
+
+	return sc;
+}
+
+void
+sensorstream_stop(void)
+{
+	if (!atomic_load(&sensorstream.running)) {
+		return;
+	}
+
+	sensorstream.stopper = rtems_task_self();
+	atomic_store(&sensorstream.stop, true);
+	(void)rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+}
+
+static void
+sensorstream_print_stats(void)
+{
+	struct sensorstream_stats stats;
+
+	sensorstream_get_stats(&stats);
+	printf("state:     %s\n", atomic_load(&sensorstream.running) ?
+	    "running" : "stopped");
+	printf("pushed:    %" PRIu64 " samples\n", stats.pushed);
+	printf("dropped:   %" PRIu64 " samples (queue full)\n", stats.dropped);
+	printf("sent:      %" PRIu64 " samples in %" PRIu64 " datagrams\n",
+	    stats.sent_samples, stats.sent_datagrams);
+	printf("errors:    %" PRIu64 " datagrams not sent\n",
+	    stats.send_errors);
+	printf("max queue: %" PRIu32 " of %u samples\n", stats.max_fill,
+	    SENSORSTREAM_QUEUE_SIZE);
+}
+
+static int
+command_sensorstream(int argc, char *argv[])
+{
+	struct sensorstream_config config = {
+		.port = SENSORSTREAM_DEFAULT_PORT,
+		.batch = profile.stream_batch,
+		.flush_ms = profile.stream_flush_ms,
+	};
+	unsigned long rate = profile.stream_rate;
+	rtems_status_code sc;
+	int i;
+
+	if (argc == 1) {
+		sensorstream_print_stats();
+		return 0;
+	}
+
+	if (argc == 2 && strcmp(argv[1], "stop") == 0) {
+		sensorstream_stop();
+		sensorstream_print_stats();
+		return 0;
+	}
+
+	if (argc < 3 || strcmp(argv[1], "start") != 0) {
+		puts(shell_SENSORSTREAM_Command.usage);
+		return -1;
+	}
+
+	config.host = argv[2];
+	for (i = 3; i < argc; ++i) {
+		unsigned long value;
+
+		if (i + 1 >= argc) {
+			puts(shell_SENSORSTREAM_Command.usage);
+			return -1;
+		}
+		value = strtoul(argv[i + 1], NULL, 0);
+		if (strcmp(argv[i], "-p") == 0) {
+			config.port = (uint16_t)value;
+		} else if (strcmp(argv[i], "-b") == 0) {
+			config.batch = (unsigned)value;
+		} else if (strcmp(argv[i], "-f") == 0) {
+			config.flush_ms = (unsigned)value;
+		} else if (strcmp(argv[i], "-r") == 0) {
+			rate = value;
+		} else {
+			puts(shell_SENSORSTREAM_Command.usage);
+			return -1;
+		}
+		++i;
+	}
+
+	sc = sensorstream_start(&config);
+	if (sc != RTEMS_SUCCESSFUL) {
+		printf("Couldn't start stream: %s\n", rtems_status_text(sc));
+		return -1;
+	}
+
+	if (rate > 0) {
+		sc = sensorstream_start_task(
+		    rtems_build_name('S', 'G', 'E', 'N'),
+		    SENSORSTREAM_GEN_PRIO, sensorstream_generator,
+		    (rtems_task_argument)rate);
+		if (sc != RTEMS_SUCCESSFUL) {
+			printf("Couldn't start generator: %s\n",
+			    rtems_status_text(sc));
+		}
+	}
+
+	return 0;
+}
+
+rtems_shell_cmd_t shell_SENSORSTREAM_Command = {
+	.name = "sensorstream",
+	.usage = "Use with: sensorstream [start <ip> [-p <port>] [-b <batch>] "
+	    "[-f <ms>] [-r <rate>]|stop]\n"
+	    "Stream sensor samples via UDP to sensorstream-receiver on a host.\n"
+	    "Without arguments, show the statistics.\n"
+	    "  -p: UDP port (default: 5300)\n"
+	    "  -b: Samples per datagram (max: 90)\n"
+	    "  -f: Flush interval in ms\n"
+	    "  -r: Generate a test signal with rate samples/s\n"
+	    "Defaults come from the [sensors] section of the profile.\n",
+	.topic = "net",
+	.command = command_sensorstream,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
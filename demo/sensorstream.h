@@ -0,0 +1,83 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DEMO_SENSORSTREAM_H
+#define DEMO_SENSORSTREAM_H
+
+#include <rtems.h>
+#include <rtems/shell.h>
+
+#include "sensorstream-proto.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+struct sensorstream_config {
+	/* IPv4 address of the receiver */
+	const char *host;
+	uint16_t port;
+	/* Samples per datagram, at most SENSORSTREAM_MAX_BATCH */
+	unsigned batch;
+	/* Send an incomplete datagram after this time */
+	unsigned flush_ms;
+};
+
+struct sensorstream_stats {
+	uint64_t pushed;
+	uint64_t dropped;
+	uint64_t sent_samples;
+	uint64_t sent_datagrams;
+	uint64_t send_errors;
+	uint32_t max_fill;
+};
+
+/*
+ * Start the sender task. Samples pushed before are discarded. Returns
+ * RTEMS_RESOURCE_IN_USE if the stream is already running.
+ */
+rtems_status_code sensorstream_start(const struct sensorstream_config *config);
+
+/* Stop the sender task after the queued samples have been sent. */
+void sensorstream_stop(void);
+
+/*
+ * Queue a sample with the current time. The queue is lock-free for a single
+ * producer, so there must be only one task or interrupt that pushes at a time.
+ * Returns false if the queue was full and the sample has been dropped.
+ */
+bool sensorstream_push(uint32_t channel, int32_t value);
+
+void sensorstream_get_stats(struct sensorstream_stats *stats);
+
+extern rtems_shell_cmd_t shell_SENSORSTREAM_Command;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DEMO_SENSORSTREAM_H */
@@ -0,0 +1,350 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "tasktop.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/timestampimpl.h>
+
+#define TASKTOP_MAX_TASKS	128
+#define TASKTOP_MAX_INDEX	256
+#define TASKTOP_STACK_PATTERN	0xa5a5a5a5u
+
+/* Longer intervals overflow the conversion to clock ticks */
+#define TASKTOP_MAX_INTERVAL_MS	3600000ul
+
+/* Suggested stack: high-water mark plus a quarter, rounded up to 1 KiB */
+#define TASKTOP_STACK_ROUND	1024u
+
+struct tasktop_sample {
+	rtems_id id;
+	char name[16];
+	uint64_t cpu_ns;
+	uint32_t switches;
+	size_t stack_size;
+	size_t stack_used;
+	uint64_t cpu_delta_ns;
+	uint32_t switch_delta;
+};
+
+struct tasktop_snapshot {
+	size_t count;
+	uint64_t uptime_ns;
+	struct tasktop_sample tasks[TASKTOP_MAX_TASKS];
+};
+
+/*
+ * Indexed by API and object index of the heir. Updated in the switch
+ * extension with interrupts disabled, so a plain increment is enough.
+ */
+static uint32_t tasktop_switches[4][TASKTOP_MAX_INDEX];
+
+static uint32_t *
+tasktop_switch_counter(rtems_id id)
+{
+	uint32_t api = (uint32_t)rtems_object_id_get_api(id) & 0x3;
+	uint32_t index = rtems_object_id_get_index(id);
+
+	if (index >= TASKTOP_MAX_INDEX) {
+		return NULL;
+	}
+	return &tasktop_switches[api][index];
+}
+
+/* Fill with the pattern that tasktop_stack_used() looks for */
+static void
+tasktop_stack_fill(const Stack_Control *stack)
+{
+	uint32_t *p = stack->area;
+	uint32_t *end = (uint32_t *)((char *)p + stack->size);
+
+	while (p < end) {
+		*p = TASKTOP_STACK_PATTERN;
+		++p;
+	}
+}
+
+bool
+tasktop_thread_create(rtems_tcb *executing, rtems_tcb *created)
+{
+	uint32_t *counter = tasktop_switch_counter(created->Object.id);
+
+	(void)executing;
+
+	if (counter != NULL) {
+		*counter = 0;
+	}
+	tasktop_stack_fill(&created->Start.Initial_stack);
+
+	return true;
+}
+
+void
+tasktop_thread_switch(rtems_tcb *executing, rtems_tcb *heir)
+{
+	uint32_t *counter = tasktop_switch_counter(heir->Object.id);
+
+	(void)executing;
+
+	if (counter != NULL) {
+		++(*counter);
+	}
+}
+
+/* The stack grows down, so untouched pattern words are at the low end. */
+static size_t
+tasktop_stack_used(const rtems_tcb *tcb)
+{
+	const uint32_t *begin = tcb->Start.Initial_stack.area;
+	const uint32_t *end = (const uint32_t *)
+	    ((const char *)begin + tcb->Start.Initial_stack.size);
+	const uint32_t *p = begin;
+
+	while (p < end && *p == TASKTOP_STACK_PATTERN) {
+		++p;
+	}
+
+	return (size_t)((const char *)end - (const char *)p);
+}
+
+static bool
+tasktop_visitor(rtems_tcb *tcb, void *arg)
+{
+	struct tasktop_snapshot *snapshot = arg;
+	struct tasktop_sample *sample;
+	Timestamp_Control cpu;
+	uint32_t *counter;
+
+	if (snapshot->count >= TASKTOP_MAX_TASKS) {
+		return true;
+	}
+
+	sample = &snapshot->tasks[snapshot->count];
+	++snapshot->count;
+
+	sample->id = tcb->Object.id;
+	rtems_object_get_name(sample->id, sizeof(sample->name), sample->name);
+	_Thread_Get_CPU_time_used(tcb, &cpu);
+	sample->cpu_ns = _Timestamp_Get_as_nanoseconds(&cpu);
+	counter = tasktop_switch_counter(sample->id);
+	sample->switches = counter != NULL ? *counter : 0;
+	sample->stack_size = tcb->Start.Initial_stack.size;
+	sample->stack_used = tasktop_stack_used(tcb);
+
+	return false;
+}
+
+static void
+tasktop_take(struct tasktop_snapshot *snapshot)
+{
+	snapshot->count = 0;
+	snapshot->uptime_ns = rtems_clock_get_uptime_nanoseconds();
+	rtems_task_iterate(tasktop_visitor, snapshot);
+}
+
+static int
+tasktop_compare_cpu(const void *a, const void *b)
+{
+	const struct tasktop_sample *sa = a;
+	const struct tasktop_sample *sb = b;
+
+	if (sa->cpu_delta_ns != sb->cpu_delta_ns) {
+		return sa->cpu_delta_ns < sb->cpu_delta_ns ? 1 : -1;
+	}
+	return sa->id < sb->id ? -1 : sa->id > sb->id;
+}
+
+/* Fill in the deltas of now relative to before. New tasks count from zero. */
+static void
+tasktop_delta(const struct tasktop_snapshot *before,
+    struct tasktop_snapshot *now)
+{
+	size_t i;
+
+	for (i = 0; i < now->count; ++i) {
+		struct tasktop_sample *sample = &now->tasks[i];
+		size_t j;
+
+		sample->cpu_delta_ns = sample->cpu_ns;
+		sample->switch_delta = sample->switches;
+		for (j = 0; j < before->count; ++j) {
+			if (before->tasks[j].id == sample->id) {
+				sample->cpu_delta_ns -= before->tasks[j].cpu_ns;
+				sample->switch_delta -=
+				    before->tasks[j].switches;
+				break;
+			}
+		}
+	}
+
+	qsort(now->tasks, now->count, sizeof(now->tasks[0]),
+	    tasktop_compare_cpu);
+}
+
+static void
+tasktop_print(const struct tasktop_snapshot *before,
+    const struct tasktop_snapshot *now)
+{
+	uint64_t total = (now->uptime_ns - before->uptime_ns) *
+	    rtems_scheduler_get_processor_maximum();
+	size_t i;
+
+	printf("\n    ID     | NAME             |  CPU %% | SWITCHES |"
+	    "  STACK | USED      \n");
+	for (i = 0; i < now->count; ++i) {
+		const struct tasktop_sample *s = &now->tasks[i];
+		uint64_t permille = total > 0 ?
+		    (s->cpu_delta_ns * 1000 + total / 2) / total : 0;
+
+		printf(" 0x%08" PRIx32 " | %-16s | %3" PRIu64 ".%" PRIu64
+		    " | %8" PRIu32 " | %6zu | %6zu %3zu%%\n",
+		    s->id, s->name, permille / 10, permille % 10,
+		    s->switch_delta, s->stack_size, s->stack_used,
+		    s->stack_size > 0 ? s->stack_used * 100 / s->stack_size : 0);
+	}
+}
+
+static size_t
+tasktop_suggest(size_t used)
+{
+	size_t suggestion = used + used / 4;
+
+	suggestion = RTEMS_ALIGN_UP(suggestion, TASKTOP_STACK_ROUND);
+	if (suggestion < RTEMS_MINIMUM_STACK_SIZE) {
+		suggestion = RTEMS_MINIMUM_STACK_SIZE;
+	}
+
+	return suggestion;
+}
+
+static void
+tasktop_print_suggestions(const struct tasktop_snapshot *now)
+{
+	size_t total_size = 0;
+	size_t total_suggested = 0;
+	size_t i;
+
+	printf("\n    ID     | NAME             |  STACK |   USED | SUGGESTED\n");
+	for (i = 0; i < now->count; ++i) {
+		const struct tasktop_sample *s = &now->tasks[i];
+		size_t suggestion = tasktop_suggest(s->stack_used);
+
+		printf(" 0x%08" PRIx32 " | %-16s | %6zu | %6zu | %6zu%s\n",
+		    s->id, s->name, s->stack_size, s->stack_used, suggestion,
+		    suggestion > s->stack_size ? " (!)" : "");
+		total_size += s->stack_size;
+		total_suggested += suggestion;
+	}
+	printf("\nTotal stack: %zu bytes, suggested: %zu bytes\n"
+	    "The high-water marks only cover the code paths executed so far.\n"
+	    "Exercise the application before using the suggested values.\n",
+	    total_size, total_suggested);
+}
+
+/* A positive number without trailing garbage */
+static bool
+tasktop_parse_number(const char *s, unsigned long max, unsigned long *value)
+{
+	char *end;
+
+	*value = strtoul(s, &end, 0);
+	return end != s && *end == '\0' && *value != 0 && *value <= max;
+}
+
+static int
+command_tasktop(int argc, char *argv[])
+{
+	static struct tasktop_snapshot snapshots[2];
+	unsigned long interval_ms = 1000;
+	unsigned long count = 1;
+	bool suggest = false;
+	unsigned long i;
+	int arg;
+
+	for (arg = 1; arg < argc; ++arg) {
+		if (strcmp(argv[arg], "-s") == 0) {
+			suggest = true;
+		} else if (strcmp(argv[arg], "-i") == 0 && arg + 1 < argc) {
+			++arg;
+			if (!tasktop_parse_number(argv[arg],
+			    TASKTOP_MAX_INTERVAL_MS, &interval_ms)) {
+				puts(shell_TASKTOP_Command.usage);
+				return -1;
+			}
+		} else if (strcmp(argv[arg], "-n") == 0 && arg + 1 < argc) {
+			++arg;
+			if (!tasktop_parse_number(argv[arg], UINT32_MAX,
+			    &count)) {
+				puts(shell_TASKTOP_Command.usage);
+				return -1;
+			}
+		} else {
+			puts(shell_TASKTOP_Command.usage);
+			return -1;
+		}
+	}
+	if (suggest) {
+		tasktop_take(&snapshots[0]);
+		tasktop_print_suggestions(&snapshots[0]);
+		return 0;
+	}
+
+	tasktop_take(&snapshots[0]);
+	for (i = 0; i < count; ++i) {
+		struct tasktop_snapshot *before = &snapshots[i % 2];
+		struct tasktop_snapshot *now = &snapshots[(i + 1) % 2];
+
+		rtems_task_wake_after(RTEMS_MILLISECONDS_TO_TICKS(interval_ms));
+		tasktop_take(now);
+		tasktop_delta(before, now);
+		tasktop_print(before, now);
+	}
+
+	return 0;
+}
+
+rtems_shell_cmd_t shell_TASKTOP_Command = {
+	.name = "tasktop",
+	.usage = "Use with: tasktop [-i <ms>] [-n <count>] [-s]\n"
+	    "Show CPU usage, context switches and stack high-water mark of all\n"
+	    "tasks, including the libbsd threads.\n"
+	    "  -i: Sample interval in milliseconds (default: 1000)\n"
+	    "  -n: Number of samples (default: 1)\n"
+	    "  -s: Suggest stack sizes from the high-water marks\n",
+	.topic = "rtems",
+	.command = command_tasktop,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
@@ -0,0 +1,563 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "tracing.h"
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/record.h>
+#include <rtems/recordserver.h>
+#include <rtems/thread.h>
+
+#include <bsp.h>
+#include <bsp/irq.h>
+#include <bsp/irq-generic.h>
+#ifdef LIBBSP_ARM_ATSAM_BSP_H
+#include <rtems/score/armv7m.h>
+#else /* LIBBSP_ARM_ATSAM_BSP_H */
+#include <dev/irq/arm-gic.h>
+#endif /* LIBBSP_ARM_ATSAM_BSP_H */
+
+#define TRACING_SERVER_PRIO	10
+#define TRACING_SERVER_PERIOD	10
+#define TRACING_MAX_VECTOR_HANDLERS	8
+#define TRACING_NAME_ITEMS	4
+
+struct tracing_irq_handler {
+	const char *info;
+	rtems_option options;
+	rtems_interrupt_handler handler;
+	void *arg;
+};
+
+struct tracing_irq_collector {
+	size_t count;
+	bool skip;
+	struct tracing_irq_handler handler[TRACING_MAX_VECTOR_HANDLERS];
+};
+
+static struct {
+	rtems_mutex mutex;
+	uint32_t classes;
+	rtems_id switch_ext;
+	rtems_id thread_ext;
+	uint16_t server_port;
+	size_t irq_count;
+} tracing = {
+	.mutex = RTEMS_MUTEX_INITIALIZER("tracing"),
+};
+
+static const rtems_extensions_table tracing_switch_table = {
+	.thread_switch = _Record_Thread_switch,
+};
+
+static void
+tracing_thread_name(rtems_tcb *tcb)
+{
+	char name[TRACING_NAME_ITEMS * sizeof(rtems_record_data)];
+	rtems_record_data data;
+	size_t len;
+	size_t i;
+
+	memset(name, 0, sizeof(name));
+	rtems_object_get_name(tcb->Object.id, sizeof(name), name);
+	len = strlen(name);
+
+	/* Same encoding as used by the RTEMS record server */
+	rtems_record_produce(RTEMS_RECORD_THREAD_ID, tcb->Object.id);
+	for (i = 0; i < len; i += sizeof(data)) {
+		size_t j;
+
+		data = 0;
+		for (j = 0; j < sizeof(data); ++j) {
+			data |= (rtems_record_data)(uint8_t)name[i + j] << (8 * j);
+		}
+		rtems_record_produce(RTEMS_RECORD_THREAD_NAME, data);
+	}
+}
+
+static bool
+tracing_thread_create(rtems_tcb *executing, rtems_tcb *created)
+{
+	bool ok;
+
+	ok = _Record_Thread_create(executing, created);
+	tracing_thread_name(created);
+
+	return ok;
+}
+
+static const rtems_extensions_table tracing_thread_table = {
+	.thread_create = tracing_thread_create,
+	.thread_start = _Record_Thread_start,
+	.thread_restart = _Record_Thread_restart,
+	.thread_delete = _Record_Thread_delete,
+	.thread_begin = _Record_Thread_begin,
+	.thread_exitted = _Record_Thread_exitted,
+	.thread_terminate = _Record_Thread_terminate,
+};
+
+static bool
+tracing_name_visitor(rtems_tcb *tcb, void *arg)
+{
+	(void)arg;
+	tracing_thread_name(tcb);
+	return false;
+}
+
+static void
+tracing_irq_entry(void *arg)
+{
+	rtems_record_produce(RTEMS_RECORD_INTERRUPT_ENTRY,
+	    (rtems_record_data)(uintptr_t)arg);
+}
+
+static void
+tracing_irq_exit(void *arg)
+{
+	rtems_record_produce(RTEMS_RECORD_INTERRUPT_EXIT,
+	    (rtems_record_data)(uintptr_t)arg);
+}
+
+static void
+tracing_irq_collect(void *arg, const char *info, rtems_option options,
+    rtems_interrupt_handler handler, void *handler_arg)
+{
+	struct tracing_irq_collector *c = arg;
+	struct tracing_irq_handler *h;
+
+	/* A vector that can't be restored completely isn't touched */
+	if ((options & RTEMS_INTERRUPT_UNIQUE) != 0 ||
+	    c->count >= TRACING_MAX_VECTOR_HANDLERS) {
+		c->skip = true;
+		return;
+	}
+	h = &c->handler[c->count];
+	h->info = info;
+	h->options = options;
+	h->handler = handler;
+	h->arg = handler_arg;
+	++c->count;
+}
+
+/* RTEMS 5 has no generic way to ask for this */
+static bool
+tracing_irq_vector_is_enabled(rtems_vector_number vector)
+{
+#ifdef LIBBSP_ARM_ATSAM_BSP_H
+	return _ARMV7M_NVIC_Is_enabled((int)vector);
+#else /* LIBBSP_ARM_ATSAM_BSP_H */
+	return gic_id_is_enabled(ARM_GIC_DIST, vector);
+#endif /* LIBBSP_ARM_ATSAM_BSP_H */
+}
+
+static void
+tracing_irq_unbracket(rtems_vector_number vector)
+{
+	void *arg = (void *)(uintptr_t)vector;
+
+	(void)rtems_interrupt_handler_remove(vector, tracing_irq_exit, arg);
+	(void)rtems_interrupt_handler_remove(vector, tracing_irq_entry, arg);
+}
+
+/*
+ * Put the entry handler in front of and the exit handler behind the handlers
+ * of the drivers. These stay installed with their own handler and argument,
+ * so a driver can remove them at any time. Shared handlers are called in the
+ * order of installation, hence the handlers of the drivers are installed
+ * again behind the entry handler. The entry handler keeps the vector from
+ * getting empty meanwhile, which would change its enable state. The vector is
+ * masked so that a level triggered interrupt doesn't fire while its handler
+ * is missing, and only enabled again if it was enabled before.
+ */
+static rtems_status_code
+tracing_irq_bracket(rtems_vector_number vector,
+    const struct tracing_irq_collector *c)
+{
+	void *arg = (void *)(uintptr_t)vector;
+	rtems_status_code sc;
+	bool enabled;
+	size_t i;
+
+	enabled = tracing_irq_vector_is_enabled(vector);
+	if (enabled) {
+		bsp_interrupt_vector_disable(vector);
+	}
+
+	sc = rtems_interrupt_handler_install(vector, "record entry",
+	    RTEMS_INTERRUPT_SHARED, tracing_irq_entry, arg);
+	for (i = 0; sc == RTEMS_SUCCESSFUL && i < c->count; ++i) {
+		const struct tracing_irq_handler *h = &c->handler[i];
+
+		sc = rtems_interrupt_handler_remove(vector, h->handler,
+		    h->arg);
+		if (sc == RTEMS_SUCCESSFUL) {
+			sc = rtems_interrupt_handler_install(vector, h->info,
+			    h->options, h->handler, h->arg);
+		}
+	}
+	if (sc == RTEMS_SUCCESSFUL) {
+		sc = rtems_interrupt_handler_install(vector, "record exit",
+		    RTEMS_INTERRUPT_SHARED, tracing_irq_exit, arg);
+	}
+	if (sc != RTEMS_SUCCESSFUL) {
+		tracing_irq_unbracket(vector);
+	}
+
+	if (enabled) {
+		bsp_interrupt_vector_enable(vector);
+	}
+
+	return sc;
+}
+
+static void
+tracing_irq_enable(void)
+{
+	rtems_vector_number vector;
+
+	tracing.irq_count = 0;
+	for (vector = BSP_INTERRUPT_VECTOR_MIN;
+	    vector <= BSP_INTERRUPT_VECTOR_MAX; ++vector) {
+		struct tracing_irq_collector c = {
+			.count = 0,
+		};
+
+		/* Handlers can't be changed during the iteration */
+		(void)rtems_interrupt_handler_iterate(vector,
+		    tracing_irq_collect, &c);
+		if (c.count != 0 && !c.skip &&
+		    tracing_irq_bracket(vector, &c) == RTEMS_SUCCESSFUL) {
+			++tracing.irq_count;
+		}
+	}
+}
+
+static void
+tracing_irq_disable(void)
+{
+	rtems_vector_number vector;
+
+	/*
+	 * The handlers of the drivers aren't touched. If a driver removed its
+	 * handlers meanwhile, the vector gets disabled with the last one.
+	 */
+	for (vector = BSP_INTERRUPT_VECTOR_MIN;
+	    vector <= BSP_INTERRUPT_VECTOR_MAX; ++vector) {
+		tracing_irq_unbracket(vector);
+	}
+	tracing.irq_count = 0;
+}
+
+static rtems_status_code
+tracing_extension_enable(rtems_id *id, rtems_name name,
+    const rtems_extensions_table *table)
+{
+	if (*id != 0) {
+		return RTEMS_SUCCESSFUL;
+	}
+	return rtems_extension_create(name, table, id);
+}
+
+static void
+tracing_extension_disable(rtems_id *id)
+{
+	if (*id != 0) {
+		(void)rtems_extension_delete(*id);
+		*id = 0;
+	}
+}
+
+rtems_status_code
+tracing_start(uint32_t classes)
+{
+	rtems_status_code sc = RTEMS_SUCCESSFUL;
+
+	rtems_mutex_lock(&tracing.mutex);
+
+	if ((classes & (TRACING_CLASS_SWITCH | TRACING_CLASS_THREAD)) != 0 &&
+	    (tracing.classes &
+	    (TRACING_CLASS_SWITCH | TRACING_CLASS_THREAD)) == 0) {
+		/* Let the trace viewer know the names of existing threads */
+		rtems_task_iterate(tracing_name_visitor, NULL);
+	}
+
+	if ((classes & TRACING_CLASS_SWITCH) != 0) {
+		sc = tracing_extension_enable(&tracing.switch_ext,
+		    rtems_build_name('R', 'S', 'W', 'I'),
+		    &tracing_switch_table);
+	} else {
+		tracing_extension_disable(&tracing.switch_ext);
+	}
+
+	if (sc == RTEMS_SUCCESSFUL && (classes & TRACING_CLASS_THREAD) != 0) {
+		sc = tracing_extension_enable(&tracing.thread_ext,
+		    rtems_build_name('R', 'T', 'H', 'R'),
+		    &tracing_thread_table);
+	} else {
+		tracing_extension_disable(&tracing.thread_ext);
+	}
+
+	if (sc == RTEMS_SUCCESSFUL && (classes & TRACING_CLASS_IRQ) != 0) {
+		if ((tracing.classes & TRACING_CLASS_IRQ) == 0) {
+			tracing_irq_enable();
+		}
+	} else if ((tracing.classes & TRACING_CLASS_IRQ) != 0) {
+		tracing_irq_disable();
+	}
+
+	tracing.classes = 0;
+	if (tracing.switch_ext != 0) {
+		tracing.classes |= TRACING_CLASS_SWITCH;
+	}
+	if (tracing.thread_ext != 0) {
+		tracing.classes |= TRACING_CLASS_THREAD;
+	}
+	if (tracing.irq_count != 0) {
+		tracing.classes |= TRACING_CLASS_IRQ;
+	}
+
+	rtems_mutex_unlock(&tracing.mutex);
+
+	rtems_record_line();
+
+	return sc;
+}
+
+void
+tracing_stop(void)
+{
+	(void)tracing_start(0);
+}
+
+uint32_t
+tracing_get_classes(void)
+{
+	return tracing.classes;
+}
+
+rtems_status_code
+tracing_start_server(uint16_t port)
+{
+	rtems_status_code sc = RTEMS_SUCCESSFUL;
+
+	rtems_mutex_lock(&tracing.mutex);
+	if (tracing.server_port == 0) {
+		sc = rtems_record_start_server(TRACING_SERVER_PRIO, port,
+		    TRACING_SERVER_PERIOD);
+		if (sc == RTEMS_SUCCESSFUL) {
+			tracing.server_port = port;
+		}
+	} else if (tracing.server_port != port) {
+		sc = RTEMS_RESOURCE_IN_USE;
+	}
+	rtems_mutex_unlock(&tracing.mutex);
+
+	return sc;
+}
+
+static void
+tracing_dump_chunk(void *arg, const void *data, size_t length)
+{
+	FILE *file = arg;
+
+	(void)fwrite(data, 1, length, file);
+}
+
+int
+tracing_dump(const char *path)
+{
+	FILE *file;
+	int rv;
+
+	file = fopen(path, "wb");
+	if (file == NULL) {
+		return -1;
+	}
+
+	rtems_record_dump(tracing_dump_chunk, file);
+
+	rv = ferror(file) ? -1 : 0;
+	if (fclose(file) != 0) {
+		rv = -1;
+	}
+
+	return rv;
+}
+
+static const struct {
+	const char *name;
+	uint32_t class;
+} tracing_class_names[] = {
+	{ "switch", TRACING_CLASS_SWITCH },
+	{ "thread", TRACING_CLASS_THREAD },
+	{ "irq", TRACING_CLASS_IRQ },
+	{ "all", TRACING_CLASS_ALL },
+};
+
+static int
+tracing_parse_classes(char *list, uint32_t *classes)
+{
+	char *saveptr;
+	char *token;
+
+	*classes = 0;
+	for (token = strtok_r(list, ",", &saveptr); token != NULL;
+	    token = strtok_r(NULL, ",", &saveptr)) {
+		size_t i;
+
+		for (i = 0; i < RTEMS_ARRAY_SIZE(tracing_class_names); ++i) {
+			if (strcmp(token, tracing_class_names[i].name) == 0) {
+				*classes |= tracing_class_names[i].class;
+				break;
+			}
+		}
+		if (i == RTEMS_ARRAY_SIZE(tracing_class_names)) {
+			printf("ERROR: Unknown event class '%s'\n", token);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static void
+tracing_print_status(void)
+{
+	uint32_t classes = tracing_get_classes();
+	size_t i;
+
+	printf("classes:");
+	if (classes == 0) {
+		printf(" none");
+	}
+	for (i = 0; i < RTEMS_ARRAY_SIZE(tracing_class_names); ++i) {
+		if (tracing_class_names[i].class != TRACING_CLASS_ALL &&
+		    (classes & tracing_class_names[i].class) != 0) {
+			printf(" %s", tracing_class_names[i].name);
+		}
+	}
+	printf("\n");
+	printf("traced interrupt vectors: %zu\n", tracing.irq_count);
+	if (tracing.server_port != 0) {
+		printf("server: port %" PRIu16 "\n", tracing.server_port);
+	} else {
+		printf("server: not started\n");
+	}
+}
+
+static int
+command_record(int argc, char *argv[])
+{
+	rtems_status_code sc;
+
+	if (argc < 2 || strcmp(argv[1], "status") == 0) {
+		tracing_print_status();
+		return 0;
+	}
+
+	if (strcmp(argv[1], "start") == 0) {
+		uint32_t classes = TRACING_CLASS_SWITCH;
+
+		if (argc == 4 && strcmp(argv[2], "-c") == 0) {
+			if (tracing_parse_classes(argv[3], &classes) != 0) {
+				return -1;
+			}
+		} else if (argc != 2) {
+			puts(shell_RECORD_Command.usage);
+			return -1;
+		}
+		sc = tracing_start(classes);
+		if (sc != RTEMS_SUCCESSFUL) {
+			printf("ERROR: Start failed: %s\n",
+			    rtems_status_text(sc));
+			return -1;
+		}
+	} else if (strcmp(argv[1], "stop") == 0 && argc == 2) {
+		tracing_stop();
+	} else if (strcmp(argv[1], "server") == 0 && argc <= 3) {
+		unsigned long port = TRACING_DEFAULT_PORT;
+
+		if (argc == 3) {
+			char *end;
+
+			port = strtoul(argv[2], &end, 0);
+			if (*end != '\0' || port == 0 || port > UINT16_MAX) {
+				printf("ERROR: Invalid port '%s'\n", argv[2]);
+				return -1;
+			}
+		}
+		sc = tracing_start_server((uint16_t)port);
+		if (sc != RTEMS_SUCCESSFUL) {
+			printf("ERROR: Server start failed: %s\n",
+			    rtems_status_text(sc));
+			return -1;
+		}
+	} else if (strcmp(argv[1], "dump") == 0 && argc == 3) {
+		if (tracing_dump(argv[2]) != 0) {
+			printf("ERROR: Dump to %s failed: %s\n", argv[2],
+			    strerror(errno));
+			return -1;
+		}
+	} else {
+		puts(shell_RECORD_Command.usage);
+		return -1;
+	}
+
+	tracing_print_status();
+
+	return 0;
+}
+
+rtems_shell_cmd_t shell_RECORD_Command = {
+	.name = "record",
+	.usage = "Use with: record [status]\n"
+	    "           record start [-c <class>[,<class>...]]\n"
+	    "           record stop\n"
+	    "           record server [<port>]\n"
+	    "           record dump <file>\n"
+	    "Control the event recording at run time.\n"
+	    "  start:  Record the given classes (default: switch). Classes are\n"
+	    "          switch, thread, irq and all. Interrupts of vectors that\n"
+	    "          get their first handler while irq is enabled or that\n"
+	    "          have a unique handler are not traced.\n"
+	    "  server: Stream the events via TCP (default port: 1234).\n"
+	    "  dump:   Write the buffered events to a file, for example\n"
+	    "          'record dump /media/mmcsd-0-0/trace.rec'.\n"
+	    "Convert the stream or a dump with 'rtems-record-chrome'.\n",
+	.topic = "misc",
+	.command = command_record,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
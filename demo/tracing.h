@@ -0,0 +1,83 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DEMO_TRACING_H
+#define DEMO_TRACING_H
+
+#include <rtems.h>
+#include <rtems/shell.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Event classes that can be recorded. Scheduler and thread life cycle events
+ * are produced by user extensions which are only installed while the class is
+ * enabled. Interrupt events are produced by handlers that are installed in
+ * front of and behind the handlers of the drivers on each vector. The
+ * handlers of the drivers stay installed as they are, so drivers can remove
+ * them while TRACING_CLASS_IRQ is enabled. Vectors with a unique handler
+ * can't be traced. Events produced explicitly, for example with
+ * rtems_record_line(), are always recorded.
+ */
+#define TRACING_CLASS_SWITCH	(1u << 0)
+#define TRACING_CLASS_THREAD	(1u << 1)
+#define TRACING_CLASS_IRQ	(1u << 2)
+#define TRACING_CLASS_ALL \
+	(TRACING_CLASS_SWITCH | TRACING_CLASS_THREAD | TRACING_CLASS_IRQ)
+
+#define TRACING_DEFAULT_PORT	1234
+
+/*
+ * Enable exactly the given classes. Classes that are currently enabled but
+ * not part of the set are disabled.
+ */
+rtems_status_code tracing_start(uint32_t classes);
+
+/* Disable all event classes. */
+void tracing_stop(void);
+
+/* Return the currently enabled event classes. */
+uint32_t tracing_get_classes(void);
+
+/*
+ * Start the record server on the given TCP port. The server can't be stopped
+ * again, so starting it a second time only succeeds for the same port.
+ */
+rtems_status_code tracing_start_server(uint16_t port);
+
+/* Write the content of the record buffers in the record server format. */
+int tracing_dump(const char *path);
+
+extern rtems_shell_cmd_t shell_RECORD_Command;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DEMO_TRACING_H */
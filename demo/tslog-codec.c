@@ -0,0 +1,515 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "tslog-codec.h"
+
+static const uint32_t tslog_crc_table[16] = {
+	0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac,
+	0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+	0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+	0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c,
+};
+
+/* The usual CRC-32 (zlib) with a 16 entry table, which is small and fast enough */
+uint32_t
+tslog_crc32(uint32_t crc, const void *data, size_t len)
+{
+	const uint8_t *p = data;
+
+	crc = ~crc;
+	while (len > 0) {
+		crc = tslog_crc_table[(crc ^ *p) & 0xf] ^ (crc >> 4);
+		crc = tslog_crc_table[(crc ^ (*p >> 4)) & 0xf] ^ (crc >> 4);
+		++p;
+		--len;
+	}
+
+	return ~crc;
+}
+
+static void
+tslog_put_le(uint8_t *buf, uint64_t value, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; ++i) {
+		buf[i] = (uint8_t)(value >> (8 * i));
+	}
+}
+
+static uint64_t
+tslog_get_le(const uint8_t *buf, size_t len)
+{
+	uint64_t value = 0;
+	size_t i;
+
+	for (i = 0; i < len; ++i) {
+		value |= (uint64_t)buf[i] << (8 * i);
+	}
+
+	return value;
+}
+
+void
+tslog_header_pack(uint8_t buf[TSLOG_HEADER_SIZE],
+    const struct tslog_chunk_header *header)
+{
+	tslog_put_le(&buf[0], TSLOG_MAGIC, 4);
+	tslog_put_le(&buf[4], TSLOG_VERSION, 2);
+	tslog_put_le(&buf[6], TSLOG_HEADER_SIZE, 2);
+	tslog_put_le(&buf[8], header->chunk_size, 4);
+	tslog_put_le(&buf[12], header->payload_size, 4);
+	tslog_put_le(&buf[16], header->count, 4);
+	tslog_put_le(&buf[20], header->series, 4);
+	tslog_put_le(&buf[24], header->type, 4);
+	tslog_put_le(&buf[28], header->crc, 4);
+	tslog_put_le(&buf[32], (uint64_t)header->first_time, 8);
+	tslog_put_le(&buf[40], (uint64_t)header->last_time, 8);
+}
+
+bool
+tslog_header_unpack(struct tslog_chunk_header *header,
+    const uint8_t buf[TSLOG_HEADER_SIZE])
+{
+	if (tslog_get_le(&buf[0], 4) != TSLOG_MAGIC ||
+	    tslog_get_le(&buf[4], 2) != TSLOG_VERSION ||
+	    tslog_get_le(&buf[6], 2) != TSLOG_HEADER_SIZE) {
+		return false;
+	}
+
+	header->chunk_size = (uint32_t)tslog_get_le(&buf[8], 4);
+	header->payload_size = (uint32_t)tslog_get_le(&buf[12], 4);
+	header->count = (uint32_t)tslog_get_le(&buf[16], 4);
+	header->series = (uint32_t)tslog_get_le(&buf[20], 4);
+	header->type = (uint32_t)tslog_get_le(&buf[24], 4);
+	header->crc = (uint32_t)tslog_get_le(&buf[28], 4);
+	header->first_time = (int64_t)tslog_get_le(&buf[32], 8);
+	header->last_time = (int64_t)tslog_get_le(&buf[40], 8);
+
+	return header->chunk_size >= TSLOG_MIN_CHUNK_SIZE &&
+	    header->payload_size <= header->chunk_size - TSLOG_HEADER_SIZE;
+}
+
+bool
+tslog_chunk_check(const struct tslog_chunk_header *header,
+    const uint8_t *chunk)
+{
+	static const uint8_t zero[4];
+	uint32_t crc;
+
+	crc = tslog_crc32(0, chunk, 28);
+	crc = tslog_crc32(crc, zero, sizeof(zero));
+	crc = tslog_crc32(crc, chunk + 32,
+	    TSLOG_HEADER_SIZE - 32 + header->payload_size);
+
+	return crc == header->crc;
+}
+
+static void
+tslog_write_bits(struct tslog_encoder *enc, uint64_t value, unsigned count)
+{
+	while (count > 0) {
+		size_t byte = enc->bit / 8;
+		unsigned free_bits = 8 - (unsigned)(enc->bit % 8);
+		unsigned n = count < free_bits ? count : free_bits;
+		uint8_t bits = (uint8_t)((value >> (count - n)) &
+		    ((1u << n) - 1));
+
+		enc->buf[byte] |= (uint8_t)(bits << (free_bits - n));
+		enc->bit += n;
+		count -= n;
+	}
+}
+
+static bool
+tslog_read_bits(struct tslog_decoder *dec, unsigned count, uint64_t *value)
+{
+	uint64_t v = 0;
+
+	if (dec->bit + count > dec->size * 8) {
+		return false;
+	}
+
+	while (count > 0) {
+		size_t byte = dec->bit / 8;
+		unsigned avail = 8 - (unsigned)(dec->bit % 8);
+		unsigned n = count < avail ? count : avail;
+		uint8_t bits = (uint8_t)(dec->buf[byte] >> (avail - n)) &
+		    (uint8_t)((1u << n) - 1);
+
+		v = (v << n) | bits;
+		dec->bit += n;
+		count -= n;
+	}
+	*value = v;
+
+	return true;
+}
+
+static int64_t
+tslog_sign_extend(uint64_t value, unsigned bits)
+{
+	uint64_t sign = (uint64_t)1 << (bits - 1);
+
+	return (int64_t)((value ^ sign) - sign);
+}
+
+static uint64_t
+tslog_zigzag(int64_t value)
+{
+	return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static int64_t
+tslog_unzigzag(uint64_t value)
+{
+	return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+static void
+tslog_write_varint(struct tslog_encoder *enc, uint64_t value)
+{
+	while (value >= 0x80) {
+		tslog_write_bits(enc, (value & 0x7f) | 0x80, 8);
+		value >>= 7;
+	}
+	tslog_write_bits(enc, value, 8);
+}
+
+static bool
+tslog_read_varint(struct tslog_decoder *dec, uint64_t *value)
+{
+	uint64_t v = 0;
+	unsigned shift;
+
+	for (shift = 0; shift < 70; shift += 7) {
+		uint64_t byte;
+
+		if (!tslog_read_bits(dec, 8, &byte)) {
+			return false;
+		}
+		v |= (byte & 0x7f) << shift;
+		if ((byte & 0x80) == 0) {
+			*value = v;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Prefix, number of value bits and range of the delta-of-delta classes */
+static const struct {
+	uint8_t prefix;
+	uint8_t prefix_bits;
+	uint8_t value_bits;
+} tslog_dod_classes[] = {
+	{ 0x2, 2, 7 },
+	{ 0x6, 3, 9 },
+	{ 0xe, 4, 12 },
+	{ 0xf, 4, 64 },
+};
+
+/*
+ * The differences are calculated modulo 2^64, so that arbitrary timestamps
+ * don't overflow a signed type. The decoder wraps the same way.
+ */
+static void
+tslog_encode_time(struct tslog_encoder *enc, int64_t time)
+{
+	int64_t delta = (int64_t)((uint64_t)time - (uint64_t)enc->prev_time);
+	int64_t dod = (int64_t)((uint64_t)delta - (uint64_t)enc->prev_delta);
+	size_t i;
+
+	if (dod == 0) {
+		tslog_write_bits(enc, 0, 1);
+	} else {
+		for (i = 0; i < sizeof(tslog_dod_classes) /
+		    sizeof(tslog_dod_classes[0]) - 1; ++i) {
+			int64_t limit = (int64_t)1 <<
+			    (tslog_dod_classes[i].value_bits - 1);
+
+			if (dod >= -limit && dod < limit) {
+				break;
+			}
+		}
+		tslog_write_bits(enc, tslog_dod_classes[i].prefix,
+		    tslog_dod_classes[i].prefix_bits);
+		tslog_write_bits(enc, (uint64_t)dod,
+		    tslog_dod_classes[i].value_bits);
+	}
+
+	enc->prev_delta = delta;
+	enc->prev_time = time;
+}
+
+static bool
+tslog_decode_time(struct tslog_decoder *dec, int64_t *time)
+{
+	uint64_t bit;
+	uint64_t raw;
+	int64_t dod = 0;
+	size_t i;
+
+	if (!tslog_read_bits(dec, 1, &bit)) {
+		return false;
+	}
+	if (bit != 0) {
+		/* Count the ones of the prefix, at most three more */
+		for (i = 0; i < 3; ++i) {
+			if (!tslog_read_bits(dec, 1, &bit)) {
+				return false;
+			}
+			if (bit == 0) {
+				break;
+			}
+		}
+		if (!tslog_read_bits(dec, tslog_dod_classes[i].value_bits,
+		    &raw)) {
+			return false;
+		}
+		dod = tslog_sign_extend(raw, tslog_dod_classes[i].value_bits);
+	}
+
+	dec->prev_delta = (int64_t)((uint64_t)dec->prev_delta + (uint64_t)dod);
+	dec->prev_time = (int64_t)((uint64_t)dec->prev_time +
+	    (uint64_t)dec->prev_delta);
+	*time = dec->prev_time;
+
+	return true;
+}
+
+static unsigned
+tslog_clz64(uint64_t value)
+{
+	return value == 0 ? 64 : (unsigned)__builtin_clzll(value);
+}
+
+static unsigned
+tslog_ctz64(uint64_t value)
+{
+	return value == 0 ? 64 : (unsigned)__builtin_ctzll(value);
+}
+
+static void
+tslog_encode_double(struct tslog_encoder *enc, uint64_t value)
+{
+	uint64_t xor = value ^ enc->prev_value;
+	unsigned leading;
+	unsigned trailing;
+	unsigned meaningful;
+
+	enc->prev_value = value;
+
+	if (xor == 0) {
+		tslog_write_bits(enc, 0, 1);
+		return;
+	}
+
+	leading = tslog_clz64(xor);
+	trailing = tslog_ctz64(xor);
+	if (leading > 31) {
+		leading = 31;
+	}
+
+	tslog_write_bits(enc, 1, 1);
+	if (leading >= enc->prev_leading &&
+	    trailing >= enc->prev_trailing) {
+		/* Fits into the window of the previous value */
+		meaningful = 64 - enc->prev_leading - enc->prev_trailing;
+		tslog_write_bits(enc, 0, 1);
+		tslog_write_bits(enc, xor >> enc->prev_trailing, meaningful);
+	} else {
+		meaningful = 64 - leading - trailing;
+		tslog_write_bits(enc, 1, 1);
+		tslog_write_bits(enc, leading, 5);
+		/* 64 meaningful bits are stored as 0 */
+		tslog_write_bits(enc, meaningful & 0x3f, 6);
+		tslog_write_bits(enc, xor >> trailing, meaningful);
+		enc->prev_leading = leading;
+		enc->prev_trailing = trailing;
+	}
+}
+
+static bool
+tslog_decode_double(struct tslog_decoder *dec, uint64_t *value)
+{
+	uint64_t bit;
+	uint64_t raw;
+	unsigned meaningful;
+
+	if (!tslog_read_bits(dec, 1, &bit)) {
+		return false;
+	}
+	if (bit == 0) {
+		*value = dec->prev_value;
+		return true;
+	}
+
+	if (!tslog_read_bits(dec, 1, &bit)) {
+		return false;
+	}
+	if (bit != 0) {
+		if (!tslog_read_bits(dec, 5, &raw)) {
+			return false;
+		}
+		dec->prev_leading = (unsigned)raw;
+		if (!tslog_read_bits(dec, 6, &raw)) {
+			return false;
+		}
+		meaningful = raw == 0 ? 64 : (unsigned)raw;
+		if (dec->prev_leading + meaningful > 64) {
+			return false;
+		}
+		dec->prev_trailing = 64 - dec->prev_leading - meaningful;
+	}
+
+	meaningful = 64 - dec->prev_leading - dec->prev_trailing;
+	if (!tslog_read_bits(dec, meaningful, &raw)) {
+		return false;
+	}
+	dec->prev_value ^= raw << dec->prev_trailing;
+	*value = dec->prev_value;
+
+	return true;
+}
+
+void
+tslog_encoder_init(struct tslog_encoder *enc, uint8_t *buf, size_t size,
+    enum tslog_type type)
+{
+	memset(enc, 0, sizeof(*enc));
+	memset(buf, 0, size);
+	enc->buf = buf;
+	enc->size = size;
+	enc->type = type;
+	/* No window of meaningful bits yet */
+	enc->prev_leading = 64;
+}
+
+bool
+tslog_encoder_append(struct tslog_encoder *enc, int64_t time, uint64_t value)
+{
+	if (enc->bit + TSLOG_MAX_SAMPLE_BITS > enc->size * 8) {
+		return false;
+	}
+
+	if (enc->count == 0) {
+		/* The first timestamp is in the header */
+		enc->first_time = time;
+		enc->prev_time = time;
+		enc->prev_delta = 0;
+		if (enc->type == TSLOG_TYPE_DOUBLE) {
+			tslog_write_bits(enc, value, 64);
+		}
+	} else {
+		tslog_encode_time(enc, time);
+		if (enc->type == TSLOG_TYPE_DOUBLE) {
+			tslog_encode_double(enc, value);
+		}
+	}
+
+	if (enc->type == TSLOG_TYPE_INT) {
+		tslog_write_varint(enc, tslog_zigzag(
+		    (int64_t)(value - enc->prev_value)));
+	}
+	enc->prev_value = value;
+	++enc->count;
+
+	return true;
+}
+
+size_t
+tslog_encoder_size(const struct tslog_encoder *enc)
+{
+	return (enc->bit + 7) / 8;
+}
+
+void
+tslog_encoder_header(const struct tslog_encoder *enc,
+    struct tslog_chunk_header *header)
+{
+	header->payload_size = (uint32_t)tslog_encoder_size(enc);
+	header->count = enc->count;
+	header->type = enc->type;
+	header->first_time = enc->first_time;
+	header->last_time = enc->prev_time;
+}
+
+void
+tslog_decoder_init(struct tslog_decoder *dec,
+    const struct tslog_chunk_header *header, const uint8_t *payload)
+{
+	memset(dec, 0, sizeof(*dec));
+	dec->buf = payload;
+	dec->size = header->payload_size;
+	dec->type = (enum tslog_type)header->type;
+	dec->remaining = header->count;
+	dec->prev_time = header->first_time;
+}
+
+bool
+tslog_decoder_next(struct tslog_decoder *dec, int64_t *time,
+    uint64_t *value)
+{
+	uint64_t raw;
+
+	if (dec->remaining == 0) {
+		return false;
+	}
+
+	if (dec->index == 0) {
+		*time = dec->prev_time;
+		if (dec->type == TSLOG_TYPE_DOUBLE) {
+			if (!tslog_read_bits(dec, 64, &raw)) {
+				return false;
+			}
+			dec->prev_value = raw;
+		}
+	} else {
+		if (!tslog_decode_time(dec, time)) {
+			return false;
+		}
+		if (dec->type == TSLOG_TYPE_DOUBLE &&
+		    !tslog_decode_double(dec, &dec->prev_value)) {
+			return false;
+		}
+	}
+
+	if (dec->type == TSLOG_TYPE_INT) {
+		if (!tslog_read_varint(dec, &raw)) {
+			return false;
+		}
+		dec->prev_value += (uint64_t)tslog_unzigzag(raw);
+	}
+
+	*value = dec->prev_value;
+	++dec->index;
+	--dec->remaining;
+
+	return true;
+}
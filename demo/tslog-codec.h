@@ -0,0 +1,178 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Encoding of the chunked time series format. This code is shared with the
+ * host tools and must not depend on RTEMS.
+ *
+ * A file is a sequence of chunks of the same size. Each chunk starts with a
+ * header that contains the time range, the number of samples and a CRC and is
+ * followed by a bit stream and zero padding up to the chunk size. Because the
+ * chunks have a fixed size, a reader finds a time with a binary search over
+ * the chunk headers.
+ *
+ * Timestamps are stored as delta-of-delta with variable length prefixes,
+ * floating point values as XOR with the previous value (both as described in
+ * the Gorilla paper by Facebook). Integer values are stored as zigzag varint
+ * of the difference to the previous value.
+ */
+
+#ifndef DEMO_TSLOG_CODEC_H
+#define DEMO_TSLOG_CODEC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define TSLOG_MAGIC			0x31435354 /* "TSC1" */
+#define TSLOG_VERSION			1
+#define TSLOG_HEADER_SIZE		48
+#define TSLOG_DEFAULT_CHUNK_SIZE	4096
+#define TSLOG_MIN_CHUNK_SIZE		256
+
+/* Worst case of one timestamp (4 + 64) and one value (2 + 5 + 6 + 64 or 80) */
+#define TSLOG_MAX_SAMPLE_BITS		148
+
+enum tslog_type {
+	TSLOG_TYPE_DOUBLE = 0,
+	TSLOG_TYPE_INT = 1,
+};
+
+/* All fields are stored in little endian byte order */
+struct tslog_chunk_header {
+	uint32_t chunk_size;
+	uint32_t payload_size;
+	uint32_t count;
+	uint32_t series;
+	uint32_t type;
+	/* CRC-32 of the header (with crc zero) and the payload */
+	uint32_t crc;
+	int64_t first_time;
+	int64_t last_time;
+};
+
+struct tslog_encoder {
+	uint8_t *buf;
+	size_t size;
+	size_t bit;
+	enum tslog_type type;
+	uint32_t count;
+	int64_t first_time;
+	int64_t prev_time;
+	int64_t prev_delta;
+	uint64_t prev_value;
+	unsigned prev_leading;
+	unsigned prev_trailing;
+};
+
+struct tslog_decoder {
+	const uint8_t *buf;
+	size_t size;
+	size_t bit;
+	enum tslog_type type;
+	uint32_t remaining;
+	uint32_t index;
+	int64_t prev_time;
+	int64_t prev_delta;
+	uint64_t prev_value;
+	unsigned prev_leading;
+	unsigned prev_trailing;
+};
+
+static inline uint64_t
+tslog_double_to_bits(double value)
+{
+	uint64_t bits;
+
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+static inline double
+tslog_bits_to_double(uint64_t bits)
+{
+	double value;
+
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+uint32_t tslog_crc32(uint32_t crc, const void *data, size_t len);
+
+void tslog_header_pack(uint8_t buf[TSLOG_HEADER_SIZE],
+    const struct tslog_chunk_header *header);
+
+/*
+ * Returns false if the magic or the version don't match, if the chunk size is
+ * below TSLOG_MIN_CHUNK_SIZE or if the payload doesn't fit into the chunk.
+ */
+bool tslog_header_unpack(struct tslog_chunk_header *header,
+    const uint8_t buf[TSLOG_HEADER_SIZE]);
+
+/*
+ * Check the CRC of a complete chunk (header and payload). The chunk has to be
+ * at least header->payload_size + TSLOG_HEADER_SIZE bytes long.
+ */
+bool tslog_chunk_check(const struct tslog_chunk_header *header,
+    const uint8_t *chunk);
+
+/* Start a new bit stream in buf. The buffer is cleared. */
+void tslog_encoder_init(struct tslog_encoder *enc, uint8_t *buf, size_t size,
+    enum tslog_type type);
+
+/*
+ * Add a sample. The value is the bit pattern of a double or an int64_t,
+ * depending on the type. Returns false without changing the encoder if there
+ * might not be enough space left for the sample.
+ */
+bool tslog_encoder_append(struct tslog_encoder *enc, int64_t time,
+    uint64_t value);
+
+/* Return the number of bytes used so far. */
+size_t tslog_encoder_size(const struct tslog_encoder *enc);
+
+/* Fill in the fields of the header that the encoder knows. */
+void tslog_encoder_header(const struct tslog_encoder *enc,
+    struct tslog_chunk_header *header);
+
+void tslog_decoder_init(struct tslog_decoder *dec,
+    const struct tslog_chunk_header *header, const uint8_t *payload);
+
+/* Return the next sample. Returns false at the end or on corrupt data. */
+bool tslog_decoder_next(struct tslog_decoder *dec, int64_t *time,
+    uint64_t *value);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DEMO_TSLOG_CODEC_H */
@@ -0,0 +1,345 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "tslog.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "dmabuf.h"
+
+int
+tslog_writer_open(struct tslog_writer *w, const char *path,
+    uint32_t series, enum tslog_type type, size_t chunk_size)
+{
+	struct stat st;
+
+	if (chunk_size < TSLOG_MIN_CHUNK_SIZE || chunk_size > UINT32_MAX ||
+	    (type != TSLOG_TYPE_DOUBLE && type != TSLOG_TYPE_INT)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	memset(w, 0, sizeof(*w));
+	w->last_time = INT64_MIN;
+	w->fd = open(path, O_RDWR | O_CREAT | O_APPEND, 0666);
+	if (w->fd < 0) {
+		return -1;
+	}
+
+	/* Chunks must stay aligned for the binary search of readers */
+	if (fstat(w->fd, &st) != 0 || st.st_size % (off_t)chunk_size != 0) {
+		close(w->fd);
+		errno = EINVAL;
+		return -1;
+	}
+
+	/*
+	 * Continue after the last chunk of an existing file. It has to use the
+	 * same chunk size and the time must not go backwards.
+	 */
+	if (st.st_size > 0) {
+		struct tslog_chunk_header header;
+		uint8_t raw[TSLOG_HEADER_SIZE];
+
+		if (pread(w->fd, raw, sizeof(raw),
+		    st.st_size - (off_t)chunk_size) != sizeof(raw) ||
+		    !tslog_header_unpack(&header, raw) ||
+		    header.chunk_size != chunk_size) {
+			close(w->fd);
+			errno = EINVAL;
+			return -1;
+		}
+		w->last_time = header.last_time;
+	}
+
+	/* Aligned, so the SD driver can transfer directly from the buffer */
+	w->chunk = dmabuf_alloc(chunk_size);
+	if (w->chunk == NULL) {
+		close(w->fd);
+		errno = ENOMEM;
+		return -1;
+	}
+
+	w->series = series;
+	w->chunk_size = chunk_size;
+	tslog_encoder_init(&w->enc, w->chunk + TSLOG_HEADER_SIZE,
+	    chunk_size - TSLOG_HEADER_SIZE, type);
+
+	return 0;
+}
+
+static int
+tslog_writer_write_chunk(struct tslog_writer *w)
+{
+	struct tslog_chunk_header header = {
+		.chunk_size = (uint32_t)w->chunk_size,
+		.series = w->series,
+		.crc = 0,
+	};
+	ssize_t n;
+
+	if (w->enc.count == 0) {
+		return 0;
+	}
+
+	tslog_encoder_header(&w->enc, &header);
+	tslog_header_pack(w->chunk, &header);
+	header.crc = tslog_crc32(0, w->chunk,
+	    TSLOG_HEADER_SIZE + header.payload_size);
+	tslog_header_pack(w->chunk, &header);
+
+	n = write(w->fd, w->chunk, w->chunk_size);
+	if (n != (ssize_t)w->chunk_size) {
+		if (n >= 0) {
+			errno = ENOSPC;
+		}
+		return -1;
+	}
+
+	++w->chunks;
+	tslog_encoder_init(&w->enc, w->chunk + TSLOG_HEADER_SIZE,
+	    w->chunk_size - TSLOG_HEADER_SIZE, w->enc.type);
+
+	return 0;
+}
+
+int
+tslog_writer_append(struct tslog_writer *w, int64_t time, uint64_t value)
+{
+	if (time < w->last_time) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (!tslog_encoder_append(&w->enc, time, value)) {
+		if (tslog_writer_write_chunk(w) != 0) {
+			return -1;
+		}
+		/* Always fits into an empty chunk */
+		(void)tslog_encoder_append(&w->enc, time, value);
+	}
+	w->last_time = time;
+	++w->samples;
+
+	return 0;
+}
+
+int
+tslog_writer_flush(struct tslog_writer *w)
+{
+	return tslog_writer_write_chunk(w);
+}
+
+int
+tslog_writer_close(struct tslog_writer *w)
+{
+	int rv = tslog_writer_flush(w);
+
+	if (close(w->fd) != 0) {
+		rv = -1;
+	}
+	dmabuf_free(w->chunk);
+	w->chunk = NULL;
+
+	return rv;
+}
+
+/* Something like a temperature: slow drift with noise, sampled every 100 ms */
+static int
+tslog_bench(const char *path, unsigned long count, enum tslog_type type)
+{
+	struct tslog_writer w;
+	uint64_t start;
+	uint64_t ns;
+	size_t text = 0;
+	int64_t time = 1700000000000;
+	unsigned long i;
+	struct stat st;
+
+	/* Start from scratch, the timestamps would go backwards otherwise */
+	(void)unlink(path);
+	if (tslog_writer_open(&w, path, 1, type,
+	    TSLOG_DEFAULT_CHUNK_SIZE) != 0) {
+		printf("Couldn't open %s: %s\n", path, strerror(errno));
+		return -1;
+	}
+
+	start = rtems_clock_get_uptime_nanoseconds();
+	for (i = 0; i < count; ++i) {
+		int64_t centi = 2000 + (int64_t)(500. * sin((double)i / 600.)) +
+		    rand() % 5 - 2;
+		char line[48];
+		int rv;
+
+		time += 100 + rand() % 3 - 1;
+		if (type == TSLOG_TYPE_INT) {
+			rv = tslog_writer_append_int(&w, time, centi);
+		} else {
+			rv = tslog_writer_append_double(&w, time,
+			    (double)centi / 100.);
+		}
+		if (rv != 0) {
+			printf("Write failed: %s\n", strerror(errno));
+			break;
+		}
+		/* What the same sample costs in a CSV file */
+		text += (size_t)snprintf(line, sizeof(line), "%" PRId64 ",%.2f\n",
+		    time, (double)centi / 100.);
+	}
+	if (tslog_writer_close(&w) != 0) {
+		printf("Close failed: %s\n", strerror(errno));
+	}
+	ns = rtems_clock_get_uptime_nanoseconds() - start;
+
+	if (stat(path, &st) != 0) {
+		return -1;
+	}
+	printf("%" PRIu64 " samples in %" PRIu64 " chunks (= write() calls)\n"
+	    "file:  %jd bytes (%.2f bytes/sample)\n"
+	    "CSV:   %zu bytes (%.1fx larger)\n"
+	    "time:  %" PRIu64 " us (%.2f us/sample incl. CSV formatting)\n",
+	    w.samples, w.chunks, (intmax_t)st.st_size,
+	    w.samples > 0 ? (double)st.st_size / (double)w.samples : 0.,
+	    text, st.st_size > 0 ? (double)text / (double)st.st_size : 0.,
+	    ns / 1000, w.samples > 0 ? (double)ns / 1000. / (double)w.samples : 0.);
+
+	return 0;
+}
+
+/* Print the index of a file and verify the CRC of each chunk */
+static int
+tslog_info(const char *path)
+{
+	struct tslog_chunk_header header;
+	uint8_t *chunk = NULL;
+	size_t chunk_size = 0;
+	unsigned errors = 0;
+	off_t offset = 0;
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		printf("Couldn't open %s: %s\n", path, strerror(errno));
+		return -1;
+	}
+
+	printf("chunk  series  samples  payload  first_time           "
+	    "last_time            crc\n");
+	while (true) {
+		uint8_t raw[TSLOG_HEADER_SIZE];
+		bool ok;
+
+		if (pread(fd, raw, sizeof(raw), offset) != sizeof(raw)) {
+			break;
+		}
+		if (!tslog_header_unpack(&header, raw) ||
+		    (chunk_size != 0 && header.chunk_size != chunk_size)) {
+			printf("Invalid chunk header at %jd\n",
+			    (intmax_t)offset);
+			++errors;
+			break;
+		}
+		if (chunk == NULL) {
+			chunk_size = header.chunk_size;
+			chunk = dmabuf_alloc(chunk_size);
+			if (chunk == NULL) {
+				printf("Not enough memory\n");
+				break;
+			}
+		}
+
+		ok = pread(fd, chunk, chunk_size, offset) ==
+		    (ssize_t)chunk_size && tslog_chunk_check(&header, chunk);
+		if (!ok) {
+			++errors;
+		}
+		printf("%5jd  %6" PRIu32 "  %7" PRIu32 "  %7" PRIu32 "  %-19"
+		    PRId64 "  %-19" PRId64 "  %s\n",
+		    (intmax_t)(offset / (off_t)chunk_size), header.series,
+		    header.count, header.payload_size, header.first_time,
+		    header.last_time, ok ? "ok" : "BAD");
+		offset += (off_t)chunk_size;
+	}
+
+	dmabuf_free(chunk);
+	close(fd);
+
+	return errors == 0 ? 0 : -1;
+}
+
+static int
+command_tslog(int argc, char *argv[])
+{
+	if (argc == 3 && strcmp(argv[1], "info") == 0) {
+		return tslog_info(argv[2]);
+	}
+
+	if (argc >= 3 && argc <= 5 && strcmp(argv[1], "bench") == 0) {
+		enum tslog_type type = TSLOG_TYPE_INT;
+		unsigned long count = 100000;
+		int i;
+
+		for (i = 3; i < argc; ++i) {
+			if (strcmp(argv[i], "-d") == 0) {
+				type = TSLOG_TYPE_DOUBLE;
+			} else {
+				count = strtoul(argv[i], NULL, 0);
+			}
+		}
+		return tslog_bench(argv[2], count, type);
+	}
+
+	puts(shell_TSLOG_Command.usage);
+	return -1;
+}
+
+rtems_shell_cmd_t shell_TSLOG_Command = {
+	.name = "tslog",
+	.usage = "Use with: tslog info <file>\n"
+	    "          tslog bench <file> [samples] [-d]\n"
+	    "Compressed time series files. Decode them on the host with the\n"
+	    "tslog tool (make tslog-tools).\n"
+	    "  info:  Print the chunk index and verify the CRCs\n"
+	    "  bench: Write a simulated temperature (default: 100000 samples)\n"
+	    "         as fixed point integers or with -d as doubles and compare\n"
+	    "         the size with a CSV file. The file is replaced.\n",
+	.topic = "files",
+	.command = command_tslog,
+	.alias = NULL,
+	.next = NULL,
+	.mode = 0,
+	.uid = 0,
+	.gid = 0,
+};
@@ -0,0 +1,103 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DEMO_TSLOG_H
+#define DEMO_TSLOG_H
+
+#include <rtems.h>
+#include <rtems/shell.h>
+
+#include "tslog-codec.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Writer for compressed time series files (see tslog-codec.h for the
+ * format). Samples are collected in a chunk buffer and the file is only
+ * written when a chunk is full, so each write() is one chunk. Use a chunk size
+ * that is a multiple of the cluster size of the file system.
+ *
+ * Values should be stored as TSLOG_TYPE_INT in a fixed point unit (for
+ * example centidegrees) if the sensor has a fixed resolution. This compresses
+ * considerably better than the XOR encoding of doubles.
+ */
+struct tslog_writer {
+	int fd;
+	uint32_t series;
+	size_t chunk_size;
+	uint8_t *chunk;
+	struct tslog_encoder enc;
+	int64_t last_time;
+	uint64_t chunks;
+	uint64_t samples;
+};
+
+/*
+ * Open a file for appending. An existing file has to use the same chunk size
+ * and new samples must not be older than the last one in the file. Returns 0
+ * on success and -1 with errno set otherwise.
+ */
+int tslog_writer_open(struct tslog_writer *w, const char *path,
+    uint32_t series, enum tslog_type type, size_t chunk_size);
+
+/*
+ * Add a sample. Timestamps must not decrease, their unit is up to the
+ * application. Returns 0 on success and -1 with errno set otherwise.
+ */
+int tslog_writer_append(struct tslog_writer *w, int64_t time, uint64_t value);
+
+static inline int
+tslog_writer_append_double(struct tslog_writer *w, int64_t time, double value)
+{
+	return tslog_writer_append(w, time, tslog_double_to_bits(value));
+}
+
+static inline int
+tslog_writer_append_int(struct tslog_writer *w, int64_t time, int64_t value)
+{
+	return tslog_writer_append(w, time, (uint64_t)value);
+}
+
+/*
+ * Write the current chunk even if it is not full. The rest of the chunk is
+ * padding, so only use this when the data has to be on the card (for example
+ * before a shutdown).
+ */
+int tslog_writer_flush(struct tslog_writer *w);
+
+/* Flush and close the file. */
+int tslog_writer_close(struct tslog_writer *w);
+
+extern rtems_shell_cmd_t shell_TSLOG_Command;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DEMO_TSLOG_H */
@@ -0,0 +1,122 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BLAS_NEON_H
+#define BLAS_NEON_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Optimized replacements for some routines of the reference BLAS. They have
+ * the Fortran interface (all arguments by reference, character arguments
+ * with hidden lengths at the end like gfortran passes them) and replace the
+ * objects of the same name in libblas.a. LAPACK and CBLAS use them without
+ * any change.
+ *
+ * Single precision uses NEON. ARMv7 NEON has no double precision, so the
+ * double precision routines are register blocked for the VFP (32 double
+ * registers, fused multiply-add).
+ */
+
+/*
+ * Cache blocking for the Cortex-A7 of the i.MX6ULL (32 KiB L1D, 128 KiB L2).
+ * A packed KC x NR panel of B stays in L1, a packed MC x KC block of A in
+ * half of L2. B is packed in blocks of KC x NC.
+ */
+#define BLAS_NEON_SGEMM_MC	64
+#define BLAS_NEON_SGEMM_KC	256
+#define BLAS_NEON_SGEMM_NC	256
+#define BLAS_NEON_DGEMM_MC	32
+#define BLAS_NEON_DGEMM_KC	256
+#define BLAS_NEON_DGEMM_NC	128
+
+/* Products up to this m * n * k are computed without packing */
+#define BLAS_NEON_GEMM_SMALL	(32 * 32 * 32)
+
+/* Provided by the reference BLAS */
+void xerbla_(const char *srname, const int *info, size_t srname_len);
+
+static inline bool
+blas_neon_lsame(char a, char b)
+{
+	return (a | 0x20) == (b | 0x20);
+}
+
+static inline int
+blas_neon_max(int a, int b)
+{
+	return a > b ? a : b;
+}
+
+/* First element of a vector with a negative increment like the reference */
+static inline int
+blas_neon_start(int n, int inc)
+{
+	return inc < 0 ? (1 - n) * inc : 0;
+}
+
+void saxpy_(const int *n, const float *alpha, const float *x, const int *incx,
+    float *y, const int *incy);
+
+void daxpy_(const int *n, const double *alpha, const double *x,
+    const int *incx, double *y, const int *incy);
+
+float sdot_(const int *n, const float *x, const int *incx, const float *y,
+    const int *incy);
+
+double ddot_(const int *n, const double *x, const int *incx, const double *y,
+    const int *incy);
+
+void sgemv_(const char *trans, const int *m, const int *n, const float *alpha,
+    const float *a, const int *lda, const float *x, const int *incx,
+    const float *beta, float *y, const int *incy, size_t trans_len);
+
+void dgemv_(const char *trans, const int *m, const int *n,
+    const double *alpha, const double *a, const int *lda, const double *x,
+    const int *incx, const double *beta, double *y, const int *incy,
+    size_t trans_len);
+
+void sgemm_(const char *transa, const char *transb, const int *m,
+    const int *n, const int *k, const float *alpha, const float *a,
+    const int *lda, const float *b, const int *ldb, const float *beta,
+    float *c, const int *ldc, size_t transa_len, size_t transb_len);
+
+void dgemm_(const char *transa, const char *transb, const int *m,
+    const int *n, const int *k, const double *alpha, const double *a,
+    const int *lda, const double *b, const int *ldb, const double *beta,
+    double *c, const int *ldc, size_t transa_len, size_t transb_len);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BLAS_NEON_H */
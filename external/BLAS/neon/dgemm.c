@@ -0,0 +1,74 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "blas-neon.h"
+
+#define GEMM_T			double
+#define GEMM_NAME(x)		d##x
+#define GEMM_XERBLA_NAME	"DGEMM "
+#define GEMM_MR			4
+#define GEMM_NR			4
+#define GEMM_MC			BLAS_NEON_DGEMM_MC
+#define GEMM_KC			BLAS_NEON_DGEMM_KC
+#define GEMM_NC			BLAS_NEON_DGEMM_NC
+
+/*
+ * 4 x 4 block of C in 16 of the 32 VFP double registers. The remaining ones
+ * hold a column of A and a row of B, so the compiler doesn't have to spill.
+ */
+static void
+dgemm_kernel(int kc, const double *a, const double *b, double *c, int ldc)
+{
+	double c00 = 0.0, c10 = 0.0, c20 = 0.0, c30 = 0.0;
+	double c01 = 0.0, c11 = 0.0, c21 = 0.0, c31 = 0.0;
+	double c02 = 0.0, c12 = 0.0, c22 = 0.0, c32 = 0.0;
+	double c03 = 0.0, c13 = 0.0, c23 = 0.0, c33 = 0.0;
+	int p;
+
+	for (p = 0; p < kc; ++p) {
+		double a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3];
+		double b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3];
+
+		c00 += a0 * b0; c10 += a1 * b0; c20 += a2 * b0; c30 += a3 * b0;
+		c01 += a0 * b1; c11 += a1 * b1; c21 += a2 * b1; c31 += a3 * b1;
+		c02 += a0 * b2; c12 += a1 * b2; c22 += a2 * b2; c32 += a3 * b2;
+		c03 += a0 * b3; c13 += a1 * b3; c23 += a2 * b3; c33 += a3 * b3;
+
+		a += GEMM_MR;
+		b += GEMM_NR;
+	}
+
+	c[0] += c00; c[1] += c10; c[2] += c20; c[3] += c30;
+	c += ldc;
+	c[0] += c01; c[1] += c11; c[2] += c21; c[3] += c31;
+	c += ldc;
+	c[0] += c02; c[1] += c12; c[2] += c22; c[3] += c32;
+	c += ldc;
+	c[0] += c03; c[1] += c13; c[2] += c23; c[3] += c33;
+}
+
+#include "gemm-template.h"
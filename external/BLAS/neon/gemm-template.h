@@ -0,0 +1,318 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Blocked matrix multiplication in the style of GotoBLAS, included by
+ * sgemm.c and dgemm.c. The including file defines:
+ *
+ *   GEMM_T          element type
+ *   GEMM_NAME(x)    prefixes x with s or d
+ *   GEMM_XERBLA_NAME  routine name for xerbla_(), "SGEMM " or "DGEMM "
+ *   GEMM_MR/NR      size of the register block of the micro kernel
+ *   GEMM_MC/KC/NC   cache blocking
+ *   GEMM_NAME(gemm_kernel)(kc, a, b, c, ldc): C[MR x NR] += A * B for a
+ *                   packed MR x kc panel of A and a packed kc x NR panel of B
+ *
+ * op(A) is packed in row panels of MR with alpha applied, op(B) in column
+ * panels of NR. Edges are padded with zeros, so the kernel always computes
+ * a full register block and only the valid part is added to C.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Address of element (i, j) of op(X) */
+#define GEMM_AT(x, ld, trans, i, j) \
+	((trans) ? &(x)[(j) + (i) * (ld)] : &(x)[(i) + (j) * (ld)])
+
+static inline int
+GEMM_NAME(gemm_min)(int a, int b)
+{
+	return a < b ? a : b;
+}
+
+static inline int
+GEMM_NAME(gemm_round)(int value, int multiple)
+{
+	return (value + multiple - 1) / multiple * multiple;
+}
+
+static void
+GEMM_NAME(gemm_pack_a)(int mc, int kc, const GEMM_T *a, int lda, bool trans,
+    GEMM_T alpha, GEMM_T *buf)
+{
+	int ir;
+	int p;
+	int i;
+
+	for (ir = 0; ir < mc; ir += GEMM_MR) {
+		int mr = GEMM_NAME(gemm_min)(GEMM_MR, mc - ir);
+
+		for (p = 0; p < kc; ++p) {
+			for (i = 0; i < mr; ++i) {
+				buf[i] = alpha * *GEMM_AT(a, lda, trans, ir + i, p);
+			}
+			for (; i < GEMM_MR; ++i) {
+				buf[i] = 0;
+			}
+			buf += GEMM_MR;
+		}
+	}
+}
+
+static void
+GEMM_NAME(gemm_pack_b)(int kc, int nc, const GEMM_T *b, int ldb, bool trans,
+    GEMM_T *buf)
+{
+	int jr;
+	int p;
+	int j;
+
+	for (jr = 0; jr < nc; jr += GEMM_NR) {
+		int nr = GEMM_NAME(gemm_min)(GEMM_NR, nc - jr);
+
+		for (p = 0; p < kc; ++p) {
+			for (j = 0; j < nr; ++j) {
+				buf[j] = *GEMM_AT(b, ldb, trans, p, jr + j);
+			}
+			for (; j < GEMM_NR; ++j) {
+				buf[j] = 0;
+			}
+			buf += GEMM_NR;
+		}
+	}
+}
+
+/* Multiply a packed block of A with a packed block of B */
+static void
+GEMM_NAME(gemm_macro)(int mc, int nc, int kc, const GEMM_T *abuf,
+    const GEMM_T *bbuf, GEMM_T *c, int ldc)
+{
+	int jr;
+	int ir;
+
+	for (jr = 0; jr < nc; jr += GEMM_NR) {
+		int nr = GEMM_NAME(gemm_min)(GEMM_NR, nc - jr);
+		const GEMM_T *b = &bbuf[jr * kc];
+
+		for (ir = 0; ir < mc; ir += GEMM_MR) {
+			int mr = GEMM_NAME(gemm_min)(GEMM_MR, mc - ir);
+			const GEMM_T *a = &abuf[ir * kc];
+			GEMM_T *cij = &c[ir + jr * ldc];
+
+			if (mr == GEMM_MR && nr == GEMM_NR) {
+				GEMM_NAME(gemm_kernel)(kc, a, b, cij, ldc);
+			} else {
+				GEMM_T tmp[GEMM_MR * GEMM_NR];
+				int i;
+				int j;
+
+				memset(tmp, 0, sizeof(tmp));
+				GEMM_NAME(gemm_kernel)(kc, a, b, tmp, GEMM_MR);
+				for (j = 0; j < nr; ++j) {
+					for (i = 0; i < mr; ++i) {
+						cij[i + j * ldc] +=
+						    tmp[i + j * GEMM_MR];
+					}
+				}
+			}
+		}
+	}
+}
+
+/* Without packing, for small products and if there is no memory */
+static void
+GEMM_NAME(gemm_small)(bool transa, bool transb, int m, int n, int k,
+    GEMM_T alpha, const GEMM_T *a, int lda, const GEMM_T *b, int ldb,
+    GEMM_T *c, int ldc)
+{
+	static const int one = 1;
+	int i;
+	int j;
+	int p;
+
+	for (j = 0; j < n; ++j) {
+		GEMM_T *cj = &c[j * ldc];
+
+		if (!transa) {
+			/* C(:, j) += A(:, p) * alpha * op(B)(p, j) */
+			for (p = 0; p < k; ++p) {
+				GEMM_T t = alpha * *GEMM_AT(b, ldb, transb, p, j);
+
+				GEMM_NAME(axpy_)(&m, &t, &a[p * lda], &one, cj,
+				    &one);
+			}
+		} else if (!transb) {
+			/* Both columns are contiguous */
+			for (i = 0; i < m; ++i) {
+				cj[i] += alpha * GEMM_NAME(dot_)(&k,
+				    &a[i * lda], &one, &b[j * ldb], &one);
+			}
+		} else {
+			for (i = 0; i < m; ++i) {
+				cj[i] += alpha * GEMM_NAME(dot_)(&k,
+				    &a[i * lda], &one, &b[j], &ldb);
+			}
+		}
+	}
+}
+
+static void
+GEMM_NAME(gemm_blocked)(bool transa, bool transb, int m, int n, int k,
+    GEMM_T alpha, const GEMM_T *a, int lda, const GEMM_T *b, int ldb,
+    GEMM_T *c, int ldc)
+{
+	int kc_max = GEMM_NAME(gemm_min)(GEMM_KC, k);
+	int mc_max = GEMM_NAME(gemm_round)(GEMM_NAME(gemm_min)(GEMM_MC, m),
+	    GEMM_MR);
+	int nc_max = GEMM_NAME(gemm_round)(GEMM_NAME(gemm_min)(GEMM_NC, n),
+	    GEMM_NR);
+	size_t asize = (size_t)mc_max * (size_t)kc_max;
+	size_t bsize = (size_t)kc_max * (size_t)nc_max;
+	GEMM_T *abuf;
+	GEMM_T *bbuf;
+	void *mem;
+	int jc;
+	int pc;
+	int ic;
+
+	/* Per call, so the routines stay reentrant */
+	if (posix_memalign(&mem, 64, (asize + bsize) * sizeof(GEMM_T)) != 0) {
+		GEMM_NAME(gemm_small)(transa, transb, m, n, k, alpha, a, lda,
+		    b, ldb, c, ldc);
+		return;
+	}
+	abuf = mem;
+	bbuf = abuf + asize;
+
+	for (jc = 0; jc < n; jc += GEMM_NC) {
+		int nc = GEMM_NAME(gemm_min)(GEMM_NC, n - jc);
+
+		for (pc = 0; pc < k; pc += GEMM_KC) {
+			int kc = GEMM_NAME(gemm_min)(GEMM_KC, k - pc);
+
+			GEMM_NAME(gemm_pack_b)(kc, nc,
+			    GEMM_AT(b, ldb, transb, pc, jc), ldb, transb,
+			    bbuf);
+
+			for (ic = 0; ic < m; ic += GEMM_MC) {
+				int mc = GEMM_NAME(gemm_min)(GEMM_MC, m - ic);
+
+				GEMM_NAME(gemm_pack_a)(mc, kc,
+				    GEMM_AT(a, lda, transa, ic, pc), lda,
+				    transa, alpha, abuf);
+				GEMM_NAME(gemm_macro)(mc, nc, kc, abuf, bbuf,
+				    &c[ic + jc * ldc], ldc);
+			}
+		}
+	}
+
+	free(mem);
+}
+
+static int
+GEMM_NAME(gemm_check)(const char *name, const char *transa,
+    const char *transb, int m, int n, int k, int lda, int ldb, int ldc)
+{
+	bool nota = blas_neon_lsame(*transa, 'N');
+	bool notb = blas_neon_lsame(*transb, 'N');
+	int nrowa = nota ? m : k;
+	int nrowb = notb ? k : n;
+	int info = 0;
+
+	if (!nota && !blas_neon_lsame(*transa, 'C') &&
+	    !blas_neon_lsame(*transa, 'T')) {
+		info = 1;
+	} else if (!notb && !blas_neon_lsame(*transb, 'C') &&
+	    !blas_neon_lsame(*transb, 'T')) {
+		info = 2;
+	} else if (m < 0) {
+		info = 3;
+	} else if (n < 0) {
+		info = 4;
+	} else if (k < 0) {
+		info = 5;
+	} else if (lda < blas_neon_max(1, nrowa)) {
+		info = 8;
+	} else if (ldb < blas_neon_max(1, nrowb)) {
+		info = 10;
+	} else if (ldc < blas_neon_max(1, m)) {
+		info = 13;
+	}
+
+	if (info != 0) {
+		xerbla_(name, &info, 6);
+	}
+
+	return info;
+}
+
+void
+GEMM_NAME(gemm_)(const char *transa, const char *transb, const int *m,
+    const int *n, const int *k, const GEMM_T *alpha, const GEMM_T *a,
+    const int *lda, const GEMM_T *b, const int *ldb, const GEMM_T *beta,
+    GEMM_T *c, const int *ldc, size_t transa_len, size_t transb_len)
+{
+	bool ta = !blas_neon_lsame(*transa, 'N');
+	bool tb = !blas_neon_lsame(*transb, 'N');
+	GEMM_T al = *alpha;
+	GEMM_T be = *beta;
+	int i;
+	int j;
+
+	(void)transa_len;
+	(void)transb_len;
+
+	if (GEMM_NAME(gemm_check)(GEMM_XERBLA_NAME, transa, transb, *m, *n,
+	    *k, *lda, *ldb, *ldc) != 0) {
+		return;
+	}
+	if (*m == 0 || *n == 0 || ((al == 0 || *k == 0) && be == 1)) {
+		return;
+	}
+
+	if (be != 1) {
+		for (j = 0; j < *n; ++j) {
+			GEMM_T *cj = &c[j * *ldc];
+
+			for (i = 0; i < *m; ++i) {
+				cj[i] = be == 0 ? 0 : be * cj[i];
+			}
+		}
+	}
+	if (al == 0 || *k == 0) {
+		return;
+	}
+
+	if ((long)*m * *n * *k <= BLAS_NEON_GEMM_SMALL) {
+		GEMM_NAME(gemm_small)(ta, tb, *m, *n, *k, al, a, *lda, b,
+		    *ldb, c, *ldc);
+	} else {
+		GEMM_NAME(gemm_blocked)(ta, tb, *m, *n, *k, al, a, *lda, b,
+		    *ldb, c, *ldc);
+	}
+}
@@ -0,0 +1,339 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "blas-neon.h"
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif /* __ARM_NEON */
+
+/*
+ * Both routines work on four columns of A at once. With trans = 'N', each
+ * element of y is loaded and stored once per four columns. With trans = 'T',
+ * each element of x is loaded once for four dot products.
+ */
+
+static int
+gemv_check(const char *name, const char *trans, int m, int n, int lda,
+    int incx, int incy)
+{
+	int info = 0;
+
+	if (!blas_neon_lsame(*trans, 'N') && !blas_neon_lsame(*trans, 'T') &&
+	    !blas_neon_lsame(*trans, 'C')) {
+		info = 1;
+	} else if (m < 0) {
+		info = 2;
+	} else if (n < 0) {
+		info = 3;
+	} else if (lda < blas_neon_max(1, m)) {
+		info = 6;
+	} else if (incx == 0) {
+		info = 8;
+	} else if (incy == 0) {
+		info = 11;
+	}
+
+	if (info != 0) {
+		xerbla_(name, &info, 6);
+	}
+
+	return info;
+}
+
+#ifdef __ARM_NEON
+static inline float
+gemv_hsum(float32x4_t v)
+{
+	float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+
+	return vget_lane_f32(vpadd_f32(s, s), 0);
+}
+#endif /* __ARM_NEON */
+
+void
+sgemv_(const char *trans, const int *m, const int *n, const float *alpha,
+    const float *a, const int *lda, const float *x, const int *incx,
+    const float *beta, float *y, const int *incy, size_t trans_len)
+{
+	bool notrans = blas_neon_lsame(*trans, 'N');
+	int rows = *m;
+	int cols = *n;
+	int ld = *lda;
+	int ix = *incx;
+	int iy = *incy;
+	float al = *alpha;
+	float be = *beta;
+	int lenx;
+	int leny;
+	int kx;
+	int ky;
+	int i;
+	int j;
+
+	(void)trans_len;
+
+	if (gemv_check("SGEMV ", trans, rows, cols, ld, ix, iy) != 0) {
+		return;
+	}
+	if (rows == 0 || cols == 0 || (al == 0.0f && be == 1.0f)) {
+		return;
+	}
+
+	lenx = notrans ? cols : rows;
+	leny = notrans ? rows : cols;
+	kx = blas_neon_start(lenx, ix);
+	ky = blas_neon_start(leny, iy);
+
+	if (be != 1.0f) {
+		for (i = 0; i < leny; ++i) {
+			float *yi = &y[ky + i * iy];
+
+			*yi = be == 0.0f ? 0.0f : be * *yi;
+		}
+	}
+	if (al == 0.0f) {
+		return;
+	}
+
+	if (notrans && iy == 1) {
+		for (j = 0; j + 4 <= cols; j += 4) {
+			const float *a0 = &a[j * ld];
+			const float *a1 = a0 + ld;
+			const float *a2 = a1 + ld;
+			const float *a3 = a2 + ld;
+			float t0 = al * x[kx + j * ix];
+			float t1 = al * x[kx + (j + 1) * ix];
+			float t2 = al * x[kx + (j + 2) * ix];
+			float t3 = al * x[kx + (j + 3) * ix];
+
+			i = 0;
+#ifdef __ARM_NEON
+			for (; i + 4 <= rows; i += 4) {
+				float32x4_t v = vld1q_f32(&y[i]);
+
+				v = vmlaq_n_f32(v, vld1q_f32(&a0[i]), t0);
+				v = vmlaq_n_f32(v, vld1q_f32(&a1[i]), t1);
+				v = vmlaq_n_f32(v, vld1q_f32(&a2[i]), t2);
+				v = vmlaq_n_f32(v, vld1q_f32(&a3[i]), t3);
+				vst1q_f32(&y[i], v);
+			}
+#endif /* __ARM_NEON */
+			for (; i < rows; ++i) {
+				y[i] += t0 * a0[i] + t1 * a1[i] + t2 * a2[i] +
+				    t3 * a3[i];
+			}
+		}
+		for (; j < cols; ++j) {
+			const float *a0 = &a[j * ld];
+			float t0 = al * x[kx + j * ix];
+
+			i = 0;
+#ifdef __ARM_NEON
+			for (; i + 4 <= rows; i += 4) {
+				vst1q_f32(&y[i], vmlaq_n_f32(vld1q_f32(&y[i]),
+				    vld1q_f32(&a0[i]), t0));
+			}
+#endif /* __ARM_NEON */
+			for (; i < rows; ++i) {
+				y[i] += t0 * a0[i];
+			}
+		}
+	} else if (notrans) {
+		for (j = 0; j < cols; ++j) {
+			const float *a0 = &a[j * ld];
+			float t0 = al * x[kx + j * ix];
+
+			for (i = 0; i < rows; ++i) {
+				y[ky + i * iy] += t0 * a0[i];
+			}
+		}
+	} else if (ix == 1) {
+		for (j = 0; j + 4 <= cols; j += 4) {
+			const float *a0 = &a[j * ld];
+			const float *a1 = a0 + ld;
+			const float *a2 = a1 + ld;
+			const float *a3 = a2 + ld;
+			float r0 = 0.0f;
+			float r1 = 0.0f;
+			float r2 = 0.0f;
+			float r3 = 0.0f;
+
+			i = 0;
+#ifdef __ARM_NEON
+			{
+				float32x4_t s0 = vdupq_n_f32(0.0f);
+				float32x4_t s1 = vdupq_n_f32(0.0f);
+				float32x4_t s2 = vdupq_n_f32(0.0f);
+				float32x4_t s3 = vdupq_n_f32(0.0f);
+
+				for (; i + 4 <= rows; i += 4) {
+					float32x4_t xv = vld1q_f32(&x[i]);
+
+					s0 = vmlaq_f32(s0, vld1q_f32(&a0[i]), xv);
+					s1 = vmlaq_f32(s1, vld1q_f32(&a1[i]), xv);
+					s2 = vmlaq_f32(s2, vld1q_f32(&a2[i]), xv);
+					s3 = vmlaq_f32(s3, vld1q_f32(&a3[i]), xv);
+				}
+				r0 = gemv_hsum(s0);
+				r1 = gemv_hsum(s1);
+				r2 = gemv_hsum(s2);
+				r3 = gemv_hsum(s3);
+			}
+#endif /* __ARM_NEON */
+			for (; i < rows; ++i) {
+				r0 += a0[i] * x[i];
+				r1 += a1[i] * x[i];
+				r2 += a2[i] * x[i];
+				r3 += a3[i] * x[i];
+			}
+			y[ky + j * iy] += al * r0;
+			y[ky + (j + 1) * iy] += al * r1;
+			y[ky + (j + 2) * iy] += al * r2;
+			y[ky + (j + 3) * iy] += al * r3;
+		}
+		for (; j < cols; ++j) {
+			y[ky + j * iy] += al * sdot_(&rows, &a[j * ld], incx,
+			    x, incx);
+		}
+	} else {
+		for (j = 0; j < cols; ++j) {
+			const float *a0 = &a[j * ld];
+			float r0 = 0.0f;
+
+			for (i = 0; i < rows; ++i) {
+				r0 += a0[i] * x[kx + i * ix];
+			}
+			y[ky + j * iy] += al * r0;
+		}
+	}
+}
+
+void
+dgemv_(const char *trans, const int *m, const int *n, const double *alpha,
+    const double *a, const int *lda, const double *x, const int *incx,
+    const double *beta, double *y, const int *incy, size_t trans_len)
+{
+	bool notrans = blas_neon_lsame(*trans, 'N');
+	int rows = *m;
+	int cols = *n;
+	int ld = *lda;
+	int ix = *incx;
+	int iy = *incy;
+	double al = *alpha;
+	double be = *beta;
+	int lenx;
+	int leny;
+	int kx;
+	int ky;
+	int i;
+	int j;
+
+	(void)trans_len;
+
+	if (gemv_check("DGEMV ", trans, rows, cols, ld, ix, iy) != 0) {
+		return;
+	}
+	if (rows == 0 || cols == 0 || (al == 0.0 && be == 1.0)) {
+		return;
+	}
+
+	lenx = notrans ? cols : rows;
+	leny = notrans ? rows : cols;
+	kx = blas_neon_start(lenx, ix);
+	ky = blas_neon_start(leny, iy);
+
+	if (be != 1.0) {
+		for (i = 0; i < leny; ++i) {
+			double *yi = &y[ky + i * iy];
+
+			*yi = be == 0.0 ? 0.0 : be * *yi;
+		}
+	}
+	if (al == 0.0) {
+		return;
+	}
+
+	if (notrans) {
+		for (j = 0; j + 4 <= cols; j += 4) {
+			const double *a0 = &a[j * ld];
+			const double *a1 = a0 + ld;
+			const double *a2 = a1 + ld;
+			const double *a3 = a2 + ld;
+			double t0 = al * x[kx + j * ix];
+			double t1 = al * x[kx + (j + 1) * ix];
+			double t2 = al * x[kx + (j + 2) * ix];
+			double t3 = al * x[kx + (j + 3) * ix];
+
+			for (i = 0; i < rows; ++i) {
+				y[ky + i * iy] += t0 * a0[i] + t1 * a1[i] +
+				    t2 * a2[i] + t3 * a3[i];
+			}
+		}
+		for (; j < cols; ++j) {
+			const double *a0 = &a[j * ld];
+			double t0 = al * x[kx + j * ix];
+
+			for (i = 0; i < rows; ++i) {
+				y[ky + i * iy] += t0 * a0[i];
+			}
+		}
+	} else {
+		for (j = 0; j + 4 <= cols; j += 4) {
+			const double *a0 = &a[j * ld];
+			const double *a1 = a0 + ld;
+			const double *a2 = a1 + ld;
+			const double *a3 = a2 + ld;
+			double r0 = 0.0;
+			double r1 = 0.0;
+			double r2 = 0.0;
+			double r3 = 0.0;
+
+			for (i = 0; i < rows; ++i) {
+				double xi = x[kx + i * ix];
+
+				r0 += a0[i] * xi;
+				r1 += a1[i] * xi;
+				r2 += a2[i] * xi;
+				r3 += a3[i] * xi;
+			}
+			y[ky + j * iy] += al * r0;
+			y[ky + (j + 1) * iy] += al * r1;
+			y[ky + (j + 2) * iy] += al * r2;
+			y[ky + (j + 3) * iy] += al * r3;
+		}
+		for (; j < cols; ++j) {
+			const double *a0 = &a[j * ld];
+			double r0 = 0.0;
+
+			for (i = 0; i < rows; ++i) {
+				r0 += a0[i] * x[kx + i * ix];
+			}
+			y[ky + j * iy] += al * r0;
+		}
+	}
+}
@@ -0,0 +1,219 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "blas-neon.h"
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif /* __ARM_NEON */
+
+void
+saxpy_(const int *n, const float *alpha, const float *x, const int *incx,
+    float *y, const int *incy)
+{
+	int count = *n;
+	float a = *alpha;
+	int i = 0;
+
+	if (count <= 0 || a == 0.0f) {
+		return;
+	}
+
+	if (*incx == 1 && *incy == 1) {
+#ifdef __ARM_NEON
+		float32x4_t va = vdupq_n_f32(a);
+
+		for (; i + 16 <= count; i += 16) {
+			float32x4_t y0 = vld1q_f32(&y[i]);
+			float32x4_t y1 = vld1q_f32(&y[i + 4]);
+			float32x4_t y2 = vld1q_f32(&y[i + 8]);
+			float32x4_t y3 = vld1q_f32(&y[i + 12]);
+
+			y0 = vmlaq_f32(y0, va, vld1q_f32(&x[i]));
+			y1 = vmlaq_f32(y1, va, vld1q_f32(&x[i + 4]));
+			y2 = vmlaq_f32(y2, va, vld1q_f32(&x[i + 8]));
+			y3 = vmlaq_f32(y3, va, vld1q_f32(&x[i + 12]));
+			vst1q_f32(&y[i], y0);
+			vst1q_f32(&y[i + 4], y1);
+			vst1q_f32(&y[i + 8], y2);
+			vst1q_f32(&y[i + 12], y3);
+		}
+		for (; i + 4 <= count; i += 4) {
+			vst1q_f32(&y[i], vmlaq_f32(vld1q_f32(&y[i]), va,
+			    vld1q_f32(&x[i])));
+		}
+#endif /* __ARM_NEON */
+		for (; i < count; ++i) {
+			y[i] += a * x[i];
+		}
+	} else {
+		int ix = blas_neon_start(count, *incx);
+		int iy = blas_neon_start(count, *incy);
+
+		for (; i < count; ++i) {
+			y[iy] += a * x[ix];
+			ix += *incx;
+			iy += *incy;
+		}
+	}
+}
+
+float
+sdot_(const int *n, const float *x, const int *incx, const float *y,
+    const int *incy)
+{
+	int count = *n;
+	float sum = 0.0f;
+	int i = 0;
+
+	if (count <= 0) {
+		return 0.0f;
+	}
+
+	if (*incx == 1 && *incy == 1) {
+#ifdef __ARM_NEON
+		/* Independent accumulators hide the latency of VMLA */
+		float32x4_t s0 = vdupq_n_f32(0.0f);
+		float32x4_t s1 = vdupq_n_f32(0.0f);
+		float32x4_t s2 = vdupq_n_f32(0.0f);
+		float32x4_t s3 = vdupq_n_f32(0.0f);
+		float32x2_t s;
+
+		for (; i + 16 <= count; i += 16) {
+			s0 = vmlaq_f32(s0, vld1q_f32(&x[i]), vld1q_f32(&y[i]));
+			s1 = vmlaq_f32(s1, vld1q_f32(&x[i + 4]),
+			    vld1q_f32(&y[i + 4]));
+			s2 = vmlaq_f32(s2, vld1q_f32(&x[i + 8]),
+			    vld1q_f32(&y[i + 8]));
+			s3 = vmlaq_f32(s3, vld1q_f32(&x[i + 12]),
+			    vld1q_f32(&y[i + 12]));
+		}
+		for (; i + 4 <= count; i += 4) {
+			s0 = vmlaq_f32(s0, vld1q_f32(&x[i]), vld1q_f32(&y[i]));
+		}
+		s0 = vaddq_f32(vaddq_f32(s0, s1), vaddq_f32(s2, s3));
+		s = vadd_f32(vget_low_f32(s0), vget_high_f32(s0));
+		sum = vget_lane_f32(vpadd_f32(s, s), 0);
+#endif /* __ARM_NEON */
+		for (; i < count; ++i) {
+			sum += x[i] * y[i];
+		}
+	} else {
+		int ix = blas_neon_start(count, *incx);
+		int iy = blas_neon_start(count, *incy);
+
+		for (; i < count; ++i) {
+			sum += x[ix] * y[iy];
+			ix += *incx;
+			iy += *incy;
+		}
+	}
+
+	return sum;
+}
+
+void
+daxpy_(const int *n, const double *alpha, const double *x, const int *incx,
+    double *y, const int *incy)
+{
+	int count = *n;
+	double a = *alpha;
+	int i = 0;
+
+	if (count <= 0 || a == 0.0) {
+		return;
+	}
+
+	if (*incx == 1 && *incy == 1) {
+		/* Four independent multiply-adds per iteration for the VFP */
+		for (; i + 4 <= count; i += 4) {
+			double y0 = y[i] + a * x[i];
+			double y1 = y[i + 1] + a * x[i + 1];
+			double y2 = y[i + 2] + a * x[i + 2];
+			double y3 = y[i + 3] + a * x[i + 3];
+
+			y[i] = y0;
+			y[i + 1] = y1;
+			y[i + 2] = y2;
+			y[i + 3] = y3;
+		}
+		for (; i < count; ++i) {
+			y[i] += a * x[i];
+		}
+	} else {
+		int ix = blas_neon_start(count, *incx);
+		int iy = blas_neon_start(count, *incy);
+
+		for (; i < count; ++i) {
+			y[iy] += a * x[ix];
+			ix += *incx;
+			iy += *incy;
+		}
+	}
+}
+
+double
+ddot_(const int *n, const double *x, const int *incx, const double *y,
+    const int *incy)
+{
+	int count = *n;
+	double sum = 0.0;
+	int i = 0;
+
+	if (count <= 0) {
+		return 0.0;
+	}
+
+	if (*incx == 1 && *incy == 1) {
+		double s0 = 0.0;
+		double s1 = 0.0;
+		double s2 = 0.0;
+		double s3 = 0.0;
+
+		for (; i + 4 <= count; i += 4) {
+			s0 += x[i] * y[i];
+			s1 += x[i + 1] * y[i + 1];
+			s2 += x[i + 2] * y[i + 2];
+			s3 += x[i + 3] * y[i + 3];
+		}
+		sum = (s0 + s1) + (s2 + s3);
+		for (; i < count; ++i) {
+			sum += x[i] * y[i];
+		}
+	} else {
+		int ix = blas_neon_start(count, *incx);
+		int iy = blas_neon_start(count, *incy);
+
+		for (; i < count; ++i) {
+			sum += x[ix] * y[iy];
+			ix += *incx;
+			iy += *incy;
+		}
+	}
+
+	return sum;
+}
@@ -0,0 +1,121 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "blas-neon.h"
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif /* __ARM_NEON */
+
+#define GEMM_T			float
+#define GEMM_NAME(x)		s##x
+#define GEMM_XERBLA_NAME	"SGEMM "
+#define GEMM_MR			8
+#define GEMM_NR			4
+#define GEMM_MC			BLAS_NEON_SGEMM_MC
+#define GEMM_KC			BLAS_NEON_SGEMM_KC
+#define GEMM_NC			BLAS_NEON_SGEMM_NC
+
+#ifdef __ARM_NEON
+/*
+ * 8 x 4 block of C in eight q registers. Every step loads a column of eight
+ * elements of A and a row of four elements of B and multiplies them by lane.
+ */
+static void
+sgemm_kernel(int kc, const float *a, const float *b, float *c, int ldc)
+{
+	float32x4_t c00 = vdupq_n_f32(0.0f);
+	float32x4_t c10 = vdupq_n_f32(0.0f);
+	float32x4_t c01 = vdupq_n_f32(0.0f);
+	float32x4_t c11 = vdupq_n_f32(0.0f);
+	float32x4_t c02 = vdupq_n_f32(0.0f);
+	float32x4_t c12 = vdupq_n_f32(0.0f);
+	float32x4_t c03 = vdupq_n_f32(0.0f);
+	float32x4_t c13 = vdupq_n_f32(0.0f);
+	int p;
+	int j;
+
+	for (p = 0; p < kc; ++p) {
+		float32x4_t a0 = vld1q_f32(a);
+		float32x4_t a1 = vld1q_f32(a + 4);
+		float32x4_t bv = vld1q_f32(b);
+		float32x2_t b01 = vget_low_f32(bv);
+		float32x2_t b23 = vget_high_f32(bv);
+
+		c00 = vmlaq_lane_f32(c00, a0, b01, 0);
+		c10 = vmlaq_lane_f32(c10, a1, b01, 0);
+		c01 = vmlaq_lane_f32(c01, a0, b01, 1);
+		c11 = vmlaq_lane_f32(c11, a1, b01, 1);
+		c02 = vmlaq_lane_f32(c02, a0, b23, 0);
+		c12 = vmlaq_lane_f32(c12, a1, b23, 0);
+		c03 = vmlaq_lane_f32(c03, a0, b23, 1);
+		c13 = vmlaq_lane_f32(c13, a1, b23, 1);
+
+		a += GEMM_MR;
+		b += GEMM_NR;
+	}
+
+	{
+		float32x4_t lo[GEMM_NR] = { c00, c01, c02, c03 };
+		float32x4_t hi[GEMM_NR] = { c10, c11, c12, c13 };
+
+		for (j = 0; j < GEMM_NR; ++j) {
+			float *cj = &c[j * ldc];
+
+			vst1q_f32(cj, vaddq_f32(vld1q_f32(cj), lo[j]));
+			vst1q_f32(cj + 4, vaddq_f32(vld1q_f32(cj + 4), hi[j]));
+		}
+	}
+}
+#else /* __ARM_NEON */
+static void
+sgemm_kernel(int kc, const float *a, const float *b, float *c, int ldc)
+{
+	float acc[GEMM_MR * GEMM_NR] = { 0.0f };
+	int p;
+	int i;
+	int j;
+
+	for (p = 0; p < kc; ++p) {
+		for (j = 0; j < GEMM_NR; ++j) {
+			for (i = 0; i < GEMM_MR; ++i) {
+				acc[i + j * GEMM_MR] += a[i] * b[j];
+			}
+		}
+		a += GEMM_MR;
+		b += GEMM_NR;
+	}
+
+	for (j = 0; j < GEMM_NR; ++j) {
+		for (i = 0; i < GEMM_MR; ++i) {
+			c[i + j * ldc] += acc[i + j * GEMM_MR];
+		}
+	}
+}
+#endif /* __ARM_NEON */
+
+#include "gemm-template.h"
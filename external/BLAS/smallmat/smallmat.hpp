@@ -0,0 +1,383 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SMALLMAT_HPP
+#define SMALLMAT_HPP
+
+/*
+ * Fixed size matrices from 1x1 to about 16x16 for filters and kinematics.
+ *
+ * All sizes are template parameters, so the loops have constant bounds and
+ * are unrolled. Nothing is allocated and there are no argument checks like in
+ * BLAS and LAPACK. The storage is column major like in BLAS with every column
+ * padded to a multiple of four elements, so single precision columns are
+ * whole NEON registers. The padding is always zero.
+ *
+ *   smallmat::matrix<float, 6, 6> p;
+ *   smallmat::matrix<float, 6, 6> l;
+ *
+ *   p(0, 0) = 1.0f;
+ *   ...
+ *   if (smallmat::cholesky(l, p)) {
+ *           smallmat::cholesky_solve(x, l, b);
+ *   }
+ *
+ * The functions that fail for singular (or not positive definite) matrices
+ * return false and leave the result undefined.
+ */
+
+#include <cmath>
+#include <cstddef>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif /* __ARM_NEON */
+
+namespace smallmat {
+
+namespace detail {
+
+/* Call f(0), ..., f(N - 1) without a loop */
+template <int N>
+struct unroll {
+	template <typename F>
+	static inline __attribute__((always_inline)) void
+	run(F &&f)
+	{
+		unroll<N - 1>::run(f);
+		f(N - 1);
+	}
+};
+
+template <>
+struct unroll<0> {
+	template <typename F>
+	static inline __attribute__((always_inline)) void
+	run(F &&)
+	{
+	}
+};
+
+constexpr int
+padded(int rows)
+{
+	return (rows + 3) / 4 * 4;
+}
+
+/* Operations on whole padded columns of length LD */
+template <typename T, int LD>
+struct column {
+	/* y += a * x */
+	static inline __attribute__((always_inline)) void
+	axpy(T *y, T a, const T *x)
+	{
+		unroll<LD>::run([&](int i) { y[i] += a * x[i]; });
+	}
+
+	/* y = a * x */
+	static inline __attribute__((always_inline)) void
+	scale(T *y, T a, const T *x)
+	{
+		unroll<LD>::run([&](int i) { y[i] = a * x[i]; });
+	}
+};
+
+#ifdef __ARM_NEON
+template <int LD>
+struct column<float, LD> {
+	static inline __attribute__((always_inline)) void
+	axpy(float *y, float a, const float *x)
+	{
+		unroll<LD / 4>::run([&](int i) {
+			vst1q_f32(&y[4 * i], vmlaq_n_f32(vld1q_f32(&y[4 * i]),
+			    vld1q_f32(&x[4 * i]), a));
+		});
+	}
+
+	static inline __attribute__((always_inline)) void
+	scale(float *y, float a, const float *x)
+	{
+		unroll<LD / 4>::run([&](int i) {
+			vst1q_f32(&y[4 * i], vmulq_n_f32(vld1q_f32(&x[4 * i]),
+			    a));
+		});
+	}
+};
+#endif /* __ARM_NEON */
+
+} /* namespace detail */
+
+template <typename T, int R, int C>
+struct matrix {
+	static constexpr int rows = R;
+	static constexpr int cols = C;
+	/* Distance of the columns in elements */
+	static constexpr int ld = detail::padded(R);
+
+	alignas(16) T data[C * ld] = {};
+
+	T &
+	operator()(int i, int j)
+	{
+		return data[i + j * ld];
+	}
+
+	constexpr const T &
+	operator()(int i, int j) const
+	{
+		return data[i + j * ld];
+	}
+
+	T *
+	col(int j)
+	{
+		return &data[j * ld];
+	}
+
+	constexpr const T *
+	col(int j) const
+	{
+		return &data[j * ld];
+	}
+
+	static matrix
+	identity()
+	{
+		matrix m;
+
+		detail::unroll<(R < C ? R : C)>::run([&](int i) {
+			m(i, i) = T(1);
+		});
+		return m;
+	}
+};
+
+template <typename T, int N>
+using vector = matrix<T, N, 1>;
+
+/* out = a * b, out must be neither a nor b */
+template <typename T, int R, int K, int C>
+inline void
+multiply(matrix<T, R, C> &out, const matrix<T, R, K> &a,
+    const matrix<T, K, C> &b)
+{
+	using col = detail::column<T, matrix<T, R, C>::ld>;
+
+	detail::unroll<C>::run([&](int j) {
+		T *o = out.col(j);
+
+		col::scale(o, b(0, j), a.col(0));
+		detail::unroll<K - 1>::run([&](int k) {
+			col::axpy(o, b(k + 1, j), a.col(k + 1));
+		});
+	});
+}
+
+template <typename T, int R, int K, int C>
+inline matrix<T, R, C>
+operator*(const matrix<T, R, K> &a, const matrix<T, K, C> &b)
+{
+	matrix<T, R, C> out;
+
+	multiply(out, a, b);
+	return out;
+}
+
+template <typename T, int R, int C>
+inline matrix<T, C, R>
+transpose(const matrix<T, R, C> &a)
+{
+	matrix<T, C, R> out;
+
+	for (int j = 0; j < C; ++j) {
+		for (int i = 0; i < R; ++i) {
+			out(j, i) = a(i, j);
+		}
+	}
+	return out;
+}
+
+/*
+ * Cholesky factorization a = l * l^T of a symmetric positive definite
+ * matrix. Only the lower triangle of a is used, the upper one of l is zero.
+ */
+template <typename T, int N>
+inline bool
+cholesky(matrix<T, N, N> &l, const matrix<T, N, N> &a)
+{
+	using col = detail::column<T, matrix<T, N, N>::ld>;
+
+	for (int j = 0; j < N; ++j) {
+		T *lj = l.col(j);
+		T d;
+
+		/* Left looking: a(:, j) - sum of l(:, k) * l(j, k) for k < j */
+		col::scale(lj, T(1), a.col(j));
+		for (int k = 0; k < j; ++k) {
+			col::axpy(lj, -l(j, k), l.col(k));
+		}
+
+		d = lj[j];
+		if (!(d > T(0))) {
+			return false;
+		}
+		d = std::sqrt(d);
+		col::scale(lj, T(1) / d, lj);
+		for (int i = 0; i < j; ++i) {
+			lj[i] = T(0);
+		}
+		lj[j] = d;
+	}
+
+	return true;
+}
+
+/* Solve a * x = b with the Cholesky factor l of a, x may be b */
+template <typename T, int N, int C>
+inline void
+cholesky_solve(matrix<T, N, C> &x, const matrix<T, N, N> &l,
+    const matrix<T, N, C> &b)
+{
+	using col = detail::column<T, matrix<T, N, C>::ld>;
+
+	if (&x != &b) {
+		x = b;
+	}
+
+	for (int j = 0; j < C; ++j) {
+		T *xj = x.col(j);
+
+		/* l * y = b, column oriented */
+		for (int k = 0; k < N; ++k) {
+			T y = xj[k] / l(k, k);
+
+			col::axpy(xj, -y, l.col(k));
+			xj[k] = y;
+		}
+
+		/* l^T * x = y, dot products with the columns of l */
+		for (int k = N - 1; k >= 0; --k) {
+			const T *lk = l.col(k);
+			T sum = xj[k];
+
+			for (int i = k + 1; i < N; ++i) {
+				sum -= lk[i] * xj[i];
+			}
+			xj[k] = sum / lk[k];
+		}
+	}
+}
+
+/*
+ * Solve a * x = b with Gaussian elimination and partial pivoting. The
+ * updates are done on whole columns, so they use NEON.
+ */
+template <typename T, int N, int C>
+inline bool
+solve(matrix<T, N, C> &x, const matrix<T, N, N> &a, const matrix<T, N, C> &b)
+{
+	using col = detail::column<T, matrix<T, N, N>::ld>;
+	static_assert(matrix<T, N, N>::ld == matrix<T, N, C>::ld,
+	    "same column padding");
+	matrix<T, N, N> u = a;
+	matrix<T, N, 1> m;
+
+	x = b;
+
+	for (int k = 0; k < N; ++k) {
+		int p = k;
+		T pivot;
+
+		for (int i = k + 1; i < N; ++i) {
+			if (std::fabs(u(i, k)) > std::fabs(u(p, k))) {
+				p = i;
+			}
+		}
+		pivot = u(p, k);
+		if (pivot == T(0)) {
+			return false;
+		}
+		if (p != k) {
+			for (int j = k; j < N; ++j) {
+				T t = u(k, j);
+
+				u(k, j) = u(p, j);
+				u(p, j) = t;
+			}
+			for (int j = 0; j < C; ++j) {
+				T t = x(k, j);
+
+				x(k, j) = x(p, j);
+				x(p, j) = t;
+			}
+		}
+
+		/* Multipliers below the pivot, zero elsewhere */
+		col::scale(m.col(0), T(1) / pivot, u.col(k));
+		for (int i = 0; i <= k; ++i) {
+			m(i, 0) = T(0);
+		}
+		for (int j = k + 1; j < N; ++j) {
+			col::axpy(u.col(j), -u(k, j), m.col(0));
+		}
+		for (int j = 0; j < C; ++j) {
+			col::axpy(x.col(j), -x(k, j), m.col(0));
+		}
+	}
+
+	/* Back substitution with the columns of u above the diagonal */
+	for (int k = N - 1; k >= 0; --k) {
+		T *uk = u.col(k);
+		T d = uk[k];
+
+		for (int i = k; i < matrix<T, N, N>::ld; ++i) {
+			uk[i] = T(0);
+		}
+		for (int j = 0; j < C; ++j) {
+			T v = x(k, j) / d;
+
+			col::axpy(x.col(j), -v, uk);
+			x(k, j) = v;
+		}
+	}
+
+	return true;
+}
+
+/* inv = a^-1, inv may be a */
+template <typename T, int N>
+inline bool
+inverse(matrix<T, N, N> &inv, const matrix<T, N, N> &a)
+{
+	matrix<T, N, N> copy = a;
+
+	return solve(inv, copy, matrix<T, N, N>::identity());
+}
+
+} /* namespace smallmat */
+
+#endif /* SMALLMAT_HPP */
@@ -0,0 +1,255 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dsp-internal.h"
+
+#include <string.h>
+
+/*
+ * The cascades run section by section over the whole block, so the
+ * coefficients and the state of a section stay in registers. The first
+ * section reads the input, the others work in place on the output.
+ */
+
+void
+dsp_biquad_f32_init(struct dsp_biquad_f32 *bq, const float *coeffs,
+    uint32_t sections, float *state)
+{
+	bq->coeffs = coeffs;
+	bq->state = state;
+	bq->sections = sections;
+	memset(state, 0, 2 * sections * sizeof(*state));
+}
+
+void
+dsp_biquad_f32(struct dsp_biquad_f32 *bq, const float *in, float *out,
+    uint32_t n)
+{
+	const float *src = in;
+	uint32_t s;
+
+	for (s = 0; s < bq->sections; ++s) {
+		const float *c = &bq->coeffs[5 * s];
+		float b0 = c[0];
+		float b1 = c[1];
+		float b2 = c[2];
+		float a1 = c[3];
+		float a2 = c[4];
+		float d1 = bq->state[2 * s];
+		float d2 = bq->state[2 * s + 1];
+		uint32_t i;
+
+		/* Transposed direct form II */
+		for (i = 0; i < n; ++i) {
+			float x = src[i];
+			float y = b0 * x + d1;
+
+			d1 = b1 * x - a1 * y + d2;
+			d2 = b2 * x - a2 * y;
+			out[i] = y;
+		}
+
+		bq->state[2 * s] = d1;
+		bq->state[2 * s + 1] = d2;
+		src = out;
+	}
+}
+
+void
+dsp_biquad_f32x4_init(struct dsp_biquad_f32 *bq, const float *coeffs,
+    uint32_t sections, float *state)
+{
+	bq->coeffs = coeffs;
+	bq->state = state;
+	bq->sections = sections;
+	memset(state, 0, 2 * 4 * sections * sizeof(*state));
+}
+
+void
+dsp_biquad_f32x4(struct dsp_biquad_f32 *bq, const float *in, float *out,
+    uint32_t n)
+{
+	const float *src = in;
+	uint32_t s;
+
+	for (s = 0; s < bq->sections; ++s) {
+		const float *c = &bq->coeffs[5 * s];
+		float *state = &bq->state[8 * s];
+		uint32_t i;
+#ifdef __ARM_NEON
+		float32x4_t d1 = vld1q_f32(&state[0]);
+		float32x4_t d2 = vld1q_f32(&state[4]);
+
+		for (i = 0; i < n; ++i) {
+			float32x4_t x = vld1q_f32(&src[4 * i]);
+			float32x4_t y = vmlaq_n_f32(d1, x, c[0]);
+
+			d1 = vmlsq_n_f32(vmlaq_n_f32(d2, x, c[1]), y, c[3]);
+			d2 = vmlsq_n_f32(vmulq_n_f32(x, c[2]), y, c[4]);
+			vst1q_f32(&out[4 * i], y);
+		}
+
+		vst1q_f32(&state[0], d1);
+		vst1q_f32(&state[4], d2);
+#else /* __ARM_NEON */
+		uint32_t ch;
+
+		for (ch = 0; ch < 4; ++ch) {
+			float d1 = state[ch];
+			float d2 = state[4 + ch];
+
+			for (i = 0; i < n; ++i) {
+				float x = src[4 * i + ch];
+				float y = c[0] * x + d1;
+
+				d1 = c[1] * x - c[3] * y + d2;
+				d2 = c[2] * x - c[4] * y;
+				out[4 * i + ch] = y;
+			}
+
+			state[ch] = d1;
+			state[4 + ch] = d2;
+		}
+#endif /* __ARM_NEON */
+		src = out;
+	}
+}
+
+void
+dsp_biquad_q15_init(struct dsp_biquad_q15 *bq, const dsp_q15 *coeffs,
+    uint32_t sections, uint32_t post_shift, dsp_q15 *state)
+{
+	bq->coeffs = coeffs;
+	bq->state = state;
+	bq->sections = sections;
+	bq->post_shift = post_shift;
+	memset(state, 0, 4 * sections * sizeof(*state));
+}
+
+void
+dsp_biquad_q15(struct dsp_biquad_q15 *bq, const dsp_q15 *in, dsp_q15 *out,
+    uint32_t n)
+{
+	const dsp_q15 *src = in;
+	uint32_t shift = 15 - bq->post_shift;
+	uint32_t s;
+
+	for (s = 0; s < bq->sections; ++s) {
+		const dsp_q15 *c = &bq->coeffs[5 * s];
+		int32_t b0 = c[0];
+		int32_t b1 = c[1];
+		int32_t b2 = c[2];
+		int32_t a1 = c[3];
+		int32_t a2 = c[4];
+		dsp_q15 *state = &bq->state[4 * s];
+		int32_t x1 = state[0];
+		int32_t x2 = state[1];
+		int32_t y1 = state[2];
+		int32_t y2 = state[3];
+		uint32_t i;
+
+		/* Direct form I, the Q30 products can't overflow 64 bits */
+		for (i = 0; i < n; ++i) {
+			int32_t x = src[i];
+			int64_t acc = (int64_t)b0 * x + (int64_t)b1 * x1 +
+			    (int64_t)b2 * x2 - (int64_t)a1 * y1 -
+			    (int64_t)a2 * y2;
+			dsp_q15 y = dsp_sat_q15(acc >> shift);
+
+			x2 = x1;
+			x1 = x;
+			y2 = y1;
+			y1 = y;
+			out[i] = y;
+		}
+
+		state[0] = (dsp_q15)x1;
+		state[1] = (dsp_q15)x2;
+		state[2] = (dsp_q15)y1;
+		state[3] = (dsp_q15)y2;
+		src = out;
+	}
+}
+
+void
+dsp_biquad_q31_init(struct dsp_biquad_q31 *bq, const dsp_q31 *coeffs,
+    uint32_t sections, uint32_t post_shift, dsp_q31 *state)
+{
+	bq->coeffs = coeffs;
+	bq->state = state;
+	bq->sections = sections;
+	bq->post_shift = post_shift;
+	memset(state, 0, 4 * sections * sizeof(*state));
+}
+
+void
+dsp_biquad_q31(struct dsp_biquad_q31 *bq, const dsp_q31 *in, dsp_q31 *out,
+    uint32_t n)
+{
+	const dsp_q31 *src = in;
+	uint32_t shift = 30 - bq->post_shift;
+	uint32_t s;
+
+	for (s = 0; s < bq->sections; ++s) {
+		const dsp_q31 *c = &bq->coeffs[5 * s];
+		int64_t b0 = c[0];
+		int64_t b1 = c[1];
+		int64_t b2 = c[2];
+		int64_t a1 = c[3];
+		int64_t a2 = c[4];
+		dsp_q31 *state = &bq->state[4 * s];
+		int64_t x1 = state[0];
+		int64_t x2 = state[1];
+		int64_t y1 = state[2];
+		int64_t y2 = state[3];
+		uint32_t i;
+
+		/*
+		 * Direct form I. The Q62 products are summed up as Q61, which
+		 * leaves two guard bits for the five of them.
+		 */
+		for (i = 0; i < n; ++i) {
+			int64_t x = src[i];
+			int64_t acc = ((b0 * x) >> 1) + ((b1 * x1) >> 1) +
+			    ((b2 * x2) >> 1) - ((a1 * y1) >> 1) -
+			    ((a2 * y2) >> 1);
+			dsp_q31 y = dsp_sat_q31(acc >> shift);
+
+			x2 = x1;
+			x1 = x;
+			y2 = y1;
+			y1 = y;
+			out[i] = y;
+		}
+
+		state[0] = (dsp_q31)x1;
+		state[1] = (dsp_q31)x2;
+		state[2] = (dsp_q31)y1;
+		state[3] = (dsp_q31)y2;
+		src = out;
+	}
+}
@@ -0,0 +1,143 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dsp-internal.h"
+
+#include <string.h>
+
+/* Same state layout as the FIR filters, see fir.c */
+
+static float
+decimate_f32_dot(const float *c, uint32_t taps, const float *x)
+{
+	uint32_t k = 0;
+	float acc = 0.0f;
+
+#ifdef __ARM_NEON
+	float32x4_t acc4 = vdupq_n_f32(0.0f);
+
+	for (; k + 4 <= taps; k += 4) {
+		acc4 = vmlaq_f32(acc4, vld1q_f32(&c[k]),
+		    dsp_rev_f32(vld1q_f32(x - k - 3)));
+	}
+	acc = dsp_hsum_f32(acc4);
+#endif /* __ARM_NEON */
+	for (; k < taps; ++k) {
+		acc += c[k] * x[-(int32_t)k];
+	}
+
+	return acc;
+}
+
+static int64_t
+decimate_q15_dot(const dsp_q15 *c, uint32_t taps, const dsp_q15 *x)
+{
+	uint32_t k = 0;
+	int64_t acc = 0;
+
+#ifdef __ARM_NEON
+	int64x2_t acc2 = vdupq_n_s64(0);
+
+	for (; k + 4 <= taps; k += 4) {
+		acc2 = vpadalq_s32(acc2, vmull_s16(vld1_s16(&c[k]),
+		    vrev64_s16(vld1_s16(x - k - 3))));
+	}
+	acc = vgetq_lane_s64(acc2, 0) + vgetq_lane_s64(acc2, 1);
+#endif /* __ARM_NEON */
+	for (; k < taps; ++k) {
+		acc += (int32_t)c[k] * x[-(int32_t)k];
+	}
+
+	return acc;
+}
+
+void
+dsp_decimate_f32_init(struct dsp_decimate_f32 *dec, uint32_t factor,
+    const float *coeffs, uint32_t taps, float *state, uint32_t max_block)
+{
+	dsp_fir_f32_init(&dec->fir, coeffs, taps, state, max_block);
+	dec->fir.max_block = max_block / factor * factor;
+	dec->factor = factor;
+}
+
+void
+dsp_decimate_f32(struct dsp_decimate_f32 *dec, const float *in, float *out,
+    uint32_t n)
+{
+	struct dsp_fir_f32 *fir = &dec->fir;
+	uint32_t history = fir->taps - 1;
+
+	while (n > 0) {
+		uint32_t block = dsp_min(n, fir->max_block);
+		uint32_t j;
+
+		memcpy(&fir->state[history], in, block * sizeof(*in));
+		for (j = 0; j < block / dec->factor; ++j) {
+			out[j] = decimate_f32_dot(fir->coeffs, fir->taps,
+			    &fir->state[j * dec->factor + history]);
+		}
+		memmove(fir->state, &fir->state[block],
+		    history * sizeof(*in));
+		in += block;
+		out += block / dec->factor;
+		n -= block;
+	}
+}
+
+void
+dsp_decimate_q15_init(struct dsp_decimate_q15 *dec, uint32_t factor,
+    const dsp_q15 *coeffs, uint32_t taps, dsp_q15 *state, uint32_t max_block)
+{
+	dsp_fir_q15_init(&dec->fir, coeffs, taps, state, max_block);
+	dec->fir.max_block = max_block / factor * factor;
+	dec->factor = factor;
+}
+
+void
+dsp_decimate_q15(struct dsp_decimate_q15 *dec, const dsp_q15 *in,
+    dsp_q15 *out, uint32_t n)
+{
+	struct dsp_fir_q15 *fir = &dec->fir;
+	uint32_t history = fir->taps - 1;
+
+	while (n > 0) {
+		uint32_t block = dsp_min(n, fir->max_block);
+		uint32_t j;
+
+		memcpy(&fir->state[history], in, block * sizeof(*in));
+		for (j = 0; j < block / dec->factor; ++j) {
+			out[j] = dsp_sat_q15(decimate_q15_dot(fir->coeffs,
+			    fir->taps,
+			    &fir->state[j * dec->factor + history]) >> 15);
+		}
+		memmove(fir->state, &fir->state[block],
+		    history * sizeof(*in));
+		in += block;
+		out += block / dec->factor;
+		n -= block;
+	}
+}
@@ -0,0 +1,92 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DSP_INTERNAL_H
+#define DSP_INTERNAL_H
+
+#include "dsp/dsp.h"
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif /* __ARM_NEON */
+
+static inline dsp_q15
+dsp_sat_q15(int64_t value)
+{
+	if (value > INT16_MAX) {
+		return INT16_MAX;
+	}
+	if (value < INT16_MIN) {
+		return INT16_MIN;
+	}
+	return (dsp_q15)value;
+}
+
+static inline dsp_q31
+dsp_sat_q31(int64_t value)
+{
+	if (value > INT32_MAX) {
+		return INT32_MAX;
+	}
+	if (value < INT32_MIN) {
+		return INT32_MIN;
+	}
+	return (dsp_q31)value;
+}
+
+/* Q31 product like VQDMULH: (2 a b) >> 32 with saturation */
+static inline dsp_q31
+dsp_mul_q31(dsp_q31 a, dsp_q31 b)
+{
+	return dsp_sat_q31(((int64_t)a * b) >> 31);
+}
+
+static inline uint32_t
+dsp_min(uint32_t a, uint32_t b)
+{
+	return a < b ? a : b;
+}
+
+#ifdef __ARM_NEON
+static inline float
+dsp_hsum_f32(float32x4_t v)
+{
+	float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+
+	return vget_lane_f32(vpadd_f32(s, s), 0);
+}
+
+/* Elements in reverse order */
+static inline float32x4_t
+dsp_rev_f32(float32x4_t v)
+{
+	v = vrev64q_f32(v);
+	return vcombine_f32(vget_high_f32(v), vget_low_f32(v));
+}
+#endif /* __ARM_NEON */
+
+#endif /* DSP_INTERNAL_H */
@@ -0,0 +1,282 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DSP_DSP_H
+#define DSP_DSP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Signal processing for sensor pipelines. The routines use NEON on the
+ * GRiSP2 and plain C elsewhere (GRiSP1), with the same results for the fixed
+ * point formats.
+ *
+ * Nothing allocates memory in the processing functions. Filters keep their
+ * history in a state buffer of the caller, so they can run block by block on
+ * a stream. Only dsp_rfft_f32_init() allocates the twiddle tables.
+ *
+ * Fixed point samples and coefficients are Q15 (int16_t) or Q31 (int32_t).
+ * Results are rounded toward minus infinity and saturated.
+ */
+
+typedef int16_t dsp_q15;
+typedef int32_t dsp_q31;
+
+/*
+ * FIR filter
+ *
+ * out[i] = sum of coeffs[k] * in[i - k] for k < taps. The state buffer needs
+ * taps - 1 + max_block elements, longer blocks are processed in pieces. The
+ * coefficients are not copied and must stay valid.
+ */
+struct dsp_fir_f32 {
+	const float *coeffs;
+	float *state;
+	uint32_t taps;
+	uint32_t max_block;
+};
+
+struct dsp_fir_q15 {
+	const dsp_q15 *coeffs;
+	dsp_q15 *state;
+	uint32_t taps;
+	uint32_t max_block;
+};
+
+struct dsp_fir_q31 {
+	const dsp_q31 *coeffs;
+	dsp_q31 *state;
+	uint32_t taps;
+	uint32_t max_block;
+};
+
+#define DSP_FIR_STATE_SIZE(taps, max_block) ((taps) - 1 + (max_block))
+
+void dsp_fir_f32_init(struct dsp_fir_f32 *fir, const float *coeffs,
+    uint32_t taps, float *state, uint32_t max_block);
+void dsp_fir_f32(struct dsp_fir_f32 *fir, const float *in, float *out,
+    uint32_t n);
+
+void dsp_fir_q15_init(struct dsp_fir_q15 *fir, const dsp_q15 *coeffs,
+    uint32_t taps, dsp_q15 *state, uint32_t max_block);
+void dsp_fir_q15(struct dsp_fir_q15 *fir, const dsp_q15 *in, dsp_q15 *out,
+    uint32_t n);
+
+/*
+ * The products are truncated to Q31 before they are summed up, like the
+ * saturating doubling multiply of NEON does it.
+ */
+void dsp_fir_q31_init(struct dsp_fir_q31 *fir, const dsp_q31 *coeffs,
+    uint32_t taps, dsp_q31 *state, uint32_t max_block);
+void dsp_fir_q31(struct dsp_fir_q31 *fir, const dsp_q31 *in, dsp_q31 *out,
+    uint32_t n);
+
+/*
+ * Polyphase FIR decimator
+ *
+ * Filters and keeps every factor-th sample. Only the kept outputs are
+ * computed, which is the same work as running the factor polyphase branches
+ * at the low rate. Blocks must be a multiple of the factor. The state buffer
+ * needs taps - 1 + max_block elements, max_block is rounded down to a
+ * multiple of the factor.
+ */
+struct dsp_decimate_f32 {
+	struct dsp_fir_f32 fir;
+	uint32_t factor;
+};
+
+struct dsp_decimate_q15 {
+	struct dsp_fir_q15 fir;
+	uint32_t factor;
+};
+
+void dsp_decimate_f32_init(struct dsp_decimate_f32 *dec, uint32_t factor,
+    const float *coeffs, uint32_t taps, float *state, uint32_t max_block);
+/* Writes n / factor samples to out */
+void dsp_decimate_f32(struct dsp_decimate_f32 *dec, const float *in,
+    float *out, uint32_t n);
+
+void dsp_decimate_q15_init(struct dsp_decimate_q15 *dec, uint32_t factor,
+    const dsp_q15 *coeffs, uint32_t taps, dsp_q15 *state, uint32_t max_block);
+void dsp_decimate_q15(struct dsp_decimate_q15 *dec, const dsp_q15 *in,
+    dsp_q15 *out, uint32_t n);
+
+/*
+ * Biquad IIR cascade
+ *
+ * Every section has the coefficients b0, b1, b2, a1, a2 (in this order, a0
+ * is 1) of
+ *
+ *   y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2]
+ *
+ * like the second order sections of scipy.signal (without a0, sign of a as
+ * there). The float cascade uses the transposed direct form II and needs two
+ * state values per section. The serial dependency of a single channel
+ * doesn't vectorize, so there is a NEON version for four channels of
+ * interleaved samples (for example the axes of an accelerometer), which
+ * needs 2 * 4 state values per section.
+ *
+ * The fixed point cascades use the direct form I with a 64-bit accumulator
+ * and four state values per section. The coefficients are scaled by
+ * 2^-post_shift to fit into [-1, 1), the sum is shifted back.
+ */
+struct dsp_biquad_f32 {
+	const float *coeffs;
+	float *state;
+	uint32_t sections;
+};
+
+struct dsp_biquad_q15 {
+	const dsp_q15 *coeffs;
+	dsp_q15 *state;
+	uint32_t sections;
+	uint32_t post_shift;
+};
+
+struct dsp_biquad_q31 {
+	const dsp_q31 *coeffs;
+	dsp_q31 *state;
+	uint32_t sections;
+	uint32_t post_shift;
+};
+
+void dsp_biquad_f32_init(struct dsp_biquad_f32 *bq, const float *coeffs,
+    uint32_t sections, float *state);
+void dsp_biquad_f32(struct dsp_biquad_f32 *bq, const float *in, float *out,
+    uint32_t n);
+
+/* Four channels, n frames of in[4 * i + channel] */
+void dsp_biquad_f32x4_init(struct dsp_biquad_f32 *bq, const float *coeffs,
+    uint32_t sections, float *state);
+void dsp_biquad_f32x4(struct dsp_biquad_f32 *bq, const float *in, float *out,
+    uint32_t n);
+
+void dsp_biquad_q15_init(struct dsp_biquad_q15 *bq, const dsp_q15 *coeffs,
+    uint32_t sections, uint32_t post_shift, dsp_q15 *state);
+void dsp_biquad_q15(struct dsp_biquad_q15 *bq, const dsp_q15 *in,
+    dsp_q15 *out, uint32_t n);
+
+void dsp_biquad_q31_init(struct dsp_biquad_q31 *bq, const dsp_q31 *coeffs,
+    uint32_t sections, uint32_t post_shift, dsp_q31 *state);
+void dsp_biquad_q31(struct dsp_biquad_q31 *bq, const dsp_q31 *in,
+    dsp_q31 *out, uint32_t n);
+
+/*
+ * Real FFT
+ *
+ * Forward transform of n real samples (n a power of two from 16 to 65536),
+ * not normalized. It is a complex FFT of n / 2 points with radix-4 stages in
+ * the Stockham order (no bit reversal) and a split of the result into the
+ * spectrum of the real signal. All twiddle factors are computed by the init
+ * function.
+ *
+ * The result has n / 2 + 1 bins packed into n floats: out[0] is the real DC
+ * bin, out[1] the real bin at n / 2 (Nyquist) and out[2 k], out[2 k + 1] the
+ * real and imaginary part of bin k for 0 < k < n / 2.
+ */
+struct dsp_rfft_f32 {
+	uint32_t n;
+	/* Twiddles of all stages and the split, see rfft.c */
+	float *tables;
+	/* Split real and imaginary parts, 2 * 2 * n / 2 floats */
+	float *work;
+};
+
+/* Returns 0 or -1 for an invalid size or if there is not enough memory */
+int dsp_rfft_f32_init(struct dsp_rfft_f32 *fft, uint32_t n);
+void dsp_rfft_f32_destroy(struct dsp_rfft_f32 *fft);
+/* in and out may be the same */
+void dsp_rfft_f32(struct dsp_rfft_f32 *fft, const float *in, float *out);
+
+/* Magnitudes of the n / 2 + 1 bins of a packed spectrum */
+void dsp_rfft_mag_f32(const float *spectrum, float *mag, uint32_t n);
+
+/*
+ * Windows
+ */
+enum dsp_window {
+	DSP_WINDOW_RECTANGULAR,
+	DSP_WINDOW_HANN,
+	DSP_WINDOW_HAMMING,
+	DSP_WINDOW_BLACKMAN,
+	DSP_WINDOW_FLATTOP,
+};
+
+/* Periodic window for spectral analysis (the DFT-even form) */
+void dsp_window_f32(enum dsp_window type, float *w, uint32_t n);
+void dsp_window_q15(enum dsp_window type, dsp_q15 *w, uint32_t n);
+
+/* out[i] = a[i] * b[i], out may be a or b */
+void dsp_mult_f32(const float *a, const float *b, float *out, uint32_t n);
+void dsp_mult_q15(const dsp_q15 *a, const dsp_q15 *b, dsp_q15 *out,
+    uint32_t n);
+
+/* Conversions with saturation, to fixed point truncated toward zero */
+void dsp_f32_to_q15(const float *in, dsp_q15 *out, uint32_t n);
+void dsp_q15_to_f32(const dsp_q15 *in, float *out, uint32_t n);
+void dsp_f32_to_q31(const float *in, dsp_q31 *out, uint32_t n);
+void dsp_q31_to_f32(const dsp_q31 *in, float *out, uint32_t n);
+
+/*
+ * Math functions on arrays
+ *
+ * Polynomial approximations, four values per NEON instruction. The maximum
+ * errors against the exact result, measured with all floats of the range
+ * (atan2 with 4 * 10^8 random pairs) by tools/libdsp/vmath-accuracy.c:
+ *
+ *   exp    1.0 ulp
+ *   log    0.83 ulp (0.87 ulp for the scalar version)
+ *   sin    1.4 ulp for |x| <= pi, 7.9e-8 absolute for |x| <= 8192
+ *   cos    1.5 ulp for |x| <= pi, 7.9e-8 absolute for |x| <= 8192
+ *   atan2  5.5 ulp (3.3 ulp for the scalar version)
+ *
+ * Beyond pi, the relative error of sin and cos grows near their zeros. They
+ * use sinf() and cosf() of libm for |x| > 8192. Results of exp below FLT_MIN
+ * are 0 and denormal inputs of log count as 0, because NEON flushes
+ * denormals to zero. Other special values (infinity, NaN, -0) give the
+ * results of libm.
+ *
+ * out may be the same as in.
+ */
+void dsp_exp_f32(const float *in, float *out, uint32_t n);
+void dsp_log_f32(const float *in, float *out, uint32_t n);
+void dsp_sin_f32(const float *in, float *out, uint32_t n);
+void dsp_cos_f32(const float *in, float *out, uint32_t n);
+/* out[i] = atan2(y[i], x[i]) */
+void dsp_atan2_f32(const float *y, const float *x, float *out, uint32_t n);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DSP_DSP_H */
@@ -0,0 +1,225 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dsp-internal.h"
+
+#include <string.h>
+
+/*
+ * All filters copy the new block behind the taps - 1 previous samples in the
+ * state buffer, so out[i] only depends on s[i] ... s[i + taps - 1] and a
+ * block needs no special case at its start.
+ */
+
+static void
+fir_f32_block(const float *c, uint32_t taps, const float *s, float *out,
+    uint32_t n)
+{
+	uint32_t i = 0;
+	uint32_t k;
+
+#ifdef __ARM_NEON
+	for (; i + 8 <= n; i += 8) {
+		float32x4_t acc0 = vdupq_n_f32(0.0f);
+		float32x4_t acc1 = vdupq_n_f32(0.0f);
+		const float *x = &s[i + taps - 1];
+
+		for (k = 0; k < taps; ++k) {
+			acc0 = vmlaq_n_f32(acc0, vld1q_f32(x - k), c[k]);
+			acc1 = vmlaq_n_f32(acc1, vld1q_f32(x - k + 4), c[k]);
+		}
+		vst1q_f32(&out[i], acc0);
+		vst1q_f32(&out[i + 4], acc1);
+	}
+#endif /* __ARM_NEON */
+	for (; i < n; ++i) {
+		const float *x = &s[i + taps - 1];
+		float acc = 0.0f;
+
+		for (k = 0; k < taps; ++k) {
+			acc += c[k] * x[-(int32_t)k];
+		}
+		out[i] = acc;
+	}
+}
+
+static void
+fir_q15_block(const dsp_q15 *c, uint32_t taps, const dsp_q15 *s,
+    dsp_q15 *out, uint32_t n)
+{
+	uint32_t i = 0;
+	uint32_t k;
+
+#ifdef __ARM_NEON
+	for (; i + 4 <= n; i += 4) {
+		int64x2_t acc_lo = vdupq_n_s64(0);
+		int64x2_t acc_hi = vdupq_n_s64(0);
+		const dsp_q15 *x = &s[i + taps - 1];
+
+		for (k = 0; k < taps; ++k) {
+			int32x4_t p = vmull_n_s16(vld1_s16(x - k), c[k]);
+
+			acc_lo = vaddw_s32(acc_lo, vget_low_s32(p));
+			acc_hi = vaddw_s32(acc_hi, vget_high_s32(p));
+		}
+		vst1_s16(&out[i], vqmovn_s32(vcombine_s32(
+		    vqshrn_n_s64(acc_lo, 15), vqshrn_n_s64(acc_hi, 15))));
+	}
+#endif /* __ARM_NEON */
+	for (; i < n; ++i) {
+		const dsp_q15 *x = &s[i + taps - 1];
+		int64_t acc = 0;
+
+		for (k = 0; k < taps; ++k) {
+			acc += (int32_t)c[k] * x[-(int32_t)k];
+		}
+		out[i] = dsp_sat_q15(acc >> 15);
+	}
+}
+
+static void
+fir_q31_block(const dsp_q31 *c, uint32_t taps, const dsp_q31 *s,
+    dsp_q31 *out, uint32_t n)
+{
+	uint32_t i = 0;
+	uint32_t k;
+
+#ifdef __ARM_NEON
+	for (; i + 4 <= n; i += 4) {
+		int64x2_t acc_lo = vdupq_n_s64(0);
+		int64x2_t acc_hi = vdupq_n_s64(0);
+		const dsp_q31 *x = &s[i + taps - 1];
+
+		for (k = 0; k < taps; ++k) {
+			int32x4_t p = vqdmulhq_n_s32(vld1q_s32(x - k), c[k]);
+
+			acc_lo = vaddw_s32(acc_lo, vget_low_s32(p));
+			acc_hi = vaddw_s32(acc_hi, vget_high_s32(p));
+		}
+		vst1q_s32(&out[i], vcombine_s32(vqmovn_s64(acc_lo),
+		    vqmovn_s64(acc_hi)));
+	}
+#endif /* __ARM_NEON */
+	for (; i < n; ++i) {
+		const dsp_q31 *x = &s[i + taps - 1];
+		int64_t acc = 0;
+
+		for (k = 0; k < taps; ++k) {
+			acc += dsp_mul_q31(c[k], x[-(int32_t)k]);
+		}
+		out[i] = dsp_sat_q31(acc);
+	}
+}
+
+void
+dsp_fir_f32_init(struct dsp_fir_f32 *fir, const float *coeffs, uint32_t taps,
+    float *state, uint32_t max_block)
+{
+	fir->coeffs = coeffs;
+	fir->state = state;
+	fir->taps = taps;
+	fir->max_block = max_block;
+	memset(state, 0, DSP_FIR_STATE_SIZE(taps, max_block) * sizeof(*state));
+}
+
+void
+dsp_fir_f32(struct dsp_fir_f32 *fir, const float *in, float *out, uint32_t n)
+{
+	uint32_t history = fir->taps - 1;
+
+	while (n > 0) {
+		uint32_t block = dsp_min(n, fir->max_block);
+
+		memcpy(&fir->state[history], in, block * sizeof(*in));
+		fir_f32_block(fir->coeffs, fir->taps, fir->state, out, block);
+		memmove(fir->state, &fir->state[block],
+		    history * sizeof(*in));
+		in += block;
+		out += block;
+		n -= block;
+	}
+}
+
+void
+dsp_fir_q15_init(struct dsp_fir_q15 *fir, const dsp_q15 *coeffs,
+    uint32_t taps, dsp_q15 *state, uint32_t max_block)
+{
+	fir->coeffs = coeffs;
+	fir->state = state;
+	fir->taps = taps;
+	fir->max_block = max_block;
+	memset(state, 0, DSP_FIR_STATE_SIZE(taps, max_block) * sizeof(*state));
+}
+
+void
+dsp_fir_q15(struct dsp_fir_q15 *fir, const dsp_q15 *in, dsp_q15 *out,
+    uint32_t n)
+{
+	uint32_t history = fir->taps - 1;
+
+	while (n > 0) {
+		uint32_t block = dsp_min(n, fir->max_block);
+
+		memcpy(&fir->state[history], in, block * sizeof(*in));
+		fir_q15_block(fir->coeffs, fir->taps, fir->state, out, block);
+		memmove(fir->state, &fir->state[block],
+		    history * sizeof(*in));
+		in += block;
+		out += block;
+		n -= block;
+	}
+}
+
+void
+dsp_fir_q31_init(struct dsp_fir_q31 *fir, const dsp_q31 *coeffs,
+    uint32_t taps, dsp_q31 *state, uint32_t max_block)
+{
+	fir->coeffs = coeffs;
+	fir->state = state;
+	fir->taps = taps;
+	fir->max_block = max_block;
+	memset(state, 0, DSP_FIR_STATE_SIZE(taps, max_block) * sizeof(*state));
+}
+
+void
+dsp_fir_q31(struct dsp_fir_q31 *fir, const dsp_q31 *in, dsp_q31 *out,
+    uint32_t n)
+{
+	uint32_t history = fir->taps - 1;
+
+	while (n > 0) {
+		uint32_t block = dsp_min(n, fir->max_block);
+
+		memcpy(&fir->state[history], in, block * sizeof(*in));
+		fir_q31_block(fir->coeffs, fir->taps, fir->state, out, block);
+		memmove(fir->state, &fir->state[block],
+		    history * sizeof(*in));
+		in += block;
+		out += block;
+		n -= block;
+	}
+}
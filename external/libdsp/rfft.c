@@ -0,0 +1,429 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dsp-internal.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The n real samples are the n / 2 = m complex values z[k] = x[2 k] +
+ * i x[2 k + 1]. Their FFT is computed in split format (real and imaginary
+ * parts in separate arrays), which keeps four values in a NEON register
+ * without shuffles.
+ *
+ * The complex FFT uses the Stockham algorithm: every stage reads one buffer
+ * and writes the other one in sorted order, so there is no bit reversal. The
+ * radix-4 stage of length l with stride s (l * s = m) is
+ *
+ *   a = x[q + s p], b = x[q + s (p + l/4)], c = ..(p + l/2), d = ..(p + 3l/4)
+ *   y[q + s 4p]       = (a + c) + (b + d)
+ *   y[q + s (4p + 1)] = w^p  ((a - c) - i (b - d))
+ *   y[q + s (4p + 2)] = w^2p ((a + c) - (b + d))
+ *   y[q + s (4p + 3)] = w^3p ((a - c) + i (b - d))
+ *
+ * for p < l/4, q < s and w = exp(-2 pi i / l). If log2(m) is odd, a radix-2
+ * stage of length 2 finishes it. The last step splits Z into the spectrum of
+ * the real signal:
+ *
+ *   X[k] = (Z[k] + Z*[m-k]) / 2 - i w_n^k (Z[k] - Z*[m-k]) / 2
+ *
+ * The tables hold 6 * l/4 twiddles (w^p, w^2p, w^3p) for every radix-4 stage
+ * followed by the m values w_n^k of the split, real parts first each.
+ */
+
+static void
+rfft_cmul(float ar, float ai, float wr, float wi, float *yr, float *yi)
+{
+	*yr = ar * wr - ai * wi;
+	*yi = ar * wi + ai * wr;
+}
+
+static void
+rfft_radix4_scalar(uint32_t l, uint32_t s, const float *tw,
+    const float *xr, const float *xi, float *yr, float *yi, uint32_t p)
+{
+	uint32_t m = l / 4;
+	uint32_t q;
+
+	for (q = 0; q < s; ++q) {
+		uint32_t i0 = q + s * p;
+		uint32_t i1 = i0 + s * m;
+		uint32_t i2 = i1 + s * m;
+		uint32_t i3 = i2 + s * m;
+		uint32_t o = q + s * 4 * p;
+		float apcr = xr[i0] + xr[i2];
+		float apci = xi[i0] + xi[i2];
+		float amcr = xr[i0] - xr[i2];
+		float amci = xi[i0] - xi[i2];
+		float bpdr = xr[i1] + xr[i3];
+		float bpdi = xi[i1] + xi[i3];
+		float bmdr = xr[i1] - xr[i3];
+		float bmdi = xi[i1] - xi[i3];
+
+		yr[o] = apcr + bpdr;
+		yi[o] = apci + bpdi;
+		/* (a - c) - i (b - d) */
+		rfft_cmul(amcr + bmdi, amci - bmdr, tw[p], tw[m + p],
+		    &yr[o + s], &yi[o + s]);
+		rfft_cmul(apcr - bpdr, apci - bpdi, tw[2 * m + p],
+		    tw[3 * m + p], &yr[o + 2 * s], &yi[o + 2 * s]);
+		/* (a - c) + i (b - d) */
+		rfft_cmul(amcr - bmdi, amci + bmdr, tw[4 * m + p],
+		    tw[5 * m + p], &yr[o + 3 * s], &yi[o + 3 * s]);
+	}
+}
+
+#ifdef __ARM_NEON
+static inline void
+rfft_cmul4(float32x4_t ar, float32x4_t ai, float32x4_t wr, float32x4_t wi,
+    float32x4_t *yr, float32x4_t *yi)
+{
+	*yr = vmlsq_f32(vmulq_f32(ar, wr), ai, wi);
+	*yi = vmlaq_f32(vmulq_f32(ar, wi), ai, wr);
+}
+
+/* Four butterflies of the same p and q, ..., q + 3 */
+static inline void
+rfft_radix4_neon(float32x4_t ar, float32x4_t ai, float32x4_t br,
+    float32x4_t bi, float32x4_t cr, float32x4_t ci, float32x4_t dr,
+    float32x4_t di, const float32x4_t *w, float32x4_t *y)
+{
+	float32x4_t apcr = vaddq_f32(ar, cr);
+	float32x4_t apci = vaddq_f32(ai, ci);
+	float32x4_t amcr = vsubq_f32(ar, cr);
+	float32x4_t amci = vsubq_f32(ai, ci);
+	float32x4_t bpdr = vaddq_f32(br, dr);
+	float32x4_t bpdi = vaddq_f32(bi, di);
+	float32x4_t bmdr = vsubq_f32(br, dr);
+	float32x4_t bmdi = vsubq_f32(bi, di);
+
+	y[0] = vaddq_f32(apcr, bpdr);
+	y[1] = vaddq_f32(apci, bpdi);
+	rfft_cmul4(vaddq_f32(amcr, bmdi), vsubq_f32(amci, bmdr), w[0], w[1],
+	    &y[2], &y[3]);
+	rfft_cmul4(vsubq_f32(apcr, bpdr), vsubq_f32(apci, bpdi), w[2], w[3],
+	    &y[4], &y[5]);
+	rfft_cmul4(vsubq_f32(amcr, bmdi), vaddq_f32(amci, bmdr), w[4], w[5],
+	    &y[6], &y[7]);
+}
+#endif /* __ARM_NEON */
+
+static void
+rfft_radix4(uint32_t l, uint32_t s, const float *tw, const float *xr,
+    const float *xi, float *yr, float *yi)
+{
+	uint32_t m = l / 4;
+	uint32_t p = 0;
+
+#ifdef __ARM_NEON
+	if (s == 1) {
+		/* First stage, four values of p at once */
+		for (; p + 4 <= m; p += 4) {
+			float32x4_t w[6];
+			float32x4_t y[8];
+			float32x4x4_t out;
+			int j;
+
+			for (j = 0; j < 6; ++j) {
+				w[j] = vld1q_f32(&tw[(uint32_t)j * m + p]);
+			}
+			rfft_radix4_neon(vld1q_f32(&xr[p]), vld1q_f32(&xi[p]),
+			    vld1q_f32(&xr[p + m]), vld1q_f32(&xi[p + m]),
+			    vld1q_f32(&xr[p + 2 * m]),
+			    vld1q_f32(&xi[p + 2 * m]),
+			    vld1q_f32(&xr[p + 3 * m]),
+			    vld1q_f32(&xi[p + 3 * m]), w, y);
+
+			/* Interleaved, y[4 p + j] for the four p */
+			out.val[0] = y[0];
+			out.val[1] = y[2];
+			out.val[2] = y[4];
+			out.val[3] = y[6];
+			vst4q_f32(&yr[4 * p], out);
+			out.val[0] = y[1];
+			out.val[1] = y[3];
+			out.val[2] = y[5];
+			out.val[3] = y[7];
+			vst4q_f32(&yi[4 * p], out);
+		}
+	} else if (s % 4 == 0) {
+		for (; p < m; ++p) {
+			float32x4_t w[6];
+			uint32_t q;
+			int j;
+
+			for (j = 0; j < 6; ++j) {
+				w[j] = vdupq_n_f32(tw[(uint32_t)j * m + p]);
+			}
+			for (q = 0; q < s; q += 4) {
+				uint32_t i0 = q + s * p;
+				uint32_t i1 = i0 + s * m;
+				uint32_t i2 = i1 + s * m;
+				uint32_t i3 = i2 + s * m;
+				uint32_t o = q + s * 4 * p;
+				float32x4_t y[8];
+
+				rfft_radix4_neon(vld1q_f32(&xr[i0]),
+				    vld1q_f32(&xi[i0]), vld1q_f32(&xr[i1]),
+				    vld1q_f32(&xi[i1]), vld1q_f32(&xr[i2]),
+				    vld1q_f32(&xi[i2]), vld1q_f32(&xr[i3]),
+				    vld1q_f32(&xi[i3]), w, y);
+				for (j = 0; j < 4; ++j) {
+					uint32_t k = o + (uint32_t)j * s;
+
+					vst1q_f32(&yr[k], y[2 * j]);
+					vst1q_f32(&yi[k], y[2 * j + 1]);
+				}
+			}
+		}
+	}
+#endif /* __ARM_NEON */
+	for (; p < m; ++p) {
+		rfft_radix4_scalar(l, s, tw, xr, xi, yr, yi, p);
+	}
+}
+
+/* Last stage of length 2, s = m / 2 */
+static void
+rfft_radix2(uint32_t s, const float *xr, const float *xi, float *yr,
+    float *yi)
+{
+	uint32_t q = 0;
+
+#ifdef __ARM_NEON
+	for (; q + 4 <= s; q += 4) {
+		float32x4_t ar = vld1q_f32(&xr[q]);
+		float32x4_t ai = vld1q_f32(&xi[q]);
+		float32x4_t br = vld1q_f32(&xr[q + s]);
+		float32x4_t bi = vld1q_f32(&xi[q + s]);
+
+		vst1q_f32(&yr[q], vaddq_f32(ar, br));
+		vst1q_f32(&yi[q], vaddq_f32(ai, bi));
+		vst1q_f32(&yr[q + s], vsubq_f32(ar, br));
+		vst1q_f32(&yi[q + s], vsubq_f32(ai, bi));
+	}
+#endif /* __ARM_NEON */
+	for (; q < s; ++q) {
+		float ar = xr[q];
+		float ai = xi[q];
+		float br = xr[q + s];
+		float bi = xi[q + s];
+
+		yr[q] = ar + br;
+		yi[q] = ai + bi;
+		yr[q + s] = ar - br;
+		yi[q + s] = ai - bi;
+	}
+}
+
+/* X[k] for 0 < k < m from Z[k] and Z[m - k], out interleaved */
+static void
+rfft_split(uint32_t m, const float *tw, const float *zr, const float *zi,
+    float *out)
+{
+	const float *wr = tw;
+	const float *wi = tw + m;
+	uint32_t k = 1;
+
+#ifdef __ARM_NEON
+	float32x4_t half = vdupq_n_f32(0.5f);
+
+	for (; k + 4 <= m; k += 4) {
+		float32x4_t ar = vld1q_f32(&zr[k]);
+		float32x4_t ai = vld1q_f32(&zi[k]);
+		/* Z[m - k], ..., Z[m - k - 3] */
+		float32x4_t br = dsp_rev_f32(vld1q_f32(&zr[m - k - 3]));
+		float32x4_t bi = dsp_rev_f32(vld1q_f32(&zi[m - k - 3]));
+		/* Even part (A + B*) / 2, odd part (A - B*) / 2 */
+		float32x4_t er = vmulq_f32(vaddq_f32(ar, br), half);
+		float32x4_t ei = vmulq_f32(vsubq_f32(ai, bi), half);
+		float32x4_t or = vmulq_f32(vsubq_f32(ar, br), half);
+		float32x4_t oi = vmulq_f32(vaddq_f32(ai, bi), half);
+		float32x4_t twr = vld1q_f32(&wr[k]);
+		float32x4_t twi = vld1q_f32(&wi[k]);
+		float32x4x2_t x;
+
+		/* X = E - i W O = E + W (Oi - i Or) */
+		x.val[0] = vaddq_f32(er, vmlaq_f32(vmulq_f32(twr, oi), twi,
+		    or));
+		x.val[1] = vaddq_f32(ei, vmlsq_f32(vmulq_f32(twi, oi), twr,
+		    or));
+		vst2q_f32(&out[2 * k], x);
+	}
+#endif /* __ARM_NEON */
+	for (; k < m; ++k) {
+		float ar = zr[k];
+		float ai = zi[k];
+		float br = zr[m - k];
+		float bi = zi[m - k];
+		float er = 0.5f * (ar + br);
+		float ei = 0.5f * (ai - bi);
+		float or = 0.5f * (ar - br);
+		float oi = 0.5f * (ai + bi);
+
+		out[2 * k] = er + wr[k] * oi + wi[k] * or;
+		out[2 * k + 1] = ei + wi[k] * oi - wr[k] * or;
+	}
+}
+
+int
+dsp_rfft_f32_init(struct dsp_rfft_f32 *fft, uint32_t n)
+{
+	uint32_t m = n / 2;
+	size_t table_size = 0;
+	float *tw;
+	uint32_t l;
+	uint32_t k;
+
+	memset(fft, 0, sizeof(*fft));
+	if (n < 16 || n > 65536 || (n & (n - 1)) != 0) {
+		return -1;
+	}
+
+	for (l = m; l >= 4; l /= 4) {
+		table_size += 6 * (l / 4);
+	}
+	table_size += 2 * m;
+
+	fft->tables = malloc(table_size * sizeof(float));
+	fft->work = malloc(4 * m * sizeof(float));
+	if (fft->tables == NULL || fft->work == NULL) {
+		dsp_rfft_f32_destroy(fft);
+		return -1;
+	}
+	fft->n = n;
+
+	tw = fft->tables;
+	for (l = m; l >= 4; l /= 4) {
+		uint32_t q = l / 4;
+		uint32_t p;
+		uint32_t j;
+
+		for (j = 1; j <= 3; ++j) {
+			for (p = 0; p < q; ++p) {
+				double a = -2.0 * M_PI * j * p / l;
+
+				tw[(2 * j - 2) * q + p] = (float)cos(a);
+				tw[(2 * j - 1) * q + p] = (float)sin(a);
+			}
+		}
+		tw += 6 * q;
+	}
+	for (k = 0; k < m; ++k) {
+		double a = -2.0 * M_PI * k / n;
+
+		tw[k] = (float)cos(a);
+		tw[m + k] = (float)sin(a);
+	}
+
+	return 0;
+}
+
+void
+dsp_rfft_f32_destroy(struct dsp_rfft_f32 *fft)
+{
+	free(fft->tables);
+	free(fft->work);
+	fft->tables = NULL;
+	fft->work = NULL;
+}
+
+void
+dsp_rfft_f32(struct dsp_rfft_f32 *fft, const float *in, float *out)
+{
+	uint32_t m = fft->n / 2;
+	const float *tw = fft->tables;
+	float *xr = fft->work;
+	float *xi = xr + m;
+	float *yr = xi + m;
+	float *yi = yr + m;
+	uint32_t l;
+	uint32_t s = 1;
+	uint32_t k = 0;
+
+	/* Even samples are the real, odd ones the imaginary parts */
+#ifdef __ARM_NEON
+	for (; k + 4 <= m; k += 4) {
+		float32x4x2_t v = vld2q_f32(&in[2 * k]);
+
+		vst1q_f32(&xr[k], v.val[0]);
+		vst1q_f32(&xi[k], v.val[1]);
+	}
+#endif /* __ARM_NEON */
+	for (; k < m; ++k) {
+		xr[k] = in[2 * k];
+		xi[k] = in[2 * k + 1];
+	}
+
+	for (l = m; l >= 4; l /= 4) {
+		float *t;
+
+		rfft_radix4(l, s, tw, xr, xi, yr, yi);
+		tw += 6 * (l / 4);
+		s *= 4;
+
+		t = xr;
+		xr = yr;
+		yr = t;
+		t = xi;
+		xi = yi;
+		yi = t;
+	}
+	if (l == 2) {
+		float *t;
+
+		rfft_radix2(s, xr, xi, yr, yi);
+
+		t = xr;
+		xr = yr;
+		yr = t;
+		t = xi;
+		xi = yi;
+		yi = t;
+	}
+
+	out[0] = xr[0] + xi[0];
+	out[1] = xr[0] - xi[0];
+	rfft_split(m, tw, xr, xi, out);
+}
+
+void
+dsp_rfft_mag_f32(const float *spectrum, float *mag, uint32_t n)
+{
+	uint32_t k;
+
+	mag[0] = fabsf(spectrum[0]);
+	mag[n / 2] = fabsf(spectrum[1]);
+	for (k = 1; k < n / 2; ++k) {
+		float re = spectrum[2 * k];
+		float im = spectrum[2 * k + 1];
+
+		mag[k] = sqrtf(re * re + im * im);
+	}
+}
@@ -0,0 +1,152 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dsp-internal.h"
+
+void
+dsp_mult_f32(const float *a, const float *b, float *out, uint32_t n)
+{
+	uint32_t i = 0;
+
+#ifdef __ARM_NEON
+	for (; i + 4 <= n; i += 4) {
+		vst1q_f32(&out[i], vmulq_f32(vld1q_f32(&a[i]),
+		    vld1q_f32(&b[i])));
+	}
+#endif /* __ARM_NEON */
+	for (; i < n; ++i) {
+		out[i] = a[i] * b[i];
+	}
+}
+
+void
+dsp_mult_q15(const dsp_q15 *a, const dsp_q15 *b, dsp_q15 *out, uint32_t n)
+{
+	uint32_t i = 0;
+
+#ifdef __ARM_NEON
+	for (; i + 8 <= n; i += 8) {
+		vst1q_s16(&out[i], vqdmulhq_s16(vld1q_s16(&a[i]),
+		    vld1q_s16(&b[i])));
+	}
+#endif /* __ARM_NEON */
+	for (; i < n; ++i) {
+		out[i] = dsp_sat_q15(((int32_t)a[i] * b[i]) >> 15);
+	}
+}
+
+/*
+ * The conversions to fixed point truncate toward zero like VCVT does. NaN
+ * becomes 0.
+ */
+static dsp_q31
+convert_to_fixed(float value, double scale, int64_t min, int64_t max)
+{
+	double v = (double)value * scale;
+
+	if (v != v) {
+		return 0;
+	}
+	if (v >= (double)max) {
+		return (dsp_q31)max;
+	}
+	if (v <= (double)min) {
+		return (dsp_q31)min;
+	}
+	return (dsp_q31)v;
+}
+
+void
+dsp_f32_to_q15(const float *in, dsp_q15 *out, uint32_t n)
+{
+	uint32_t i = 0;
+
+#ifdef __ARM_NEON
+	for (; i + 8 <= n; i += 8) {
+		int32x4_t lo = vcvtq_n_s32_f32(vld1q_f32(&in[i]), 15);
+		int32x4_t hi = vcvtq_n_s32_f32(vld1q_f32(&in[i + 4]), 15);
+
+		vst1q_s16(&out[i], vcombine_s16(vqmovn_s32(lo),
+		    vqmovn_s32(hi)));
+	}
+#endif /* __ARM_NEON */
+	for (; i < n; ++i) {
+		out[i] = (dsp_q15)convert_to_fixed(in[i], 32768.0, INT16_MIN,
+		    INT16_MAX);
+	}
+}
+
+void
+dsp_q15_to_f32(const dsp_q15 *in, float *out, uint32_t n)
+{
+	uint32_t i = 0;
+
+#ifdef __ARM_NEON
+	for (; i + 8 <= n; i += 8) {
+		int16x8_t v = vld1q_s16(&in[i]);
+
+		vst1q_f32(&out[i], vcvtq_n_f32_s32(
+		    vmovl_s16(vget_low_s16(v)), 15));
+		vst1q_f32(&out[i + 4], vcvtq_n_f32_s32(
+		    vmovl_s16(vget_high_s16(v)), 15));
+	}
+#endif /* __ARM_NEON */
+	for (; i < n; ++i) {
+		out[i] = (float)in[i] * (1.0f / 32768.0f);
+	}
+}
+
+void
+dsp_f32_to_q31(const float *in, dsp_q31 *out, uint32_t n)
+{
+	uint32_t i = 0;
+
+#ifdef __ARM_NEON
+	for (; i + 4 <= n; i += 4) {
+		vst1q_s32(&out[i], vcvtq_n_s32_f32(vld1q_f32(&in[i]), 31));
+	}
+#endif /* __ARM_NEON */
+	for (; i < n; ++i) {
+		out[i] = convert_to_fixed(in[i], 2147483648.0, INT32_MIN,
+		    INT32_MAX);
+	}
+}
+
+void
+dsp_q31_to_f32(const dsp_q31 *in, float *out, uint32_t n)
+{
+	uint32_t i = 0;
+
+#ifdef __ARM_NEON
+	for (; i + 4 <= n; i += 4) {
+		vst1q_f32(&out[i], vcvtq_n_f32_s32(vld1q_s32(&in[i]), 31));
+	}
+#endif /* __ARM_NEON */
+	for (; i < n; ++i) {
+		out[i] = (float)in[i] * (1.0f / 2147483648.0f);
+	}
+}
@@ -0,0 +1,603 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dsp-internal.h"
+
+#include <math.h>
+#include <string.h>
+
+/*
+ * The polynomials are the single precision ones of the Cephes library. Each
+ * function has a NEON version for four values and a scalar one for the
+ * targets without NEON. The NEON loops process the remaining values in a
+ * padded vector, so a value gives the same result at every position.
+ *
+ * NEON always flushes denormals to zero. The scalar versions do the same at
+ * the edges (results of exp below FLT_MIN, denormal inputs of log), so both
+ * behave alike.
+ */
+
+/* exp(x) is finite up to the float below 128 ln(2), normal from ln(FLT_MIN) */
+#define VMATH_EXP_HI 88.72283172607422f
+#define VMATH_EXP_LO -87.33654022216797f
+#define VMATH_LOG2E 1.44269504088896341f
+/* ln(2) = C1 - C2, C1 has few bits so that n C1 is exact */
+#define VMATH_LN2_C1 0.693359375f
+#define VMATH_LN2_C2 -2.12194440e-4f
+
+#define VMATH_SQRT2 1.41421356237309505f
+
+/*
+ * pi / 2 = P1 + P2 + P3, j P1 and j P2 are exact up to |j| = 2^13. Larger
+ * arguments go to sinf() and cosf() of libm.
+ */
+#define VMATH_TWO_OVER_PI 0.636619772367581343f
+#define VMATH_PIO2_P1 1.5703125f
+#define VMATH_PIO2_P2 4.837512969970703125e-4f
+#define VMATH_PIO2_P3 7.54978995489188216e-8f
+#define VMATH_SIN_MAX 8192.0f
+
+#define VMATH_PI 3.14159265358979324f
+#define VMATH_PIO2 1.57079632679489662f
+#define VMATH_PIO4 0.785398163397448310f
+#define VMATH_TAN_PIO8 0.414213562373095049f
+
+/* sin(r) and cos(r) for |r| <= pi / 4 */
+static float
+vmath_sin_poly(float r)
+{
+	float z = r * r;
+	float p = -1.9515295891e-4f;
+
+	p = p * z + 8.3321608736e-3f;
+	p = p * z - 1.6666654611e-1f;
+
+	/* Keeps the sign of sin(-0) */
+	return r == 0.0f ? r : p * z * r + r;
+}
+
+static float
+vmath_cos_poly(float r)
+{
+	float z = r * r;
+	float p = 2.443315711809948e-5f;
+
+	p = p * z - 1.388731625493765e-3f;
+	p = p * z + 4.166664568298827e-2f;
+
+	return p * z * z - 0.5f * z + 1.0f;
+}
+
+/* Round half away from zero like the NEON versions */
+static int32_t
+vmath_round(float x)
+{
+	return (int32_t)(x + copysignf(0.5f, x));
+}
+
+/* sin(x) for quadrant 0, cos(x) for quadrant 1 */
+static float
+vmath_sin1(float x, int32_t quadrant)
+{
+	int32_t j;
+	float fj;
+	float r;
+	float v;
+
+	if (!(fabsf(x) <= VMATH_SIN_MAX)) {
+		return quadrant == 0 ? sinf(x) : cosf(x);
+	}
+
+	j = vmath_round(x * VMATH_TWO_OVER_PI);
+	fj = (float)j;
+	r = x - fj * VMATH_PIO2_P1;
+	r = r - fj * VMATH_PIO2_P2;
+	r = r - fj * VMATH_PIO2_P3;
+
+	j += quadrant;
+	v = (j & 1) != 0 ? vmath_cos_poly(r) : vmath_sin_poly(r);
+
+	return (j & 2) != 0 ? -v : v;
+}
+
+#ifdef __ARM_NEON
+#define VMATH_DUP(c) vdupq_n_f32(c)
+
+/* p = p * x + c */
+#define VMATH_HORNER(p, x, c) vmlaq_f32(VMATH_DUP(c), p, x)
+
+static inline int32x4_t
+vmath_round4(float32x4_t x)
+{
+	uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(x),
+	    vdupq_n_u32(0x80000000U));
+	float32x4_t half = vreinterpretq_f32_u32(vorrq_u32(sign,
+	    vreinterpretq_u32_f32(VMATH_DUP(0.5f))));
+
+	return vcvtq_s32_f32(vaddq_f32(x, half));
+}
+
+static inline float32x4_t
+vmath_exp4(float32x4_t x)
+{
+	float32x4_t xc = vminq_f32(vmaxq_f32(x, VMATH_DUP(VMATH_EXP_LO)),
+	    VMATH_DUP(VMATH_EXP_HI));
+	int32x4_t n = vmath_round4(vmulq_n_f32(xc, VMATH_LOG2E));
+	float32x4_t fn = vcvtq_f32_s32(n);
+	float32x4_t r = vmlsq_n_f32(xc, fn, VMATH_LN2_C1);
+	float32x4_t p = VMATH_DUP(1.9875691500e-4f);
+	uint32x4_t bits;
+
+	r = vmlsq_n_f32(r, fn, VMATH_LN2_C2);
+	p = VMATH_HORNER(p, r, 1.3981999507e-3f);
+	p = VMATH_HORNER(p, r, 8.3334519073e-3f);
+	p = VMATH_HORNER(p, r, 4.1665795894e-2f);
+	p = VMATH_HORNER(p, r, 1.6666665459e-1f);
+	p = VMATH_HORNER(p, r, 5.0000001201e-1f);
+	p = vaddq_f32(vmlaq_f32(r, p, vmulq_f32(r, r)), VMATH_DUP(1.0f));
+
+	bits = vreinterpretq_u32_s32(vaddq_s32(vreinterpretq_s32_f32(p),
+	    vshlq_n_s32(n, 23)));
+	bits = vbicq_u32(bits, vorrq_u32(vcltq_u32(bits,
+	    vdupq_n_u32(0x00800000U)), vcltq_f32(x, VMATH_DUP(VMATH_EXP_LO))));
+
+	return vbslq_f32(vcgtq_f32(x, VMATH_DUP(VMATH_EXP_HI)),
+	    VMATH_DUP(INFINITY), vreinterpretq_f32_u32(bits));
+}
+
+static inline float32x4_t
+vmath_log4(float32x4_t x)
+{
+	uint32x4_t bits = vreinterpretq_u32_f32(x);
+	uint32x4_t exponent = vandq_u32(bits, vdupq_n_u32(0x7f800000U));
+	int32x4_t e = vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)),
+	    vdupq_n_s32(127));
+	float32x4_t m = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits,
+	    vdupq_n_u32(0x007fffffU)), vdupq_n_u32(0x3f800000U)));
+	uint32x4_t big = vcgtq_f32(m, VMATH_DUP(VMATH_SQRT2));
+	float32x4_t fe;
+	float32x4_t f;
+	float32x4_t z;
+	float32x4_t p;
+	float32x4_t r;
+
+	m = vbslq_f32(big, vmulq_n_f32(m, 0.5f), m);
+	/* The mask is -1 */
+	e = vsubq_s32(e, vreinterpretq_s32_u32(big));
+	fe = vcvtq_f32_s32(e);
+	f = vsubq_f32(m, VMATH_DUP(1.0f));
+	z = vmulq_f32(f, f);
+
+	p = VMATH_DUP(7.0376836292e-2f);
+	p = VMATH_HORNER(p, f, -1.1514610310e-1f);
+	p = VMATH_HORNER(p, f, 1.1676998740e-1f);
+	p = VMATH_HORNER(p, f, -1.2420140846e-1f);
+	p = VMATH_HORNER(p, f, 1.4249322787e-1f);
+	p = VMATH_HORNER(p, f, -1.6668057665e-1f);
+	p = VMATH_HORNER(p, f, 2.0000714765e-1f);
+	p = VMATH_HORNER(p, f, -2.4999993993e-1f);
+	p = VMATH_HORNER(p, f, 3.3333331174e-1f);
+	p = vmulq_f32(vmulq_f32(p, f), z);
+	p = vmlaq_n_f32(p, fe, VMATH_LN2_C2);
+	p = vmlsq_n_f32(p, z, 0.5f);
+	r = vmlaq_n_f32(vaddq_f32(f, p), fe, VMATH_LN2_C1);
+
+	/* Infinity and NaN, negative values, zero and denormals */
+	r = vbslq_f32(vceqq_u32(exponent, vdupq_n_u32(0x7f800000U)), x, r);
+	r = vbslq_f32(vtstq_u32(bits, vdupq_n_u32(0x80000000U)),
+	    VMATH_DUP(NAN), r);
+	return vbslq_f32(vceqq_u32(exponent, vdupq_n_u32(0)),
+	    VMATH_DUP(-INFINITY), r);
+}
+
+static inline float32x4_t
+vmath_sin4(float32x4_t x, int32_t quadrant)
+{
+	int32x4_t j = vmath_round4(vmulq_n_f32(x, VMATH_TWO_OVER_PI));
+	float32x4_t fj = vcvtq_f32_s32(j);
+	float32x4_t r = vmlsq_n_f32(x, fj, VMATH_PIO2_P1);
+	float32x4_t z;
+	float32x4_t s;
+	float32x4_t c;
+	uint32x4_t q;
+
+	r = vmlsq_n_f32(r, fj, VMATH_PIO2_P2);
+	r = vmlsq_n_f32(r, fj, VMATH_PIO2_P3);
+	z = vmulq_f32(r, r);
+
+	s = VMATH_DUP(-1.9515295891e-4f);
+	s = VMATH_HORNER(s, z, 8.3321608736e-3f);
+	s = VMATH_HORNER(s, z, -1.6666654611e-1f);
+	s = vmlaq_f32(r, vmulq_f32(s, z), r);
+	s = vbslq_f32(vceqq_f32(r, VMATH_DUP(0.0f)), r, s);
+
+	c = VMATH_DUP(2.443315711809948e-5f);
+	c = VMATH_HORNER(c, z, -1.388731625493765e-3f);
+	c = VMATH_HORNER(c, z, 4.166664568298827e-2f);
+	c = vmlsq_n_f32(vmulq_f32(vmulq_f32(c, z), z), z, 0.5f);
+	c = vaddq_f32(c, VMATH_DUP(1.0f));
+
+	q = vreinterpretq_u32_s32(vaddq_s32(j, vdupq_n_s32(quadrant)));
+	s = vbslq_f32(vtstq_u32(q, vdupq_n_u32(1)), c, s);
+	/* Bit 1 of the quadrant to the sign */
+	return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(s),
+	    vshlq_n_u32(vandq_u32(q, vdupq_n_u32(2)), 30)));
+}
+
+static inline bool
+vmath_any(uint32x4_t mask)
+{
+	uint32x2_t m = vorr_u32(vget_low_u32(mask), vget_high_u32(mask));
+
+	return vget_lane_u32(vpmax_u32(m, m), 0) != 0;
+}
+
+/* a / b with the reciprocal estimate and two Newton-Raphson steps */
+static inline float32x4_t
+vmath_div4(float32x4_t a, float32x4_t b)
+{
+	float32x4_t e = vrecpeq_f32(b);
+
+	e = vmulq_f32(e, vrecpsq_f32(b, e));
+	e = vmulq_f32(e, vrecpsq_f32(b, e));
+
+	return vmulq_f32(a, e);
+}
+
+static inline float32x4_t
+vmath_atan24(float32x4_t y, float32x4_t x)
+{
+	float32x4_t ax = vabsq_f32(x);
+	float32x4_t ay = vabsq_f32(y);
+	float32x4_t mx = vmaxq_f32(ax, ay);
+	float32x4_t mn = vminq_f32(ax, ay);
+	float32x4_t a = vmath_div4(mn, mx);
+	uint32x4_t reduce;
+	float32x4_t t;
+	float32x4_t z;
+	float32x4_t p;
+	float32x4_t r;
+	uint32x4_t sign = vdupq_n_u32(0x80000000U);
+
+	/* 0 / 0 and inf / inf */
+	a = vbslq_f32(vceqq_f32(mx, VMATH_DUP(0.0f)), VMATH_DUP(0.0f), a);
+	a = vbslq_f32(vceqq_f32(mn, VMATH_DUP(INFINITY)), VMATH_DUP(1.0f), a);
+
+	reduce = vcgtq_f32(a, VMATH_DUP(VMATH_TAN_PIO8));
+	t = vbslq_f32(reduce, vmath_div4(vsubq_f32(a, VMATH_DUP(1.0f)),
+	    vaddq_f32(a, VMATH_DUP(1.0f))), a);
+	z = vmulq_f32(t, t);
+
+	p = VMATH_DUP(8.05374449538e-2f);
+	p = VMATH_HORNER(p, z, -1.38776856032e-1f);
+	p = VMATH_HORNER(p, z, 1.99777106478e-1f);
+	p = VMATH_HORNER(p, z, -3.33329491539e-1f);
+	r = vmlaq_f32(t, vmulq_f32(p, z), t);
+	r = vbslq_f32(reduce, vaddq_f32(r, VMATH_DUP(VMATH_PIO4)), r);
+
+	r = vbslq_f32(vcgtq_f32(ay, ax), vsubq_f32(VMATH_DUP(VMATH_PIO2), r),
+	    r);
+	r = vbslq_f32(vtstq_u32(vreinterpretq_u32_f32(x), sign),
+	    vsubq_f32(VMATH_DUP(VMATH_PI), r), r);
+
+	/* r is positive or NaN, set the sign of y */
+	return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(r),
+	    vandq_u32(vreinterpretq_u32_f32(y), sign)));
+}
+
+static void
+vmath_sin_cos(const float *in, float *out, uint32_t n, int32_t quadrant)
+{
+	float32x4_t limit = VMATH_DUP(VMATH_SIN_MAX);
+	uint32_t i = 0;
+
+	for (; i < n; i += 4) {
+		float32x4_t x;
+		float tail[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		uint32_t count = dsp_min(n - i, 4);
+		uint32_t k;
+
+		if (count == 4) {
+			x = vld1q_f32(&in[i]);
+		} else {
+			memcpy(tail, &in[i], count * sizeof(float));
+			x = vld1q_f32(tail);
+		}
+
+		/* The NaN check is the negation of |x| <= limit */
+		if (vmath_any(vmvnq_u32(vcaleq_f32(x, limit)))) {
+			for (k = 0; k < count; ++k) {
+				out[i + k] = vmath_sin1(in[i + k], quadrant);
+			}
+		} else if (count == 4) {
+			vst1q_f32(&out[i], vmath_sin4(x, quadrant));
+		} else {
+			vst1q_f32(tail, vmath_sin4(x, quadrant));
+			memcpy(&out[i], tail, count * sizeof(float));
+		}
+	}
+}
+#endif /* __ARM_NEON */
+
+#ifndef __ARM_NEON
+static float
+vmath_exp_poly(float r)
+{
+	float p = 1.9875691500e-4f;
+
+	p = p * r + 1.3981999507e-3f;
+	p = p * r + 8.3334519073e-3f;
+	p = p * r + 4.1665795894e-2f;
+	p = p * r + 1.6666665459e-1f;
+	p = p * r + 5.0000001201e-1f;
+
+	return p * r * r + r + 1.0f;
+}
+
+/* log(1 + f) - f + f^2 / 2 for f in [sqrt(1/2) - 1, sqrt(2) - 1) */
+static float
+vmath_log_poly(float f)
+{
+	float p = 7.0376836292e-2f;
+
+	p = p * f - 1.1514610310e-1f;
+	p = p * f + 1.1676998740e-1f;
+	p = p * f - 1.2420140846e-1f;
+	p = p * f + 1.4249322787e-1f;
+	p = p * f - 1.6668057665e-1f;
+	p = p * f + 2.0000714765e-1f;
+	p = p * f - 2.4999993993e-1f;
+	p = p * f + 3.3333331174e-1f;
+
+	return p * f * f * f;
+}
+
+/* atan(t) for |t| <= tan(pi / 8) */
+static float
+vmath_atan_poly(float t)
+{
+	float z = t * t;
+	float p = 8.05374449538e-2f;
+
+	p = p * z - 1.38776856032e-1f;
+	p = p * z + 1.99777106478e-1f;
+	p = p * z - 3.33329491539e-1f;
+
+	return p * z * t + t;
+}
+
+static uint32_t
+vmath_bits(float x)
+{
+	uint32_t bits;
+
+	memcpy(&bits, &x, sizeof(bits));
+	return bits;
+}
+
+static float
+vmath_float(uint32_t bits)
+{
+	float x;
+
+	memcpy(&x, &bits, sizeof(x));
+	return x;
+}
+
+static float
+vmath_exp1(float x)
+{
+	int32_t n;
+	float r;
+	uint32_t bits;
+
+	if (x != x) {
+		return x;
+	}
+	if (x > VMATH_EXP_HI) {
+		return INFINITY;
+	}
+	if (x < VMATH_EXP_LO) {
+		return 0.0f;
+	}
+
+	n = vmath_round(x * VMATH_LOG2E);
+	r = x - (float)n * VMATH_LN2_C1;
+	r = r - (float)n * VMATH_LN2_C2;
+
+	/* Scale by 2^n in the exponent, p < 1 for n = 128 */
+	bits = vmath_bits(vmath_exp_poly(r)) + ((uint32_t)n << 23);
+	if (bits < 0x00800000U) {
+		return 0.0f;
+	}
+
+	return vmath_float(bits);
+}
+
+static float
+vmath_log1(float x)
+{
+	uint32_t bits = vmath_bits(x);
+	int32_t e;
+	float m;
+	float f;
+	float z;
+
+	if ((bits & 0x7f800000U) == 0) {
+		/* Zero and denormals */
+		return -INFINITY;
+	}
+	if ((bits & 0x80000000U) != 0) {
+		return NAN;
+	}
+	if ((bits & 0x7f800000U) == 0x7f800000U) {
+		return x;
+	}
+
+	e = (int32_t)(bits >> 23) - 127;
+	m = vmath_float((bits & 0x007fffffU) | 0x3f800000U);
+	if (m > VMATH_SQRT2) {
+		m *= 0.5f;
+		++e;
+	}
+	f = m - 1.0f;
+	z = f * f;
+
+	return f + (vmath_log_poly(f) + (float)e * VMATH_LN2_C2 - 0.5f * z) +
+	    (float)e * VMATH_LN2_C1;
+}
+
+static float
+vmath_atan21(float y, float x)
+{
+	float ax = fabsf(x);
+	float ay = fabsf(y);
+	float mx = ax > ay ? ax : ay;
+	float mn = ax > ay ? ay : ax;
+	float a;
+	float r;
+
+	if (x != x || y != y) {
+		return x + y;
+	}
+	if (mx == 0.0f) {
+		a = 0.0f;
+	} else if (mn == INFINITY) {
+		a = 1.0f;
+	} else {
+		a = mn / mx;
+	}
+
+	if (a > VMATH_TAN_PIO8) {
+		r = VMATH_PIO4 + vmath_atan_poly((a - 1.0f) / (a + 1.0f));
+	} else {
+		r = vmath_atan_poly(a);
+	}
+	if (ay > ax) {
+		r = VMATH_PIO2 - r;
+	}
+	if (signbit(x)) {
+		r = VMATH_PI - r;
+	}
+
+	return copysignf(r, y);
+}
+#endif /* __ARM_NEON */
+
+/* Loop over four values at a time and a padded rest */
+#ifdef __ARM_NEON
+#define VMATH_LOOP(in, out, n, fn4, fn1) \
+	do { \
+		uint32_t i_ = 0; \
+		\
+		for (; i_ + 4 <= (n); i_ += 4) { \
+			vst1q_f32(&(out)[i_], fn4(vld1q_f32(&(in)[i_]))); \
+		} \
+		if (i_ < (n)) { \
+			float tail_[4] = { 0.0f, 0.0f, 0.0f, 0.0f }; \
+			\
+			memcpy(tail_, &(in)[i_], ((n) - i_) * sizeof(float)); \
+			vst1q_f32(tail_, fn4(vld1q_f32(tail_))); \
+			memcpy(&(out)[i_], tail_, ((n) - i_) * sizeof(float)); \
+		} \
+	} while (0)
+#else /* __ARM_NEON */
+#define VMATH_LOOP(in, out, n, fn4, fn1) \
+	do { \
+		uint32_t i_; \
+		\
+		for (i_ = 0; i_ < (n); ++i_) { \
+			(out)[i_] = fn1((in)[i_]); \
+		} \
+	} while (0)
+#endif /* __ARM_NEON */
+
+void
+dsp_exp_f32(const float *in, float *out, uint32_t n)
+{
+	VMATH_LOOP(in, out, n, vmath_exp4, vmath_exp1);
+}
+
+void
+dsp_log_f32(const float *in, float *out, uint32_t n)
+{
+	VMATH_LOOP(in, out, n, vmath_log4, vmath_log1);
+}
+
+void
+dsp_sin_f32(const float *in, float *out, uint32_t n)
+{
+#ifdef __ARM_NEON
+	vmath_sin_cos(in, out, n, 0);
+#else /* __ARM_NEON */
+	uint32_t i;
+
+	for (i = 0; i < n; ++i) {
+		out[i] = vmath_sin1(in[i], 0);
+	}
+#endif /* __ARM_NEON */
+}
+
+void
+dsp_cos_f32(const float *in, float *out, uint32_t n)
+{
+#ifdef __ARM_NEON
+	vmath_sin_cos(in, out, n, 1);
+#else /* __ARM_NEON */
+	uint32_t i;
+
+	for (i = 0; i < n; ++i) {
+		out[i] = vmath_sin1(in[i], 1);
+	}
+#endif /* __ARM_NEON */
+}
+
+void
+dsp_atan2_f32(const float *y, const float *x, float *out, uint32_t n)
+{
+	uint32_t i = 0;
+
+#ifdef __ARM_NEON
+	for (; i + 4 <= n; i += 4) {
+		vst1q_f32(&out[i], vmath_atan24(vld1q_f32(&y[i]),
+		    vld1q_f32(&x[i])));
+	}
+	if (i < n) {
+		float ty[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		float tx[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+		memcpy(ty, &y[i], (n - i) * sizeof(float));
+		memcpy(tx, &x[i], (n - i) * sizeof(float));
+		vst1q_f32(ty, vmath_atan24(vld1q_f32(ty), vld1q_f32(tx)));
+		memcpy(&out[i], ty, (n - i) * sizeof(float));
+	}
+#else /* __ARM_NEON */
+	for (; i < n; ++i) {
+		out[i] = vmath_atan21(y[i], x[i]);
+	}
+#endif /* __ARM_NEON */
+}
@@ -0,0 +1,99 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dsp-internal.h"
+
+#include <math.h>
+
+/* Generalized cosine window sum a[0] - a[1] cos(x) + a[2] cos(2 x) - ... */
+static double
+window_value(enum dsp_window type, uint32_t i, uint32_t n)
+{
+	static const double hann[] = { 0.5, 0.5 };
+	static const double hamming[] = { 0.54, 0.46 };
+	static const double blackman[] = { 0.42, 0.5, 0.08 };
+	/* Same as scipy.signal.windows.flattop */
+	static const double flattop[] = {
+		0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368
+	};
+	const double *a;
+	size_t terms;
+	double x = 2.0 * M_PI * i / n;
+	double w = 0.0;
+	size_t k;
+
+	switch (type) {
+	case DSP_WINDOW_HANN:
+		a = hann;
+		terms = sizeof(hann) / sizeof(hann[0]);
+		break;
+	case DSP_WINDOW_HAMMING:
+		a = hamming;
+		terms = sizeof(hamming) / sizeof(hamming[0]);
+		break;
+	case DSP_WINDOW_BLACKMAN:
+		a = blackman;
+		terms = sizeof(blackman) / sizeof(blackman[0]);
+		break;
+	case DSP_WINDOW_FLATTOP:
+		a = flattop;
+		terms = sizeof(flattop) / sizeof(flattop[0]);
+		break;
+	default:
+		return 1.0;
+	}
+
+	for (k = 0; k < terms; ++k) {
+		double c = a[k] * cos((double)k * x);
+
+		w += (k % 2) == 0 ? c : -c;
+	}
+
+	return w;
+}
+
+void
+dsp_window_f32(enum dsp_window type, float *w, uint32_t n)
+{
+	uint32_t i;
+
+	for (i = 0; i < n; ++i) {
+		w[i] = (float)window_value(type, i, n);
+	}
+}
+
+void
+dsp_window_q15(enum dsp_window type, dsp_q15 *w, uint32_t n)
+{
+	uint32_t i;
+
+	for (i = 0; i < n; ++i) {
+		double v = floor(window_value(type, i, n) * 32768.0 + 0.5);
+
+		w[i] = dsp_sat_q15((int64_t)v);
+	}
+}
@@ -17,39 +17,149 @@ DEPFLAGS = -MT $@ -MD -MP -MF $(basename $@).d
 SYSFLAGS = -B $(PROJECT_LIB) -specs bsp_specs -qrtems
 WARNFLAGS = -Wall -Wextra -Wconversion -Wformat-security -Wformat=2 -Wshadow -Wcast-qual -Wcast-align -Wredundant-decls
 CWARNFLAGS = $(WARNFLAGS) -Wstrict-prototypes -Wbad-function-cast
-OPTFLAGS = $(CFLAGS_OPTIMIZE_V)
+
+# Build profile, select it with PROFILE=... on the make command line:
+#   speed: -O2 with link time optimization and unused sections removed
+#   size:  -Os with link time optimization and unused sections removed
+#   debug: -O0 without LTO, everything stays in the image for the debugger
+# The LTO objects are fat, so libraries built with speed or size can be linked
+# into applications with any profile.
+PROFILE ?= speed
+PROFILE_LTOFLAGS = -flto -ffat-lto-objects
+ifeq ($(PROFILE),speed)
+OPTFLAGS = -O2 -g -ffunction-sections -fdata-sections $(PROFILE_LTOFLAGS)
+PROFILE_LDFLAGS = -Wl,--gc-sections
+PROFILE_LTO = 1
+else ifeq ($(PROFILE),size)
+OPTFLAGS = -Os -g -ffunction-sections -fdata-sections $(PROFILE_LTOFLAGS)
+PROFILE_LDFLAGS = -Wl,--gc-sections
+PROFILE_LTO = 1
+else ifeq ($(PROFILE),debug)
+OPTFLAGS = -O0 -g
+PROFILE_LDFLAGS =
+PROFILE_LTO = 0
+else
+$(error PROFILE must be speed, size or debug, not '$(PROFILE)')
+endif
+
+# Profile guided optimization, can be combined with any PROFILE:
+#   generate: instrument the application. Run it and write the profile with
+#             the pgo shell command of the demo (see demo/pgo.h).
+#   use:      optimize with the profile in $(PGO_DIR). It has the layout
+#             written by the application, for example pgo/b-imx7/init.gcda.
+# Clean before switching, the objects aren't rebuilt otherwise.
+PGO ?=
+PGO_DIR ?= pgo
+# The application strips this many directories from the absolute path of
+# the profile files, so they end up relative to the application directory.
+# Both stages have to compile the same code, so it is defined for both.
+PGO_CFLAGS = -DPGO_PREFIX_STRIP=$(words $(subst /, ,$(CURDIR)))
+PGO_LDFLAGS =
+ifeq ($(PGO),generate)
+OPTFLAGS += -fprofile-generate $(PGO_CFLAGS)
+# The application only has weak references to these
+PGO_LDFLAGS = -Wl,-u,__gcov_dump -Wl,-u,__gcov_reset
+PGO_COPY =
+else ifeq ($(PGO),use)
+# Counters of tasks running in parallel might be slightly inconsistent
+OPTFLAGS += -fprofile-use -fprofile-correction $(PGO_CFLAGS)
+# GCC looks for the profile next to the object
+PGO_COPY = @if [ -f $(PGO_DIR)/$(basename $@).gcda ]; then \
+	cp $(PGO_DIR)/$(basename $@).gcda $(basename $@).gcda; fi
+else ifneq ($(PGO),)
+$(error PGO must be generate, use or empty, not '$(PGO)')
+endif
 
 CFLAGS = $(DEPFLAGS) $(SYSFLAGS) $(CWARNFLAGS) $(CPU_CFLAGS) $(OPTFLAGS)
 CXXFLAGS = $(DEPFLAGS) $(SYSFLAGS) $(WARNFLAGS) $(CPU_CFLAGS) $(OPTFLAGS)
-LINKFLAGS = $(SYSFLAGS) $(CPU_CFLAGS) $(LDFLAGS) $(OPTFLAGS)
+LINKFLAGS = $(SYSFLAGS) $(CPU_CFLAGS) $(LDFLAGS) $(OPTFLAGS) \
+	$(PROFILE_LDFLAGS) $(PGO_LDFLAGS)
 ASFLAGS = $(CPU_CFLAGS)
 
 CCLINK = $(CC) $(LINKFLAGS) -Wl,-Map,$(basename $@).map
 CXXLINK = $(CXX) $(LINKFLAGS) -Wl,-Map,$(basename $@).map
 
+# Print the sizes per section and per library from the map file of the
+# target. Use it in the recipe right after $(CCLINK) or $(CXXLINK).
+SIZE_REPORT = @echo "Size report of $@ (PROFILE=$(PROFILE))" && \
+	awk -f $(RTEMS_ROOT)/make/size-report.awk $(basename $@).map
+
+# Compression of the application image for barebox, select it with
+# IMAGE_COMPRESSION=... on the make command line:
+#   gzip: gzip -9, the smallest image, the slowest to decompress
+#   lzo:  lzop -9, bigger, decompresses several times faster than gzip
+#   lz4:  lz4 -9 (legacy frame format), about as big as lzo, faster still
+#   none: nothing to decompress, the most to load
+# The fastest boot depends on how fast the boot medium reads, compare them
+# with the image-bench target of the demo.
+IMAGE_COMPRESSION ?= gzip
+ifeq ($(IMAGE_COMPRESSION),gzip)
+IMAGE_COMPRESS = gzip -9 -k -f $<
+IMAGE_SUFFIX = .gz
+else ifeq ($(IMAGE_COMPRESSION),lzo)
+IMAGE_COMPRESS = lzop -9 -f $<
+IMAGE_SUFFIX = .lzo
+else ifeq ($(IMAGE_COMPRESSION),lz4)
+IMAGE_COMPRESS = lz4 -l -9 -f -q $< $<.lz4
+IMAGE_SUFFIX = .lz4
+else ifeq ($(IMAGE_COMPRESSION),none)
+IMAGE_COMPRESS = true
+IMAGE_SUFFIX =
+else
+$(error IMAGE_COMPRESSION must be gzip, lzo, lz4 or none, not '$(IMAGE_COMPRESSION)')
+endif
+
+# Recipe for the uImage that barebox starts, made of the binary in the first
+# prerequisite. barebox only tells compressed from uncompressed images by the
+# header and detects the format from the data.
+MKIMAGE = $(IMAGE_COMPRESS) && \
+	mkimage.py -A arm -O linux -T kernel -C $(IMAGE_COMPRESSION) \
+	-a 0x80200000 -e 0x80200000 -n RTEMS -d $<$(IMAGE_SUFFIX) $@
+
+# Add it to the prerequisites of an image made with $(MKIMAGE), after the
+# binary. It is replaced when IMAGE_COMPRESSION changes, so the image is
+# rebuilt.
+IMAGE_STAMP = $(BUILDDIR)/image-compression-$(IMAGE_COMPRESSION).stamp
+
+$(BUILDDIR)/image-compression-%.stamp:
+	rm -f $(BUILDDIR)/image-compression-*.stamp
+	touch $@
+
 $(BUILDDIR)/%.o: %.c
+	$(PGO_COPY)
 	$(CC) $(CPPFLAGS) $(CFLAGS) -c $< -o $@
 
 $(BUILDDIR)/%.o: %.S
 	$(CC) $(CPPFLAGS) -DASM $(CFLAGS) -c $< -o $@
 
 $(BUILDDIR)/%.o: %.cc
+	$(PGO_COPY)
 	$(CXX) $(CPPFLAGS) $(CXXFLAGS) -c $< -o $@
 
 $(BUILDDIR)/%.o: %.cpp
+	$(PGO_COPY)
 	$(CXX) $(CPPFLAGS) $(CXXFLAGS) -c $< -o $@
 
 $(BUILDDIR)/%.o: %.s
 	$(AS) $(ASFLAGS) $< -o $@
 
+ifeq ($(PROFILE_LTO),1)
+# The wrappers load the LTO plugin, so the archive index covers LTO symbols
+AR = $(RTEMS_CPU)-rtems$(RTEMS_API)-gcc-ar
+else
 AR = $(RTEMS_CPU)-rtems$(RTEMS_API)-ar
+endif
 AS = $(RTEMS_CPU)-rtems$(RTEMS_API)-as
 CC = $(RTEMS_CPU)-rtems$(RTEMS_API)-gcc --pipe
 CXX = $(RTEMS_CPU)-rtems$(RTEMS_API)-g++
 LD = $(RTEMS_CPU)-rtems$(RTEMS_API)-ld
 NM = $(RTEMS_CPU)-rtems$(RTEMS_API)-nm
 OBJCOPY = $(RTEMS_CPU)-rtems$(RTEMS_API)-objcopy
+ifeq ($(PROFILE_LTO),1)
+RANLIB = $(RTEMS_CPU)-rtems$(RTEMS_API)-gcc-ranlib
+else
 RANLIB = $(RTEMS_CPU)-rtems$(RTEMS_API)-ranlib
+endif
 SIZE = $(RTEMS_CPU)-rtems$(RTEMS_API)-size
 STRIP = $(RTEMS_CPU)-rtems$(RTEMS_API)-strip
 export AR
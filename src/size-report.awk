@@ -0,0 +1,155 @@
+#
+# Summarize a map file of the GNU linker: the size of each allocated output
+# section and how much each library, the application objects and the link
+# time optimization partitions contribute to code, data and bss.
+#
+# Usage: awk -f size-report.awk app.map
+#
+# With LTO, the application and the libraries that have been built with
+# -flto end up in the "(lto)" entry.
+#
+
+function hex(s,    i, c, v) {
+	v = 0
+	s = tolower(s)
+	sub(/^0x/, "", s)
+	for (i = 1; i <= length(s); ++i) {
+		c = index("0123456789abcdef", substr(s, i, 1))
+		if (c == 0) {
+			break
+		}
+		v = v * 16 + c - 1
+	}
+	return v
+}
+
+function is_allocated(name, addr) {
+	if (name ~ /^\.(debug|comment|ARM\.attributes|stab|note\.gnu\.build-id)/) {
+		return 0
+	}
+	return addr != 0
+}
+
+function kind(name) {
+	if (name ~ /^\.rodata/) {
+		return "text"
+	}
+	if (name ~ /bss|noinit/) {
+		return "bss"
+	}
+	if (name ~ /data|rwset/) {
+		return "data"
+	}
+	return "text"
+}
+
+function owner(file) {
+	if (file ~ /^\(/) {
+		return file
+	}
+	if (file ~ /ltrans/) {
+		return "(lto)"
+	}
+	if (file ~ /\.a\(/) {
+		sub(/\(.*$/, "", file)
+		sub(/.*\//, "", file)
+		return file
+	}
+	if (file ~ /^\//) {
+		sub(/.*\//, "", file)
+		return file
+	}
+	return "(application)"
+}
+
+function output_section(name, addr, size) {
+	current = ""
+	if (is_allocated(name, addr) && size > 0) {
+		current = name
+		sections[name] += size
+	}
+}
+
+function input_section(size, file) {
+	if (current == "" || size == 0) {
+		return
+	}
+	file = owner(file)
+	libs[file, kind(current)] += size
+	totals[file] += size
+}
+
+/^Linker script and memory map/ {
+	in_map = 1
+	next
+}
+
+!in_map {
+	next
+}
+
+# Output section, address and size might be on the next line
+/^\.[^ \t]/ {
+	pending_input = 0
+	if (NF >= 3 && $2 ~ /^0x/) {
+		output_section($1, hex($2), hex($3))
+		pending_output = ""
+	} else {
+		pending_output = $1
+	}
+	next
+}
+
+/^ \*fill\*/ {
+	if (NF >= 3) {
+		input_section(hex($3), "(fill)")
+	}
+	next
+}
+
+# Input section, address, size and file might be on the next line
+/^ [.A-Za-z_]/ {
+	if (NF >= 4 && $2 ~ /^0x/ && $3 ~ /^0x/) {
+		input_section(hex($3), $4)
+		pending_input = 0
+	} else if (NF == 1) {
+		pending_input = 1
+	}
+	next
+}
+
+/^[ \t]+0x[0-9a-fA-F]+[ \t]+0x[0-9a-fA-F]+/ {
+	if (pending_output != "") {
+		output_section(pending_output, hex($1), hex($2))
+		pending_output = ""
+	} else if (pending_input && NF >= 3) {
+		input_section(hex($2), $3)
+	}
+	pending_input = 0
+	next
+}
+
+{
+	pending_input = 0
+	pending_output = ""
+}
+
+END {
+	sort = "sort -k2 -n -r"
+
+	printf("%-24s %10s\n", "section", "bytes")
+	for (name in sections) {
+		printf("%-24s %10d\n", name, sections[name]) | sort
+	}
+	close(sort)
+
+	printf("\n%-24s %10s %10s %10s %10s\n", "library", "total", "text",
+	    "data", "bss")
+	sort = "sort -k2 -n -r"
+	for (name in totals) {
+		printf("%-24s %10d %10d %10d %10d\n", name, totals[name],
+		    libs[name, "text"], libs[name, "data"],
+		    libs[name, "bss"]) | sort
+	}
+	close(sort)
+}
@@ -0,0 +1,658 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Checks of the kernels of external/BLAS/neon against the reference BLAS.
+ * The Makefile renames the kernels to neon_*_, so both can be linked into
+ * one program and get the same inputs. A host build checks the plain C
+ * paths, an ARM build with NEON (see the Makefile) the NEON ones.
+ *
+ * The sizes are odd and cross the register and the cache blocks, vectors use
+ * positive and negative increments and matrices padded leading dimensions.
+ * With beta = 0, C and y are filled with NaN, which must not show up in the
+ * result. Elements outside of the result must stay unchanged.
+ *
+ * The results may differ in the order of the additions, so two results
+ * only have to agree within 2 (k + 2) eps times the sum of the absolute
+ * values of the terms, k being the length of the sums.
+ */
+
+#include <float.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "blas-neon.h"
+
+/* Elements of a vector with the increment, at least one */
+#define BLASTEST_LEN(n, inc) ((n) > 0 ? 1 + ((n) - 1) * abs(inc) : 1)
+
+#define BLASTEST_COUNT(x) (sizeof(x) / sizeof((x)[0]))
+
+/* The kernels of external/BLAS/neon, renamed by the Makefile */
+extern __typeof__(saxpy_) neon_saxpy_;
+extern __typeof__(daxpy_) neon_daxpy_;
+extern __typeof__(sdot_) neon_sdot_;
+extern __typeof__(ddot_) neon_ddot_;
+extern __typeof__(sgemv_) neon_sgemv_;
+extern __typeof__(dgemv_) neon_dgemv_;
+extern __typeof__(sgemm_) neon_sgemm_;
+extern __typeof__(dgemm_) neon_dgemm_;
+
+struct blastest_result {
+	const char *name;
+	unsigned cases;
+	unsigned failures;
+	/* Largest error relative to the bound */
+	double error;
+};
+
+/* incx, incy */
+static const int blastest_incs[][2] = {
+	{ 1, 1 }, { 2, 1 }, { 1, 3 }, { -1, 1 }, { 1, -1 }, { -1, -3 },
+	{ -3, 2 },
+};
+
+/* alpha, beta */
+static const double blastest_scalars[][2] = {
+	{ 1.0, 0.0 }, { -0.5, 1.0 }, { 1.5, 0.25 }, { 0.0, -2.0 },
+};
+
+static unsigned blastest_failures;
+
+static uint32_t blastest_seed = 1;
+
+/* Uniform in [-1, 1) and exact in single precision */
+static double
+blastest_random(void)
+{
+	blastest_seed = blastest_seed * 1103515245u + 12345u;
+	return (double)((blastest_seed >> 8) & 0xffff) / 32768.0 - 1.0;
+}
+
+static void *
+blastest_alloc(size_t size)
+{
+	void *x;
+
+	x = malloc(size);
+	if (x == NULL) {
+		perror("malloc");
+		exit(1);
+	}
+
+	return x;
+}
+
+static double *
+blastest_random_vector(size_t n)
+{
+	double *x = blastest_alloc(n * sizeof(*x));
+	size_t i;
+
+	for (i = 0; i < n; ++i) {
+		x[i] = blastest_random();
+	}
+
+	return x;
+}
+
+static double *
+blastest_copy(const double *x, size_t n)
+{
+	double *y = blastest_alloc(n * sizeof(*y));
+
+	memcpy(y, x, n * sizeof(*y));
+	return y;
+}
+
+static float *
+blastest_to_float(const double *x, size_t n)
+{
+	float *f = blastest_alloc(n * sizeof(*f));
+	size_t i;
+
+	for (i = 0; i < n; ++i) {
+		f[i] = (float)x[i];
+	}
+
+	return f;
+}
+
+static void
+blastest_from_float(double *x, float *f, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; ++i) {
+		x[i] = f[i];
+	}
+	free(f);
+}
+
+static double
+blastest_eps(bool dbl)
+{
+	return dbl ? DBL_EPSILON : FLT_EPSILON;
+}
+
+/* Index of element i of a vector like the reference BLAS */
+static size_t
+blastest_index(int n, int inc, int i)
+{
+	return (size_t)(inc > 0 ? i * inc : (n - 1 - i) * -inc);
+}
+
+/* Both results have to be within the bound of each other, NaN fails */
+static bool
+blastest_compare(struct blastest_result *r, double neon, double ref,
+    double bound)
+{
+	double error;
+
+	if (isnan(neon) || isnan(ref)) {
+		return false;
+	}
+	error = fabs(neon - ref);
+	if (bound > 0.0) {
+		r->error = fmax(r->error, error / bound);
+	}
+
+	return error <= bound;
+}
+
+static void
+blastest_case(struct blastest_result *r, bool ok, const char *fmt, ...)
+{
+	va_list ap;
+
+	++r->cases;
+	if (ok) {
+		return;
+	}
+
+	/* Only the first few, one broken path fails many cases */
+	if (r->failures < 5) {
+		printf("%s FAIL: ", r->name);
+		va_start(ap, fmt);
+		vprintf(fmt, ap);
+		va_end(ap);
+		printf("\n");
+	}
+	++r->failures;
+}
+
+static void
+blastest_report(const struct blastest_result *r)
+{
+	printf("%-8s %6u cases, max error %.3g of the bound %s\n", r->name,
+	    r->cases, r->error, r->failures == 0 ? "ok" : "FAIL");
+	if (r->failures != 0) {
+		++blastest_failures;
+	}
+}
+
+static void
+blastest_axpy_call(bool dbl, bool neon, int n, double alpha, const double *x,
+    int incx, double *y, int incy)
+{
+	size_t lenx = (size_t)BLASTEST_LEN(n, incx);
+	size_t leny = (size_t)BLASTEST_LEN(n, incy);
+	float fa = (float)alpha;
+	float *fx;
+	float *fy;
+
+	if (dbl) {
+		(neon ? neon_daxpy_ : daxpy_)(&n, &alpha, x, &incx, y, &incy);
+		return;
+	}
+
+	fx = blastest_to_float(x, lenx);
+	fy = blastest_to_float(y, leny);
+	(neon ? neon_saxpy_ : saxpy_)(&n, &fa, fx, &incx, fy, &incy);
+	blastest_from_float(y, fy, leny);
+	free(fx);
+}
+
+static void
+blastest_axpy_case(struct blastest_result *r, bool dbl, int n, int incx,
+    int incy)
+{
+	size_t leny = (size_t)BLASTEST_LEN(n, incy);
+	double *x = blastest_random_vector((size_t)BLASTEST_LEN(n, incx));
+	double *y = blastest_random_vector(leny);
+	size_t sc;
+
+	for (sc = 0; sc < BLASTEST_COUNT(blastest_scalars); ++sc) {
+		double alpha = blastest_scalars[sc][0];
+		double *yn = blastest_copy(y, leny);
+		double *yr = blastest_copy(y, leny);
+		bool ok = true;
+		size_t i;
+
+		blastest_axpy_call(dbl, true, n, alpha, x, incx, yn, incy);
+		blastest_axpy_call(dbl, false, n, alpha, x, incx, yr, incy);
+
+		/* Also covers the gaps between the elements */
+		for (i = 0; i < leny; ++i) {
+			double bound = 4.0 * blastest_eps(dbl) *
+			    (fabs(alpha) + fabs(y[i]));
+
+			ok = blastest_compare(r, yn[i], yr[i], bound) && ok;
+		}
+		blastest_case(r, ok, "n %d incx %d incy %d alpha %g", n, incx,
+		    incy, alpha);
+
+		free(yn);
+		free(yr);
+	}
+
+	free(x);
+	free(y);
+}
+
+static void
+blastest_axpy(bool dbl)
+{
+	static const int sizes[] = { 0, 1, 3, 4, 5, 15, 16, 17, 33, 100 };
+	struct blastest_result r = { dbl ? "daxpy" : "saxpy", 0, 0, 0.0 };
+	size_t s;
+	size_t i;
+
+	for (s = 0; s < BLASTEST_COUNT(sizes); ++s) {
+		for (i = 0; i < BLASTEST_COUNT(blastest_incs); ++i) {
+			blastest_axpy_case(&r, dbl, sizes[s],
+			    blastest_incs[i][0], blastest_incs[i][1]);
+		}
+	}
+
+	blastest_report(&r);
+}
+
+static double
+blastest_dot_call(bool dbl, bool neon, int n, const double *x, int incx,
+    const double *y, int incy)
+{
+	float *fx;
+	float *fy;
+	double result;
+
+	if (dbl) {
+		return (neon ? neon_ddot_ : ddot_)(&n, x, &incx, y, &incy);
+	}
+
+	fx = blastest_to_float(x, (size_t)BLASTEST_LEN(n, incx));
+	fy = blastest_to_float(y, (size_t)BLASTEST_LEN(n, incy));
+	result = (neon ? neon_sdot_ : sdot_)(&n, fx, &incx, fy, &incy);
+	free(fx);
+	free(fy);
+
+	return result;
+}
+
+static void
+blastest_dot_case(struct blastest_result *r, bool dbl, int n, int incx,
+    int incy)
+{
+	double *x = blastest_random_vector((size_t)BLASTEST_LEN(n, incx));
+	double *y = blastest_random_vector((size_t)BLASTEST_LEN(n, incy));
+	double bound = 0.0;
+	bool ok;
+	int i;
+
+	for (i = 0; i < n; ++i) {
+		bound += fabs(x[blastest_index(n, incx, i)] *
+		    y[blastest_index(n, incy, i)]);
+	}
+	bound *= 2.0 * (n + 2) * blastest_eps(dbl);
+
+	ok = blastest_compare(r,
+	    blastest_dot_call(dbl, true, n, x, incx, y, incy),
+	    blastest_dot_call(dbl, false, n, x, incx, y, incy), bound);
+	blastest_case(r, ok, "n %d incx %d incy %d", n, incx, incy);
+
+	free(x);
+	free(y);
+}
+
+static void
+blastest_dot(bool dbl)
+{
+	static const int sizes[] = { 0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 33,
+	    100, 1001 };
+	struct blastest_result r = { dbl ? "ddot" : "sdot", 0, 0, 0.0 };
+	size_t s;
+	size_t i;
+
+	for (s = 0; s < BLASTEST_COUNT(sizes); ++s) {
+		for (i = 0; i < BLASTEST_COUNT(blastest_incs); ++i) {
+			blastest_dot_case(&r, dbl, sizes[s],
+			    blastest_incs[i][0], blastest_incs[i][1]);
+		}
+	}
+
+	blastest_report(&r);
+}
+
+static void
+blastest_gemv_call(bool dbl, bool neon, char trans, int m, int n,
+    double alpha, const double *a, int lda, const double *x, int incx,
+    double beta, double *y, int incy)
+{
+	size_t lena = (size_t)lda * (size_t)n;
+	size_t lenx = (size_t)BLASTEST_LEN(trans == 'N' ? n : m, incx);
+	size_t leny = (size_t)BLASTEST_LEN(trans == 'N' ? m : n, incy);
+	float fa = (float)alpha;
+	float fb = (float)beta;
+	float *fm;
+	float *fx;
+	float *fy;
+
+	if (dbl) {
+		(neon ? neon_dgemv_ : dgemv_)(&trans, &m, &n, &alpha, a, &lda,
+		    x, &incx, &beta, y, &incy, 1);
+		return;
+	}
+
+	fm = blastest_to_float(a, lena);
+	fx = blastest_to_float(x, lenx);
+	fy = blastest_to_float(y, leny);
+	(neon ? neon_sgemv_ : sgemv_)(&trans, &m, &n, &fa, fm, &lda, fx,
+	    &incx, &fb, fy, &incy, 1);
+	blastest_from_float(y, fy, leny);
+	free(fm);
+	free(fx);
+}
+
+static void
+blastest_gemv_case(struct blastest_result *r, bool dbl, char trans, int m,
+    int n, int incx, int incy)
+{
+	bool notrans = trans == 'N';
+	/* Padded leading dimension */
+	int lda = m + 3;
+	int nx = notrans ? n : m;
+	int ny = notrans ? m : n;
+	size_t leny = (size_t)BLASTEST_LEN(ny, incy);
+	double *a = blastest_random_vector((size_t)lda * (size_t)n);
+	double *x = blastest_random_vector((size_t)BLASTEST_LEN(nx, incx));
+	double *y = blastest_random_vector(leny);
+	size_t sc;
+
+	for (sc = 0; sc < BLASTEST_COUNT(blastest_scalars); ++sc) {
+		double alpha = blastest_scalars[sc][0];
+		double beta = blastest_scalars[sc][1];
+		double *y0 = blastest_copy(y, leny);
+		double *yn;
+		double *yr;
+		bool ok = true;
+		size_t i;
+		int e;
+		int l;
+
+		if (beta == 0.0) {
+			for (e = 0; e < ny; ++e) {
+				y0[blastest_index(ny, incy, e)] = NAN;
+			}
+		}
+		yn = blastest_copy(y0, leny);
+		yr = blastest_copy(y0, leny);
+		blastest_gemv_call(dbl, true, trans, m, n, alpha, a, lda, x,
+		    incx, beta, yn, incy);
+		blastest_gemv_call(dbl, false, trans, m, n, alpha, a, lda, x,
+		    incx, beta, yr, incy);
+
+		for (e = 0; e < ny; ++e) {
+			size_t yi = blastest_index(ny, incy, e);
+			double bound = beta != 0.0 ? fabs(beta * y0[yi]) : 0.0;
+
+			for (l = 0; l < nx; ++l) {
+				double ae = notrans ?
+				    a[e + (size_t)l * (size_t)lda] :
+				    a[l + (size_t)e * (size_t)lda];
+
+				bound += fabs(alpha * ae *
+				    x[blastest_index(nx, incx, l)]);
+			}
+			bound *= 2.0 * (nx + 2) * blastest_eps(dbl);
+			ok = blastest_compare(r, yn[yi], yr[yi], bound) && ok;
+		}
+		/* The gaps between the elements stay as they are */
+		for (i = 0; i < leny; ++i) {
+			if (i % (size_t)abs(incy) != 0 && yn[i] != y0[i]) {
+				ok = false;
+			}
+		}
+		blastest_case(r, ok,
+		    "%c m %d n %d incx %d incy %d alpha %g beta %g", trans, m,
+		    n, incx, incy, alpha, beta);
+
+		free(y0);
+		free(yn);
+		free(yr);
+	}
+
+	free(a);
+	free(x);
+	free(y);
+}
+
+static void
+blastest_gemv(bool dbl)
+{
+	static const int sizes[][2] = {
+		{ 1, 1 }, { 3, 5 }, { 4, 4 }, { 7, 9 }, { 17, 3 },
+		{ 33, 31 }, { 65, 129 }, { 300, 7 },
+	};
+	struct blastest_result r = { dbl ? "dgemv" : "sgemv", 0, 0, 0.0 };
+	size_t s;
+	size_t i;
+
+	for (s = 0; s < BLASTEST_COUNT(sizes); ++s) {
+		for (i = 0; i < BLASTEST_COUNT(blastest_incs); ++i) {
+			blastest_gemv_case(&r, dbl, 'N', sizes[s][0],
+			    sizes[s][1], blastest_incs[i][0],
+			    blastest_incs[i][1]);
+			blastest_gemv_case(&r, dbl, 'T', sizes[s][0],
+			    sizes[s][1], blastest_incs[i][0],
+			    blastest_incs[i][1]);
+		}
+	}
+
+	blastest_report(&r);
+}
+
+static void
+blastest_gemm_call(bool dbl, bool neon, const char *trans, int m, int n,
+    int k, double alpha, const double *a, int lda, const double *b, int ldb,
+    double beta, double *c, int ldc)
+{
+	size_t lena = (size_t)lda * (size_t)(trans[0] == 'N' ? k : m);
+	size_t lenb = (size_t)ldb * (size_t)(trans[1] == 'N' ? n : k);
+	size_t lenc = (size_t)ldc * (size_t)n;
+	float fa = (float)alpha;
+	float fb = (float)beta;
+	float *fma;
+	float *fmb;
+	float *fmc;
+
+	if (dbl) {
+		(neon ? neon_dgemm_ : dgemm_)(&trans[0], &trans[1], &m, &n, &k,
+		    &alpha, a, &lda, b, &ldb, &beta, c, &ldc, 1, 1);
+		return;
+	}
+
+	fma = blastest_to_float(a, lena);
+	fmb = blastest_to_float(b, lenb);
+	fmc = blastest_to_float(c, lenc);
+	(neon ? neon_sgemm_ : sgemm_)(&trans[0], &trans[1], &m, &n, &k, &fa,
+	    fma, &lda, fmb, &ldb, &fb, fmc, &ldc, 1, 1);
+	blastest_from_float(c, fmc, lenc);
+	free(fma);
+	free(fmb);
+}
+
+/* Bound of element (i, j) of C */
+static double
+blastest_gemm_bound(bool dbl, const char *trans, int k, double alpha,
+    const double *a, int lda, const double *b, int ldb, double beta,
+    double c, int i, int j)
+{
+	double bound = beta != 0.0 ? fabs(beta * c) : 0.0;
+	int l;
+
+	for (l = 0; l < k; ++l) {
+		double ae = trans[0] == 'N' ? a[i + (size_t)l * (size_t)lda] :
+		    a[l + (size_t)i * (size_t)lda];
+		double be = trans[1] == 'N' ? b[l + (size_t)j * (size_t)ldb] :
+		    b[j + (size_t)l * (size_t)ldb];
+
+		bound += fabs(alpha * ae * be);
+	}
+
+	return bound * 2.0 * (k + 2) * blastest_eps(dbl);
+}
+
+static void
+blastest_gemm_case(struct blastest_result *r, bool dbl, const char *trans,
+    int m, int n, int k)
+{
+	/* Padded leading dimensions */
+	int lda = (trans[0] == 'N' ? m : k) + 1;
+	int ldb = (trans[1] == 'N' ? k : n) + 2;
+	int ldc = m + 3;
+	size_t lenc = (size_t)ldc * (size_t)n;
+	double *a = blastest_random_vector(
+	    (size_t)lda * (size_t)(trans[0] == 'N' ? k : m));
+	double *b = blastest_random_vector(
+	    (size_t)ldb * (size_t)(trans[1] == 'N' ? n : k));
+	double *c = blastest_random_vector(lenc);
+	size_t sc;
+
+	for (sc = 0; sc < BLASTEST_COUNT(blastest_scalars); ++sc) {
+		double alpha = blastest_scalars[sc][0];
+		double beta = blastest_scalars[sc][1];
+		double *c0 = blastest_copy(c, lenc);
+		double *cn;
+		double *cr;
+		bool ok = true;
+		int i;
+		int j;
+
+		for (j = 0; j < n && beta == 0.0; ++j) {
+			for (i = 0; i < m; ++i) {
+				c0[i + (size_t)j * (size_t)ldc] = NAN;
+			}
+		}
+		cn = blastest_copy(c0, lenc);
+		cr = blastest_copy(c0, lenc);
+		blastest_gemm_call(dbl, true, trans, m, n, k, alpha, a, lda, b,
+		    ldb, beta, cn, ldc);
+		blastest_gemm_call(dbl, false, trans, m, n, k, alpha, a, lda, b,
+		    ldb, beta, cr, ldc);
+
+		for (j = 0; j < n; ++j) {
+			for (i = 0; i < ldc; ++i) {
+				size_t ci = (size_t)i + (size_t)j * (size_t)ldc;
+
+				if (i >= m) {
+					/* Padding rows stay as they are */
+					if (cn[ci] != c0[ci]) {
+						ok = false;
+					}
+					continue;
+				}
+
+				ok = blastest_compare(r, cn[ci], cr[ci],
+				    blastest_gemm_bound(dbl, trans, k, alpha,
+				    a, lda, b, ldb, beta, c0[ci], i, j)) && ok;
+			}
+		}
+		blastest_case(r, ok, "%s m %d n %d k %d alpha %g beta %g",
+		    trans, m, n, k, alpha, beta);
+
+		free(c0);
+		free(cn);
+		free(cr);
+	}
+
+	free(a);
+	free(b);
+	free(c);
+}
+
+static void
+blastest_gemm(bool dbl)
+{
+	/*
+	 * Up to 32^3 without packing. The bigger ones cross the MC, KC and NC
+	 * blocks of both precisions.
+	 */
+	static const int sizes[][3] = {
+		{ 1, 1, 1 }, { 3, 5, 7 }, { 4, 4, 4 }, { 8, 4, 16 },
+		{ 13, 11, 0 }, { 31, 33, 17 }, { 67, 65, 129 },
+		{ 97, 261, 263 }, { 9, 300, 5 },
+	};
+	static const char *const transs[] = { "NN", "NT", "TN", "TT" };
+	struct blastest_result r = { dbl ? "dgemm" : "sgemm", 0, 0, 0.0 };
+	size_t s;
+	size_t t;
+
+	for (s = 0; s < BLASTEST_COUNT(sizes); ++s) {
+		for (t = 0; t < BLASTEST_COUNT(transs); ++t) {
+			blastest_gemm_case(&r, dbl, transs[t], sizes[s][0],
+			    sizes[s][1], sizes[s][2]);
+		}
+	}
+
+	blastest_report(&r);
+}
+
+int
+main(void)
+{
+	blastest_axpy(false);
+	blastest_axpy(true);
+	blastest_dot(false);
+	blastest_dot(true);
+	blastest_gemv(false);
+	blastest_gemv(true);
+	blastest_gemm(false);
+	blastest_gemm(true);
+
+	if (blastest_failures != 0) {
+		printf("%u checks failed\n", blastest_failures);
+		return 1;
+	}
+	printf("All checks passed\n");
+
+	return 0;
+}
@@ -0,0 +1,590 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Checks of libdsp against double precision references on the host. The
+ * host build uses the plain C versions, which are also used on the GRiSP1
+ * and for the tails of the NEON loops. The fixed point results of NEON and C
+ * are the same by design, the float results of NEON are checked with the
+ * dsp command of the benchmark application on the target.
+ *
+ * The references use the quantized coefficients and inputs, so the limits
+ * only cover the rounding of the kernel itself. Filters run in blocks of
+ * varying size to check that the state is carried over correctly.
+ */
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <dsp/dsp.h>
+
+#define DSPTEST_N	1000
+#define DSPTEST_TAPS	37
+#define DSPTEST_MAX_BLOCK 64
+#define DSPTEST_FACTOR	4
+#define DSPTEST_SECTIONS 2
+
+#define DSPTEST_Q15	32768.0
+#define DSPTEST_Q31	2147483648.0
+
+static unsigned dsptest_failures;
+
+static uint32_t dsptest_seed = 1;
+
+/* Uniform in [-1, 1) */
+static float
+dsptest_random(void)
+{
+	dsptest_seed = dsptest_seed * 1103515245u + 12345u;
+	return (float)((dsptest_seed >> 8) & 0xffff) / 32768.0f - 1.0f;
+}
+
+/* Block sizes from 1 to max that vary with the position */
+static uint32_t
+dsptest_block(uint32_t i, uint32_t n, uint32_t max)
+{
+	uint32_t block = 1 + (i * 7) % max;
+
+	return block < n - i ? block : n - i;
+}
+
+static void
+dsptest_check(const char *name, double error, double limit)
+{
+	bool ok = error <= limit;
+
+	printf("%-16s max error %-10.3g limit %-10.3g %s\n", name, error,
+	    limit, ok ? "ok" : "FAIL");
+	if (!ok) {
+		++dsptest_failures;
+	}
+}
+
+static void
+dsptest_equal(const char *name, int64_t value, int64_t expected)
+{
+	if (value != expected) {
+		printf("%-16s %" PRId64 ", expected %" PRId64 " FAIL\n", name,
+		    value, expected);
+		++dsptest_failures;
+	}
+}
+
+static double
+dsptest_max_error(const double *ref, const double *value, uint32_t n)
+{
+	double error = 0.0;
+	uint32_t i;
+
+	for (i = 0; i < n; ++i) {
+		error = fmax(error, fabs(ref[i] - value[i]));
+	}
+
+	return error;
+}
+
+static void
+dsptest_reference_fir(const double *c, uint32_t taps, const double *x,
+    double *y, uint32_t n)
+{
+	uint32_t i;
+
+	for (i = 0; i < n; ++i) {
+		double acc = 0.0;
+		uint32_t k;
+
+		for (k = 0; k < taps && k <= i; ++k) {
+			acc += c[k] * x[i - k];
+		}
+		y[i] = acc;
+	}
+}
+
+/* Direct form I, the coefficients b0, b1, b2, a1, a2 of each section */
+static void
+dsptest_reference_biquad(const double *c, uint32_t sections,
+    const double *x, double *y, uint32_t n)
+{
+	double state[DSPTEST_SECTIONS][4];
+	uint32_t i;
+
+	memset(state, 0, sizeof(state));
+	for (i = 0; i < n; ++i) {
+		double v = x[i];
+		uint32_t s;
+
+		for (s = 0; s < sections; ++s) {
+			const double *b = &c[5 * s];
+			double *z = state[s];
+			double out = b[0] * v + b[1] * z[0] + b[2] * z[1] -
+			    b[3] * z[2] - b[4] * z[3];
+
+			z[1] = z[0];
+			z[0] = v;
+			z[3] = z[2];
+			z[2] = out;
+			v = out;
+		}
+		y[i] = v;
+	}
+}
+
+static void
+dsptest_fir(void)
+{
+	static float x[DSPTEST_N];
+	static float y[DSPTEST_N];
+	static float c[DSPTEST_TAPS];
+	static float state[DSP_FIR_STATE_SIZE(DSPTEST_TAPS, DSPTEST_MAX_BLOCK)];
+	static dsp_q15 x15[DSPTEST_N];
+	static dsp_q15 y15[DSPTEST_N];
+	static dsp_q15 c15[DSPTEST_TAPS];
+	static dsp_q15 state15[DSP_FIR_STATE_SIZE(DSPTEST_TAPS,
+	    DSPTEST_MAX_BLOCK)];
+	static dsp_q31 x31[DSPTEST_N];
+	static dsp_q31 y31[DSPTEST_N];
+	static dsp_q31 c31[DSPTEST_TAPS];
+	static dsp_q31 state31[DSP_FIR_STATE_SIZE(DSPTEST_TAPS,
+	    DSPTEST_MAX_BLOCK)];
+	static double rx[DSPTEST_N];
+	static double ry[DSPTEST_N];
+	static double rc[DSPTEST_TAPS];
+	static double value[DSPTEST_N];
+	struct dsp_fir_f32 fir;
+	struct dsp_fir_q15 fir15;
+	struct dsp_fir_q31 fir31;
+	uint32_t i;
+	uint32_t n;
+
+	for (i = 0; i < DSPTEST_N; ++i) {
+		x[i] = 0.5f * dsptest_random();
+	}
+	for (i = 0; i < DSPTEST_TAPS; ++i) {
+		c[i] = 0.1f * dsptest_random();
+	}
+	dsp_f32_to_q15(x, x15, DSPTEST_N);
+	dsp_f32_to_q15(c, c15, DSPTEST_TAPS);
+	dsp_f32_to_q31(x, x31, DSPTEST_N);
+	dsp_f32_to_q31(c, c31, DSPTEST_TAPS);
+
+	dsp_fir_f32_init(&fir, c, DSPTEST_TAPS, state, DSPTEST_MAX_BLOCK);
+	for (i = 0; i < DSPTEST_N; i += n) {
+		n = dsptest_block(i, DSPTEST_N, 150);
+		dsp_fir_f32(&fir, &x[i], &y[i], n);
+	}
+	for (i = 0; i < DSPTEST_N; ++i) {
+		rx[i] = x[i];
+		value[i] = y[i];
+	}
+	for (i = 0; i < DSPTEST_TAPS; ++i) {
+		rc[i] = c[i];
+	}
+	dsptest_reference_fir(rc, DSPTEST_TAPS, rx, ry, DSPTEST_N);
+	dsptest_check("fir f32", dsptest_max_error(ry, value, DSPTEST_N),
+	    1e-6);
+
+	dsp_fir_q15_init(&fir15, c15, DSPTEST_TAPS, state15,
+	    DSPTEST_MAX_BLOCK);
+	for (i = 0; i < DSPTEST_N; i += n) {
+		n = dsptest_block(i, DSPTEST_N, 100);
+		dsp_fir_q15(&fir15, &x15[i], &y15[i], n);
+	}
+	for (i = 0; i < DSPTEST_N; ++i) {
+		rx[i] = x15[i] / DSPTEST_Q15;
+		value[i] = y15[i] / DSPTEST_Q15;
+	}
+	for (i = 0; i < DSPTEST_TAPS; ++i) {
+		rc[i] = c15[i] / DSPTEST_Q15;
+	}
+	dsptest_reference_fir(rc, DSPTEST_TAPS, rx, ry, DSPTEST_N);
+	/* The sum is truncated once */
+	dsptest_check("fir q15", dsptest_max_error(ry, value, DSPTEST_N),
+	    1.0 / DSPTEST_Q15);
+
+	dsp_fir_q31_init(&fir31, c31, DSPTEST_TAPS, state31,
+	    DSPTEST_MAX_BLOCK);
+	for (i = 0; i < DSPTEST_N; i += n) {
+		n = dsptest_block(i, DSPTEST_N, 90);
+		dsp_fir_q31(&fir31, &x31[i], &y31[i], n);
+	}
+	for (i = 0; i < DSPTEST_N; ++i) {
+		rx[i] = x31[i] / DSPTEST_Q31;
+		value[i] = y31[i] / DSPTEST_Q31;
+	}
+	for (i = 0; i < DSPTEST_TAPS; ++i) {
+		rc[i] = c31[i] / DSPTEST_Q31;
+	}
+	dsptest_reference_fir(rc, DSPTEST_TAPS, rx, ry, DSPTEST_N);
+	/* Each product is truncated */
+	dsptest_check("fir q31", dsptest_max_error(ry, value, DSPTEST_N),
+	    (DSPTEST_TAPS + 1) / DSPTEST_Q31);
+}
+
+static void
+dsptest_decimate(void)
+{
+	static float x[DSPTEST_N];
+	static float y[DSPTEST_N / DSPTEST_FACTOR];
+	static float c[DSPTEST_TAPS];
+	static float state[DSP_FIR_STATE_SIZE(DSPTEST_TAPS, DSPTEST_MAX_BLOCK)];
+	static dsp_q15 x15[DSPTEST_N];
+	static dsp_q15 y15[DSPTEST_N / DSPTEST_FACTOR];
+	static dsp_q15 c15[DSPTEST_TAPS];
+	static dsp_q15 state15[DSP_FIR_STATE_SIZE(DSPTEST_TAPS,
+	    DSPTEST_MAX_BLOCK)];
+	static double rx[DSPTEST_N];
+	static double ry[DSPTEST_N];
+	static double rc[DSPTEST_TAPS];
+	static double ref[DSPTEST_N / DSPTEST_FACTOR];
+	static double value[DSPTEST_N / DSPTEST_FACTOR];
+	struct dsp_decimate_f32 dec;
+	struct dsp_decimate_q15 dec15;
+	uint32_t m = DSPTEST_N / DSPTEST_FACTOR;
+	uint32_t i;
+
+	for (i = 0; i < DSPTEST_N; ++i) {
+		x[i] = 0.5f * dsptest_random();
+	}
+	for (i = 0; i < DSPTEST_TAPS; ++i) {
+		c[i] = 0.1f * dsptest_random();
+	}
+	dsp_f32_to_q15(x, x15, DSPTEST_N);
+	dsp_f32_to_q15(c, c15, DSPTEST_TAPS);
+
+	/* Blocks of 40 and 200 samples, the latter in pieces */
+	dsp_decimate_f32_init(&dec, DSPTEST_FACTOR, c, DSPTEST_TAPS, state,
+	    DSPTEST_MAX_BLOCK);
+	for (i = 0; i < DSPTEST_N / 2; i += 40) {
+		dsp_decimate_f32(&dec, &x[i], &y[i / DSPTEST_FACTOR], 40);
+	}
+	for (; i < DSPTEST_N; i += 100) {
+		dsp_decimate_f32(&dec, &x[i], &y[i / DSPTEST_FACTOR], 100);
+	}
+	for (i = 0; i < DSPTEST_N; ++i) {
+		rx[i] = x[i];
+	}
+	for (i = 0; i < DSPTEST_TAPS; ++i) {
+		rc[i] = c[i];
+	}
+	dsptest_reference_fir(rc, DSPTEST_TAPS, rx, ry, DSPTEST_N);
+	for (i = 0; i < m; ++i) {
+		ref[i] = ry[DSPTEST_FACTOR * i];
+		value[i] = y[i];
+	}
+	dsptest_check("decimate f32", dsptest_max_error(ref, value, m), 1e-6);
+
+	dsp_decimate_q15_init(&dec15, DSPTEST_FACTOR, c15, DSPTEST_TAPS,
+	    state15, DSPTEST_MAX_BLOCK);
+	for (i = 0; i < DSPTEST_N; i += 200) {
+		dsp_decimate_q15(&dec15, &x15[i], &y15[i / DSPTEST_FACTOR],
+		    200);
+	}
+	for (i = 0; i < DSPTEST_N; ++i) {
+		rx[i] = x15[i] / DSPTEST_Q15;
+	}
+	for (i = 0; i < DSPTEST_TAPS; ++i) {
+		rc[i] = c15[i] / DSPTEST_Q15;
+	}
+	dsptest_reference_fir(rc, DSPTEST_TAPS, rx, ry, DSPTEST_N);
+	for (i = 0; i < m; ++i) {
+		ref[i] = ry[DSPTEST_FACTOR * i];
+		value[i] = y15[i] / DSPTEST_Q15;
+	}
+	dsptest_check("decimate q15", dsptest_max_error(ref, value, m),
+	    1.0 / DSPTEST_Q15);
+}
+
+static void
+dsptest_biquad(void)
+{
+	/* A low-pass and a peaking section, as b0, b1, b2, a1, a2 */
+	static const float c[5 * DSPTEST_SECTIONS] = {
+		0.0675f, 0.135f, 0.0675f, -1.143f, 0.4128f,
+		0.2f, 0.4f, 0.2f, -0.5f, 0.3f,
+	};
+	static float x[4 * DSPTEST_N];
+	static float y[4 * DSPTEST_N];
+	static float channel[DSPTEST_N];
+	static dsp_q15 x15[DSPTEST_N];
+	static dsp_q15 y15[DSPTEST_N];
+	static dsp_q31 x31[DSPTEST_N];
+	static dsp_q31 y31[DSPTEST_N];
+	static double rx[DSPTEST_N];
+	static double ry[DSPTEST_N];
+	static double value[DSPTEST_N];
+	float state[8 * DSPTEST_SECTIONS];
+	float half[5 * DSPTEST_SECTIONS];
+	dsp_q15 c15[5 * DSPTEST_SECTIONS];
+	dsp_q15 state15[4 * DSPTEST_SECTIONS];
+	dsp_q31 c31[5 * DSPTEST_SECTIONS];
+	dsp_q31 state31[4 * DSPTEST_SECTIONS];
+	double rc[5 * DSPTEST_SECTIONS];
+	struct dsp_biquad_f32 bq;
+	struct dsp_biquad_q15 bq15;
+	struct dsp_biquad_q31 bq31;
+	double error;
+	uint32_t ch;
+	uint32_t i;
+
+	for (i = 0; i < 4 * DSPTEST_N; ++i) {
+		x[i] = 0.5f * dsptest_random();
+	}
+	for (i = 0; i < 5 * DSPTEST_SECTIONS; ++i) {
+		rc[i] = c[i];
+		half[i] = c[i] / 2.0f;
+	}
+
+	dsp_biquad_f32_init(&bq, c, DSPTEST_SECTIONS, state);
+	dsp_biquad_f32(&bq, x, y, 300);
+	dsp_biquad_f32(&bq, &x[300], &y[300], DSPTEST_N - 300);
+	for (i = 0; i < DSPTEST_N; ++i) {
+		rx[i] = x[i];
+		value[i] = y[i];
+	}
+	dsptest_reference_biquad(rc, DSPTEST_SECTIONS, rx, ry, DSPTEST_N);
+	dsptest_check("biquad f32", dsptest_max_error(ry, value, DSPTEST_N),
+	    1e-6);
+
+	dsp_biquad_f32x4_init(&bq, c, DSPTEST_SECTIONS, state);
+	dsp_biquad_f32x4(&bq, x, y, DSPTEST_N / 2);
+	dsp_biquad_f32x4(&bq, &x[2 * DSPTEST_N], &y[2 * DSPTEST_N],
+	    DSPTEST_N / 2);
+	error = 0.0;
+	for (ch = 0; ch < 4; ++ch) {
+		for (i = 0; i < DSPTEST_N; ++i) {
+			rx[i] = x[4 * i + ch];
+			value[i] = y[4 * i + ch];
+		}
+		dsptest_reference_biquad(rc, DSPTEST_SECTIONS, rx, ry,
+		    DSPTEST_N);
+		error = fmax(error, dsptest_max_error(ry, value, DSPTEST_N));
+	}
+	dsptest_check("biquad f32x4", error, 1e-6);
+
+	/* The fixed point coefficients are scaled for a post shift of 1 */
+	for (i = 0; i < DSPTEST_N; ++i) {
+		channel[i] = x[i];
+	}
+	dsp_f32_to_q15(channel, x15, DSPTEST_N);
+	dsp_f32_to_q15(half, c15, 5 * DSPTEST_SECTIONS);
+	dsp_biquad_q15_init(&bq15, c15, DSPTEST_SECTIONS, 1, state15);
+	dsp_biquad_q15(&bq15, x15, y15, 500);
+	dsp_biquad_q15(&bq15, &x15[500], &y15[500], DSPTEST_N - 500);
+	for (i = 0; i < DSPTEST_N; ++i) {
+		rx[i] = x15[i] / DSPTEST_Q15;
+		value[i] = y15[i] / DSPTEST_Q15;
+	}
+	for (i = 0; i < 5 * DSPTEST_SECTIONS; ++i) {
+		rc[i] = c15[i] / (DSPTEST_Q15 / 2.0);
+	}
+	dsptest_reference_biquad(rc, DSPTEST_SECTIONS, rx, ry, DSPTEST_N);
+	/* The truncation of each section is fed back and amplified */
+	dsptest_check("biquad q15", dsptest_max_error(ry, value, DSPTEST_N),
+	    16.0 / DSPTEST_Q15);
+
+	dsp_f32_to_q31(channel, x31, DSPTEST_N);
+	dsp_f32_to_q31(half, c31, 5 * DSPTEST_SECTIONS);
+	dsp_biquad_q31_init(&bq31, c31, DSPTEST_SECTIONS, 1, state31);
+	dsp_biquad_q31(&bq31, x31, y31, 500);
+	dsp_biquad_q31(&bq31, &x31[500], &y31[500], DSPTEST_N - 500);
+	for (i = 0; i < DSPTEST_N; ++i) {
+		rx[i] = x31[i] / DSPTEST_Q31;
+		value[i] = y31[i] / DSPTEST_Q31;
+	}
+	for (i = 0; i < 5 * DSPTEST_SECTIONS; ++i) {
+		rc[i] = c31[i] / (DSPTEST_Q31 / 2.0);
+	}
+	dsptest_reference_biquad(rc, DSPTEST_SECTIONS, rx, ry, DSPTEST_N);
+	dsptest_check("biquad q31", dsptest_max_error(ry, value, DSPTEST_N),
+	    16.0 / DSPTEST_Q31);
+}
+
+/* Error relative to the largest bin, all bins up to 4096 points */
+static double
+dsptest_rfft_error(uint32_t n)
+{
+	struct dsp_rfft_f32 fft;
+	float *in = malloc(n * sizeof(*in));
+	float *out = malloc(n * sizeof(*out));
+	uint32_t step = n > 4096 ? n / 128 : 1;
+	double error = 0.0;
+	double max = 0.0;
+	uint32_t k;
+	uint32_t j;
+
+	if (in == NULL || out == NULL || dsp_rfft_f32_init(&fft, n) != 0) {
+		free(in);
+		free(out);
+		return INFINITY;
+	}
+
+	for (j = 0; j < n; ++j) {
+		in[j] = dsptest_random();
+	}
+	/* In place */
+	memcpy(out, in, n * sizeof(*out));
+	dsp_rfft_f32(&fft, out, out);
+
+	for (k = 0; k <= n / 2; k += step) {
+		double re = 0.0;
+		double im = 0.0;
+		double value_re;
+		double value_im;
+
+		for (j = 0; j < n; ++j) {
+			double a = -2.0 * M_PI *
+			    (double)(((uint64_t)j * k) % n) / n;
+
+			re += in[j] * cos(a);
+			im += in[j] * sin(a);
+		}
+		if (k == 0) {
+			value_re = out[0];
+			value_im = 0.0;
+		} else if (k == n / 2) {
+			value_re = out[1];
+			value_im = 0.0;
+		} else {
+			value_re = out[2 * k];
+			value_im = out[2 * k + 1];
+		}
+		error = fmax(error, hypot(value_re - re, value_im - im));
+		max = fmax(max, hypot(re, im));
+	}
+
+	dsp_rfft_f32_destroy(&fft);
+	free(in);
+	free(out);
+
+	return error / max;
+}
+
+static void
+dsptest_rfft(void)
+{
+	struct dsp_rfft_f32 fft;
+	double error = 0.0;
+	uint32_t n;
+
+	for (n = 16; n <= 65536; n *= 2) {
+		error = fmax(error, dsptest_rfft_error(n));
+	}
+	dsptest_check("rfft vs DFT", error, 1e-6);
+
+	dsptest_equal("rfft init 8", dsp_rfft_f32_init(&fft, 8), -1);
+	dsptest_equal("rfft init 48", dsp_rfft_f32_init(&fft, 48), -1);
+}
+
+static void
+dsptest_conversions(void)
+{
+	static const float in[] = {
+		1.0f, -1.0f, 2.0f, -2.0f, 0.5f, -0.5f, 1e-6f, 0.99999f,
+		-0.99999f, 3e9f, NAN,
+	};
+	static const int64_t q15[] = {
+		32767, -32768, 32767, -32768, 16384, -16384, 0, 32767,
+		-32767, 32767, 0,
+	};
+	static const int64_t q31[] = {
+		2147483647, -2147483648LL, 2147483647, -2147483648LL,
+		1073741824, -1073741824, 2147, 2147462144,
+		-2147462144, 2147483647, 0,
+	};
+	enum { COUNT = sizeof(in) / sizeof(in[0]) };
+	dsp_q15 out15[COUNT];
+	dsp_q31 out31[COUNT];
+	dsp_q15 a[4] = { 16384, -32768, -32768, 32767 };
+	dsp_q15 b[4] = { 16384, -32768, 16384, -1 };
+	float f[4];
+	unsigned failures = dsptest_failures;
+	uint32_t i;
+
+	dsp_f32_to_q15(in, out15, COUNT);
+	dsp_f32_to_q31(in, out31, COUNT);
+	for (i = 0; i < COUNT; ++i) {
+		dsptest_equal("f32 to q15", out15[i], q15[i]);
+		dsptest_equal("f32 to q31", out31[i], q31[i]);
+	}
+
+	dsp_q15_to_f32(out15, f, 4);
+	for (i = 0; i < 4; ++i) {
+		dsptest_equal("q15 to f32", (int64_t)(f[i] * DSPTEST_Q15),
+		    out15[i]);
+	}
+	dsp_q31_to_f32(out31, f, 4);
+	dsptest_equal("q31 to f32", f[0] == 1.0f, 1);
+	dsptest_equal("q31 to f32", f[1] == -1.0f, 1);
+
+	dsp_mult_q15(a, b, a, 4);
+	dsptest_equal("mult q15", a[0], 8192);
+	dsptest_equal("mult q15 sat", a[1], 32767);
+	dsptest_equal("mult q15", a[2], -16384);
+	/* Rounded toward minus infinity */
+	dsptest_equal("mult q15", a[3], -1);
+
+	printf("%-16s %s\n", "q15/q31",
+	    dsptest_failures == failures ? "ok" : "FAIL");
+}
+
+static void
+dsptest_window(void)
+{
+	float w[64];
+	double error = 0.0;
+	uint32_t k;
+
+	dsp_window_f32(DSP_WINDOW_HANN, w, 64);
+	for (k = 0; k < 64; ++k) {
+		double ref = 0.5 - 0.5 * cos(2.0 * M_PI * k / 64.0);
+
+		error = fmax(error, fabs(w[k] - ref));
+	}
+	dsptest_check("window hann", error, 1e-6);
+}
+
+int
+main(void)
+{
+	dsptest_fir();
+	dsptest_decimate();
+	dsptest_biquad();
+	dsptest_rfft();
+	dsptest_conversions();
+	dsptest_window();
+
+	if (dsptest_failures != 0) {
+		printf("%u checks failed\n", dsptest_failures);
+		return 1;
+	}
+	printf("All checks passed\n");
+
+	return 0;
+}
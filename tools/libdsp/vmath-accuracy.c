@@ -0,0 +1,331 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Accuracy of the math functions of libdsp (dsp_exp_f32() ...) against the
+ * double precision functions of the host libm (glibc). This is how the error
+ * bounds in dsp/dsp.h are measured:
+ *
+ *   vmath-accuracy -s 1 -n 400000000
+ *
+ * checks every float of the ranges and 4 * 10^8 random pairs for atan2,
+ * which takes a while. The default checks every 64th float and 10^7 pairs.
+ * The program fails if an error exceeds the documented bound.
+ *
+ * Built with a compiler for ARM with NEON (for example -mfpu=neon-vfpv4), the
+ * NEON versions are measured, otherwise the scalar ones.
+ */
+
+#include <float.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <dsp/dsp.h>
+
+#define VMATH_BLOCK 4096
+
+/* Bit patterns of the floats */
+#define VMATH_PI		0x40490fdbu
+#define VMATH_SIN_MAX		0x46000000u
+#define VMATH_EXP_HI		0x42b17217u
+#define VMATH_EXP_LO		0xc2aeac4fu
+#define VMATH_MINUS_ZERO	0x80000000u
+#define VMATH_FLT_MIN		0x00800000u
+#define VMATH_FLT_MAX		0x7f7fffffu
+
+enum vmath_error {
+	VMATH_ULP,
+	VMATH_ABS,
+};
+
+struct vmath_range {
+	const char *name;
+	void (*fn)(const float *in, float *out, uint32_t n);
+	double (*ref)(double x);
+	/* Bit patterns, lo to hi in steps of one float away from zero */
+	uint32_t lo;
+	uint32_t hi;
+	enum vmath_error error;
+	double bound;
+};
+
+/* The bounds of dsp/dsp.h, some differ for the scalar versions */
+#ifdef __ARM_NEON
+#define VMATH_BOUND(neon, scalar) (neon)
+#else /* __ARM_NEON */
+#define VMATH_BOUND(neon, scalar) (scalar)
+#endif /* __ARM_NEON */
+
+static const struct vmath_range vmath_ranges[] = {
+	{ "exp", dsp_exp_f32, exp, 0, VMATH_EXP_HI, VMATH_ULP, 1.0 },
+	{ "exp", dsp_exp_f32, exp, VMATH_MINUS_ZERO, VMATH_EXP_LO,
+	    VMATH_ULP, 1.0 },
+	{ "log", dsp_log_f32, log, VMATH_FLT_MIN, VMATH_FLT_MAX,
+	    VMATH_ULP, VMATH_BOUND(0.83, 0.87) },
+	{ "sin", dsp_sin_f32, sin, 0, VMATH_PI, VMATH_ULP, 1.4 },
+	{ "sin", dsp_sin_f32, sin, VMATH_MINUS_ZERO, VMATH_MINUS_ZERO |
+	    VMATH_PI, VMATH_ULP, 1.4 },
+	{ "cos", dsp_cos_f32, cos, 0, VMATH_PI, VMATH_ULP, 1.5 },
+	{ "cos", dsp_cos_f32, cos, VMATH_MINUS_ZERO, VMATH_MINUS_ZERO |
+	    VMATH_PI, VMATH_ULP, 1.5 },
+	{ "sin", dsp_sin_f32, sin, 0, VMATH_SIN_MAX, VMATH_ABS, 7.9e-8 },
+	{ "sin", dsp_sin_f32, sin, VMATH_MINUS_ZERO, VMATH_MINUS_ZERO |
+	    VMATH_SIN_MAX, VMATH_ABS, 7.9e-8 },
+	{ "cos", dsp_cos_f32, cos, 0, VMATH_SIN_MAX, VMATH_ABS, 7.9e-8 },
+	{ "cos", dsp_cos_f32, cos, VMATH_MINUS_ZERO, VMATH_MINUS_ZERO |
+	    VMATH_SIN_MAX, VMATH_ABS, 7.9e-8 },
+};
+
+#define VMATH_ATAN2_BOUND VMATH_BOUND(5.5, 3.3)
+
+static unsigned vmath_failures;
+
+static float
+vmath_float(uint32_t bits)
+{
+	float value;
+
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+/*
+ * Error in units of the last place of the exact result. Results below
+ * FLT_MIN are flushed to zero by NEON, so they count as exact.
+ */
+static bool
+vmath_ulp_error(double value, double ref, double *error)
+{
+	float f = (float)ref;
+
+	if (fabsf(f) < FLT_MIN) {
+		if (fabs(value) < FLT_MIN) {
+			return false;
+		}
+		*error = fabs(value - ref) / ldexp(1.0, -149);
+		return true;
+	}
+
+	*error = fabs(value - ref) / ldexp(1.0, ilogbf(f) - 23);
+	return true;
+}
+
+static void
+vmath_report(const char *name, const char *range, uint64_t count,
+    double error, const char *unit, float at, double bound)
+{
+	bool ok = error <= bound;
+
+	printf("%-6s %-28s %11" PRIu64 " values  max %.4g %s at %.9g "
+	    "(bound %.3g) %s\n", name, range, count, error, unit, at, bound,
+	    ok ? "ok" : "FAIL");
+	if (!ok) {
+		++vmath_failures;
+	}
+}
+
+static void
+vmath_check_range(const struct vmath_range *r, uint32_t stride)
+{
+	static float in[VMATH_BLOCK];
+	static float out[VMATH_BLOCK];
+	uint64_t bits = r->lo;
+	uint64_t count = 0;
+	double max_error = 0.0;
+	float at = 0.0f;
+	char range[32];
+
+	/* Both ends of the range are always checked */
+	while (bits <= r->hi) {
+		uint32_t n;
+		uint32_t i;
+
+		for (n = 0; n < VMATH_BLOCK && bits <= r->hi; ++n) {
+			in[n] = vmath_float((uint32_t)bits);
+			if (bits < r->hi && bits + stride > r->hi) {
+				bits = r->hi;
+			} else {
+				bits += stride;
+			}
+		}
+		(*r->fn)(in, out, n);
+
+		for (i = 0; i < n; ++i) {
+			double ref = (*r->ref)((double)in[i]);
+			double error;
+
+			if (r->error == VMATH_ABS) {
+				error = fabs(out[i] - ref);
+			} else if (!vmath_ulp_error(out[i], ref, &error)) {
+				continue;
+			}
+			if (error > max_error) {
+				max_error = error;
+				at = in[i];
+			}
+			++count;
+		}
+	}
+
+	snprintf(range, sizeof(range), "[%.6g, %.6g]", vmath_float(r->lo),
+	    vmath_float(r->hi));
+	vmath_report(r->name, range, count, max_error,
+	    r->error == VMATH_ULP ? "ulp" : "abs", at, r->bound);
+}
+
+static uint32_t vmath_seed = 12345;
+
+static uint32_t
+vmath_random(void)
+{
+	vmath_seed = vmath_seed * 1664525u + 1013904223u;
+	return vmath_seed;
+}
+
+/* Mantissa and exponent in 2^-20 ... 2^20, both signs */
+static float
+vmath_random_float(void)
+{
+	uint32_t r = vmath_random();
+	float value = ldexpf((float)(r >> 8) / 16777216.0f,
+	    (int)(vmath_random() % 40) - 20);
+
+	return (r & 1) != 0 ? -value : value;
+}
+
+static void
+vmath_check_atan2(uint64_t pairs)
+{
+	static float y[VMATH_BLOCK];
+	static float x[VMATH_BLOCK];
+	static float out[VMATH_BLOCK];
+	uint64_t done = 0;
+	uint64_t count = 0;
+	double max_error = 0.0;
+	float at_y = 0.0f;
+	float at_x = 0.0f;
+
+	while (done < pairs) {
+		uint32_t n = pairs - done < VMATH_BLOCK ?
+		    (uint32_t)(pairs - done) : VMATH_BLOCK;
+		uint32_t i;
+
+		for (i = 0; i < n; ++i) {
+			y[i] = vmath_random_float();
+			x[i] = vmath_random_float();
+		}
+		dsp_atan2_f32(y, x, out, n);
+
+		for (i = 0; i < n; ++i) {
+			double error;
+
+			if (!vmath_ulp_error(out[i],
+			    atan2((double)y[i], (double)x[i]), &error)) {
+				continue;
+			}
+			if (error > max_error) {
+				max_error = error;
+				at_y = y[i];
+				at_x = x[i];
+			}
+			++count;
+		}
+		done += n;
+	}
+
+	printf("atan2  %-28s %11" PRIu64 " values  max %.4g "
+	    "ulp at (%.9g, %.9g) (bound %.3g) %s\n", "random pairs", count,
+	    max_error, at_y, at_x, VMATH_ATAN2_BOUND,
+	    max_error <= VMATH_ATAN2_BOUND ? "ok" : "FAIL");
+	if (max_error > VMATH_ATAN2_BOUND) {
+		++vmath_failures;
+	}
+}
+
+static void
+vmath_usage(void)
+{
+	fprintf(stderr, "Use with: vmath-accuracy [-s stride] [-n pairs]\n"
+	    "  -s: check every stride-th float of the ranges (default: 64)\n"
+	    "  -n: random pairs for atan2 (default: 10000000)\n");
+	exit(2);
+}
+
+int
+main(int argc, char **argv)
+{
+	unsigned long stride = 64;
+	unsigned long long pairs = 10000000;
+	size_t i;
+	char *end;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "s:n:")) != -1) {
+		switch (opt) {
+		case 's':
+			stride = strtoul(optarg, &end, 0);
+			if (end == optarg || *end != '\0' || stride == 0 ||
+			    stride > UINT32_MAX) {
+				vmath_usage();
+			}
+			break;
+		case 'n':
+			pairs = strtoull(optarg, &end, 0);
+			if (end == optarg || *end != '\0') {
+				vmath_usage();
+			}
+			break;
+		default:
+			vmath_usage();
+		}
+	}
+	if (optind != argc) {
+		vmath_usage();
+	}
+
+#ifdef __ARM_NEON
+	printf("NEON versions, every %lu. float\n", stride);
+#else /* __ARM_NEON */
+	printf("Scalar versions, every %lu. float\n", stride);
+#endif /* __ARM_NEON */
+
+	for (i = 0; i < sizeof(vmath_ranges) / sizeof(vmath_ranges[0]); ++i) {
+		vmath_check_range(&vmath_ranges[i], (uint32_t)stride);
+	}
+	vmath_check_atan2(pairs);
+
+	if (vmath_failures != 0) {
+		printf("%u bounds exceeded\n", vmath_failures);
+		return 1;
+	}
+
+	return 0;
+}
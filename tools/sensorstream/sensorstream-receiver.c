@@ -0,0 +1,350 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Host side receiver for the sensorstream service of the demo application.
+ * Reports throughput, lost and reordered datagrams, samples dropped on the
+ * device and the latency from taking a sample to receiving it.
+ *
+ * The absolute latency is only meaningful if the clocks of the board and the
+ * host are synchronized. The latency above the minimum (the jitter of the
+ * path) is independent of a constant offset between the clocks.
+ */
+
+#define _GNU_SOURCE
+
+#include <arpa/inet.h>
+#include <endian.h>
+#include <errno.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <netinet/in.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sensorstream-proto.h"
+
+/* Latency histogram with 100 us buckets up to 1 s */
+#define HIST_BUCKET_NS	100000
+#define HIST_BUCKETS	10000
+
+struct stats {
+	uint64_t datagrams;
+	uint64_t samples;
+	uint64_t bytes;
+	uint64_t lost;
+	uint64_t reordered;
+	uint64_t latency_count;
+	int64_t latency_min;
+	int64_t latency_max;
+	double latency_sum;
+	uint64_t hist[HIST_BUCKETS + 1];
+};
+
+static volatile sig_atomic_t stop;
+
+static void
+on_signal(int sig)
+{
+	(void)sig;
+	stop = 1;
+}
+
+static uint64_t
+now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+static void
+stats_reset(struct stats *s)
+{
+	memset(s, 0, sizeof(*s));
+	s->latency_min = INT64_MAX;
+	s->latency_max = INT64_MIN;
+}
+
+static void
+stats_add_latency(struct stats *s, int64_t latency)
+{
+	int64_t bucket = latency / HIST_BUCKET_NS;
+
+	if (bucket < 0) {
+		bucket = 0;
+	} else if (bucket > HIST_BUCKETS) {
+		bucket = HIST_BUCKETS;
+	}
+	++s->hist[bucket];
+	++s->latency_count;
+	s->latency_sum += (double)latency;
+	if (latency < s->latency_min) {
+		s->latency_min = latency;
+	}
+	if (latency > s->latency_max) {
+		s->latency_max = latency;
+	}
+}
+
+static double
+stats_percentile_ms(const struct stats *s, double p)
+{
+	uint64_t wanted = (uint64_t)((double)s->latency_count * p);
+	uint64_t seen = 0;
+	size_t i;
+
+	for (i = 0; i <= HIST_BUCKETS; ++i) {
+		seen += s->hist[i];
+		if (seen > wanted) {
+			break;
+		}
+	}
+
+	return (double)(i + 1) * HIST_BUCKET_NS / 1e6;
+}
+
+static void
+stats_print(const char *label, const struct stats *s, double seconds,
+    uint32_t device_dropped)
+{
+	uint64_t expected = s->datagrams + s->lost;
+
+	printf("%s %6.2f s: %8.0f samples/s %7.3f Mbit/s, "
+	    "datagrams %" PRIu64 " lost %" PRIu64 " (%.3f%%) reordered %"
+	    PRIu64 ", device drops %" PRIu32 "\n",
+	    label, seconds, seconds > 0 ? (double)s->samples / seconds : 0.,
+	    seconds > 0 ? (double)s->bytes * 8. / seconds / 1e6 : 0.,
+	    s->datagrams, s->lost,
+	    expected > 0 ? (double)s->lost * 100. / (double)expected : 0.,
+	    s->reordered, device_dropped);
+	if (s->latency_count > 0) {
+		double avg = s->latency_sum / (double)s->latency_count;
+
+		printf("    latency [ms]: min %.3f avg %.3f max %.3f "
+		    "p99 <%.1f, above min: avg %.3f max %.3f\n",
+		    (double)s->latency_min / 1e6, avg / 1e6,
+		    (double)s->latency_max / 1e6,
+		    stats_percentile_ms(s, 0.99),
+		    (avg - (double)s->latency_min) / 1e6,
+		    (double)(s->latency_max - s->latency_min) / 1e6);
+	}
+}
+
+static void
+usage(const char *name)
+{
+	fprintf(stderr,
+	    "Usage: %s [-p port] [-i interval] [-t seconds] [-c csv]\n"
+	    "  -p: UDP port to listen on (default: %d)\n"
+	    "  -i: Report interval in seconds, 0 disables (default: 1)\n"
+	    "  -t: Stop after the given time (default: until Ctrl-C)\n"
+	    "  -c: Write all samples as time_ns,channel,value to a file\n",
+	    name, SENSORSTREAM_DEFAULT_PORT);
+}
+
+int
+main(int argc, char **argv)
+{
+	static uint8_t buf[65536];
+	static struct stats total;
+	static struct stats interval;
+	struct sockaddr_in addr;
+	unsigned port = SENSORSTREAM_DEFAULT_PORT;
+	double report = 1.0;
+	double duration = 0;
+	FILE *csv = NULL;
+	uint64_t start = 0;
+	uint64_t interval_start = 0;
+	uint32_t next_seq = 0;
+	uint32_t device_dropped = 0;
+	bool first = true;
+	int sock;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "p:i:t:c:h")) != -1) {
+		switch (opt) {
+		case 'p':
+			port = (unsigned)strtoul(optarg, NULL, 0);
+			break;
+		case 'i':
+			report = strtod(optarg, NULL);
+			break;
+		case 't':
+			duration = strtod(optarg, NULL);
+			break;
+		case 'c':
+			csv = fopen(optarg, "w");
+			if (csv == NULL) {
+				perror(optarg);
+				return 1;
+			}
+			break;
+		default:
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	sock = socket(AF_INET, SOCK_DGRAM, 0);
+	if (sock < 0) {
+		perror("socket");
+		return 1;
+	}
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons((uint16_t)port);
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+		perror("bind");
+		return 1;
+	}
+
+	/* Wake up regularly for the interval reports */
+	{
+		struct timeval tv = { .tv_sec = 0, .tv_usec = 100000 };
+
+		setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+	}
+
+	signal(SIGINT, on_signal);
+	signal(SIGTERM, on_signal);
+	stats_reset(&total);
+	stats_reset(&interval);
+	printf("Listening on UDP port %u\n", port);
+
+	while (!stop) {
+		const struct sensorstream_header *header =
+		    (const struct sensorstream_header *)buf;
+		const struct sensorstream_sample *samples =
+		    (const struct sensorstream_sample *)(header + 1);
+		ssize_t n = recv(sock, buf, sizeof(buf), 0);
+		uint64_t now = now_ns();
+		uint16_t count;
+		uint32_t seq;
+		uint16_t i;
+
+		if (n >= (ssize_t)sizeof(*header) &&
+		    ntohl(header->magic) == SENSORSTREAM_MAGIC) {
+			count = ntohs(header->count);
+			seq = ntohl(header->seq);
+			if ((size_t)n < sizeof(*header) +
+			    count * sizeof(*samples)) {
+				continue;
+			}
+
+			if (first || seq == 0) {
+				/* First datagram or the stream restarted */
+				if (!first) {
+					printf("Stream restarted\n");
+				}
+				first = false;
+				start = now;
+				interval_start = now;
+				stats_reset(&total);
+				stats_reset(&interval);
+				next_seq = seq;
+			}
+
+			if (seq == next_seq) {
+				++next_seq;
+			} else if ((int32_t)(seq - next_seq) > 0) {
+				total.lost += seq - next_seq;
+				interval.lost += seq - next_seq;
+				next_seq = seq + 1;
+			} else {
+				++total.reordered;
+				++interval.reordered;
+				if (total.lost > 0) {
+					--total.lost;
+				}
+				if (interval.lost > 0) {
+					--interval.lost;
+				}
+			}
+
+			device_dropped = ntohl(header->dropped);
+			++total.datagrams;
+			++interval.datagrams;
+			total.samples += count;
+			interval.samples += count;
+			total.bytes += (uint64_t)n;
+			interval.bytes += (uint64_t)n;
+
+			for (i = 0; i < count; ++i) {
+				uint64_t t = be64toh(samples[i].time_ns);
+				int64_t latency = (int64_t)(now - t);
+
+				stats_add_latency(&total, latency);
+				stats_add_latency(&interval, latency);
+				if (csv != NULL) {
+					fprintf(csv, "%" PRIu64 ",%" PRIu32
+					    ",%" PRId32 "\n", t,
+					    ntohl(samples[i].channel),
+					    (int32_t)ntohl(
+					    (uint32_t)samples[i].value));
+				}
+			}
+		} else if (n < 0 && errno != EAGAIN && errno != EINTR) {
+			perror("recv");
+			break;
+		}
+
+		if (first) {
+			continue;
+		}
+		if (report > 0 && (double)(now - interval_start) / 1e9 >= report) {
+			stats_print("[interval]", &interval,
+			    (double)(now - interval_start) / 1e9,
+			    device_dropped);
+			stats_reset(&interval);
+			interval_start = now;
+		}
+		if (duration > 0 && (double)(now - start) / 1e9 >= duration) {
+			break;
+		}
+	}
+
+	if (!first) {
+		stats_print("[total]   ", &total,
+		    (double)(now_ns() - start) / 1e9, device_dropped);
+	}
+	if (csv != NULL) {
+		fclose(csv);
+	}
+	close(sock);
+
+	return 0;
+}
@@ -0,0 +1,304 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 GRiSP contributors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Host tool for the compressed time series files written by the demo
+ * application (see demo/tslog-codec.h for the format).
+ */
+
+#define _FILE_OFFSET_BITS 64
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "tslog-codec.h"
+
+struct tslog_file {
+	int fd;
+	uint32_t chunk_size;
+	uint64_t chunk_count;
+	uint8_t *chunk;
+};
+
+static int
+file_open(struct tslog_file *f, const char *path)
+{
+	uint8_t raw[TSLOG_HEADER_SIZE];
+	struct tslog_chunk_header header;
+	struct stat st;
+
+	memset(f, 0, sizeof(*f));
+	f->fd = open(path, O_RDONLY);
+	if (f->fd < 0) {
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		return -1;
+	}
+	if (fstat(f->fd, &st) != 0) {
+		close(f->fd);
+		return -1;
+	}
+	if (st.st_size == 0) {
+		/* Empty file, nothing to do */
+		return 0;
+	}
+	if (pread(f->fd, raw, sizeof(raw), 0) != sizeof(raw) ||
+	    !tslog_header_unpack(&header, raw)) {
+		fprintf(stderr, "%s: Not a time series file\n", path);
+		close(f->fd);
+		return -1;
+	}
+
+	f->chunk_size = header.chunk_size;
+	f->chunk_count = (uint64_t)st.st_size / header.chunk_size;
+	if ((uint64_t)st.st_size % header.chunk_size != 0) {
+		fprintf(stderr, "%s: Ignoring incomplete last chunk\n", path);
+	}
+	f->chunk = malloc(f->chunk_size);
+	if (f->chunk == NULL) {
+		close(f->fd);
+		return -1;
+	}
+
+	return 0;
+}
+
+static void
+file_close(struct tslog_file *f)
+{
+	free(f->chunk);
+	close(f->fd);
+}
+
+static bool
+file_read_header(struct tslog_file *f, uint64_t index,
+    struct tslog_chunk_header *header)
+{
+	uint8_t raw[TSLOG_HEADER_SIZE];
+
+	return pread(f->fd, raw, sizeof(raw),
+	    (off_t)(index * f->chunk_size)) == sizeof(raw) &&
+	    tslog_header_unpack(header, raw) &&
+	    header->chunk_size == f->chunk_size;
+}
+
+static bool
+file_read_chunk(struct tslog_file *f, uint64_t index,
+    struct tslog_chunk_header *header)
+{
+	return pread(f->fd, f->chunk, f->chunk_size,
+	    (off_t)(index * f->chunk_size)) == (ssize_t)f->chunk_size &&
+	    tslog_header_unpack(header, f->chunk) &&
+	    header->chunk_size == f->chunk_size &&
+	    tslog_chunk_check(header, f->chunk);
+}
+
+/*
+ * Find the first chunk that might contain samples at or after start. Only
+ * the headers of O(log n) chunks are read.
+ */
+static uint64_t
+file_find(struct tslog_file *f, int64_t start)
+{
+	uint64_t lo = 0;
+	uint64_t hi = f->chunk_count;
+
+	while (lo < hi) {
+		uint64_t mid = lo + (hi - lo) / 2;
+		struct tslog_chunk_header header;
+
+		if (!file_read_header(f, mid, &header)) {
+			/* Damaged header, fall back to a linear scan from here */
+			return lo;
+		}
+		if (header.last_time < start) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+static int
+cmd_info(const char *path)
+{
+	struct tslog_file f;
+	uint64_t samples = 0;
+	uint64_t payload = 0;
+	unsigned errors = 0;
+	uint64_t i;
+
+	if (file_open(&f, path) != 0) {
+		return 1;
+	}
+
+	printf("chunk size: %" PRIu32 ", chunks: %" PRIu64 "\n",
+	    f.chunk_size, f.chunk_count);
+	printf("%8s %8s %6s %8s %8s %20s %20s %s\n", "chunk", "series", "type",
+	    "samples", "payload", "first_time", "last_time", "crc");
+	for (i = 0; i < f.chunk_count; ++i) {
+		struct tslog_chunk_header header;
+		bool ok = file_read_chunk(&f, i, &header);
+
+		if (!ok && !file_read_header(&f, i, &header)) {
+			printf("%8" PRIu64 " invalid header\n", i);
+			++errors;
+			continue;
+		}
+		if (!ok) {
+			++errors;
+		}
+		samples += header.count;
+		payload += header.payload_size;
+		printf("%8" PRIu64 " %8" PRIu32 " %6s %8" PRIu32 " %8" PRIu32
+		    " %20" PRId64 " %20" PRId64 " %s\n", i, header.series,
+		    header.type == TSLOG_TYPE_INT ? "int" : "double",
+		    header.count, header.payload_size, header.first_time,
+		    header.last_time, ok ? "ok" : "BAD");
+	}
+
+	if (samples > 0) {
+		printf("%" PRIu64 " samples, %.2f bytes/sample in the file, "
+		    "%.2f bytes/sample payload, %u bad chunks\n", samples,
+		    (double)(f.chunk_count * f.chunk_size) / (double)samples,
+		    (double)payload / (double)samples, errors);
+	}
+	file_close(&f);
+
+	return errors == 0 ? 0 : 2;
+}
+
+static int
+cmd_dump(const char *path, bool has_start, int64_t start, bool has_end,
+    int64_t end)
+{
+	struct tslog_file f;
+	unsigned errors = 0;
+	uint64_t i;
+
+	if (file_open(&f, path) != 0) {
+		return 1;
+	}
+
+	i = has_start ? file_find(&f, start) : 0;
+	for (; i < f.chunk_count; ++i) {
+		struct tslog_chunk_header header;
+		struct tslog_decoder dec;
+		int64_t time;
+		uint64_t value;
+
+		if (!file_read_chunk(&f, i, &header)) {
+			fprintf(stderr, "Skipping bad chunk %" PRIu64 "\n", i);
+			++errors;
+			continue;
+		}
+		if (has_end && header.first_time > end) {
+			break;
+		}
+		if (has_start && header.last_time < start) {
+			continue;
+		}
+
+		tslog_decoder_init(&dec, &header, f.chunk + TSLOG_HEADER_SIZE);
+		while (tslog_decoder_next(&dec, &time, &value)) {
+			if ((has_start && time < start) ||
+			    (has_end && time > end)) {
+				continue;
+			}
+			if (header.type == TSLOG_TYPE_INT) {
+				printf("%" PRId64 ",%" PRIu32 ",%" PRId64 "\n",
+				    time, header.series, (int64_t)value);
+			} else {
+				printf("%" PRId64 ",%" PRIu32 ",%.17g\n", time,
+				    header.series, tslog_bits_to_double(value));
+			}
+		}
+		if (dec.remaining != 0) {
+			fprintf(stderr, "Chunk %" PRIu64 " is truncated\n", i);
+			++errors;
+		}
+	}
+	file_close(&f);
+
+	return errors == 0 ? 0 : 2;
+}
+
+static void
+usage(const char *name)
+{
+	fprintf(stderr,
+	    "Usage: %s info <file>\n"
+	    "       %s dump [-s start] [-e end] <file>\n"
+	    "  info: Print the chunk index, verify the CRCs and show the\n"
+	    "        compression\n"
+	    "  dump: Print the samples as time,series,value. With -s and -e\n"
+	    "        only the samples in the time range (inclusive), the\n"
+	    "        start chunk is found with a binary search.\n",
+	    name, name);
+}
+
+int
+main(int argc, char **argv)
+{
+	bool has_start = false;
+	bool has_end = false;
+	int64_t start = 0;
+	int64_t end = 0;
+	int i;
+
+	if (argc == 3 && strcmp(argv[1], "info") == 0) {
+		return cmd_info(argv[2]);
+	}
+
+	if (argc < 3 || strcmp(argv[1], "dump") != 0) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	for (i = 2; i < argc - 1; ++i) {
+		if (strcmp(argv[i], "-s") == 0 && i + 1 < argc - 1) {
+			has_start = true;
+			start = strtoll(argv[++i], NULL, 0);
+		} else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc - 1) {
+			has_end = true;
+			end = strtoll(argv[++i], NULL, 0);
+		} else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	return cmd_dump(argv[argc - 1], has_start, start, has_end, end);
+}